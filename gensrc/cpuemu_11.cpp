@@ -34,9 +34,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0000_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -50,14 +48,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0010_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -68,15 +64,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0018_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -88,15 +82,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0020_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 22 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -107,14 +99,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0028_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -126,14 +116,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0030_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (6);
 return 26 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -143,14 +131,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0038_11)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -160,14 +146,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0039_11)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = get_long_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (8);
 return 28 * CYCLE_UNIT / 2;
 } /* 24 (5/1) */
@@ -194,9 +178,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0040_11)(uae_u32 opcode)
 {{	uae_s16 src = get_word_prefetch (4);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -215,14 +197,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0050_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2187;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel2187: ;
 return 16 * CYCLE_UNIT / 2;
@@ -239,15 +219,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0058_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2188;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel2188: ;
 return 16 * CYCLE_UNIT / 2;
@@ -265,15 +243,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0060_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2189;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel2189: ;
 return 18 * CYCLE_UNIT / 2;
@@ -290,14 +266,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0068_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2190;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2190: ;
 return 20 * CYCLE_UNIT / 2;
@@ -315,14 +289,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0070_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2191;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2191: ;
 return 22 * CYCLE_UNIT / 2;
@@ -338,14 +310,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0078_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2192;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2192: ;
 return 20 * CYCLE_UNIT / 2;
@@ -361,14 +331,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0079_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2193;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (8);
 endlabel2193: ;
 return 24 * CYCLE_UNIT / 2;
@@ -397,9 +365,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0080_11)(uae_u32 opcode)
 {{	uae_s32 src = get_long_prefetch (4);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 	m68k_dreg (regs, dstreg) = (src);
@@ -418,14 +384,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0090_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2196;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2196: ;
 return 28 * CYCLE_UNIT / 2;
@@ -442,15 +406,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0098_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2197;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2197: ;
 return 28 * CYCLE_UNIT / 2;
@@ -468,15 +430,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_00a0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2198;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2198: ;
 return 30 * CYCLE_UNIT / 2;
@@ -493,14 +453,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_00a8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2199;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (8);
 endlabel2199: ;
 return 32 * CYCLE_UNIT / 2;
@@ -518,14 +476,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_00b0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2200;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (8);
 endlabel2200: ;
 return 34 * CYCLE_UNIT / 2;
@@ -541,14 +497,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_00b8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2201;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (8);
 endlabel2201: ;
 return 32 * CYCLE_UNIT / 2;
@@ -564,14 +518,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_00b9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2202;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (12);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (10);
 endlabel2202: ;
 return 36 * CYCLE_UNIT / 2;
@@ -598,7 +550,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0108_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr memp = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_u16 val = (get_byte (memp) << 8) + get_byte (memp + 2);
+{	uae_u16 val = (get_byte_direct (memp) << 8) + get_byte_direct (memp + 2);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((val) & 0xffff);
@@ -615,7 +567,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0110_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (4);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
@@ -632,7 +584,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0118_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	get_word_prefetch (4);
 	src &= 7;
@@ -651,7 +603,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0120_11)(uae_u32 opcode)
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	get_word_prefetch (4);
 	src &= 7;
@@ -669,7 +621,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0128_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
@@ -687,7 +639,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0130_11)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
@@ -703,7 +655,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0138_11)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
@@ -719,7 +671,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0139_11)(uae_u32 opcode)
 {	uaecptr dsta = get_long_prefetch (4);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
@@ -737,7 +689,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_013a_11)(uae_u32 opcode)
 	dsta += (uae_s32)(uae_s16)get_word_prefetch (4);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
@@ -757,7 +709,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_013b_11)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (tmppc, get_word_prefetch (4));
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
@@ -802,8 +754,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0148_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr memp = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_u32 val = (get_byte (memp) << 24) + (get_byte (memp + 2) << 16)
-              + (get_byte (memp + 4) << 8) + get_byte (memp + 6);
+{	uae_u32 val = (get_byte_direct (memp) << 24) + (get_byte_direct (memp + 2) << 16)
+              + (get_byte_direct (memp + 4) << 8) + get_byte_direct (memp + 6);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (val);
@@ -820,12 +772,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0150_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (4);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -839,13 +791,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0158_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	get_word_prefetch (4);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -860,13 +812,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0160_11)(uae_u32 opcode)
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	get_word_prefetch (4);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -880,12 +832,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0168_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -900,12 +852,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0170_11)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -918,12 +870,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0178_11)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -936,12 +888,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0179_11)(uae_u32 opcode)
 {	uaecptr dsta = get_long_prefetch (4);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -956,12 +908,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_017a_11)(uae_u32 opcode)
 	dsta += (uae_s32)(uae_s16)get_word_prefetch (4);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -978,12 +930,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_017b_11)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (tmppc, get_word_prefetch (4));
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -1012,7 +964,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0188_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 	uaecptr memp = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-	put_byte (memp, src >> 8); put_byte (memp + 2, src);
+	put_byte_direct (memp, src >> 8); put_byte_direct (memp + 2, src);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 }}	m68k_incpc (4);
@@ -1028,12 +980,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0190_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (4);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -1047,13 +999,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0198_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	get_word_prefetch (4);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -1068,13 +1020,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_01a0_11)(uae_u32 opcode)
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	get_word_prefetch (4);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -1088,12 +1040,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_01a8_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -1108,12 +1060,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_01b0_11)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -1126,12 +1078,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_01b8_11)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -1144,12 +1096,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_01b9_11)(uae_u32 opcode)
 {	uaecptr dsta = get_long_prefetch (4);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -1164,12 +1116,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_01ba_11)(uae_u32 opcode)
 	dsta += (uae_s32)(uae_s16)get_word_prefetch (4);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -1186,12 +1138,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_01bb_11)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (tmppc, get_word_prefetch (4));
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -1220,8 +1172,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_01c8_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 	uaecptr memp = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-	put_byte (memp, src >> 24); put_byte (memp + 2, src >> 16);
-	put_byte (memp + 4, src >> 8); put_byte (memp + 6, src);
+	put_byte_direct (memp, src >> 24); put_byte_direct (memp + 2, src >> 16);
+	put_byte_direct (memp + 4, src >> 8); put_byte_direct (memp + 6, src);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 }}	m68k_incpc (4);
@@ -1237,12 +1189,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_01d0_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (4);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -1256,13 +1208,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_01d8_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	get_word_prefetch (4);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -1277,13 +1229,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_01e0_11)(uae_u32 opcode)
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	get_word_prefetch (4);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -1297,12 +1249,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_01e8_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -1317,12 +1269,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_01f0_11)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -1335,12 +1287,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_01f8_11)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -1353,12 +1305,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_01f9_11)(uae_u32 opcode)
 {	uaecptr dsta = get_long_prefetch (4);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -1373,12 +1325,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_01fa_11)(uae_u32 opcode)
 	dsta += (uae_s32)(uae_s16)get_word_prefetch (4);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -1395,12 +1347,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_01fb_11)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (tmppc, get_word_prefetch (4));
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -1412,9 +1364,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0200_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -1428,14 +1378,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0210_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -1446,15 +1394,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0218_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -1466,15 +1412,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0220_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 22 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -1485,14 +1429,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0228_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -1504,14 +1446,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0230_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (6);
 return 26 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -1521,14 +1461,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0238_11)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -1538,14 +1476,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0239_11)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = get_long_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (8);
 return 28 * CYCLE_UNIT / 2;
 } /* 24 (5/1) */
@@ -1572,9 +1508,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0240_11)(uae_u32 opcode)
 {{	uae_s16 src = get_word_prefetch (4);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -1593,14 +1527,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0250_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2258;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel2258: ;
 return 16 * CYCLE_UNIT / 2;
@@ -1617,15 +1549,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0258_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2259;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel2259: ;
 return 16 * CYCLE_UNIT / 2;
@@ -1643,15 +1573,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0260_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2260;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel2260: ;
 return 18 * CYCLE_UNIT / 2;
@@ -1668,14 +1596,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0268_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2261;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2261: ;
 return 20 * CYCLE_UNIT / 2;
@@ -1693,14 +1619,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0270_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2262;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2262: ;
 return 22 * CYCLE_UNIT / 2;
@@ -1716,14 +1640,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0278_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2263;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2263: ;
 return 20 * CYCLE_UNIT / 2;
@@ -1739,14 +1661,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0279_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2264;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (8);
 endlabel2264: ;
 return 24 * CYCLE_UNIT / 2;
@@ -1775,9 +1695,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0280_11)(uae_u32 opcode)
 {{	uae_s32 src = get_long_prefetch (4);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 	m68k_dreg (regs, dstreg) = (src);
@@ -1796,14 +1714,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0290_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2267;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2267: ;
 return 28 * CYCLE_UNIT / 2;
@@ -1820,15 +1736,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0298_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2268;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2268: ;
 return 28 * CYCLE_UNIT / 2;
@@ -1846,15 +1760,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_02a0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2269;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2269: ;
 return 30 * CYCLE_UNIT / 2;
@@ -1871,14 +1783,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_02a8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2270;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (8);
 endlabel2270: ;
 return 32 * CYCLE_UNIT / 2;
@@ -1896,14 +1806,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_02b0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2271;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (8);
 endlabel2271: ;
 return 34 * CYCLE_UNIT / 2;
@@ -1919,14 +1827,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_02b8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2272;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (8);
 endlabel2272: ;
 return 32 * CYCLE_UNIT / 2;
@@ -1942,14 +1848,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_02b9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2273;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (12);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (10);
 endlabel2273: ;
 return 36 * CYCLE_UNIT / 2;
@@ -1967,11 +1871,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0400_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -1983,19 +1885,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0410_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -2006,7 +1906,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0418_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -2014,12 +1914,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_0418_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -2031,7 +1929,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0420_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -2039,12 +1937,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_0420_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 22 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -2055,19 +1951,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0428_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -2079,19 +1973,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0430_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 26 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -2101,19 +1993,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0438_11)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -2123,19 +2013,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0439_11)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = get_long_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (8);
 return 28 * CYCLE_UNIT / 2;
 } /* 24 (5/1) */
@@ -2152,11 +2040,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0440_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
@@ -2173,19 +2059,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0450_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2283;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel2283: ;
 return 16 * CYCLE_UNIT / 2;
@@ -2202,7 +2086,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0458_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2284;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -2210,12 +2094,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_0458_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel2284: ;
 return 16 * CYCLE_UNIT / 2;
@@ -2233,7 +2115,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0460_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2285;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -2241,12 +2123,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_0460_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel2285: ;
 return 18 * CYCLE_UNIT / 2;
@@ -2263,19 +2143,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0468_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2286;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel2286: ;
 return 20 * CYCLE_UNIT / 2;
@@ -2293,19 +2171,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0470_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2287;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel2287: ;
 return 22 * CYCLE_UNIT / 2;
@@ -2321,19 +2197,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0478_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2288;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel2288: ;
 return 20 * CYCLE_UNIT / 2;
@@ -2349,19 +2223,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0479_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2289;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (8);
 endlabel2289: ;
 return 24 * CYCLE_UNIT / 2;
@@ -2379,11 +2251,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0480_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
@@ -2400,19 +2270,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0490_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2291;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel2291: ;
 return 28 * CYCLE_UNIT / 2;
@@ -2429,7 +2297,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0498_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2292;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -2437,12 +2305,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_0498_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel2292: ;
 return 28 * CYCLE_UNIT / 2;
@@ -2460,7 +2326,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_04a0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2293;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -2468,12 +2334,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_04a0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel2293: ;
 return 30 * CYCLE_UNIT / 2;
@@ -2490,19 +2354,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_04a8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2294;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (8);
 endlabel2294: ;
 return 32 * CYCLE_UNIT / 2;
@@ -2520,19 +2382,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_04b0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2295;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (8);
 endlabel2295: ;
 return 34 * CYCLE_UNIT / 2;
@@ -2548,19 +2408,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_04b8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2296;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (8);
 endlabel2296: ;
 return 32 * CYCLE_UNIT / 2;
@@ -2576,19 +2434,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_04b9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2297;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (12);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (10);
 endlabel2297: ;
 return 36 * CYCLE_UNIT / 2;
@@ -2606,11 +2462,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0600_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -2622,19 +2476,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0610_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -2645,7 +2497,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0618_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -2653,12 +2505,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_0618_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -2670,7 +2520,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0620_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -2678,12 +2528,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_0620_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 22 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -2694,19 +2542,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0628_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -2718,19 +2564,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0630_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 26 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -2740,19 +2584,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0638_11)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -2762,19 +2604,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0639_11)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = get_long_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (8);
 return 28 * CYCLE_UNIT / 2;
 } /* 24 (5/1) */
@@ -2791,11 +2631,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0640_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
@@ -2812,19 +2650,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0650_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2307;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel2307: ;
 return 16 * CYCLE_UNIT / 2;
@@ -2841,7 +2677,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0658_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2308;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -2849,12 +2685,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_0658_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel2308: ;
 return 16 * CYCLE_UNIT / 2;
@@ -2872,7 +2706,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0660_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2309;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -2880,12 +2714,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_0660_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel2309: ;
 return 18 * CYCLE_UNIT / 2;
@@ -2902,19 +2734,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0668_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2310;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel2310: ;
 return 20 * CYCLE_UNIT / 2;
@@ -2932,19 +2762,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0670_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2311;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel2311: ;
 return 22 * CYCLE_UNIT / 2;
@@ -2960,19 +2788,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0678_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2312;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel2312: ;
 return 20 * CYCLE_UNIT / 2;
@@ -2988,19 +2814,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0679_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2313;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (8);
 endlabel2313: ;
 return 24 * CYCLE_UNIT / 2;
@@ -3018,11 +2842,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0680_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
@@ -3039,19 +2861,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_0690_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2315;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel2315: ;
 return 28 * CYCLE_UNIT / 2;
@@ -3068,7 +2888,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0698_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2316;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -3076,12 +2896,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_0698_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel2316: ;
 return 28 * CYCLE_UNIT / 2;
@@ -3099,7 +2917,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_06a0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2317;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -3107,12 +2925,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_06a0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel2317: ;
 return 30 * CYCLE_UNIT / 2;
@@ -3129,19 +2945,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_06a8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2318;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (8);
 endlabel2318: ;
 return 32 * CYCLE_UNIT / 2;
@@ -3159,19 +2973,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_06b0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2319;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (8);
 endlabel2319: ;
 return 34 * CYCLE_UNIT / 2;
@@ -3187,19 +2999,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_06b8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2320;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (8);
 endlabel2320: ;
 return 32 * CYCLE_UNIT / 2;
@@ -3215,19 +3025,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_06b9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2321;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (12);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (10);
 endlabel2321: ;
 return 36 * CYCLE_UNIT / 2;
@@ -3255,7 +3063,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0810_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
@@ -3271,7 +3079,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0818_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	get_word_prefetch (6);
 	src &= 7;
@@ -3289,7 +3097,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0820_11)(uae_u32 opcode)
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	get_word_prefetch (6);
 	src &= 7;
@@ -3306,7 +3114,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0828_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
@@ -3323,7 +3131,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0830_11)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
@@ -3338,7 +3146,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0838_11)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
@@ -3353,7 +3161,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0839_11)(uae_u32 opcode)
 {	uaecptr dsta = get_long_prefetch (6);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (10);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
@@ -3370,7 +3178,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_083a_11)(uae_u32 opcode)
 	dsta += (uae_s32)(uae_s16)get_word_prefetch (6);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
@@ -3389,7 +3197,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_083b_11)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (tmppc, get_word_prefetch (6));
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
@@ -3434,12 +3242,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0850_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -3452,13 +3260,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0858_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	get_word_prefetch (6);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -3472,13 +3280,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0860_11)(uae_u32 opcode)
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	get_word_prefetch (6);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -3491,12 +3299,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0868_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -3510,12 +3318,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0870_11)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 22 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -3527,12 +3335,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0878_11)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -3544,12 +3352,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0879_11)(uae_u32 opcode)
 {	uaecptr dsta = get_long_prefetch (6);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (10);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (8);
 return 24 * CYCLE_UNIT / 2;
 } /* 24 (5/1) */
@@ -3563,12 +3371,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_087a_11)(uae_u32 opcode)
 	dsta += (uae_s32)(uae_s16)get_word_prefetch (6);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -3584,12 +3392,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_087b_11)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (tmppc, get_word_prefetch (6));
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	dst ^= (1 << src);
 	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 22 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -3618,12 +3426,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0890_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -3636,13 +3444,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0898_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -3656,13 +3464,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_08a0_11)(uae_u32 opcode)
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -3675,12 +3483,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_08a8_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -3694,12 +3502,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_08b0_11)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 22 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -3711,12 +3519,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_08b8_11)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -3728,12 +3536,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_08b9_11)(uae_u32 opcode)
 {	uaecptr dsta = get_long_prefetch (6);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (10);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (8);
 return 24 * CYCLE_UNIT / 2;
 } /* 24 (5/1) */
@@ -3747,12 +3555,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_08ba_11)(uae_u32 opcode)
 	dsta += (uae_s32)(uae_s16)get_word_prefetch (6);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -3768,12 +3576,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_08bb_11)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (tmppc, get_word_prefetch (6));
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst &= ~(1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 22 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -3802,12 +3610,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_08d0_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -3820,13 +3628,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_08d8_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -3840,13 +3648,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_08e0_11)(uae_u32 opcode)
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	get_word_prefetch (6);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -3859,12 +3667,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_08e8_11)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -3878,12 +3686,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_08f0_11)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 22 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -3895,12 +3703,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_08f8_11)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -3912,12 +3720,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_08f9_11)(uae_u32 opcode)
 {	uaecptr dsta = get_long_prefetch (6);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (10);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (8);
 return 24 * CYCLE_UNIT / 2;
 } /* 24 (5/1) */
@@ -3931,12 +3739,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_08fa_11)(uae_u32 opcode)
 	dsta += (uae_s32)(uae_s16)get_word_prefetch (6);
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -3952,12 +3760,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_08fb_11)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (tmppc, get_word_prefetch (6));
 	regs.ir = regs.irc;
 	regs.irc = 0;
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	get_word_prefetch (8);
 	src &= 7;
 	SET_ZFLG (1 ^ ((dst >> src) & 1));
 	dst |= (1 << src);
-	put_byte (dsta, dst);
+	put_byte_direct (dsta, dst);
 }}}}	m68k_incpc (6);
 return 22 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -3969,9 +3777,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a00_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -3985,14 +3791,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a10_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -4003,15 +3807,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a18_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -4023,15 +3825,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a20_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 22 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -4042,14 +3842,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a28_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -4061,14 +3859,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a30_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (6);
 return 26 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -4078,14 +3874,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a38_11)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -4095,14 +3889,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a39_11)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = get_long_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (8);
 return 28 * CYCLE_UNIT / 2;
 } /* 24 (5/1) */
@@ -4129,9 +3921,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a40_11)(uae_u32 opcode)
 {{	uae_s16 src = get_word_prefetch (4);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -4150,14 +3940,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a50_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2373;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel2373: ;
 return 16 * CYCLE_UNIT / 2;
@@ -4174,15 +3962,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a58_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2374;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel2374: ;
 return 16 * CYCLE_UNIT / 2;
@@ -4200,15 +3986,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a60_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2375;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel2375: ;
 return 18 * CYCLE_UNIT / 2;
@@ -4225,14 +4009,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a68_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2376;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2376: ;
 return 20 * CYCLE_UNIT / 2;
@@ -4250,14 +4032,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a70_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2377;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2377: ;
 return 22 * CYCLE_UNIT / 2;
@@ -4273,14 +4053,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a78_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2378;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2378: ;
 return 20 * CYCLE_UNIT / 2;
@@ -4296,14 +4074,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a79_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2379;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (8);
 endlabel2379: ;
 return 24 * CYCLE_UNIT / 2;
@@ -4332,9 +4108,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a80_11)(uae_u32 opcode)
 {{	uae_s32 src = get_long_prefetch (4);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 	m68k_dreg (regs, dstreg) = (src);
@@ -4356,14 +4130,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a90_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2382;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2382: ;
 return 28 * CYCLE_UNIT / 2;
@@ -4380,15 +4152,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a98_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2383;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2383: ;
 return 28 * CYCLE_UNIT / 2;
@@ -4406,15 +4176,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_0aa0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2384;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel2384: ;
 return 30 * CYCLE_UNIT / 2;
@@ -4431,14 +4199,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0aa8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2385;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (8);
 endlabel2385: ;
 return 32 * CYCLE_UNIT / 2;
@@ -4456,14 +4222,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ab0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2386;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (8);
 endlabel2386: ;
 return 34 * CYCLE_UNIT / 2;
@@ -4479,14 +4243,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ab8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2387;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (8);
 endlabel2387: ;
 return 32 * CYCLE_UNIT / 2;
@@ -4502,14 +4264,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ab9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2388;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (12);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (10);
 endlabel2388: ;
 return 36 * CYCLE_UNIT / 2;
@@ -4527,10 +4287,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c00_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 } /* 8 (2/0) */
@@ -4541,17 +4299,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c10_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 12 (3/0) */
@@ -4562,7 +4318,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c18_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -4570,10 +4326,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c18_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 12 (3/0) */
@@ -4585,7 +4339,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c20_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -4593,10 +4347,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c20_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 12 (3/0) */
@@ -4607,17 +4359,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c28_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 16 (4/0) */
@@ -4629,17 +4379,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c30_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 22 * CYCLE_UNIT / 2;
 } /* 16 (4/0) */
@@ -4649,17 +4397,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c38_11)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 16 (4/0) */
@@ -4669,17 +4415,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c39_11)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = get_long_prefetch (6);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (8);
 return 24 * CYCLE_UNIT / 2;
 } /* 20 (5/0) */
@@ -4696,10 +4440,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c40_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
 } /* 8 (2/0) */
@@ -4715,17 +4457,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c50_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2398;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel2398: ;
 return 12 * CYCLE_UNIT / 2;
@@ -4742,7 +4482,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c58_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2399;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -4750,10 +4490,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c58_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel2399: ;
 return 12 * CYCLE_UNIT / 2;
@@ -4771,7 +4509,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c60_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2400;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -4779,10 +4517,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c60_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel2400: ;
 return 14 * CYCLE_UNIT / 2;
@@ -4799,17 +4535,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c68_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2401;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel2401: ;
 return 16 * CYCLE_UNIT / 2;
@@ -4827,17 +4561,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c70_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2402;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel2402: ;
 return 18 * CYCLE_UNIT / 2;
@@ -4853,17 +4585,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c78_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2403;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel2403: ;
 return 16 * CYCLE_UNIT / 2;
@@ -4879,17 +4609,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c79_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2404;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (8);
 endlabel2404: ;
 return 20 * CYCLE_UNIT / 2;
@@ -4907,10 +4635,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c80_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (3/0) */
@@ -4926,17 +4652,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c90_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2406;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel2406: ;
 return 20 * CYCLE_UNIT / 2;
@@ -4953,7 +4677,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c98_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2407;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -4961,10 +4685,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c98_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel2407: ;
 return 20 * CYCLE_UNIT / 2;
@@ -4982,7 +4704,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ca0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2408;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -4990,10 +4712,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ca0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel2408: ;
 return 22 * CYCLE_UNIT / 2;
@@ -5010,17 +4730,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ca8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2409;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (8);
 endlabel2409: ;
 return 24 * CYCLE_UNIT / 2;
@@ -5038,17 +4756,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cb0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2410;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (8);
 endlabel2410: ;
 return 26 * CYCLE_UNIT / 2;
@@ -5064,17 +4780,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cb8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2411;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (8);
 endlabel2411: ;
 return 24 * CYCLE_UNIT / 2;
@@ -5090,17 +4804,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cb9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2412;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (12);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (10);
 endlabel2412: ;
 return 28 * CYCLE_UNIT / 2;
@@ -5112,9 +4824,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1000_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -5128,10 +4838,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_1010_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	uae_s8 src = get_byte_direct (srca);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -5145,11 +4853,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_1018_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -5164,11 +4870,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_1020_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -5182,10 +4886,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_1028_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	uae_s8 src = get_byte_direct (srca);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5200,10 +4902,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_1030_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	uae_s8 src = get_byte_direct (srca);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5216,10 +4916,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_1038_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	uae_s8 src = get_byte_direct (srca);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5232,10 +4930,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_1039_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	uae_s8 src = get_byte_direct (srca);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -5249,10 +4945,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_103a_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	uae_s8 src = get_byte_direct (srca);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5268,10 +4962,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_103b_11)(uae_u32 opcode)
 	uaecptr srca;
 	tmppc = m68k_getpc () + 2;
 	srca = get_disp_ea_000 (tmppc, get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	uae_s8 src = get_byte_direct (srca);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5284,9 +4976,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_103c_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5301,10 +4991,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_1080_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5317,12 +5005,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_1090_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5335,13 +5021,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_1098_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5355,13 +5039,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_10a0_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5374,12 +5056,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_10a8_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5393,12 +5073,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_10b0_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5410,12 +5088,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_10b8_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5427,12 +5103,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_10b9_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5445,12 +5119,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_10ba_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5465,12 +5137,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_10bb_11)(uae_u32 opcode)
 	uaecptr srca;
 	tmppc = m68k_getpc () + 2;
 	srca = get_disp_ea_000 (tmppc, get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5483,10 +5153,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_10bc_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5501,10 +5169,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_10c0_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5517,13 +5183,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_10d0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5536,14 +5200,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_10d8_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5557,14 +5219,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_10e0_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5577,13 +5237,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_10e8_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5597,13 +5255,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_10f0_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5615,13 +5271,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_10f8_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5633,13 +5287,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_10f9_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5652,13 +5304,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_10fa_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5673,13 +5323,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_10fb_11)(uae_u32 opcode)
 	uaecptr srca;
 	tmppc = m68k_getpc () + 2;
 	srca = get_disp_ea_000 (tmppc, get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5693,10 +5341,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_10fc_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5714,10 +5360,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_1100_11)(uae_u32 opcode)
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (2);
 }}}return 8 * CYCLE_UNIT / 2;
 } /* 8 (1/1) */
@@ -5728,16 +5372,14 @@ uae_u32 REGPARAM2 CPUFUNC(op_1110_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (2);
 }}}}return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -5748,17 +5390,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_1118_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (2);
 }}}}return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -5770,17 +5410,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_1120_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (2);
 }}}}return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -5791,16 +5429,14 @@ uae_u32 REGPARAM2 CPUFUNC(op_1128_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -5812,16 +5448,14 @@ uae_u32 REGPARAM2 CPUFUNC(op_1130_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 }}}}return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -5831,16 +5465,14 @@ uae_u32 REGPARAM2 CPUFUNC(op_1138_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -5850,16 +5482,14 @@ uae_u32 REGPARAM2 CPUFUNC(op_1139_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -5870,16 +5500,14 @@ uae_u32 REGPARAM2 CPUFUNC(op_113a_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -5892,16 +5520,14 @@ uae_u32 REGPARAM2 CPUFUNC(op_113b_11)(uae_u32 opcode)
 	uaecptr srca;
 	tmppc = m68k_getpc () + 2;
 	srca = get_disp_ea_000 (tmppc, get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 }}}}return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -5916,10 +5542,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_113c_11)(uae_u32 opcode)
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 }}}return 16 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -5931,10 +5555,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_1140_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5947,12 +5569,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_1150_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5965,13 +5585,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_1158_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -5985,13 +5603,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_1160_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6004,12 +5620,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_1168_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6023,12 +5637,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_1170_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6040,12 +5652,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_1178_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6057,12 +5667,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_1179_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6075,12 +5683,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_117a_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6095,12 +5701,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_117b_11)(uae_u32 opcode)
 	uaecptr srca;
 	tmppc = m68k_getpc () + 2;
 	srca = get_disp_ea_000 (tmppc, get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6113,10 +5717,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_117c_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6131,10 +5733,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_1180_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6147,13 +5747,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_1190_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6166,14 +5764,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_1198_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6187,14 +5783,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_11a0_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6207,13 +5801,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_11a8_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6227,13 +5819,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_11b0_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6245,13 +5835,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_11b8_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6263,13 +5851,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_11b9_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (8));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6282,13 +5868,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_11ba_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6303,13 +5887,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_11bb_11)(uae_u32 opcode)
 	uaecptr srca;
 	tmppc = m68k_getpc () + 2;
 	srca = get_disp_ea_000 (tmppc, get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6323,10 +5905,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_11bc_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6339,10 +5919,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_11c0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6354,12 +5932,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_11d0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6371,13 +5947,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_11d8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6390,13 +5964,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_11e0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6408,12 +5980,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_11e8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6426,12 +5996,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_11f0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6442,12 +6010,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_11f0_11)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_11f8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6458,12 +6024,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_11f8_11)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_11f9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6475,12 +6039,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_11fa_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6494,12 +6056,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_11fb_11)(uae_u32 opcode)
 	uaecptr srca;
 	tmppc = m68k_getpc () + 2;
 	srca = get_disp_ea_000 (tmppc, get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6511,10 +6071,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_11fc_11)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6527,10 +6085,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_13c0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_long_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6542,14 +6098,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_13d0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (4) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -6562,15 +6116,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_13d8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta;
 	dsta = get_word_prefetch (4) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -6584,15 +6136,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_13e0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = get_word_prefetch (4) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (6);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -6605,14 +6155,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_13e8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (6) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (8);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -6626,14 +6174,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_13f0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (6) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (8);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -6645,14 +6191,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_13f0_11)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_13f8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (6) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (8);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -6664,14 +6208,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_13f8_11)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_13f9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (8) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (10);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -6684,14 +6226,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_13fa_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (6) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (8);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -6706,14 +6246,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_13fb_11)(uae_u32 opcode)
 	uaecptr srca;
 	tmppc = m68k_getpc () + 2;
 	srca = get_disp_ea_000 (tmppc, get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (6) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (8);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -6726,10 +6264,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_13fc_11)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uaecptr dsta = get_long_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
-	put_byte (dsta, src);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
+	put_byte_direct (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -6742,9 +6278,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2000_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -6758,9 +6292,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2008_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -6778,10 +6310,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2010_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2503;
 	}
-{{	uae_s32 src = get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{{	uae_s32 src = get_long_direct (srca);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -6800,11 +6330,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_2018_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2504;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -6824,11 +6352,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_2020_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2505;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -6848,10 +6374,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2028_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2506;
 	}
-{{	uae_s32 src = get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{{	uae_s32 src = get_long_direct (srca);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6872,10 +6396,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2030_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2507;
 	}
-{{	uae_s32 src = get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{{	uae_s32 src = get_long_direct (srca);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6894,10 +6416,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2038_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2508;
 	}
-{{	uae_s32 src = get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{{	uae_s32 src = get_long_direct (srca);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6916,10 +6436,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2039_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2509;
 	}
-{{	uae_s32 src = get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{{	uae_s32 src = get_long_direct (srca);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6939,10 +6457,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_203a_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2510;
 	}
-{{	uae_s32 src = get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{{	uae_s32 src = get_long_direct (srca);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6964,10 +6480,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_203b_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2511;
 	}
-{{	uae_s32 src = get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{{	uae_s32 src = get_long_direct (srca);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6981,9 +6495,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_203c_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_long_prefetch (4);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -7027,7 +6539,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2050_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2515;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	m68k_areg (regs, dstreg) = (src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -7046,7 +6558,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2058_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2516;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	m68k_areg (regs, dstreg) = (src);
 	m68k_incpc (2);
@@ -7067,7 +6579,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2060_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2517;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	m68k_areg (regs, dstreg) = (src);
 	m68k_incpc (2);
@@ -7088,7 +6600,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2068_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2518;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	m68k_areg (regs, dstreg) = (src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -7109,7 +6621,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2070_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2519;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	m68k_areg (regs, dstreg) = (src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -7128,7 +6640,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2078_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2520;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	m68k_areg (regs, dstreg) = (src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -7147,7 +6659,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2079_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2521;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	m68k_areg (regs, dstreg) = (src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -7167,7 +6679,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_207a_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2522;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	m68k_areg (regs, dstreg) = (src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -7189,7 +6701,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_207b_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2523;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	m68k_areg (regs, dstreg) = (src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -7222,10 +6734,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2080_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2525;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7245,10 +6755,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2088_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2526;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7266,17 +6774,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_2090_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2527;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (2);
 		exception3 (opcode, dsta);
 		goto endlabel2527;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7294,7 +6800,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2098_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2528;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
@@ -7302,10 +6808,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2098_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2528;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7324,7 +6828,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20a0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2529;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
@@ -7332,10 +6836,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_20a0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2529;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7354,17 +6856,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_20a8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2530;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
 		exception3 (opcode, dsta);
 		goto endlabel2530;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7384,17 +6884,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_20b0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2531;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
 		exception3 (opcode, dsta);
 		goto endlabel2531;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7412,17 +6910,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_20b8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2532;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
 		exception3 (opcode, dsta);
 		goto endlabel2532;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7440,17 +6936,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_20b9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2533;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2533;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7469,17 +6963,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_20ba_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2534;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
 		exception3 (opcode, dsta);
 		goto endlabel2534;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7500,17 +6992,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_20bb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2535;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
 		exception3 (opcode, dsta);
 		goto endlabel2535;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7529,10 +7019,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_20bc_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2536;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7553,10 +7041,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_20c0_11)(uae_u32 opcode)
 		goto endlabel2537;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7577,10 +7063,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_20c8_11)(uae_u32 opcode)
 		goto endlabel2538;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7598,7 +7082,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2539;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (2);
@@ -7606,10 +7090,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_20d0_11)(uae_u32 opcode)
 		goto endlabel2539;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7627,7 +7109,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2540;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
@@ -7636,10 +7118,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_20d8_11)(uae_u32 opcode)
 		goto endlabel2540;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7658,7 +7138,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2541;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
@@ -7667,10 +7147,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_20e0_11)(uae_u32 opcode)
 		goto endlabel2541;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7689,7 +7167,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2542;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
@@ -7697,10 +7175,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_20e8_11)(uae_u32 opcode)
 		goto endlabel2542;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7720,7 +7196,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2543;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
@@ -7728,10 +7204,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_20f0_11)(uae_u32 opcode)
 		goto endlabel2543;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7749,7 +7223,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2544;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
@@ -7757,10 +7231,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_20f8_11)(uae_u32 opcode)
 		goto endlabel2544;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7778,7 +7250,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2545;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (6);
@@ -7786,10 +7258,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_20f9_11)(uae_u32 opcode)
 		goto endlabel2545;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7808,7 +7278,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2546;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
@@ -7816,10 +7286,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_20fa_11)(uae_u32 opcode)
 		goto endlabel2546;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7840,7 +7308,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2547;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
@@ -7848,10 +7316,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_20fb_11)(uae_u32 opcode)
 		goto endlabel2547;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7871,10 +7337,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_20fc_11)(uae_u32 opcode)
 		goto endlabel2548;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -7898,10 +7362,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2100_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (2);
 }}}}endlabel2549: ;
 return 12 * CYCLE_UNIT / 2;
@@ -7923,10 +7385,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2108_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (2);
 }}}}endlabel2550: ;
 return 12 * CYCLE_UNIT / 2;
@@ -7942,7 +7402,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2110_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2551;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	if (dsta & 1) {
@@ -7953,10 +7413,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2110_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (2);
 }}}}}}endlabel2551: ;
 return 20 * CYCLE_UNIT / 2;
@@ -7972,7 +7430,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2118_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2552;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
@@ -7984,10 +7442,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2118_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (2);
 }}}}}}endlabel2552: ;
 return 20 * CYCLE_UNIT / 2;
@@ -8004,7 +7460,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2120_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2553;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
@@ -8016,10 +7472,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2120_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (2);
 }}}}}}endlabel2553: ;
 return 22 * CYCLE_UNIT / 2;
@@ -8036,7 +7490,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2128_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2554;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	if (dsta & 1) {
@@ -8047,10 +7501,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2128_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 }}}}}}endlabel2554: ;
 return 24 * CYCLE_UNIT / 2;
@@ -8068,7 +7520,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2130_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2555;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	if (dsta & 1) {
@@ -8079,10 +7531,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2130_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 }}}}}}endlabel2555: ;
 return 26 * CYCLE_UNIT / 2;
@@ -8098,7 +7548,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2138_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2556;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	if (dsta & 1) {
@@ -8109,10 +7559,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2138_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 }}}}}}endlabel2556: ;
 return 24 * CYCLE_UNIT / 2;
@@ -8128,7 +7576,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2139_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2557;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	if (dsta & 1) {
@@ -8139,10 +7587,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2139_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 }}}}}}endlabel2557: ;
 return 28 * CYCLE_UNIT / 2;
@@ -8159,7 +7605,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_213a_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2558;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	if (dsta & 1) {
@@ -8170,10 +7616,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_213a_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 }}}}}}endlabel2558: ;
 return 24 * CYCLE_UNIT / 2;
@@ -8192,7 +7636,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_213b_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2559;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	if (dsta & 1) {
@@ -8203,10 +7647,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_213b_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 }}}}}}endlabel2559: ;
 return 26 * CYCLE_UNIT / 2;
@@ -8227,10 +7669,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_213c_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 }}}}endlabel2560: ;
 return 20 * CYCLE_UNIT / 2;
@@ -8248,10 +7688,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2140_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2561;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8271,10 +7709,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2148_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2562;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8292,17 +7728,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_2150_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2563;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
 	if (dsta & 1) {
 	m68k_incpc (4);
 		exception3 (opcode, dsta);
 		goto endlabel2563;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8320,7 +7754,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2158_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2564;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
 	if (dsta & 1) {
@@ -8328,10 +7762,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2158_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2564;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8350,7 +7782,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2160_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2565;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
 	if (dsta & 1) {
@@ -8358,10 +7790,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2160_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2565;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8380,17 +7810,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_2168_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2566;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2566;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8413,17 +7841,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_2170_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2567;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2567;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8441,17 +7867,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_2178_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2568;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2568;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8469,17 +7893,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_2179_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2569;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (8);
 	if (dsta & 1) {
 	m68k_incpc (8);
 		exception3 (opcode, dsta);
 		goto endlabel2569;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8498,17 +7920,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_217a_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2570;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2570;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8529,17 +7949,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_217b_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2571;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2571;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8558,10 +7976,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_217c_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2572;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8582,10 +7998,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2180_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2573;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8606,10 +8020,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2188_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2574;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8627,7 +8039,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2190_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2575;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
 	if (dsta & 1) {
@@ -8635,10 +8047,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2190_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2575;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8656,7 +8066,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2198_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2576;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
@@ -8665,10 +8075,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_2198_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2576;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8687,7 +8095,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21a0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2577;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
@@ -8696,10 +8104,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_21a0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2577;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8718,7 +8124,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21a8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2578;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
 	if (dsta & 1) {
@@ -8726,10 +8132,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_21a8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2578;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8749,7 +8153,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21b0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2579;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
 	if (dsta & 1) {
@@ -8757,10 +8161,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_21b0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2579;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8778,7 +8180,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21b8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2580;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
 	if (dsta & 1) {
@@ -8786,10 +8188,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_21b8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2580;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8807,7 +8207,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21b9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2581;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (8));
 	if (dsta & 1) {
@@ -8815,10 +8215,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_21b9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2581;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8837,7 +8235,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21ba_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2582;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
 	if (dsta & 1) {
@@ -8845,10 +8243,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_21ba_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2582;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8869,7 +8265,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21bb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2583;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
 	if (dsta & 1) {
@@ -8877,10 +8273,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_21bb_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2583;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8900,10 +8294,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_21bc_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2584;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8922,10 +8314,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_21c0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2585;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8944,10 +8334,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_21c8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2586;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8964,17 +8352,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_21d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2587;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
 	if (dsta & 1) {
 	m68k_incpc (4);
 		exception3 (opcode, dsta);
 		goto endlabel2587;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -8991,7 +8377,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2588;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
 	if (dsta & 1) {
@@ -8999,10 +8385,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_21d8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2588;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -9020,7 +8404,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2589;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
 	if (dsta & 1) {
@@ -9028,10 +8412,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_21e0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2589;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -9049,17 +8431,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_21e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2590;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2590;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -9078,17 +8458,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_21f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2591;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2591;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -9105,17 +8483,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_21f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2592;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2592;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -9132,17 +8508,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_21f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2593;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (8);
 	if (dsta & 1) {
 	m68k_incpc (8);
 		exception3 (opcode, dsta);
 		goto endlabel2593;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -9160,17 +8534,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_21fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2594;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2594;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -9190,17 +8562,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_21fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2595;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2595;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -9218,10 +8588,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_21fc_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2596;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -9240,10 +8608,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_23c0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2597;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -9262,10 +8628,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_23c8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2598;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -9282,7 +8646,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2599;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (4) << 16;
 	dsta |= regs.irc;
@@ -9291,10 +8655,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_23d0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2599;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -9312,7 +8674,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2600;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta;
 	dsta = get_word_prefetch (4) << 16;
@@ -9322,10 +8684,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_23d8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2600;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -9344,7 +8704,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2601;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = get_word_prefetch (4) << 16;
@@ -9354,10 +8714,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_23e0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2601;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (6);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -9376,7 +8734,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2602;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (6) << 16;
 	dsta |= regs.irc;
@@ -9385,10 +8743,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_23e8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2602;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (8);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -9408,7 +8764,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2603;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (6) << 16;
 	dsta |= regs.irc;
@@ -9417,10 +8773,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_23f0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2603;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (8);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -9438,7 +8792,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2604;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (6) << 16;
 	dsta |= regs.irc;
@@ -9447,10 +8801,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_23f8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2604;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (8);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -9468,7 +8820,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2605;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (8) << 16;
 	dsta |= regs.irc;
@@ -9477,10 +8829,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_23f9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2605;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (10);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -9499,7 +8849,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2606;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (6) << 16;
 	dsta |= regs.irc;
@@ -9508,10 +8858,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_23fa_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2606;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (8);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -9532,7 +8880,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2607;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (6) << 16;
 	dsta |= regs.irc;
@@ -9541,10 +8889,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_23fb_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2607;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (8);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -9563,10 +8909,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_23fc_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2608;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
-	put_long (dsta, src);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
+	put_long_direct (dsta, src);
 	m68k_incpc (10);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -9580,9 +8924,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3000_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -9596,9 +8938,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3008_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -9616,10 +8956,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3010_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2611;
 	}
-{{	uae_s16 src = get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{{	uae_s16 src = get_word_direct (srca);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -9638,11 +8976,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_3018_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2612;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -9662,11 +8998,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_3020_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2613;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -9686,10 +9020,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3028_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2614;
 	}
-{{	uae_s16 src = get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{{	uae_s16 src = get_word_direct (srca);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -9710,10 +9042,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3030_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2615;
 	}
-{{	uae_s16 src = get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{{	uae_s16 src = get_word_direct (srca);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -9732,10 +9062,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3038_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2616;
 	}
-{{	uae_s16 src = get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{{	uae_s16 src = get_word_direct (srca);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -9754,10 +9082,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3039_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2617;
 	}
-{{	uae_s16 src = get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{{	uae_s16 src = get_word_direct (srca);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -9777,10 +9103,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_303a_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2618;
 	}
-{{	uae_s16 src = get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{{	uae_s16 src = get_word_direct (srca);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -9802,10 +9126,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_303b_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2619;
 	}
-{{	uae_s16 src = get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{{	uae_s16 src = get_word_direct (srca);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -9819,9 +9141,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_303c_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_word_prefetch (4);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -9867,7 +9187,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3050_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2623;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	src = (uae_s32)(uae_s16)src;
 	m68k_areg (regs, dstreg) = (uae_s32)(uae_s16)(src);
 	m68k_incpc (2);
@@ -9887,7 +9207,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3058_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2624;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	src = (uae_s32)(uae_s16)src;
 	m68k_areg (regs, dstreg) = (uae_s32)(uae_s16)(src);
@@ -9909,7 +9229,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3060_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2625;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	src = (uae_s32)(uae_s16)src;
 	m68k_areg (regs, dstreg) = (uae_s32)(uae_s16)(src);
@@ -9931,7 +9251,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3068_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2626;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	src = (uae_s32)(uae_s16)src;
 	m68k_areg (regs, dstreg) = (uae_s32)(uae_s16)(src);
 	m68k_incpc (4);
@@ -9953,7 +9273,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3070_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2627;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	src = (uae_s32)(uae_s16)src;
 	m68k_areg (regs, dstreg) = (uae_s32)(uae_s16)(src);
 	m68k_incpc (4);
@@ -9973,7 +9293,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3078_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2628;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	src = (uae_s32)(uae_s16)src;
 	m68k_areg (regs, dstreg) = (uae_s32)(uae_s16)(src);
 	m68k_incpc (4);
@@ -9993,7 +9313,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3079_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2629;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	src = (uae_s32)(uae_s16)src;
 	m68k_areg (regs, dstreg) = (uae_s32)(uae_s16)(src);
 	m68k_incpc (6);
@@ -10014,7 +9334,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_307a_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2630;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	src = (uae_s32)(uae_s16)src;
 	m68k_areg (regs, dstreg) = (uae_s32)(uae_s16)(src);
 	m68k_incpc (4);
@@ -10037,7 +9357,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_307b_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2631;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	src = (uae_s32)(uae_s16)src;
 	m68k_areg (regs, dstreg) = (uae_s32)(uae_s16)(src);
 	m68k_incpc (4);
@@ -10072,10 +9392,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3080_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2633;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10095,10 +9413,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3088_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2634;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10116,17 +9432,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_3090_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2635;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (2);
 		exception3 (opcode, dsta);
 		goto endlabel2635;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10144,7 +9458,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3098_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2636;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
@@ -10152,10 +9466,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3098_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2636;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10174,7 +9486,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30a0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2637;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
@@ -10182,10 +9494,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_30a0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2637;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10204,17 +9514,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_30a8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2638;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
 		exception3 (opcode, dsta);
 		goto endlabel2638;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10234,17 +9542,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_30b0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2639;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
 		exception3 (opcode, dsta);
 		goto endlabel2639;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10262,17 +9568,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_30b8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2640;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
 		exception3 (opcode, dsta);
 		goto endlabel2640;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10290,17 +9594,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_30b9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2641;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2641;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10319,17 +9621,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_30ba_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2642;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
 		exception3 (opcode, dsta);
 		goto endlabel2642;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10350,17 +9650,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_30bb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2643;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
 		exception3 (opcode, dsta);
 		goto endlabel2643;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10379,10 +9677,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_30bc_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2644;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10403,10 +9699,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_30c0_11)(uae_u32 opcode)
 		goto endlabel2645;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10427,10 +9721,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_30c8_11)(uae_u32 opcode)
 		goto endlabel2646;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10448,7 +9740,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2647;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (2);
@@ -10456,10 +9748,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_30d0_11)(uae_u32 opcode)
 		goto endlabel2647;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10477,7 +9767,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2648;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
@@ -10486,10 +9776,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_30d8_11)(uae_u32 opcode)
 		goto endlabel2648;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10508,7 +9796,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2649;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
@@ -10517,10 +9805,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_30e0_11)(uae_u32 opcode)
 		goto endlabel2649;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10539,7 +9825,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2650;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
@@ -10547,10 +9833,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_30e8_11)(uae_u32 opcode)
 		goto endlabel2650;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10570,7 +9854,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2651;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
@@ -10578,10 +9862,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_30f0_11)(uae_u32 opcode)
 		goto endlabel2651;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10599,7 +9881,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2652;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
@@ -10607,10 +9889,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_30f8_11)(uae_u32 opcode)
 		goto endlabel2652;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10628,7 +9908,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2653;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (6);
@@ -10636,10 +9916,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_30f9_11)(uae_u32 opcode)
 		goto endlabel2653;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10658,7 +9936,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2654;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
@@ -10666,10 +9944,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_30fa_11)(uae_u32 opcode)
 		goto endlabel2654;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10690,7 +9966,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2655;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 	m68k_incpc (4);
@@ -10698,10 +9974,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_30fb_11)(uae_u32 opcode)
 		goto endlabel2655;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10721,10 +9995,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_30fc_11)(uae_u32 opcode)
 		goto endlabel2656;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -10748,10 +10020,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3100_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (2);
 }}}}endlabel2657: ;
 return 8 * CYCLE_UNIT / 2;
@@ -10773,10 +10043,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3108_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (2);
 }}}}endlabel2658: ;
 return 8 * CYCLE_UNIT / 2;
@@ -10792,7 +10060,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3110_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2659;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	if (dsta & 1) {
@@ -10803,10 +10071,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3110_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (2);
 }}}}}}endlabel2659: ;
 return 12 * CYCLE_UNIT / 2;
@@ -10822,7 +10088,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3118_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2660;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
@@ -10834,10 +10100,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3118_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (2);
 }}}}}}endlabel2660: ;
 return 12 * CYCLE_UNIT / 2;
@@ -10854,7 +10118,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3120_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2661;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
@@ -10866,10 +10130,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3120_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (2);
 }}}}}}endlabel2661: ;
 return 14 * CYCLE_UNIT / 2;
@@ -10886,7 +10148,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3128_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2662;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	if (dsta & 1) {
@@ -10897,10 +10159,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3128_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 }}}}}}endlabel2662: ;
 return 16 * CYCLE_UNIT / 2;
@@ -10918,7 +10178,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3130_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2663;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	if (dsta & 1) {
@@ -10929,10 +10189,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3130_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 }}}}}}endlabel2663: ;
 return 18 * CYCLE_UNIT / 2;
@@ -10948,7 +10206,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3138_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2664;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	if (dsta & 1) {
@@ -10959,10 +10217,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3138_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 }}}}}}endlabel2664: ;
 return 16 * CYCLE_UNIT / 2;
@@ -10978,7 +10234,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3139_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2665;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	if (dsta & 1) {
@@ -10989,10 +10245,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3139_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 }}}}}}endlabel2665: ;
 return 20 * CYCLE_UNIT / 2;
@@ -11009,7 +10263,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_313a_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2666;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	if (dsta & 1) {
@@ -11020,10 +10274,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_313a_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 }}}}}}endlabel2666: ;
 return 16 * CYCLE_UNIT / 2;
@@ -11042,7 +10294,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_313b_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2667;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	if (dsta & 1) {
@@ -11053,10 +10305,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_313b_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 }}}}}}endlabel2667: ;
 return 18 * CYCLE_UNIT / 2;
@@ -11077,10 +10327,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_313c_11)(uae_u32 opcode)
 {	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 }}}}endlabel2668: ;
 return 12 * CYCLE_UNIT / 2;
@@ -11098,10 +10346,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3140_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2669;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11121,10 +10367,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3148_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2670;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11142,17 +10386,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_3150_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2671;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
 	if (dsta & 1) {
 	m68k_incpc (4);
 		exception3 (opcode, dsta);
 		goto endlabel2671;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11170,7 +10412,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3158_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2672;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
 	if (dsta & 1) {
@@ -11178,10 +10420,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3158_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2672;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11200,7 +10440,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3160_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2673;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
 	if (dsta & 1) {
@@ -11208,10 +10448,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3160_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2673;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11230,17 +10468,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_3168_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2674;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2674;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11260,17 +10496,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_3170_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2675;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2675;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11288,17 +10522,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_3178_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2676;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2676;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11316,17 +10548,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_3179_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2677;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (8);
 	if (dsta & 1) {
 	m68k_incpc (8);
 		exception3 (opcode, dsta);
 		goto endlabel2677;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11345,17 +10575,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_317a_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2678;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2678;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11376,17 +10604,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_317b_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2679;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2679;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11405,10 +10631,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_317c_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2680;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11429,10 +10653,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3180_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2681;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11453,10 +10675,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3188_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2682;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11474,7 +10694,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3190_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2683;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
 	if (dsta & 1) {
@@ -11482,10 +10702,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3190_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2683;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11503,7 +10721,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3198_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2684;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
@@ -11512,10 +10730,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_3198_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2684;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11534,7 +10750,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31a0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2685;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
@@ -11543,10 +10759,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_31a0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2685;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11565,7 +10779,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31a8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2686;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
 	if (dsta & 1) {
@@ -11573,10 +10787,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_31a8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2686;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11596,7 +10808,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31b0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2687;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
 	if (dsta & 1) {
@@ -11604,10 +10816,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_31b0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2687;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11625,7 +10835,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31b8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2688;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
 	if (dsta & 1) {
@@ -11633,10 +10843,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_31b8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2688;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11654,7 +10862,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31b9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2689;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (8));
 	if (dsta & 1) {
@@ -11662,10 +10870,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_31b9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2689;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11684,7 +10890,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31ba_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2690;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
 	if (dsta & 1) {
@@ -11692,10 +10898,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_31ba_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2690;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11716,7 +10920,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31bb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2691;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (6));
 	if (dsta & 1) {
@@ -11724,10 +10928,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_31bb_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2691;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11747,10 +10949,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_31bc_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2692;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11769,10 +10969,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_31c0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2693;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11791,10 +10989,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_31c8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2694;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11811,17 +11007,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_31d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2695;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
 	if (dsta & 1) {
 	m68k_incpc (4);
 		exception3 (opcode, dsta);
 		goto endlabel2695;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11838,7 +11032,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2696;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
 	if (dsta & 1) {
@@ -11846,10 +11040,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_31d8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2696;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11867,7 +11059,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2697;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
 	if (dsta & 1) {
@@ -11875,10 +11067,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_31e0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2697;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11896,17 +11086,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_31e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2698;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2698;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11925,17 +11113,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_31f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2699;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2699;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11952,17 +11138,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_31f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2700;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2700;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -11979,17 +11163,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_31f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2701;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (8);
 	if (dsta & 1) {
 	m68k_incpc (8);
 		exception3 (opcode, dsta);
 		goto endlabel2701;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -12007,17 +11189,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_31fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2702;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2702;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -12037,17 +11217,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_31fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2703;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (6);
 	if (dsta & 1) {
 	m68k_incpc (6);
 		exception3 (opcode, dsta);
 		goto endlabel2703;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -12065,10 +11243,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_31fc_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2704;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -12087,10 +11263,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_33c0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2705;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -12109,10 +11283,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_33c8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2706;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -12129,7 +11301,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2707;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (4) << 16;
 	dsta |= regs.irc;
@@ -12138,10 +11310,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_33d0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2707;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -12159,7 +11329,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2708;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta;
 	dsta = get_word_prefetch (4) << 16;
@@ -12169,10 +11339,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_33d8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2708;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -12191,7 +11359,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2709;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = get_word_prefetch (4) << 16;
@@ -12201,10 +11369,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_33e0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2709;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (6);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -12223,7 +11389,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2710;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (6) << 16;
 	dsta |= regs.irc;
@@ -12232,10 +11398,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_33e8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2710;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (8);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -12255,7 +11419,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2711;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (6) << 16;
 	dsta |= regs.irc;
@@ -12264,10 +11428,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_33f0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2711;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (8);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -12285,7 +11447,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2712;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (6) << 16;
 	dsta |= regs.irc;
@@ -12294,10 +11456,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_33f8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2712;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (8);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -12315,7 +11475,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2713;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (8) << 16;
 	dsta |= regs.irc;
@@ -12324,10 +11484,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_33f9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2713;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (10);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -12346,7 +11504,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2714;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (6) << 16;
 	dsta |= regs.irc;
@@ -12355,10 +11513,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_33fa_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2714;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (8);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -12379,7 +11535,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2715;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uaecptr dsta;
 	dsta = get_word_prefetch (6) << 16;
 	dsta |= regs.irc;
@@ -12388,10 +11544,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_33fb_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2715;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (8);
 	get_word_prefetch (0);
 	regs.ir = regs.irc;
@@ -12410,10 +11564,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_33fc_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2716;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
-	put_word (dsta, src);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
+	put_word_direct (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
@@ -12447,7 +11599,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4010_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 newv = 0 - src - (GET_XFLG () ? 1 : 0);
@@ -12459,7 +11611,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4010_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte (srca, newv);
+	put_byte_direct (srca, newv);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -12469,7 +11621,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4018_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -12482,7 +11634,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4018_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte (srca, newv);
+	put_byte_direct (srca, newv);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -12493,7 +11645,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4020_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -12506,7 +11658,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4020_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte (srca, newv);
+	put_byte_direct (srca, newv);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -12516,7 +11668,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4028_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = 0 - src - (GET_XFLG () ? 1 : 0);
@@ -12528,7 +11680,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4028_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte (srca, newv);
+	put_byte_direct (srca, newv);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -12539,7 +11691,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4030_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = 0 - src - (GET_XFLG () ? 1 : 0);
@@ -12551,7 +11703,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4030_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte (srca, newv);
+	put_byte_direct (srca, newv);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -12560,7 +11712,7 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4038_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = 0 - src - (GET_XFLG () ? 1 : 0);
@@ -12572,7 +11724,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4038_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte (srca, newv);
+	put_byte_direct (srca, newv);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -12581,7 +11733,7 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4039_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u32 newv = 0 - src - (GET_XFLG () ? 1 : 0);
@@ -12593,7 +11745,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4039_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte (srca, newv);
+	put_byte_direct (srca, newv);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -12628,7 +11780,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4050_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2726;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 newv = 0 - src - (GET_XFLG () ? 1 : 0);
@@ -12640,7 +11792,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4050_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s16)(newv)) == 0));
 	SET_NFLG (((uae_s16)(newv)) < 0);
-	put_word (srca, newv);
+	put_word_direct (srca, newv);
 }}}}}}	m68k_incpc (2);
 endlabel2726: ;
 return 12 * CYCLE_UNIT / 2;
@@ -12655,7 +11807,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4058_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2727;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -12668,7 +11820,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4058_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s16)(newv)) == 0));
 	SET_NFLG (((uae_s16)(newv)) < 0);
-	put_word (srca, newv);
+	put_word_direct (srca, newv);
 }}}}}}	m68k_incpc (2);
 endlabel2727: ;
 return 12 * CYCLE_UNIT / 2;
@@ -12684,7 +11836,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4060_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2728;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -12697,7 +11849,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4060_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s16)(newv)) == 0));
 	SET_NFLG (((uae_s16)(newv)) < 0);
-	put_word (srca, newv);
+	put_word_direct (srca, newv);
 }}}}}}	m68k_incpc (2);
 endlabel2728: ;
 return 14 * CYCLE_UNIT / 2;
@@ -12712,7 +11864,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4068_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2729;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = 0 - src - (GET_XFLG () ? 1 : 0);
@@ -12724,7 +11876,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4068_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s16)(newv)) == 0));
 	SET_NFLG (((uae_s16)(newv)) < 0);
-	put_word (srca, newv);
+	put_word_direct (srca, newv);
 }}}}}}	m68k_incpc (4);
 endlabel2729: ;
 return 16 * CYCLE_UNIT / 2;
@@ -12740,7 +11892,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4070_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2730;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = 0 - src - (GET_XFLG () ? 1 : 0);
@@ -12752,7 +11904,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4070_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s16)(newv)) == 0));
 	SET_NFLG (((uae_s16)(newv)) < 0);
-	put_word (srca, newv);
+	put_word_direct (srca, newv);
 }}}}}}	m68k_incpc (4);
 endlabel2730: ;
 return 18 * CYCLE_UNIT / 2;
@@ -12766,7 +11918,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4078_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2731;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = 0 - src - (GET_XFLG () ? 1 : 0);
@@ -12778,7 +11930,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4078_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s16)(newv)) == 0));
 	SET_NFLG (((uae_s16)(newv)) < 0);
-	put_word (srca, newv);
+	put_word_direct (srca, newv);
 }}}}}}	m68k_incpc (4);
 endlabel2731: ;
 return 16 * CYCLE_UNIT / 2;
@@ -12792,7 +11944,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4079_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2732;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u32 newv = 0 - src - (GET_XFLG () ? 1 : 0);
@@ -12804,7 +11956,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4079_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s16)(newv)) == 0));
 	SET_NFLG (((uae_s16)(newv)) < 0);
-	put_word (srca, newv);
+	put_word_direct (srca, newv);
 }}}}}}	m68k_incpc (6);
 endlabel2732: ;
 return 20 * CYCLE_UNIT / 2;
@@ -12840,7 +11992,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4090_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2734;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 newv = 0 - src - (GET_XFLG () ? 1 : 0);
@@ -12852,7 +12004,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4090_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s32)(newv)) == 0));
 	SET_NFLG (((uae_s32)(newv)) < 0);
-	put_long (srca, newv);
+	put_long_direct (srca, newv);
 }}}}}}	m68k_incpc (2);
 endlabel2734: ;
 return 20 * CYCLE_UNIT / 2;
@@ -12867,7 +12019,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4098_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2735;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -12880,7 +12032,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4098_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s32)(newv)) == 0));
 	SET_NFLG (((uae_s32)(newv)) < 0);
-	put_long (srca, newv);
+	put_long_direct (srca, newv);
 }}}}}}	m68k_incpc (2);
 endlabel2735: ;
 return 20 * CYCLE_UNIT / 2;
@@ -12896,7 +12048,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40a0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2736;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -12909,7 +12061,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40a0_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s32)(newv)) == 0));
 	SET_NFLG (((uae_s32)(newv)) < 0);
-	put_long (srca, newv);
+	put_long_direct (srca, newv);
 }}}}}}	m68k_incpc (2);
 endlabel2736: ;
 return 22 * CYCLE_UNIT / 2;
@@ -12924,7 +12076,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40a8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2737;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = 0 - src - (GET_XFLG () ? 1 : 0);
@@ -12936,7 +12088,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40a8_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s32)(newv)) == 0));
 	SET_NFLG (((uae_s32)(newv)) < 0);
-	put_long (srca, newv);
+	put_long_direct (srca, newv);
 }}}}}}	m68k_incpc (4);
 endlabel2737: ;
 return 24 * CYCLE_UNIT / 2;
@@ -12952,7 +12104,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40b0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2738;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = 0 - src - (GET_XFLG () ? 1 : 0);
@@ -12964,7 +12116,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40b0_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s32)(newv)) == 0));
 	SET_NFLG (((uae_s32)(newv)) < 0);
-	put_long (srca, newv);
+	put_long_direct (srca, newv);
 }}}}}}	m68k_incpc (4);
 endlabel2738: ;
 return 26 * CYCLE_UNIT / 2;
@@ -12978,7 +12130,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40b8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2739;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = 0 - src - (GET_XFLG () ? 1 : 0);
@@ -12990,7 +12142,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40b8_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s32)(newv)) == 0));
 	SET_NFLG (((uae_s32)(newv)) < 0);
-	put_long (srca, newv);
+	put_long_direct (srca, newv);
 }}}}}}	m68k_incpc (4);
 endlabel2739: ;
 return 24 * CYCLE_UNIT / 2;
@@ -13004,7 +12156,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40b9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2740;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u32 newv = 0 - src - (GET_XFLG () ? 1 : 0);
@@ -13016,7 +12168,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40b9_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s32)(newv)) == 0));
 	SET_NFLG (((uae_s32)(newv)) < 0);
-	put_long (srca, newv);
+	put_long_direct (srca, newv);
 }}}}}}	m68k_incpc (6);
 endlabel2740: ;
 return 28 * CYCLE_UNIT / 2;
@@ -13046,7 +12198,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40d0_11)(uae_u32 opcode)
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	MakeSR ();
-	put_word (srca, regs.sr);
+	put_word_direct (srca, regs.sr);
 }}}	m68k_incpc (2);
 endlabel2742: ;
 return 8 * CYCLE_UNIT / 2;
@@ -13065,7 +12217,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40d8_11)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	MakeSR ();
-	put_word (srca, regs.sr);
+	put_word_direct (srca, regs.sr);
 }}}	m68k_incpc (2);
 endlabel2743: ;
 return 8 * CYCLE_UNIT / 2;
@@ -13085,7 +12237,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40e0_11)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	MakeSR ();
-	put_word (srca, regs.sr);
+	put_word_direct (srca, regs.sr);
 }}}	m68k_incpc (2);
 endlabel2744: ;
 return 10 * CYCLE_UNIT / 2;
@@ -13103,7 +12255,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40e8_11)(uae_u32 opcode)
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	MakeSR ();
-	put_word (srca, regs.sr);
+	put_word_direct (srca, regs.sr);
 }}}	m68k_incpc (4);
 endlabel2745: ;
 return 12 * CYCLE_UNIT / 2;
@@ -13122,7 +12274,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40f0_11)(uae_u32 opcode)
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	MakeSR ();
-	put_word (srca, regs.sr);
+	put_word_direct (srca, regs.sr);
 }}}	m68k_incpc (4);
 endlabel2746: ;
 return 14 * CYCLE_UNIT / 2;
@@ -13139,7 +12291,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40f8_11)(uae_u32 opcode)
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	MakeSR ();
-	put_word (srca, regs.sr);
+	put_word_direct (srca, regs.sr);
 }}}	m68k_incpc (4);
 endlabel2747: ;
 return 12 * CYCLE_UNIT / 2;
@@ -13156,7 +12308,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_40f9_11)(uae_u32 opcode)
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 	MakeSR ();
-	put_word (srca, regs.sr);
+	put_word_direct (srca, regs.sr);
 }}}	m68k_incpc (6);
 endlabel2748: ;
 return 16 * CYCLE_UNIT / 2;
@@ -13196,7 +12348,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4190_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2750;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	m68k_incpc (2);
 	if (dst > src) {
@@ -13225,7 +12377,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4198_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2751;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	m68k_incpc (2);
@@ -13256,7 +12408,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_41a0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2752;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	m68k_incpc (2);
@@ -13286,7 +12438,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_41a8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2753;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	m68k_incpc (4);
 	if (dst > src) {
@@ -13316,7 +12468,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_41b0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2754;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	m68k_incpc (4);
 	if (dst > src) {
@@ -13344,7 +12496,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_41b8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2755;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	m68k_incpc (4);
 	if (dst > src) {
@@ -13372,7 +12524,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_41b9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2756;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	m68k_incpc (6);
 	if (dst > src) {
@@ -13401,7 +12553,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_41ba_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2757;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	m68k_incpc (4);
 	if (dst > src) {
@@ -13432,7 +12584,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_41bb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2758;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	m68k_incpc (4);
 	if (dst > src) {
@@ -13573,9 +12725,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4200_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((0) & 0xff);
 }}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -13586,13 +12736,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_4210_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
-	put_byte (srca, 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
+	put_byte_direct (srca, 0);
 }}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -13602,14 +12750,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4218_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
-	put_byte (srca, 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
+	put_byte_direct (srca, 0);
 }}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -13620,14 +12766,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4220_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
-	put_byte (srca, 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
+	put_byte_direct (srca, 0);
 }}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -13637,13 +12781,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_4228_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
-	put_byte (srca, 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
+	put_byte_direct (srca, 0);
 }}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -13654,13 +12796,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_4230_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
-	put_byte (srca, 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
+	put_byte_direct (srca, 0);
 }}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -13669,13 +12809,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4238_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
-	put_byte (srca, 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
+	put_byte_direct (srca, 0);
 }}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -13684,13 +12822,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4239_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
-	put_byte (srca, 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
+	put_byte_direct (srca, 0);
 }}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -13702,9 +12838,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4240_11)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((0) & 0xffff);
 }}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -13719,13 +12853,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_4250_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2776;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
-	put_word (srca, 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
+	put_word_direct (srca, 0);
 }}}}	m68k_incpc (2);
 endlabel2776: ;
 return 12 * CYCLE_UNIT / 2;
@@ -13740,14 +12872,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4258_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2777;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
-	put_word (srca, 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
+	put_word_direct (srca, 0);
 }}}}	m68k_incpc (2);
 endlabel2777: ;
 return 12 * CYCLE_UNIT / 2;
@@ -13763,14 +12893,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4260_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2778;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
-	put_word (srca, 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
+	put_word_direct (srca, 0);
 }}}}	m68k_incpc (2);
 endlabel2778: ;
 return 14 * CYCLE_UNIT / 2;
@@ -13785,13 +12913,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_4268_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2779;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
-	put_word (srca, 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
+	put_word_direct (srca, 0);
 }}}}	m68k_incpc (4);
 endlabel2779: ;
 return 16 * CYCLE_UNIT / 2;
@@ -13807,13 +12933,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_4270_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2780;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
-	put_word (srca, 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
+	put_word_direct (srca, 0);
 }}}}	m68k_incpc (4);
 endlabel2780: ;
 return 18 * CYCLE_UNIT / 2;
@@ -13827,13 +12951,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_4278_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2781;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
-	put_word (srca, 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
+	put_word_direct (srca, 0);
 }}}}	m68k_incpc (4);
 endlabel2781: ;
 return 16 * CYCLE_UNIT / 2;
@@ -13847,13 +12969,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_4279_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2782;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
-	put_word (srca, 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
+	put_word_direct (srca, 0);
 }}}}	m68k_incpc (6);
 endlabel2782: ;
 return 20 * CYCLE_UNIT / 2;
@@ -13866,9 +12986,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4280_11)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (0);
 }}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -13883,13 +13001,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_4290_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2784;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
-	put_long (srca, 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
+	put_long_direct (srca, 0);
 }}}}	m68k_incpc (2);
 endlabel2784: ;
 return 20 * CYCLE_UNIT / 2;
@@ -13904,14 +13020,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4298_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2785;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
-	put_long (srca, 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
+	put_long_direct (srca, 0);
 }}}}	m68k_incpc (2);
 endlabel2785: ;
 return 20 * CYCLE_UNIT / 2;
@@ -13927,14 +13041,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_42a0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2786;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
-	put_long (srca, 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
+	put_long_direct (srca, 0);
 }}}}	m68k_incpc (2);
 endlabel2786: ;
 return 22 * CYCLE_UNIT / 2;
@@ -13949,13 +13061,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_42a8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2787;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
-	put_long (srca, 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
+	put_long_direct (srca, 0);
 }}}}	m68k_incpc (4);
 endlabel2787: ;
 return 24 * CYCLE_UNIT / 2;
@@ -13971,13 +13081,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_42b0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2788;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
-	put_long (srca, 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
+	put_long_direct (srca, 0);
 }}}}	m68k_incpc (4);
 endlabel2788: ;
 return 26 * CYCLE_UNIT / 2;
@@ -13991,13 +13099,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_42b8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2789;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
-	put_long (srca, 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
+	put_long_direct (srca, 0);
 }}}}	m68k_incpc (4);
 endlabel2789: ;
 return 24 * CYCLE_UNIT / 2;
@@ -14011,13 +13117,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_42b9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2790;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
-	put_long (srca, 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
+	put_long_direct (srca, 0);
 }}}}	m68k_incpc (6);
 endlabel2790: ;
 return 28 * CYCLE_UNIT / 2;
@@ -14037,11 +13141,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4400_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -14052,19 +13154,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_4410_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (srca, dst);
+	put_byte_direct (srca, dst);
 }}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -14074,7 +13174,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4418_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -14082,12 +13182,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4418_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (srca, dst);
+	put_byte_direct (srca, dst);
 }}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -14098,7 +13196,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4420_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -14106,12 +13204,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4420_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (srca, dst);
+	put_byte_direct (srca, dst);
 }}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -14121,19 +13217,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_4428_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (srca, dst);
+	put_byte_direct (srca, dst);
 }}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -14144,19 +13238,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_4430_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (srca, dst);
+	put_byte_direct (srca, dst);
 }}}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -14165,19 +13257,17 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4438_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (srca, dst);
+	put_byte_direct (srca, dst);
 }}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -14186,19 +13276,17 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4439_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (srca, dst);
+	put_byte_direct (srca, dst);
 }}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -14214,11 +13302,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4440_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -14233,19 +13319,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_4450_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2800;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (srca, dst);
+	put_word_direct (srca, dst);
 }}}}}}}	m68k_incpc (2);
 endlabel2800: ;
 return 12 * CYCLE_UNIT / 2;
@@ -14260,7 +13344,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4458_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2801;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -14268,12 +13352,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4458_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (srca, dst);
+	put_word_direct (srca, dst);
 }}}}}}}	m68k_incpc (2);
 endlabel2801: ;
 return 12 * CYCLE_UNIT / 2;
@@ -14289,7 +13371,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4460_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2802;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -14297,12 +13379,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4460_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (srca, dst);
+	put_word_direct (srca, dst);
 }}}}}}}	m68k_incpc (2);
 endlabel2802: ;
 return 14 * CYCLE_UNIT / 2;
@@ -14317,19 +13397,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_4468_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2803;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (srca, dst);
+	put_word_direct (srca, dst);
 }}}}}}}	m68k_incpc (4);
 endlabel2803: ;
 return 16 * CYCLE_UNIT / 2;
@@ -14345,19 +13423,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_4470_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2804;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (srca, dst);
+	put_word_direct (srca, dst);
 }}}}}}}	m68k_incpc (4);
 endlabel2804: ;
 return 18 * CYCLE_UNIT / 2;
@@ -14371,19 +13447,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_4478_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2805;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (srca, dst);
+	put_word_direct (srca, dst);
 }}}}}}}	m68k_incpc (4);
 endlabel2805: ;
 return 16 * CYCLE_UNIT / 2;
@@ -14397,19 +13471,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_4479_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2806;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (srca, dst);
+	put_word_direct (srca, dst);
 }}}}}}}	m68k_incpc (6);
 endlabel2806: ;
 return 20 * CYCLE_UNIT / 2;
@@ -14426,11 +13498,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4480_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (dst);
 }}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -14445,19 +13515,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_4490_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2808;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (srca, dst);
+	put_long_direct (srca, dst);
 }}}}}}}	m68k_incpc (2);
 endlabel2808: ;
 return 20 * CYCLE_UNIT / 2;
@@ -14472,7 +13540,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4498_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2809;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -14480,12 +13548,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4498_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (srca, dst);
+	put_long_direct (srca, dst);
 }}}}}}}	m68k_incpc (2);
 endlabel2809: ;
 return 20 * CYCLE_UNIT / 2;
@@ -14501,7 +13567,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_44a0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2810;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -14509,12 +13575,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_44a0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (srca, dst);
+	put_long_direct (srca, dst);
 }}}}}}}	m68k_incpc (2);
 endlabel2810: ;
 return 22 * CYCLE_UNIT / 2;
@@ -14529,19 +13593,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_44a8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2811;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (srca, dst);
+	put_long_direct (srca, dst);
 }}}}}}}	m68k_incpc (4);
 endlabel2811: ;
 return 24 * CYCLE_UNIT / 2;
@@ -14557,19 +13619,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_44b0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2812;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (srca, dst);
+	put_long_direct (srca, dst);
 }}}}}}}	m68k_incpc (4);
 endlabel2812: ;
 return 26 * CYCLE_UNIT / 2;
@@ -14583,19 +13643,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_44b8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2813;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (srca, dst);
+	put_long_direct (srca, dst);
 }}}}}}}	m68k_incpc (4);
 endlabel2813: ;
 return 24 * CYCLE_UNIT / 2;
@@ -14609,19 +13667,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_44b9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2814;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (srca, dst);
+	put_long_direct (srca, dst);
 }}}}}}}	m68k_incpc (6);
 endlabel2814: ;
 return 28 * CYCLE_UNIT / 2;
@@ -14652,7 +13708,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_44d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2816;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	get_wordi (4);
 	MakeSR ();
 	regs.sr &= 0xFF00;
@@ -14674,7 +13730,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_44d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2817;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 	get_wordi (4);
 	MakeSR ();
@@ -14698,7 +13754,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_44e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2818;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	get_wordi (4);
 	MakeSR ();
@@ -14721,7 +13777,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_44e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2819;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	get_wordi (6);
 	MakeSR ();
 	regs.sr &= 0xFF00;
@@ -14744,7 +13800,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_44f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2820;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	get_wordi (6);
 	MakeSR ();
 	regs.sr &= 0xFF00;
@@ -14765,7 +13821,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_44f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2821;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	get_wordi (6);
 	MakeSR ();
 	regs.sr &= 0xFF00;
@@ -14786,7 +13842,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_44f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2822;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	get_wordi (8);
 	MakeSR ();
 	regs.sr &= 0xFF00;
@@ -14808,7 +13864,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_44fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2823;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	get_wordi (6);
 	MakeSR ();
 	regs.sr &= 0xFF00;
@@ -14832,7 +13888,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_44fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2824;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	get_wordi (6);
 	MakeSR ();
 	regs.sr &= 0xFF00;
@@ -14868,9 +13924,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4600_11)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -14881,14 +13935,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4610_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
-	put_byte (srca, dst);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
+	put_byte_direct (srca, dst);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -14898,15 +13950,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_4618_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
-	put_byte (srca, dst);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
+	put_byte_direct (srca, dst);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -14917,15 +13967,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_4620_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
-	put_byte (srca, dst);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
+	put_byte_direct (srca, dst);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -14935,14 +13983,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4628_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
-	put_byte (srca, dst);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
+	put_byte_direct (srca, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -14953,14 +13999,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4630_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
-	put_byte (srca, dst);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
+	put_byte_direct (srca, dst);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -14969,14 +14013,12 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4638_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
-	put_byte (srca, dst);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
+	put_byte_direct (srca, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -14985,14 +14027,12 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4639_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
-	put_byte (srca, dst);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
+	put_byte_direct (srca, dst);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -15005,9 +14045,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4640_11)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -15022,14 +14060,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4650_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2835;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
-	put_word (srca, dst);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
+	put_word_direct (srca, dst);
 }}}}}	m68k_incpc (2);
 endlabel2835: ;
 return 12 * CYCLE_UNIT / 2;
@@ -15044,15 +14080,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_4658_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2836;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
-	put_word (srca, dst);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
+	put_word_direct (srca, dst);
 }}}}}	m68k_incpc (2);
 endlabel2836: ;
 return 12 * CYCLE_UNIT / 2;
@@ -15068,15 +14102,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_4660_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2837;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
-	put_word (srca, dst);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
+	put_word_direct (srca, dst);
 }}}}}	m68k_incpc (2);
 endlabel2837: ;
 return 14 * CYCLE_UNIT / 2;
@@ -15091,14 +14123,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4668_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2838;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
-	put_word (srca, dst);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
+	put_word_direct (srca, dst);
 }}}}}	m68k_incpc (4);
 endlabel2838: ;
 return 16 * CYCLE_UNIT / 2;
@@ -15114,14 +14144,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4670_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2839;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
-	put_word (srca, dst);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
+	put_word_direct (srca, dst);
 }}}}}	m68k_incpc (4);
 endlabel2839: ;
 return 18 * CYCLE_UNIT / 2;
@@ -15135,14 +14163,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4678_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2840;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
-	put_word (srca, dst);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
+	put_word_direct (srca, dst);
 }}}}}	m68k_incpc (4);
 endlabel2840: ;
 return 16 * CYCLE_UNIT / 2;
@@ -15156,14 +14182,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4679_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2841;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
-	put_word (srca, dst);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
+	put_word_direct (srca, dst);
 }}}}}	m68k_incpc (6);
 endlabel2841: ;
 return 20 * CYCLE_UNIT / 2;
@@ -15177,9 +14201,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4680_11)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -15194,14 +14216,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4690_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2843;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
-	put_long (srca, dst);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
+	put_long_direct (srca, dst);
 }}}}}	m68k_incpc (2);
 endlabel2843: ;
 return 20 * CYCLE_UNIT / 2;
@@ -15216,15 +14236,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_4698_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2844;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
-	put_long (srca, dst);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
+	put_long_direct (srca, dst);
 }}}}}	m68k_incpc (2);
 endlabel2844: ;
 return 20 * CYCLE_UNIT / 2;
@@ -15240,15 +14258,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_46a0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2845;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
-	put_long (srca, dst);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
+	put_long_direct (srca, dst);
 }}}}}	m68k_incpc (2);
 endlabel2845: ;
 return 22 * CYCLE_UNIT / 2;
@@ -15263,14 +14279,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_46a8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2846;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
-	put_long (srca, dst);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
+	put_long_direct (srca, dst);
 }}}}}	m68k_incpc (4);
 endlabel2846: ;
 return 24 * CYCLE_UNIT / 2;
@@ -15286,14 +14300,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_46b0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2847;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
-	put_long (srca, dst);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
+	put_long_direct (srca, dst);
 }}}}}	m68k_incpc (4);
 endlabel2847: ;
 return 26 * CYCLE_UNIT / 2;
@@ -15307,14 +14319,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_46b8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2848;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
-	put_long (srca, dst);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
+	put_long_direct (srca, dst);
 }}}}}	m68k_incpc (4);
 endlabel2848: ;
 return 24 * CYCLE_UNIT / 2;
@@ -15328,14 +14338,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_46b9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2849;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
-	put_long (srca, dst);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
+	put_long_direct (srca, dst);
 }}}}}	m68k_incpc (6);
 endlabel2849: ;
 return 28 * CYCLE_UNIT / 2;
@@ -15367,7 +14375,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2851;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	get_wordi (4);
 	regs.sr = src;
 	MakeFromSR ();
@@ -15388,7 +14396,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2852;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 	get_wordi (4);
 	regs.sr = src;
@@ -15411,7 +14419,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2853;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	get_wordi (4);
 	regs.sr = src;
@@ -15433,7 +14441,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2854;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	get_wordi (6);
 	regs.sr = src;
 	MakeFromSR ();
@@ -15455,7 +14463,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2855;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	get_wordi (6);
 	regs.sr = src;
 	MakeFromSR ();
@@ -15475,7 +14483,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2856;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	get_wordi (6);
 	regs.sr = src;
 	MakeFromSR ();
@@ -15495,7 +14503,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2857;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	get_wordi (8);
 	regs.sr = src;
 	MakeFromSR ();
@@ -15516,7 +14524,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2858;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	get_wordi (6);
 	regs.sr = src;
 	MakeFromSR ();
@@ -15539,7 +14547,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2859;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	get_wordi (6);
 	regs.sr = src;
 	MakeFromSR ();
@@ -15593,7 +14601,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4810_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG () ? 1 : 0);
@@ -15607,7 +14615,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4810_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte (srca, newv);
+	put_byte_direct (srca, newv);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -15617,7 +14625,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4818_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -15632,7 +14640,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4818_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte (srca, newv);
+	put_byte_direct (srca, newv);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -15643,7 +14651,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4820_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -15658,7 +14666,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4820_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte (srca, newv);
+	put_byte_direct (srca, newv);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -15668,7 +14676,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4828_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG () ? 1 : 0);
@@ -15682,7 +14690,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4828_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte (srca, newv);
+	put_byte_direct (srca, newv);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -15693,7 +14701,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4830_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG () ? 1 : 0);
@@ -15707,7 +14715,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4830_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte (srca, newv);
+	put_byte_direct (srca, newv);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -15716,7 +14724,7 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4838_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG () ? 1 : 0);
@@ -15730,7 +14738,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4838_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte (srca, newv);
+	put_byte_direct (srca, newv);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -15739,7 +14747,7 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4839_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG () ? 1 : 0);
@@ -15753,7 +14761,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4839_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte (srca, newv);
+	put_byte_direct (srca, newv);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -15766,9 +14774,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4840_11)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -15788,7 +14794,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4850_11)(uae_u32 opcode)
 {	m68k_areg (regs, 7) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_long (dsta, srca);
+	put_long_direct (dsta, srca);
 }}}}	m68k_incpc (2);
 endlabel2870: ;
 return 12 * CYCLE_UNIT / 2;
@@ -15809,7 +14815,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4868_11)(uae_u32 opcode)
 {	m68k_areg (regs, 7) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_long (dsta, srca);
+	put_long_direct (dsta, srca);
 }}}}	m68k_incpc (4);
 endlabel2871: ;
 return 16 * CYCLE_UNIT / 2;
@@ -15831,7 +14837,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4870_11)(uae_u32 opcode)
 {	m68k_areg (regs, 7) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_long (dsta, srca);
+	put_long_direct (dsta, srca);
 }}}}	m68k_incpc (4);
 endlabel2872: ;
 return 16 * CYCLE_UNIT / 2;
@@ -15849,7 +14855,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4878_11)(uae_u32 opcode)
 		goto endlabel2873;
 	}
 {	m68k_areg (regs, 7) = dsta;
-	put_long (dsta, srca);
+	put_long_direct (dsta, srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 }}}}	m68k_incpc (4);
@@ -15869,7 +14875,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4879_11)(uae_u32 opcode)
 		goto endlabel2874;
 	}
 {	m68k_areg (regs, 7) = dsta;
-	put_long (dsta, srca);
+	put_long_direct (dsta, srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -15892,7 +14898,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_487a_11)(uae_u32 opcode)
 {	m68k_areg (regs, 7) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_long (dsta, srca);
+	put_long_direct (dsta, srca);
 }}}}	m68k_incpc (4);
 endlabel2875: ;
 return 16 * CYCLE_UNIT / 2;
@@ -15915,7 +14921,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_487b_11)(uae_u32 opcode)
 {	m68k_areg (regs, 7) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_long (dsta, srca);
+	put_long_direct (dsta, srca);
 }}}}	m68k_incpc (4);
 endlabel2876: ;
 return 16 * CYCLE_UNIT / 2;
@@ -15929,9 +14935,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4880_11)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u16 dst = (uae_s16)(uae_s8)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -15949,8 +14953,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4890_11)(uae_u32 opcode)
 		goto endlabel2878;
 	}
 {{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
-	while (dmask) { put_word (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
-	while (amask) { put_word (srca, m68k_areg (regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+	while (dmask) { put_word_direct (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { put_word_direct (srca, m68k_areg (regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 }}}}	m68k_incpc (4);
@@ -15975,10 +14979,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_48a0_11)(uae_u32 opcode)
 	while (amask) {
 		srca -= 2;
 		if (type) m68k_areg (regs, dstreg) = srca;
-		put_word (srca, m68k_areg (regs, movem_index2[amask]));
+		put_word_direct (srca, m68k_areg (regs, movem_index2[amask]));
 		amask = movem_next[amask];
 	}
-	while (dmask) { srca -= 2; put_word (srca, m68k_dreg (regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
+	while (dmask) { srca -= 2; put_word_direct (srca, m68k_dreg (regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
 	m68k_areg (regs, dstreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -15999,8 +15003,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_48a8_11)(uae_u32 opcode)
 		goto endlabel2880;
 	}
 {{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
-	while (dmask) { put_word (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
-	while (amask) { put_word (srca, m68k_areg (regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+	while (dmask) { put_word_direct (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { put_word_direct (srca, m68k_areg (regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -16021,8 +15025,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_48b0_11)(uae_u32 opcode)
 		goto endlabel2881;
 	}
 {{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
-	while (dmask) { put_word (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
-	while (amask) { put_word (srca, m68k_areg (regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+	while (dmask) { put_word_direct (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { put_word_direct (srca, m68k_areg (regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -16041,8 +15045,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_48b8_11)(uae_u32 opcode)
 		goto endlabel2882;
 	}
 {{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
-	while (dmask) { put_word (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
-	while (amask) { put_word (srca, m68k_areg (regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+	while (dmask) { put_word_direct (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { put_word_direct (srca, m68k_areg (regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -16061,8 +15065,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_48b9_11)(uae_u32 opcode)
 		goto endlabel2883;
 	}
 {{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
-	while (dmask) { put_word (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
-	while (amask) { put_word (srca, m68k_areg (regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+	while (dmask) { put_word_direct (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { put_word_direct (srca, m68k_areg (regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 }}}}	m68k_incpc (8);
@@ -16078,9 +15082,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_48c0_11)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 dst = (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -16098,8 +15100,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_48d0_11)(uae_u32 opcode)
 		goto endlabel2885;
 	}
 {{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
-	while (dmask) { put_long (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
-	while (amask) { put_long (srca, m68k_areg (regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+	while (dmask) { put_long_direct (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { put_long_direct (srca, m68k_areg (regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 }}}}	m68k_incpc (4);
@@ -16124,10 +15126,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_48e0_11)(uae_u32 opcode)
 	while (amask) {
 		srca -= 4;
 		if (type) m68k_areg (regs, dstreg) = srca;
-		put_long (srca, m68k_areg (regs, movem_index2[amask]));
+		put_long_direct (srca, m68k_areg (regs, movem_index2[amask]));
 		amask = movem_next[amask];
 	}
-	while (dmask) { srca -= 4; put_long (srca, m68k_dreg (regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
+	while (dmask) { srca -= 4; put_long_direct (srca, m68k_dreg (regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
 	m68k_areg (regs, dstreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -16148,8 +15150,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_48e8_11)(uae_u32 opcode)
 		goto endlabel2887;
 	}
 {{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
-	while (dmask) { put_long (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
-	while (amask) { put_long (srca, m68k_areg (regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+	while (dmask) { put_long_direct (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { put_long_direct (srca, m68k_areg (regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -16170,8 +15172,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_48f0_11)(uae_u32 opcode)
 		goto endlabel2888;
 	}
 {{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
-	while (dmask) { put_long (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
-	while (amask) { put_long (srca, m68k_areg (regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+	while (dmask) { put_long_direct (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { put_long_direct (srca, m68k_areg (regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -16190,8 +15192,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_48f8_11)(uae_u32 opcode)
 		goto endlabel2889;
 	}
 {{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
-	while (dmask) { put_long (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
-	while (amask) { put_long (srca, m68k_areg (regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+	while (dmask) { put_long_direct (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { put_long_direct (srca, m68k_areg (regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -16210,8 +15212,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_48f9_11)(uae_u32 opcode)
 		goto endlabel2890;
 	}
 {{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
-	while (dmask) { put_long (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
-	while (amask) { put_long (srca, m68k_areg (regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+	while (dmask) { put_long_direct (srca, m68k_dreg (regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { put_long_direct (srca, m68k_areg (regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 }}}}	m68k_incpc (8);
@@ -16226,9 +15228,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a00_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 } /* 4 (1/0) */
@@ -16238,12 +15238,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a10_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
 } /* 8 (2/0) */
@@ -16253,13 +15251,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a18_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
 } /* 8 (2/0) */
@@ -16270,13 +15266,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a20_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
 } /* 8 (2/0) */
@@ -16286,12 +15280,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a28_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (3/0) */
@@ -16302,12 +15294,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a30_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (4);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (3/0) */
@@ -16316,12 +15306,10 @@ return 14 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4a38_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (3/0) */
@@ -16330,12 +15318,10 @@ return 12 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4a39_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (4/0) */
@@ -16346,9 +15332,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a3c_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 } /* 8 (2/0) */
@@ -16360,9 +15344,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a40_11)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 } /* 4 (1/0) */
@@ -16376,12 +15358,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a50_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2901;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (2);
 endlabel2901: ;
 return 8 * CYCLE_UNIT / 2;
@@ -16396,13 +15376,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a58_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2902;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (2);
 endlabel2902: ;
 return 8 * CYCLE_UNIT / 2;
@@ -16418,13 +15396,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a60_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2903;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (2);
 endlabel2903: ;
 return 10 * CYCLE_UNIT / 2;
@@ -16439,12 +15415,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a68_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2904;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (4);
 endlabel2904: ;
 return 12 * CYCLE_UNIT / 2;
@@ -16460,12 +15434,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a70_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2905;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (4);
 endlabel2905: ;
 return 14 * CYCLE_UNIT / 2;
@@ -16479,12 +15451,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a78_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2906;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (4);
 endlabel2906: ;
 return 12 * CYCLE_UNIT / 2;
@@ -16498,12 +15468,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a79_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2907;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (6);
 endlabel2907: ;
 return 16 * CYCLE_UNIT / 2;
@@ -16515,9 +15483,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a7c_11)(uae_u32 opcode)
 {{	uae_s16 src = get_word_prefetch (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
 } /* 8 (2/0) */
@@ -16529,9 +15495,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a80_11)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 } /* 4 (1/0) */
@@ -16545,12 +15509,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a90_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2910;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (2);
 endlabel2910: ;
 return 12 * CYCLE_UNIT / 2;
@@ -16565,13 +15527,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a98_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2911;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (2);
 endlabel2911: ;
 return 12 * CYCLE_UNIT / 2;
@@ -16587,13 +15547,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_4aa0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2912;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (2);
 endlabel2912: ;
 return 14 * CYCLE_UNIT / 2;
@@ -16608,12 +15566,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4aa8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2913;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (4);
 endlabel2913: ;
 return 16 * CYCLE_UNIT / 2;
@@ -16629,12 +15585,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ab0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2914;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (4);
 endlabel2914: ;
 return 18 * CYCLE_UNIT / 2;
@@ -16648,12 +15602,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ab8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2915;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (4);
 endlabel2915: ;
 return 16 * CYCLE_UNIT / 2;
@@ -16667,12 +15619,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ab9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2916;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (6);
 endlabel2916: ;
 return 20 * CYCLE_UNIT / 2;
@@ -16684,9 +15634,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4abc_11)(uae_u32 opcode)
 {{	uae_s32 src = get_long_prefetch (4);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (3/0) */
@@ -16696,9 +15644,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ac0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	src |= 0x80;
@@ -16712,14 +15658,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ad0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	uae_s8 src = get_byte_direct (srca);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	src |= 0x80;
-	put_byte (srca, src);
+	put_byte_direct (srca, src);
 }}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -16729,15 +15673,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ad8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	src |= 0x80;
-	put_byte (srca, src);
+	put_byte_direct (srca, src);
 }}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -16748,15 +15690,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ae0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	src |= 0x80;
-	put_byte (srca, src);
+	put_byte_direct (srca, src);
 }}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -16766,14 +15706,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ae8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	uae_s8 src = get_byte_direct (srca);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	src |= 0x80;
-	put_byte (srca, src);
+	put_byte_direct (srca, src);
 }}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -16784,14 +15722,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_4af0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	uae_s8 src = get_byte_direct (srca);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	src |= 0x80;
-	put_byte (srca, src);
+	put_byte_direct (srca, src);
 }}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -16800,14 +15736,12 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4af8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	uae_s8 src = get_byte_direct (srca);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	src |= 0x80;
-	put_byte (srca, src);
+	put_byte_direct (srca, src);
 }}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -16816,14 +15750,12 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4af9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	uae_s8 src = get_byte_direct (srca);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 	src |= 0x80;
-	put_byte (srca, src);
+	put_byte_direct (srca, src);
 }}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -16840,8 +15772,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4c90_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2926;
 	}
-{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word (srca); srca += 2; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg (regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word (srca); srca += 2; amask = movem_next[amask]; }
+{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word_direct (srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg (regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word_direct (srca); srca += 2; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 }}}}	m68k_incpc (4);
@@ -16861,8 +15793,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4c98_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2927;
 	}
-{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word (srca); srca += 2; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg (regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word (srca); srca += 2; amask = movem_next[amask]; }
+{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word_direct (srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg (regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word_direct (srca); srca += 2; amask = movem_next[amask]; }
 	m68k_areg (regs, dstreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -16883,8 +15815,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ca8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2928;
 	}
-{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word (srca); srca += 2; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg (regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word (srca); srca += 2; amask = movem_next[amask]; }
+{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word_direct (srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg (regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word_direct (srca); srca += 2; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -16905,8 +15837,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4cb0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2929;
 	}
-{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word (srca); srca += 2; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg (regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word (srca); srca += 2; amask = movem_next[amask]; }
+{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word_direct (srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg (regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word_direct (srca); srca += 2; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -16925,8 +15857,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4cb8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2930;
 	}
-{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word (srca); srca += 2; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg (regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word (srca); srca += 2; amask = movem_next[amask]; }
+{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word_direct (srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg (regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word_direct (srca); srca += 2; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -16945,8 +15877,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4cb9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2931;
 	}
-{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word (srca); srca += 2; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg (regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word (srca); srca += 2; amask = movem_next[amask]; }
+{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word_direct (srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg (regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word_direct (srca); srca += 2; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 }}}}	m68k_incpc (8);
@@ -16967,8 +15899,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4cba_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2932;
 	}
-{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word (srca); srca += 2; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg (regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word (srca); srca += 2; amask = movem_next[amask]; }
+{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word_direct (srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg (regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word_direct (srca); srca += 2; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -16991,8 +15923,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4cbb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2933;
 	}
-{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word (srca); srca += 2; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg (regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word (srca); srca += 2; amask = movem_next[amask]; }
+{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word_direct (srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg (regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word_direct (srca); srca += 2; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -17012,8 +15944,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4cd0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2934;
 	}
-{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = get_long (srca); srca += 4; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg (regs, movem_index1[amask]) = get_long (srca); srca += 4; amask = movem_next[amask]; }
+{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = get_long_direct (srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg (regs, movem_index1[amask]) = get_long_direct (srca); srca += 4; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 }}}}	m68k_incpc (4);
@@ -17033,8 +15965,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4cd8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2935;
 	}
-{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = get_long (srca); srca += 4; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg (regs, movem_index1[amask]) = get_long (srca); srca += 4; amask = movem_next[amask]; }
+{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = get_long_direct (srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg (regs, movem_index1[amask]) = get_long_direct (srca); srca += 4; amask = movem_next[amask]; }
 	m68k_areg (regs, dstreg) = srca;
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -17055,8 +15987,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ce8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2936;
 	}
-{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = get_long (srca); srca += 4; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg (regs, movem_index1[amask]) = get_long (srca); srca += 4; amask = movem_next[amask]; }
+{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = get_long_direct (srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg (regs, movem_index1[amask]) = get_long_direct (srca); srca += 4; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -17077,8 +16009,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4cf0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2937;
 	}
-{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = get_long (srca); srca += 4; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg (regs, movem_index1[amask]) = get_long (srca); srca += 4; amask = movem_next[amask]; }
+{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = get_long_direct (srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg (regs, movem_index1[amask]) = get_long_direct (srca); srca += 4; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -17097,8 +16029,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4cf8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2938;
 	}
-{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = get_long (srca); srca += 4; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg (regs, movem_index1[amask]) = get_long (srca); srca += 4; amask = movem_next[amask]; }
+{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = get_long_direct (srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg (regs, movem_index1[amask]) = get_long_direct (srca); srca += 4; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -17117,8 +16049,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4cf9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2939;
 	}
-{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = get_long (srca); srca += 4; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg (regs, movem_index1[amask]) = get_long (srca); srca += 4; amask = movem_next[amask]; }
+{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = get_long_direct (srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg (regs, movem_index1[amask]) = get_long_direct (srca); srca += 4; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (10);
 }}}}	m68k_incpc (8);
@@ -17139,8 +16071,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4cfa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2940;
 	}
-{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = get_long (srca); srca += 4; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg (regs, movem_index1[amask]) = get_long (srca); srca += 4; amask = movem_next[amask]; }
+{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = get_long_direct (srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg (regs, movem_index1[amask]) = get_long_direct (srca); srca += 4; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -17163,8 +16095,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_4cfb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel2941;
 	}
-{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = get_long (srca); srca += 4; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg (regs, movem_index1[amask]) = get_long (srca); srca += 4; amask = movem_next[amask]; }
+{{	while (dmask) { m68k_dreg (regs, movem_index1[dmask]) = get_long_direct (srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg (regs, movem_index1[amask]) = get_long_direct (srca); srca += 4; amask = movem_next[amask]; }
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 }}}}	m68k_incpc (6);
@@ -17195,7 +16127,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4e50_11)(uae_u32 opcode)
 {	m68k_areg (regs, 7) = olda;
 {	uae_s32 src = m68k_areg (regs, srcreg);
 {	uae_s16 offs = get_word_prefetch (4);
-	put_long (olda, src);
+	put_long_direct (olda, src);
 	m68k_areg (regs, srcreg) = (m68k_areg (regs, 7));
 	m68k_areg (regs, 7) += offs;
 	regs.ir = regs.irc;
@@ -17216,7 +16148,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4e58_11)(uae_u32 opcode)
 		exception3 (opcode, olda);
 		goto endlabel2944;
 	}
-{{	uae_s32 old = get_long (olda);
+{{	uae_s32 old = get_long_direct (olda);
 	m68k_areg (regs, 7) += 4;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -17296,14 +16228,14 @@ uae_u32 REGPARAM2 CPUFUNC(op_4e73_11)(uae_u32 opcode)
 		exception3 (opcode, sra);
 		goto endlabel2950;
 	}
-{{	uae_s16 sr = get_word (sra);
+{{	uae_s16 sr = get_word_direct (sra);
 	m68k_areg (regs, 7) += 2;
 {	uaecptr pca = m68k_areg (regs, 7);
 	if (pca & 1) {
 		exception3 (opcode, pca);
 		goto endlabel2950;
 	}
-{{	uae_s32 pc = get_long (pca);
+{{	uae_s32 pc = get_long_direct (pca);
 	m68k_areg (regs, 7) += 4;
 	regs.sr = sr;
 	m68k_setpc (pc);
@@ -17323,7 +16255,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4e74_11)(uae_u32 opcode)
 		exception3 (opcode, pca);
 		goto endlabel2951;
 	}
-{{	uae_s32 pc = get_long (pca);
+{{	uae_s32 pc = get_long_direct (pca);
 	m68k_areg (regs, 7) += 4;
 {	uae_s16 offs = get_word_prefetch (4);
 	m68k_areg (regs, 7) += offs;
@@ -17383,14 +16315,14 @@ uae_u32 REGPARAM2 CPUFUNC(op_4e77_11)(uae_u32 opcode)
 		exception3 (opcode, sra);
 		goto endlabel2954;
 	}
-{{	uae_s16 sr = get_word (sra);
+{{	uae_s16 sr = get_word_direct (sra);
 	m68k_areg (regs, 7) += 2;
 {	uaecptr pca = m68k_areg (regs, 7);
 	if (pca & 1) {
 		exception3 (opcode, pca);
 		goto endlabel2954;
 	}
-{{	uae_s32 pc = get_long (pca);
+{{	uae_s32 pc = get_long_direct (pca);
 	m68k_areg (regs, 7) += 4;
 	regs.sr &= 0xFF00; sr &= 0xFF;
 	regs.sr |= sr;
@@ -17421,7 +16353,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4e90_11)(uae_u32 opcode)
 	m68k_setpc (srca);
 	get_word_prefetch (0);
 	m68k_areg (regs, 7) -= 4;
-	put_long (m68k_areg (regs, 7), oldpc);
+	put_long_direct (m68k_areg (regs, 7), oldpc);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
 }}}endlabel2955: ;
@@ -17441,7 +16373,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ea8_11)(uae_u32 opcode)
 	m68k_setpc (srca);
 	get_word_prefetch (0);
 	m68k_areg (regs, 7) -= 4;
-	put_long (m68k_areg (regs, 7), oldpc);
+	put_long_direct (m68k_areg (regs, 7), oldpc);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
 }}}endlabel2956: ;
@@ -17462,7 +16394,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4eb0_11)(uae_u32 opcode)
 	m68k_setpc (srca);
 	get_word_prefetch (0);
 	m68k_areg (regs, 7) -= 4;
-	put_long (m68k_areg (regs, 7), oldpc);
+	put_long_direct (m68k_areg (regs, 7), oldpc);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
 }}}endlabel2957: ;
@@ -17481,7 +16413,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4eb8_11)(uae_u32 opcode)
 	m68k_setpc (srca);
 	get_word_prefetch (0);
 	m68k_areg (regs, 7) -= 4;
-	put_long (m68k_areg (regs, 7), oldpc);
+	put_long_direct (m68k_areg (regs, 7), oldpc);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
 }}}endlabel2958: ;
@@ -17502,7 +16434,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4eb9_11)(uae_u32 opcode)
 	m68k_setpc (srca);
 	get_word_prefetch (0);
 	m68k_areg (regs, 7) -= 4;
-	put_long (m68k_areg (regs, 7), oldpc);
+	put_long_direct (m68k_areg (regs, 7), oldpc);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
 }}}endlabel2959: ;
@@ -17522,7 +16454,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4eba_11)(uae_u32 opcode)
 	m68k_setpc (srca);
 	get_word_prefetch (0);
 	m68k_areg (regs, 7) -= 4;
-	put_long (m68k_areg (regs, 7), oldpc);
+	put_long_direct (m68k_areg (regs, 7), oldpc);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
 }}}endlabel2960: ;
@@ -17544,7 +16476,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ebb_11)(uae_u32 opcode)
 	m68k_setpc (srca);
 	get_word_prefetch (0);
 	m68k_areg (regs, 7) -= 4;
-	put_long (m68k_areg (regs, 7), oldpc);
+	put_long_direct (m68k_areg (regs, 7), oldpc);
 	regs.ir = regs.irc;
 	get_word_prefetch (2);
 }}}endlabel2961: ;
@@ -17686,11 +16618,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5000_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -17703,19 +16633,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5010_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_u32 src = srcreg;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -17727,7 +16655,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_5018_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_u32 src = srcreg;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -17735,12 +16663,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_5018_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -17753,7 +16679,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_5020_11)(uae_u32 opcode)
 {{	uae_u32 src = srcreg;
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -17761,12 +16687,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_5020_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -17778,19 +16702,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5028_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_u32 src = srcreg;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -17803,19 +16725,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5030_11)(uae_u32 opcode)
 {{	uae_u32 src = srcreg;
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -17826,19 +16746,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5038_11)(uae_u32 opcode)
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 {{	uae_u32 src = srcreg;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -17849,19 +16767,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5039_11)(uae_u32 opcode)
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 {{	uae_u32 src = srcreg;
 {	uaecptr dsta = get_long_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -17879,11 +16795,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5040_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -17915,19 +16829,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5050_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2979;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel2979: ;
 return 12 * CYCLE_UNIT / 2;
@@ -17944,7 +16856,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_5058_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2980;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -17952,12 +16864,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_5058_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel2980: ;
 return 12 * CYCLE_UNIT / 2;
@@ -17975,7 +16885,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_5060_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2981;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -17983,12 +16893,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_5060_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel2981: ;
 return 14 * CYCLE_UNIT / 2;
@@ -18005,19 +16913,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5068_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2982;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel2982: ;
 return 16 * CYCLE_UNIT / 2;
@@ -18035,19 +16941,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5070_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2983;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel2983: ;
 return 18 * CYCLE_UNIT / 2;
@@ -18066,19 +16970,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5078_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2984;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel2984: ;
 return 16 * CYCLE_UNIT / 2;
@@ -18094,19 +16996,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5079_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2985;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel2985: ;
 return 20 * CYCLE_UNIT / 2;
@@ -18125,11 +17025,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5080_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -18161,19 +17059,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5090_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2988;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel2988: ;
 return 20 * CYCLE_UNIT / 2;
@@ -18190,7 +17086,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_5098_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2989;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -18198,12 +17094,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_5098_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel2989: ;
 return 20 * CYCLE_UNIT / 2;
@@ -18221,7 +17115,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_50a0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2990;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -18229,12 +17123,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_50a0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel2990: ;
 return 22 * CYCLE_UNIT / 2;
@@ -18251,19 +17143,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_50a8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2991;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel2991: ;
 return 24 * CYCLE_UNIT / 2;
@@ -18281,19 +17171,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_50b0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2992;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel2992: ;
 return 26 * CYCLE_UNIT / 2;
@@ -18309,19 +17197,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_50b8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2993;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel2993: ;
 return 24 * CYCLE_UNIT / 2;
@@ -18337,19 +17223,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_50b9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel2994;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel2994: ;
 return 28 * CYCLE_UNIT / 2;
@@ -18403,11 +17287,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_50d0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (0) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -18417,12 +17301,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_50d8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (0) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -18433,12 +17317,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_50e0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (0) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -18448,11 +17332,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_50e8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (0) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -18463,11 +17347,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_50f0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (0) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -18476,11 +17360,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_50f8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (0) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -18489,11 +17373,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_50f9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	int val = cctrue (0) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -18511,11 +17395,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5100_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -18528,19 +17410,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5110_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_u32 src = srcreg;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -18552,7 +17432,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_5118_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_u32 src = srcreg;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -18560,12 +17440,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_5118_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -18578,7 +17456,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_5120_11)(uae_u32 opcode)
 {{	uae_u32 src = srcreg;
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -18586,12 +17464,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_5120_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -18603,19 +17479,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5128_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_u32 src = srcreg;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -18628,19 +17502,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5130_11)(uae_u32 opcode)
 {{	uae_u32 src = srcreg;
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -18651,19 +17523,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5138_11)(uae_u32 opcode)
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 {{	uae_u32 src = srcreg;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -18674,19 +17544,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5139_11)(uae_u32 opcode)
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 {{	uae_u32 src = srcreg;
 {	uaecptr dsta = get_long_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -18704,11 +17572,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5140_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -18740,19 +17606,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5150_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3014;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3014: ;
 return 12 * CYCLE_UNIT / 2;
@@ -18769,7 +17633,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_5158_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3015;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -18777,12 +17641,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_5158_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3015: ;
 return 12 * CYCLE_UNIT / 2;
@@ -18800,7 +17662,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_5160_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3016;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -18808,12 +17670,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_5160_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3016: ;
 return 14 * CYCLE_UNIT / 2;
@@ -18830,19 +17690,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5168_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3017;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3017: ;
 return 16 * CYCLE_UNIT / 2;
@@ -18860,19 +17718,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5170_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3018;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3018: ;
 return 18 * CYCLE_UNIT / 2;
@@ -18888,19 +17744,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5178_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3019;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3019: ;
 return 16 * CYCLE_UNIT / 2;
@@ -18916,19 +17770,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5179_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3020;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel3020: ;
 return 20 * CYCLE_UNIT / 2;
@@ -18947,11 +17799,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5180_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -18983,19 +17833,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_5190_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3023;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3023: ;
 return 20 * CYCLE_UNIT / 2;
@@ -19012,7 +17860,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_5198_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3024;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -19020,12 +17868,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_5198_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3024: ;
 return 20 * CYCLE_UNIT / 2;
@@ -19043,7 +17889,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_51a0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3025;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -19051,12 +17897,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_51a0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3025: ;
 return 22 * CYCLE_UNIT / 2;
@@ -19073,19 +17917,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_51a8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3026;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3026: ;
 return 24 * CYCLE_UNIT / 2;
@@ -19103,19 +17945,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_51b0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3027;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3027: ;
 return 26 * CYCLE_UNIT / 2;
@@ -19131,19 +17971,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_51b8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3028;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3028: ;
 return 24 * CYCLE_UNIT / 2;
@@ -19159,19 +17997,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_51b9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3029;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel3029: ;
 return 28 * CYCLE_UNIT / 2;
@@ -19225,11 +18061,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_51d0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (1) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19239,12 +18075,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_51d8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (1) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19255,12 +18091,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_51e0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (1) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19270,11 +18106,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_51e8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (1) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -19285,11 +18121,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_51f0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (1) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -19298,11 +18134,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_51f8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (1) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -19311,11 +18147,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_51f9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	int val = cctrue (1) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -19368,11 +18204,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_52d0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (2) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19382,12 +18218,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_52d8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (2) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19398,12 +18234,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_52e0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (2) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19413,11 +18249,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_52e8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (2) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -19428,11 +18264,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_52f0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (2) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -19441,11 +18277,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_52f8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (2) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -19454,11 +18290,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_52f9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	int val = cctrue (2) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -19511,11 +18347,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_53d0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (3) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19525,12 +18361,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_53d8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (3) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19541,12 +18377,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_53e0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (3) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19556,11 +18392,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_53e8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (3) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -19571,11 +18407,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_53f0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (3) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -19584,11 +18420,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_53f8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (3) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -19597,11 +18433,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_53f9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	int val = cctrue (3) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -19654,11 +18490,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_54d0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (4) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19668,12 +18504,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_54d8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (4) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19684,12 +18520,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_54e0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (4) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19699,11 +18535,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_54e8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (4) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -19714,11 +18550,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_54f0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (4) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -19727,11 +18563,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_54f8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (4) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -19740,11 +18576,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_54f9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	int val = cctrue (4) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -19797,11 +18633,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_55d0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (5) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19811,12 +18647,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_55d8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (5) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19827,12 +18663,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_55e0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (5) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19842,11 +18678,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_55e8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (5) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -19857,11 +18693,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_55f0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (5) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -19870,11 +18706,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_55f8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (5) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -19883,11 +18719,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_55f9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	int val = cctrue (5) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -19940,11 +18776,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_56d0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (6) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19954,12 +18790,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_56d8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (6) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19970,12 +18806,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_56e0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (6) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -19985,11 +18821,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_56e8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (6) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20000,11 +18836,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_56f0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (6) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20013,11 +18849,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_56f8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (6) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20026,11 +18862,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_56f9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	int val = cctrue (6) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -20083,11 +18919,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_57d0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (7) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20097,12 +18933,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_57d8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (7) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20113,12 +18949,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_57e0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (7) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20128,11 +18964,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_57e8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (7) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20143,11 +18979,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_57f0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (7) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20156,11 +18992,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_57f8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (7) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20169,11 +19005,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_57f9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	int val = cctrue (7) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -20226,11 +19062,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_58d0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (8) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20240,12 +19076,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_58d8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (8) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20256,12 +19092,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_58e0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (8) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20271,11 +19107,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_58e8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (8) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20286,11 +19122,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_58f0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (8) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20299,11 +19135,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_58f8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (8) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20312,11 +19148,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_58f9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	int val = cctrue (8) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -20369,11 +19205,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_59d0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (9) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20383,12 +19219,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_59d8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (9) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20399,12 +19235,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_59e0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (9) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20414,11 +19250,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_59e8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (9) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20429,11 +19265,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_59f0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (9) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20442,11 +19278,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_59f8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (9) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20455,11 +19291,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_59f9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	int val = cctrue (9) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -20512,11 +19348,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5ad0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (10) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20526,12 +19362,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_5ad8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (10) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20542,12 +19378,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_5ae0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (10) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20557,11 +19393,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5ae8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (10) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20572,11 +19408,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5af0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (10) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20585,11 +19421,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_5af8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (10) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20598,11 +19434,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_5af9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	int val = cctrue (10) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -20655,11 +19491,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5bd0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (11) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20669,12 +19505,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_5bd8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (11) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20685,12 +19521,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_5be0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (11) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20700,11 +19536,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5be8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (11) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20715,11 +19551,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5bf0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (11) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20728,11 +19564,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_5bf8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (11) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20741,11 +19577,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_5bf9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	int val = cctrue (11) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -20798,11 +19634,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5cd0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (12) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20812,12 +19648,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_5cd8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (12) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20828,12 +19664,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_5ce0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (12) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20843,11 +19679,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5ce8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (12) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20858,11 +19694,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5cf0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (12) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20871,11 +19707,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_5cf8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (12) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -20884,11 +19720,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_5cf9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	int val = cctrue (12) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -20941,11 +19777,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5dd0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (13) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20955,12 +19791,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_5dd8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (13) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20971,12 +19807,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_5de0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (13) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -20986,11 +19822,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5de8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (13) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -21001,11 +19837,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5df0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (13) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -21014,11 +19850,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_5df8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (13) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -21027,11 +19863,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_5df9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	int val = cctrue (13) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -21084,11 +19920,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5ed0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (14) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -21098,12 +19934,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_5ed8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (14) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -21114,12 +19950,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_5ee0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (14) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -21129,11 +19965,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5ee8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (14) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -21144,11 +19980,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5ef0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (14) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -21157,11 +19993,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_5ef8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (14) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -21170,11 +20006,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_5ef9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	int val = cctrue (14) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -21227,11 +20063,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5fd0_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (15) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -21241,12 +20077,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_5fd8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (15) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -21257,12 +20093,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_5fe0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	int val = cctrue (15) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -21272,11 +20108,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5fe8_11)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (15) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -21287,11 +20123,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_5ff0_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (15) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -21300,11 +20136,11 @@ return 18 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_5ff8_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	int val = cctrue (15) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -21313,11 +20149,11 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_5ff9_11)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	int val = cctrue (15) ? 0xff : 0;
-	put_byte (srca, val);
+	put_byte_direct (srca, val);
 }}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -22571,9 +21407,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_7000_11)(uae_u32 opcode)
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_u32 src = srcreg;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -22589,9 +21423,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8000_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -22605,12 +21437,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_8010_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -22624,13 +21454,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_8018_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -22645,13 +21473,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_8020_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -22665,12 +21491,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_8028_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -22685,12 +21509,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_8030_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -22703,12 +21525,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_8038_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -22721,12 +21541,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_8039_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -22740,12 +21558,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_803a_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -22761,12 +21577,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_803b_11)(uae_u32 opcode)
 	uaecptr srca;
 	tmppc = m68k_getpc () + 2;
 	srca = get_disp_ea_000 (tmppc, get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -22781,9 +21595,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_803c_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -22799,9 +21611,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8040_11)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -22819,12 +21629,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_8050_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3226;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -22843,13 +21651,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_8058_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3227;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -22869,13 +21675,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_8060_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3228;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -22894,12 +21698,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_8068_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3229;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -22919,12 +21721,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_8070_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3230;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -22942,12 +21742,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_8078_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3231;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -22965,12 +21763,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_8079_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3232;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -22989,12 +21785,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_807a_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3233;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -23015,12 +21809,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_807b_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3234;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -23036,9 +21828,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_807c_11)(uae_u32 opcode)
 {{	uae_s16 src = get_word_prefetch (4);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -23054,9 +21844,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8080_11)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (src);
@@ -23074,12 +21862,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_8090_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3237;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (src);
@@ -23098,13 +21884,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_8098_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3238;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (src);
@@ -23124,13 +21908,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_80a0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3239;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (src);
@@ -23149,12 +21931,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_80a8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3240;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (src);
@@ -23174,12 +21954,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_80b0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3241;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (src);
@@ -23197,12 +21975,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_80b8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3242;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (src);
@@ -23220,12 +21996,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_80b9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3243;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 	m68k_dreg (regs, dstreg) = (src);
@@ -23244,12 +22018,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_80ba_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3244;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (src);
@@ -23270,12 +22042,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_80bb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3245;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (src);
@@ -23291,9 +22061,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80bc_11)(uae_u32 opcode)
 {{	uae_s32 src = get_long_prefetch (4);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 	m68k_dreg (regs, dstreg) = (src);
@@ -23322,9 +22090,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80c0_11)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -23344,7 +22110,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3248;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
 	if (src == 0) {
@@ -23360,9 +22126,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80d0_11)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -23382,7 +22146,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3249;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
@@ -23399,9 +22163,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80d8_11)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -23422,7 +22184,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3250;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
@@ -23439,9 +22201,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80e0_11)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -23461,7 +22221,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3251;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
 	if (src == 0) {
@@ -23477,9 +22237,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80e8_11)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -23500,7 +22258,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3252;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
 	if (src == 0) {
@@ -23516,9 +22274,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80f0_11)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -23537,7 +22293,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3253;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
 	if (src == 0) {
@@ -23553,9 +22309,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80f8_11)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -23574,7 +22328,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3254;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
 	if (src == 0) {
@@ -23590,9 +22344,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80f9_11)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -23612,7 +22364,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3255;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
 	if (src == 0) {
@@ -23628,9 +22380,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80fa_11)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -23652,7 +22402,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3256;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
 	if (src == 0) {
@@ -23668,9 +22418,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80fb_11)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -23700,9 +22448,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80fc_11)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -23745,11 +22491,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_8108_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -23765,7 +22511,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8108_11)(uae_u32 opcode)
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
 	SET_VFLG ((tmp_newv & 0x80) != 0 && (newv & 0x80) == 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}	m68k_incpc (2);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -23777,14 +22523,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_8110_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -23796,15 +22540,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_8118_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -23817,15 +22559,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_8120_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -23837,14 +22577,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_8128_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -23857,14 +22595,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_8130_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -23875,14 +22611,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_8138_11)(uae_u32 opcode)
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -23893,14 +22627,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_8139_11)(uae_u32 opcode)
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_long_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -23916,14 +22648,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_8150_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3267;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3267: ;
 return 12 * CYCLE_UNIT / 2;
@@ -23940,15 +22670,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_8158_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3268;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3268: ;
 return 12 * CYCLE_UNIT / 2;
@@ -23966,15 +22694,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_8160_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3269;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3269: ;
 return 14 * CYCLE_UNIT / 2;
@@ -23991,14 +22717,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_8168_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3270;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3270: ;
 return 16 * CYCLE_UNIT / 2;
@@ -24016,14 +22740,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_8170_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3271;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3271: ;
 return 18 * CYCLE_UNIT / 2;
@@ -24039,14 +22761,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_8178_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3272;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3272: ;
 return 16 * CYCLE_UNIT / 2;
@@ -24062,14 +22782,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_8179_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3273;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel3273: ;
 return 20 * CYCLE_UNIT / 2;
@@ -24086,14 +22804,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_8190_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3274;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3274: ;
 return 20 * CYCLE_UNIT / 2;
@@ -24110,15 +22826,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_8198_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3275;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3275: ;
 return 20 * CYCLE_UNIT / 2;
@@ -24136,15 +22850,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_81a0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3276;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3276: ;
 return 22 * CYCLE_UNIT / 2;
@@ -24161,14 +22873,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_81a8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3277;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3277: ;
 return 24 * CYCLE_UNIT / 2;
@@ -24186,14 +22896,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_81b0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3278;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3278: ;
 return 26 * CYCLE_UNIT / 2;
@@ -24209,14 +22917,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_81b8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3279;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3279: ;
 return 24 * CYCLE_UNIT / 2;
@@ -24232,14 +22938,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_81b9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3280;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel3280: ;
 return 28 * CYCLE_UNIT / 2;
@@ -24267,9 +22971,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81c0_11)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24289,7 +22991,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3282;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
 	if (src == 0) {
@@ -24306,9 +23008,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81d0_11)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24328,7 +23028,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3283;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
@@ -24346,9 +23046,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81d8_11)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24369,7 +23067,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3284;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
@@ -24387,9 +23085,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81e0_11)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24409,7 +23105,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3285;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
 	if (src == 0) {
@@ -24426,9 +23122,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81e8_11)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24449,7 +23143,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3286;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
 	if (src == 0) {
@@ -24466,9 +23160,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81f0_11)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24487,7 +23179,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3287;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
 	if (src == 0) {
@@ -24504,9 +23196,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81f8_11)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24525,7 +23215,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3288;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
 	if (src == 0) {
@@ -24542,9 +23232,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81f9_11)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24564,7 +23252,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3289;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
 	if (src == 0) {
@@ -24581,9 +23269,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81fa_11)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24605,7 +23291,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3290;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	CLEAR_CZNV ();
 	if (src == 0) {
@@ -24622,9 +23308,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81fb_11)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24655,9 +23339,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81fc_11)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24680,11 +23362,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9000_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -24696,7 +23376,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9010_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -24704,11 +23384,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9010_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -24720,7 +23398,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9018_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -24729,11 +23407,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9018_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -24746,7 +23422,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9020_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -24755,11 +23431,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9020_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
@@ -24771,7 +23445,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9028_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -24779,11 +23453,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9028_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -24796,7 +23468,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9030_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -24804,11 +23476,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9030_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 return 14 * CYCLE_UNIT / 2;
@@ -24819,7 +23489,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9038_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -24827,11 +23497,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9038_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -24842,7 +23510,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9039_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -24850,11 +23518,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9039_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
@@ -24866,7 +23532,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_903a_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -24874,11 +23540,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_903a_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -24892,7 +23556,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_903b_11)(uae_u32 opcode)
 	uaecptr srca;
 	tmppc = m68k_getpc () + 2;
 	srca = get_disp_ea_000 (tmppc, get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -24900,11 +23564,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_903b_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 return 14 * CYCLE_UNIT / 2;
@@ -24922,11 +23584,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_903c_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -24945,11 +23605,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9040_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -24968,11 +23626,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9048_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -24988,7 +23644,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9050_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3305;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -24996,11 +23652,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9050_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (2);
 endlabel3305: ;
@@ -25017,7 +23671,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9058_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3306;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -25026,11 +23680,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9058_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (2);
 endlabel3306: ;
@@ -25048,7 +23700,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9060_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3307;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -25057,11 +23709,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9060_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (2);
 endlabel3307: ;
@@ -25078,7 +23728,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9068_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3308;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -25086,11 +23736,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9068_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel3308: ;
@@ -25108,7 +23756,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9070_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3309;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -25116,11 +23764,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9070_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel3309: ;
@@ -25136,7 +23782,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9078_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3310;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -25144,11 +23790,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9078_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel3310: ;
@@ -25164,7 +23808,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9079_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3311;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -25172,11 +23816,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9079_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (6);
 endlabel3311: ;
@@ -25193,7 +23835,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_907a_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3312;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -25201,11 +23843,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_907a_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel3312: ;
@@ -25224,7 +23864,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_907b_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3313;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -25232,11 +23872,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_907b_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel3313: ;
@@ -25255,11 +23893,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_907c_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
@@ -25278,11 +23914,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9080_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -25301,11 +23935,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9088_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -25321,7 +23953,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9090_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3317;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -25329,11 +23961,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9090_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3317: ;
@@ -25350,7 +23980,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9098_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3318;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -25359,11 +23989,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9098_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3318: ;
@@ -25381,7 +24009,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_90a0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3319;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -25390,11 +24018,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90a0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3319: ;
@@ -25411,7 +24037,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_90a8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3320;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -25419,11 +24045,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90a8_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3320: ;
@@ -25441,7 +24065,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_90b0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3321;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -25449,11 +24073,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90b0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3321: ;
@@ -25469,7 +24091,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_90b8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3322;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -25477,11 +24099,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90b8_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3322: ;
@@ -25497,7 +24117,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_90b9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3323;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -25505,11 +24125,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90b9_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel3323: ;
@@ -25526,7 +24144,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_90ba_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3324;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -25534,11 +24152,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90ba_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3324: ;
@@ -25557,7 +24173,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_90bb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3325;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -25565,11 +24181,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90bb_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3325: ;
@@ -25588,11 +24202,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90bc_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
@@ -25638,7 +24250,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_90d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3329;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -25659,7 +24271,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_90d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3330;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -25682,7 +24294,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_90e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3331;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -25704,7 +24316,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_90e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3332;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -25726,7 +24338,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_90f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3333;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -25746,7 +24358,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_90f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3334;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -25766,7 +24378,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_90f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3335;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -25787,7 +24399,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_90fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3336;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -25810,7 +24422,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_90fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3337;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -25865,11 +24477,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_9108_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -25882,7 +24494,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9108_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -25894,19 +24506,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_9110_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -25918,7 +24528,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9118_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -25926,12 +24536,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_9118_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -25944,7 +24552,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9120_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -25952,12 +24560,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_9120_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -25969,19 +24575,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_9128_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -25994,19 +24598,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_9130_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -26017,19 +24619,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_9138_11)(uae_u32 opcode)
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -26040,19 +24640,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_9139_11)(uae_u32 opcode)
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_long_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -26091,7 +24689,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9148_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3349;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
@@ -26099,7 +24697,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9148_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3349;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -26112,7 +24710,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9148_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s16)(newv)) == 0));
 	SET_NFLG (((uae_s16)(newv)) < 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}}	m68k_incpc (2);
 endlabel3349: ;
 return 16 * CYCLE_UNIT / 2;
@@ -26129,19 +24727,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_9150_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3350;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3350: ;
 return 12 * CYCLE_UNIT / 2;
@@ -26158,7 +24754,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9158_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3351;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -26166,12 +24762,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_9158_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3351: ;
 return 12 * CYCLE_UNIT / 2;
@@ -26189,7 +24783,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9160_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3352;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -26197,12 +24791,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_9160_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3352: ;
 return 14 * CYCLE_UNIT / 2;
@@ -26219,19 +24811,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_9168_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3353;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3353: ;
 return 16 * CYCLE_UNIT / 2;
@@ -26249,19 +24839,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_9170_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3354;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3354: ;
 return 18 * CYCLE_UNIT / 2;
@@ -26277,19 +24865,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_9178_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3355;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3355: ;
 return 16 * CYCLE_UNIT / 2;
@@ -26305,19 +24891,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_9179_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3356;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel3356: ;
 return 20 * CYCLE_UNIT / 2;
@@ -26357,7 +24941,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9188_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3358;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
@@ -26365,7 +24949,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9188_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3358;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -26378,7 +24962,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9188_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s32)(newv)) == 0));
 	SET_NFLG (((uae_s32)(newv)) < 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}}	m68k_incpc (2);
 endlabel3358: ;
 return 28 * CYCLE_UNIT / 2;
@@ -26395,19 +24979,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_9190_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3359;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3359: ;
 return 20 * CYCLE_UNIT / 2;
@@ -26424,7 +25006,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_9198_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3360;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -26432,12 +25014,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_9198_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3360: ;
 return 20 * CYCLE_UNIT / 2;
@@ -26455,7 +25035,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_91a0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3361;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -26463,12 +25043,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_91a0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3361: ;
 return 22 * CYCLE_UNIT / 2;
@@ -26485,19 +25063,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_91a8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3362;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3362: ;
 return 24 * CYCLE_UNIT / 2;
@@ -26515,19 +25091,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_91b0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3363;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3363: ;
 return 26 * CYCLE_UNIT / 2;
@@ -26543,19 +25117,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_91b8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3364;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3364: ;
 return 24 * CYCLE_UNIT / 2;
@@ -26571,19 +25143,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_91b9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3365;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel3365: ;
 return 28 * CYCLE_UNIT / 2;
@@ -26629,7 +25199,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_91d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3368;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -26650,7 +25220,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_91d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3369;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -26673,7 +25243,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_91e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3370;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -26695,7 +25265,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_91e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3371;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -26717,7 +25287,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_91f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3372;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -26737,7 +25307,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_91f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3373;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -26757,7 +25327,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_91f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3374;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -26778,7 +25348,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_91fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3375;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -26801,7 +25371,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_91fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3376;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -26839,10 +25409,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b000_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 } /* 4 (1/0) */
@@ -26853,7 +25421,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b010_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -26861,10 +25429,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b010_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
 } /* 8 (2/0) */
@@ -26875,7 +25441,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b018_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -26884,10 +25450,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b018_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
 } /* 8 (2/0) */
@@ -26899,7 +25463,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b020_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -26908,10 +25472,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b020_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
 } /* 8 (2/0) */
@@ -26922,7 +25484,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b028_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -26930,10 +25492,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b028_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (3/0) */
@@ -26945,7 +25505,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b030_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -26953,10 +25513,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b030_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (3/0) */
@@ -26966,7 +25524,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b038_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -26974,10 +25532,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b038_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (3/0) */
@@ -26987,7 +25543,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b039_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -26995,10 +25551,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b039_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (4/0) */
@@ -27009,7 +25563,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b03a_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27017,10 +25571,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b03a_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (3/0) */
@@ -27033,7 +25585,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b03b_11)(uae_u32 opcode)
 	uaecptr srca;
 	tmppc = m68k_getpc () + 2;
 	srca = get_disp_ea_000 (tmppc, get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27041,10 +25593,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b03b_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (3/0) */
@@ -27061,10 +25611,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b03c_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 } /* 8 (2/0) */
@@ -27082,10 +25630,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b040_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 } /* 4 (1/0) */
@@ -27103,10 +25649,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b048_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 } /* 4 (1/0) */
@@ -27121,7 +25665,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b050_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3391;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -27129,10 +25673,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b050_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel3391: ;
 return 8 * CYCLE_UNIT / 2;
@@ -27148,7 +25690,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b058_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3392;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -27157,10 +25699,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b058_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel3392: ;
 return 8 * CYCLE_UNIT / 2;
@@ -27177,7 +25717,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b060_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3393;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -27186,10 +25726,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b060_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel3393: ;
 return 10 * CYCLE_UNIT / 2;
@@ -27205,7 +25743,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b068_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3394;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27213,10 +25751,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b068_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3394: ;
 return 12 * CYCLE_UNIT / 2;
@@ -27233,7 +25769,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b070_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3395;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27241,10 +25777,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b070_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3395: ;
 return 14 * CYCLE_UNIT / 2;
@@ -27259,7 +25793,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b078_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3396;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27267,10 +25801,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b078_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3396: ;
 return 12 * CYCLE_UNIT / 2;
@@ -27285,7 +25817,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b079_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3397;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -27293,10 +25825,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b079_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel3397: ;
 return 16 * CYCLE_UNIT / 2;
@@ -27312,7 +25842,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b07a_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3398;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27320,10 +25850,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b07a_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3398: ;
 return 12 * CYCLE_UNIT / 2;
@@ -27341,7 +25869,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b07b_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3399;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27349,10 +25877,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b07b_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3399: ;
 return 14 * CYCLE_UNIT / 2;
@@ -27370,10 +25896,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b07c_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
 } /* 8 (2/0) */
@@ -27391,10 +25915,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b080_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 } /* 4 (1/0) */
@@ -27412,10 +25934,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b088_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 } /* 4 (1/0) */
@@ -27433,7 +25953,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b090_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3403;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -27441,10 +25961,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b090_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel3403: ;
 return 12 * CYCLE_UNIT / 2;
@@ -27460,7 +25978,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b098_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3404;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -27469,10 +25987,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b098_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel3404: ;
 return 12 * CYCLE_UNIT / 2;
@@ -27489,7 +26005,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0a0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3405;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -27498,10 +26014,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0a0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel3405: ;
 return 14 * CYCLE_UNIT / 2;
@@ -27517,7 +26031,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0a8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3406;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27525,10 +26039,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0a8_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3406: ;
 return 16 * CYCLE_UNIT / 2;
@@ -27545,7 +26057,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0b0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3407;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27553,10 +26065,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0b0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3407: ;
 return 18 * CYCLE_UNIT / 2;
@@ -27571,7 +26081,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0b8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3408;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27579,10 +26089,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0b8_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3408: ;
 return 16 * CYCLE_UNIT / 2;
@@ -27597,7 +26105,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0b9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3409;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -27605,10 +26113,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0b9_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel3409: ;
 return 20 * CYCLE_UNIT / 2;
@@ -27624,7 +26130,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0ba_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3410;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27632,10 +26138,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0ba_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3410: ;
 return 16 * CYCLE_UNIT / 2;
@@ -27653,7 +26157,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0bb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3411;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27661,10 +26165,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0bb_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3411: ;
 return 18 * CYCLE_UNIT / 2;
@@ -27682,10 +26184,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0bc_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (3/0) */
@@ -27703,10 +26203,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0c0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 } /* 4 (1/0) */
@@ -27724,10 +26222,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0c8_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 } /* 4 (1/0) */
@@ -27742,7 +26238,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3415;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -27750,10 +26246,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0d0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel3415: ;
 return 8 * CYCLE_UNIT / 2;
@@ -27769,7 +26263,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3416;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -27778,10 +26272,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0d8_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel3416: ;
 return 8 * CYCLE_UNIT / 2;
@@ -27798,7 +26290,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3417;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -27807,10 +26299,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0e0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel3417: ;
 return 10 * CYCLE_UNIT / 2;
@@ -27826,7 +26316,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3418;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27834,10 +26324,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0e8_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3418: ;
 return 12 * CYCLE_UNIT / 2;
@@ -27854,7 +26342,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3419;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27862,10 +26350,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0f0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3419: ;
 return 14 * CYCLE_UNIT / 2;
@@ -27880,7 +26366,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3420;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27888,10 +26374,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0f8_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3420: ;
 return 12 * CYCLE_UNIT / 2;
@@ -27906,7 +26390,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3421;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -27914,10 +26398,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0f9_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel3421: ;
 return 16 * CYCLE_UNIT / 2;
@@ -27933,7 +26415,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3422;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27941,10 +26423,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0fa_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3422: ;
 return 12 * CYCLE_UNIT / 2;
@@ -27962,7 +26442,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3423;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -27970,10 +26450,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0fb_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3423: ;
 return 14 * CYCLE_UNIT / 2;
@@ -27991,10 +26469,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0fc_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
 } /* 8 (2/0) */
@@ -28007,9 +26483,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b100_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -28023,10 +26497,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_b108_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -28034,10 +26508,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b108_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (3/0) */
@@ -28049,14 +26521,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_b110_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -28068,15 +26538,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_b118_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -28089,15 +26557,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_b120_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -28109,14 +26575,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_b128_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -28129,14 +26593,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_b130_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -28147,14 +26609,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_b138_11)(uae_u32 opcode)
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -28165,14 +26625,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_b139_11)(uae_u32 opcode)
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_long_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -28185,9 +26643,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b140_11)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -28205,14 +26661,14 @@ uae_u32 REGPARAM2 CPUFUNC(op_b148_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3435;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 		exception3 (opcode, dsta);
 		goto endlabel3435;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -28220,10 +26676,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b148_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}}}	m68k_incpc (2);
 endlabel3435: ;
 return 12 * CYCLE_UNIT / 2;
@@ -28240,14 +26694,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_b150_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3436;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3436: ;
 return 12 * CYCLE_UNIT / 2;
@@ -28264,15 +26716,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_b158_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3437;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3437: ;
 return 12 * CYCLE_UNIT / 2;
@@ -28290,15 +26740,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_b160_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3438;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3438: ;
 return 14 * CYCLE_UNIT / 2;
@@ -28315,14 +26763,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_b168_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3439;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3439: ;
 return 16 * CYCLE_UNIT / 2;
@@ -28340,14 +26786,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_b170_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3440;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3440: ;
 return 18 * CYCLE_UNIT / 2;
@@ -28363,14 +26807,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_b178_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3441;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3441: ;
 return 16 * CYCLE_UNIT / 2;
@@ -28386,14 +26828,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_b179_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3442;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel3442: ;
 return 20 * CYCLE_UNIT / 2;
@@ -28407,9 +26847,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b180_11)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (src);
@@ -28427,14 +26865,14 @@ uae_u32 REGPARAM2 CPUFUNC(op_b188_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3444;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	if (dsta & 1) {
 		exception3 (opcode, dsta);
 		goto endlabel3444;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -28442,10 +26880,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b188_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}}}	m68k_incpc (2);
 endlabel3444: ;
 return 20 * CYCLE_UNIT / 2;
@@ -28462,14 +26898,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_b190_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3445;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3445: ;
 return 20 * CYCLE_UNIT / 2;
@@ -28486,15 +26920,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_b198_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3446;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3446: ;
 return 20 * CYCLE_UNIT / 2;
@@ -28512,15 +26944,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1a0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3447;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3447: ;
 return 22 * CYCLE_UNIT / 2;
@@ -28537,14 +26967,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1a8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3448;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3448: ;
 return 24 * CYCLE_UNIT / 2;
@@ -28562,14 +26990,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1b0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3449;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3449: ;
 return 26 * CYCLE_UNIT / 2;
@@ -28585,14 +27011,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1b8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3450;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3450: ;
 return 24 * CYCLE_UNIT / 2;
@@ -28608,14 +27032,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1b9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3451;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel3451: ;
 return 28 * CYCLE_UNIT / 2;
@@ -28634,10 +27056,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1c0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 } /* 4 (1/0) */
@@ -28655,10 +27075,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1c8_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 } /* 4 (1/0) */
@@ -28673,7 +27091,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3454;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -28681,10 +27099,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1d0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel3454: ;
 return 12 * CYCLE_UNIT / 2;
@@ -28700,7 +27116,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3455;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -28709,10 +27125,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1d8_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel3455: ;
 return 12 * CYCLE_UNIT / 2;
@@ -28729,7 +27143,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3456;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -28738,10 +27152,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1e0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel3456: ;
 return 14 * CYCLE_UNIT / 2;
@@ -28757,7 +27169,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3457;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -28765,10 +27177,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1e8_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3457: ;
 return 16 * CYCLE_UNIT / 2;
@@ -28785,7 +27195,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3458;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -28793,10 +27203,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1f0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3458: ;
 return 18 * CYCLE_UNIT / 2;
@@ -28811,7 +27219,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3459;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -28819,10 +27227,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1f8_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3459: ;
 return 16 * CYCLE_UNIT / 2;
@@ -28837,7 +27243,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3460;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -28845,10 +27251,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1f9_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel3460: ;
 return 20 * CYCLE_UNIT / 2;
@@ -28864,7 +27268,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3461;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -28872,10 +27276,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1fa_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3461: ;
 return 16 * CYCLE_UNIT / 2;
@@ -28893,7 +27295,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3462;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -28901,10 +27303,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1fb_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3462: ;
 return 18 * CYCLE_UNIT / 2;
@@ -28922,10 +27322,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1fc_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (3/0) */
@@ -28938,9 +27336,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c000_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -28954,12 +27350,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c010_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -28973,13 +27367,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_c018_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -28994,13 +27386,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_c020_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -29014,12 +27404,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c028_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -29034,12 +27422,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c030_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -29052,12 +27438,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c038_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -29070,12 +27454,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c039_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -29089,12 +27471,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c03a_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -29110,12 +27490,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c03b_11)(uae_u32 opcode)
 	uaecptr srca;
 	tmppc = m68k_getpc () + 2;
 	srca = get_disp_ea_000 (tmppc, get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -29130,9 +27508,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c03c_11)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_prefetch (4);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
@@ -29148,9 +27524,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c040_11)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -29168,12 +27542,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c050_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3476;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -29192,13 +27564,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_c058_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3477;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -29218,13 +27588,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_c060_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3478;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -29243,12 +27611,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c068_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3479;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -29268,12 +27634,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c070_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3480;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -29291,12 +27655,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c078_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3481;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -29314,12 +27676,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c079_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3482;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -29338,12 +27698,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c07a_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3483;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -29364,12 +27722,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c07b_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3484;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -29385,9 +27741,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c07c_11)(uae_u32 opcode)
 {{	uae_s16 src = get_word_prefetch (4);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
@@ -29403,9 +27757,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c080_11)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (src);
@@ -29423,12 +27775,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c090_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3487;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (src);
@@ -29447,13 +27797,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_c098_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3488;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (src);
@@ -29473,13 +27821,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0a0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3489;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 	m68k_dreg (regs, dstreg) = (src);
@@ -29498,12 +27844,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0a8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3490;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (src);
@@ -29523,12 +27867,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0b0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3491;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (src);
@@ -29546,12 +27888,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0b8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3492;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (src);
@@ -29569,12 +27909,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0b9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3493;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 	m68k_dreg (regs, dstreg) = (src);
@@ -29593,12 +27931,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0ba_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3494;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (src);
@@ -29619,12 +27955,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0bb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3495;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 	m68k_dreg (regs, dstreg) = (src);
@@ -29640,9 +27974,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0bc_11)(uae_u32 opcode)
 {{	uae_s32 src = get_long_prefetch (4);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 	m68k_dreg (regs, dstreg) = (src);
@@ -29660,9 +27992,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0c0_11)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (2);
 }}}}return 58 * CYCLE_UNIT / 2;
@@ -29678,14 +28008,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3498;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (2);
 }}}}}}endlabel3498: ;
@@ -29702,15 +28030,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3499;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (2);
 }}}}}}endlabel3499: ;
@@ -29728,15 +28054,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3500;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (2);
 }}}}}}endlabel3500: ;
@@ -29753,14 +28077,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3501;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
 }}}}}}endlabel3501: ;
@@ -29778,14 +28100,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3502;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
 }}}}}}endlabel3502: ;
@@ -29801,14 +28121,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3503;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
 }}}}}}endlabel3503: ;
@@ -29824,14 +28142,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3504;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (6);
 }}}}}}endlabel3504: ;
@@ -29848,14 +28164,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3505;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
 }}}}}}endlabel3505: ;
@@ -29874,14 +28188,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3506;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
 }}}}}}endlabel3506: ;
@@ -29897,9 +28209,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0fc_11)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
 }}}}return 62 * CYCLE_UNIT / 2;
@@ -29938,11 +28248,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_c108_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -29958,7 +28268,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c108_11)(uae_u32 opcode)
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
 	SET_VFLG ((tmp_newv & 0x80) == 0 && (newv & 0x80) != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}	m68k_incpc (2);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -29970,14 +28280,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c110_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -29989,15 +28297,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_c118_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -30010,15 +28316,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_c120_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -30030,14 +28334,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c128_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -30050,14 +28352,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c130_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -30068,14 +28368,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c138_11)(uae_u32 opcode)
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -30086,14 +28384,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c139_11)(uae_u32 opcode)
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_long_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_byte (dsta, src);
+	put_byte_direct (dsta, src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -30139,14 +28435,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c150_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3519;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3519: ;
 return 12 * CYCLE_UNIT / 2;
@@ -30163,15 +28457,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_c158_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3520;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3520: ;
 return 12 * CYCLE_UNIT / 2;
@@ -30189,15 +28481,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_c160_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3521;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3521: ;
 return 14 * CYCLE_UNIT / 2;
@@ -30214,14 +28504,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c168_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3522;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3522: ;
 return 16 * CYCLE_UNIT / 2;
@@ -30239,14 +28527,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c170_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3523;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3523: ;
 return 18 * CYCLE_UNIT / 2;
@@ -30262,14 +28548,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c178_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3524;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3524: ;
 return 16 * CYCLE_UNIT / 2;
@@ -30285,14 +28569,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c179_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3525;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_word (dsta, src);
+	put_word_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel3525: ;
 return 20 * CYCLE_UNIT / 2;
@@ -30324,14 +28606,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c190_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3527;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3527: ;
 return 20 * CYCLE_UNIT / 2;
@@ -30348,15 +28628,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_c198_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3528;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3528: ;
 return 20 * CYCLE_UNIT / 2;
@@ -30374,15 +28652,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1a0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3529;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (2);
 endlabel3529: ;
 return 22 * CYCLE_UNIT / 2;
@@ -30399,14 +28675,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1a8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3530;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3530: ;
 return 24 * CYCLE_UNIT / 2;
@@ -30424,14 +28698,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1b0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3531;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3531: ;
 return 26 * CYCLE_UNIT / 2;
@@ -30447,14 +28719,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1b8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3532;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (4);
 endlabel3532: ;
 return 24 * CYCLE_UNIT / 2;
@@ -30470,14 +28740,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1b9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3533;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
-	put_long (dsta, src);
+	put_long_direct (dsta, src);
 }}}}}	m68k_incpc (6);
 endlabel3533: ;
 return 28 * CYCLE_UNIT / 2;
@@ -30493,9 +28761,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1c0_11)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}	m68k_incpc (2);
 return 58 * CYCLE_UNIT / 2;
@@ -30511,14 +28777,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3535;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 endlabel3535: ;
@@ -30535,15 +28799,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3536;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 endlabel3536: ;
@@ -30561,15 +28823,13 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3537;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 endlabel3537: ;
@@ -30586,14 +28846,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3538;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (4);
 endlabel3538: ;
@@ -30611,14 +28869,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3539;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (4);
 endlabel3539: ;
@@ -30634,14 +28890,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3540;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (4);
 endlabel3540: ;
@@ -30657,14 +28911,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3541;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (6);
 endlabel3541: ;
@@ -30681,14 +28933,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3542;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (4);
 endlabel3542: ;
@@ -30707,14 +28957,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3543;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (4);
 endlabel3543: ;
@@ -30730,9 +28978,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1fc_11)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}	m68k_incpc (4);
 return 62 * CYCLE_UNIT / 2;
@@ -30751,11 +28997,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d000_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -30767,7 +29011,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d010_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -30775,11 +29019,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d010_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -30791,7 +29033,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d018_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -30800,11 +29042,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d018_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -30817,7 +29057,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d020_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -30826,11 +29066,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d020_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
@@ -30842,7 +29080,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d028_11)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -30850,11 +29088,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d028_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -30867,7 +29103,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d030_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -30875,11 +29111,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d030_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 return 14 * CYCLE_UNIT / 2;
@@ -30890,7 +29124,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d038_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -30898,11 +29132,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d038_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -30913,7 +29145,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d039_11)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -30921,11 +29153,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d039_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
@@ -30937,7 +29167,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d03a_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -30945,11 +29175,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d03a_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -30963,7 +29191,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d03b_11)(uae_u32 opcode)
 	uaecptr srca;
 	tmppc = m68k_getpc () + 2;
 	srca = get_disp_ea_000 (tmppc, get_word_prefetch (4));
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -30971,11 +29199,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d03b_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 return 14 * CYCLE_UNIT / 2;
@@ -30993,11 +29219,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d03c_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -31016,11 +29240,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d040_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -31039,11 +29261,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d048_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -31059,7 +29279,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d050_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3558;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -31067,11 +29287,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d050_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (2);
 endlabel3558: ;
@@ -31088,7 +29306,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d058_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3559;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -31097,11 +29315,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d058_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (2);
 endlabel3559: ;
@@ -31119,7 +29335,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d060_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3560;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -31128,11 +29344,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d060_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (2);
 endlabel3560: ;
@@ -31149,7 +29363,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d068_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3561;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -31157,11 +29371,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d068_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel3561: ;
@@ -31179,7 +29391,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d070_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3562;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -31187,11 +29399,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d070_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel3562: ;
@@ -31207,7 +29417,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d078_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3563;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -31215,11 +29425,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d078_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel3563: ;
@@ -31235,7 +29443,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d079_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3564;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -31243,11 +29451,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d079_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (6);
 endlabel3564: ;
@@ -31264,7 +29470,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d07a_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3565;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -31272,11 +29478,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d07a_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel3565: ;
@@ -31295,7 +29499,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d07b_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3566;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -31303,11 +29507,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d07b_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel3566: ;
@@ -31326,11 +29528,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d07c_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
@@ -31349,11 +29549,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d080_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -31372,11 +29570,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d088_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -31392,7 +29588,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d090_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3570;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -31400,11 +29596,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d090_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3570: ;
@@ -31421,7 +29615,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d098_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3571;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -31430,11 +29624,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d098_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3571: ;
@@ -31452,7 +29644,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0a0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3572;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -31461,11 +29653,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0a0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3572: ;
@@ -31482,7 +29672,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0a8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3573;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -31490,11 +29680,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0a8_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3573: ;
@@ -31512,7 +29700,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0b0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3574;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -31520,11 +29708,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0b0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3574: ;
@@ -31540,7 +29726,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0b8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3575;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -31548,11 +29734,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0b8_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3575: ;
@@ -31568,7 +29752,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0b9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3576;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -31576,11 +29760,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0b9_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel3576: ;
@@ -31597,7 +29779,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0ba_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3577;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -31605,11 +29787,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0ba_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3577: ;
@@ -31628,7 +29808,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0bb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3578;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -31636,11 +29816,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0bb_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3578: ;
@@ -31659,11 +29837,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0bc_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
@@ -31709,7 +29885,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3582;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -31730,7 +29906,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3583;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -31753,7 +29929,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3584;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -31775,7 +29951,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3585;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -31797,7 +29973,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3586;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -31817,7 +29993,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3587;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -31837,7 +30013,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3588;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -31858,7 +30034,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3589;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -31881,7 +30057,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3590;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -31936,11 +30112,11 @@ uae_u32 REGPARAM2 CPUFUNC(op_d108_11)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte (srca);
+{	uae_s8 src = get_byte_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -31953,7 +30129,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d108_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s8)(newv)) == 0));
 	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -31965,19 +30141,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_d110_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -31989,7 +30163,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d118_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -31997,12 +30171,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_d118_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -32015,7 +30187,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d120_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -32023,12 +30195,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_d120_11)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 } /* 12 (2/1) */
@@ -32040,19 +30210,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_d128_11)(uae_u32 opcode)
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -32065,19 +30233,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_d130_11)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta;
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_prefetch (4));
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -32088,19 +30254,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_d138_11)(uae_u32 opcode)
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 } /* 16 (3/1) */
@@ -32111,19 +30275,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_d139_11)(uae_u32 opcode)
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_long_prefetch (4);
-{	uae_s8 dst = get_byte (dsta);
+{	uae_s8 dst = get_byte_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_byte (dsta, newv);
+	put_byte_direct (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 } /* 20 (4/1) */
@@ -32162,7 +30324,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d148_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3602;
 	}
-{{	uae_s16 src = get_word (srca);
+{{	uae_s16 src = get_word_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
@@ -32170,7 +30332,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d148_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3602;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -32183,7 +30345,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d148_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s16)(newv)) == 0));
 	SET_NFLG (((uae_s16)(newv)) < 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}}	m68k_incpc (2);
 endlabel3602: ;
 return 16 * CYCLE_UNIT / 2;
@@ -32200,19 +30362,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_d150_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3603;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3603: ;
 return 12 * CYCLE_UNIT / 2;
@@ -32229,7 +30389,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d158_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3604;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -32237,12 +30397,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_d158_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3604: ;
 return 12 * CYCLE_UNIT / 2;
@@ -32260,7 +30418,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d160_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3605;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -32268,12 +30426,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_d160_11)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3605: ;
 return 14 * CYCLE_UNIT / 2;
@@ -32290,19 +30446,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_d168_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3606;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3606: ;
 return 16 * CYCLE_UNIT / 2;
@@ -32320,19 +30474,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_d170_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3607;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3607: ;
 return 18 * CYCLE_UNIT / 2;
@@ -32348,19 +30500,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_d178_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3608;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3608: ;
 return 16 * CYCLE_UNIT / 2;
@@ -32376,19 +30526,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_d179_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3609;
 	}
-{{	uae_s16 dst = get_word (dsta);
+{{	uae_s16 dst = get_word_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_word (dsta, newv);
+	put_word_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel3609: ;
 return 20 * CYCLE_UNIT / 2;
@@ -32428,7 +30576,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d188_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3611;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
@@ -32436,7 +30584,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d188_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3611;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -32449,7 +30597,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d188_11)(uae_u32 opcode)
 	COPY_CARRY ();
 	SET_ZFLG (GET_ZFLG () & (((uae_s32)(newv)) == 0));
 	SET_NFLG (((uae_s32)(newv)) < 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}}	m68k_incpc (2);
 endlabel3611: ;
 return 28 * CYCLE_UNIT / 2;
@@ -32466,19 +30614,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_d190_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3612;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3612: ;
 return 20 * CYCLE_UNIT / 2;
@@ -32495,7 +30641,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d198_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3613;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -32503,12 +30649,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_d198_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3613: ;
 return 20 * CYCLE_UNIT / 2;
@@ -32526,7 +30670,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1a0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3614;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -32534,12 +30678,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1a0_11)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel3614: ;
 return 22 * CYCLE_UNIT / 2;
@@ -32556,19 +30698,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1a8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3615;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3615: ;
 return 24 * CYCLE_UNIT / 2;
@@ -32586,19 +30726,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1b0_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3616;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3616: ;
 return 26 * CYCLE_UNIT / 2;
@@ -32614,19 +30752,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1b8_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3617;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3617: ;
 return 24 * CYCLE_UNIT / 2;
@@ -32642,19 +30778,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1b9_11)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel3618;
 	}
-{{	uae_s32 dst = get_long (dsta);
+{{	uae_s32 dst = get_long_direct (dsta);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
-	put_long (dsta, newv);
+	put_long_direct (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel3618: ;
 return 28 * CYCLE_UNIT / 2;
@@ -32700,7 +30834,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1d0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3621;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -32721,7 +30855,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1d8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3622;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -32744,7 +30878,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1e0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3623;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
@@ -32766,7 +30900,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1e8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3624;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -32788,7 +30922,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1f0_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3625;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -32808,7 +30942,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1f8_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3626;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -32828,7 +30962,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1f9_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3627;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
@@ -32849,7 +30983,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1fa_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3628;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -32872,7 +31006,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1fb_11)(uae_u32 opcode)
 		exception3 (opcode, srca);
 		goto endlabel3629;
 	}
-{{	uae_s32 src = get_long (srca);
+{{	uae_s32 src = get_long_direct (srca);
 {	uae_s32 dst = m68k_areg (regs, dstreg);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
@@ -33662,19 +31796,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0d0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3655;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3655: ;
 return 12 * CYCLE_UNIT / 2;
@@ -33689,7 +31821,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0d8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3656;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	m68k_areg (regs, srcreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -33697,12 +31829,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0d8_11)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3656: ;
 return 12 * CYCLE_UNIT / 2;
@@ -33718,7 +31848,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0e0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3657;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	m68k_areg (regs, srcreg) = dataa;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -33726,12 +31856,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0e0_11)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3657: ;
 return 14 * CYCLE_UNIT / 2;
@@ -33746,19 +31874,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0e8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3658;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3658: ;
 return 16 * CYCLE_UNIT / 2;
@@ -33774,19 +31900,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0f0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3659;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3659: ;
 return 18 * CYCLE_UNIT / 2;
@@ -33800,19 +31924,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0f8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3660;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3660: ;
 return 16 * CYCLE_UNIT / 2;
@@ -33826,19 +31948,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0f9_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3661;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (6);
 endlabel3661: ;
 return 20 * CYCLE_UNIT / 2;
@@ -34603,21 +32723,19 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1d0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3686;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
 	SET_VFLG (GET_VFLG () | (sign2 != sign));
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3686: ;
 return 12 * CYCLE_UNIT / 2;
@@ -34632,7 +32750,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1d8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3687;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	m68k_areg (regs, srcreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -34640,14 +32758,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1d8_11)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
 	SET_VFLG (GET_VFLG () | (sign2 != sign));
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3687: ;
 return 12 * CYCLE_UNIT / 2;
@@ -34663,7 +32779,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1e0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3688;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	m68k_areg (regs, srcreg) = dataa;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -34671,14 +32787,12 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1e0_11)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
 	SET_VFLG (GET_VFLG () | (sign2 != sign));
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3688: ;
 return 14 * CYCLE_UNIT / 2;
@@ -34693,21 +32807,19 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1e8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3689;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
 	SET_VFLG (GET_VFLG () | (sign2 != sign));
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3689: ;
 return 16 * CYCLE_UNIT / 2;
@@ -34723,21 +32835,19 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1f0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3690;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
 	SET_VFLG (GET_VFLG () | (sign2 != sign));
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3690: ;
 return 18 * CYCLE_UNIT / 2;
@@ -34751,21 +32861,19 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1f8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3691;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
 	SET_VFLG (GET_VFLG () | (sign2 != sign));
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3691: ;
 return 16 * CYCLE_UNIT / 2;
@@ -34779,21 +32887,19 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1f9_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3692;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
 	SET_VFLG (GET_VFLG () | (sign2 != sign));
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (6);
 endlabel3692: ;
 return 20 * CYCLE_UNIT / 2;
@@ -34808,18 +32914,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2d0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3693;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3693: ;
 return 12 * CYCLE_UNIT / 2;
@@ -34834,19 +32938,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2d8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3694;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	m68k_areg (regs, srcreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3694: ;
 return 12 * CYCLE_UNIT / 2;
@@ -34862,19 +32964,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2e0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3695;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	m68k_areg (regs, srcreg) = dataa;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3695: ;
 return 14 * CYCLE_UNIT / 2;
@@ -34889,18 +32989,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2e8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3696;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3696: ;
 return 16 * CYCLE_UNIT / 2;
@@ -34916,18 +33014,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2f0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3697;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3697: ;
 return 18 * CYCLE_UNIT / 2;
@@ -34941,18 +33037,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2f8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3698;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3698: ;
 return 16 * CYCLE_UNIT / 2;
@@ -34966,18 +33060,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2f9_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3699;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (6);
 endlabel3699: ;
 return 20 * CYCLE_UNIT / 2;
@@ -34992,18 +33084,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3d0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3700;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3700: ;
 return 12 * CYCLE_UNIT / 2;
@@ -35018,19 +33108,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3d8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3701;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	m68k_areg (regs, srcreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3701: ;
 return 12 * CYCLE_UNIT / 2;
@@ -35046,19 +33134,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3e0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3702;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	m68k_areg (regs, srcreg) = dataa;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3702: ;
 return 14 * CYCLE_UNIT / 2;
@@ -35073,18 +33159,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3e8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3703;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3703: ;
 return 16 * CYCLE_UNIT / 2;
@@ -35100,18 +33184,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3f0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3704;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3704: ;
 return 18 * CYCLE_UNIT / 2;
@@ -35125,18 +33207,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3f8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3705;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3705: ;
 return 16 * CYCLE_UNIT / 2;
@@ -35150,18 +33230,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3f9_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3706;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (6);
 endlabel3706: ;
 return 20 * CYCLE_UNIT / 2;
@@ -35176,19 +33254,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4d0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3707;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3707: ;
 return 12 * CYCLE_UNIT / 2;
@@ -35203,7 +33279,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4d8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3708;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	m68k_areg (regs, srcreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -35211,12 +33287,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4d8_11)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3708: ;
 return 12 * CYCLE_UNIT / 2;
@@ -35232,7 +33306,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4e0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3709;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	m68k_areg (regs, srcreg) = dataa;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -35240,12 +33314,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4e0_11)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3709: ;
 return 14 * CYCLE_UNIT / 2;
@@ -35260,19 +33332,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4e8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3710;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3710: ;
 return 16 * CYCLE_UNIT / 2;
@@ -35288,19 +33358,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4f0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3711;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3711: ;
 return 18 * CYCLE_UNIT / 2;
@@ -35314,19 +33382,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4f8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3712;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3712: ;
 return 16 * CYCLE_UNIT / 2;
@@ -35340,19 +33406,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4f9_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3713;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (6);
 endlabel3713: ;
 return 20 * CYCLE_UNIT / 2;
@@ -35367,19 +33431,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5d0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3714;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3714: ;
 return 12 * CYCLE_UNIT / 2;
@@ -35394,7 +33456,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5d8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3715;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	m68k_areg (regs, srcreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -35402,12 +33464,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5d8_11)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3715: ;
 return 12 * CYCLE_UNIT / 2;
@@ -35423,7 +33483,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5e0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3716;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	m68k_areg (regs, srcreg) = dataa;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -35431,12 +33491,10 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5e0_11)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3716: ;
 return 14 * CYCLE_UNIT / 2;
@@ -35451,19 +33509,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5e8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3717;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3717: ;
 return 16 * CYCLE_UNIT / 2;
@@ -35479,19 +33535,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5f0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3718;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3718: ;
 return 18 * CYCLE_UNIT / 2;
@@ -35505,19 +33559,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5f8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3719;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3719: ;
 return 16 * CYCLE_UNIT / 2;
@@ -35531,19 +33583,17 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5f9_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3720;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (6);
 endlabel3720: ;
 return 20 * CYCLE_UNIT / 2;
@@ -35558,18 +33608,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6d0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3721;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3721: ;
 return 12 * CYCLE_UNIT / 2;
@@ -35584,7 +33632,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6d8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3722;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	m68k_areg (regs, srcreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -35592,11 +33640,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6d8_11)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3722: ;
 return 12 * CYCLE_UNIT / 2;
@@ -35612,7 +33658,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6e0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3723;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	m68k_areg (regs, srcreg) = dataa;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -35620,11 +33666,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6e0_11)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3723: ;
 return 14 * CYCLE_UNIT / 2;
@@ -35639,18 +33683,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6e8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3724;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3724: ;
 return 16 * CYCLE_UNIT / 2;
@@ -35666,18 +33708,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6f0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3725;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3725: ;
 return 18 * CYCLE_UNIT / 2;
@@ -35691,18 +33731,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6f8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3726;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3726: ;
 return 16 * CYCLE_UNIT / 2;
@@ -35716,18 +33754,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6f9_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3727;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (6);
 endlabel3727: ;
 return 20 * CYCLE_UNIT / 2;
@@ -35742,18 +33778,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7d0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3728;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3728: ;
 return 12 * CYCLE_UNIT / 2;
@@ -35768,7 +33802,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7d8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3729;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	m68k_areg (regs, srcreg) += 2;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -35776,11 +33810,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7d8_11)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3729: ;
 return 12 * CYCLE_UNIT / 2;
@@ -35796,7 +33828,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7e0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3730;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	m68k_areg (regs, srcreg) = dataa;
 	regs.ir = regs.irc;
 	get_word_prefetch (4);
@@ -35804,11 +33836,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7e0_11)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (2);
 endlabel3730: ;
 return 14 * CYCLE_UNIT / 2;
@@ -35823,18 +33853,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7e8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3731;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3731: ;
 return 16 * CYCLE_UNIT / 2;
@@ -35850,18 +33878,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7f0_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3732;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3732: ;
 return 18 * CYCLE_UNIT / 2;
@@ -35875,18 +33901,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7f8_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3733;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (6);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (4);
 endlabel3733: ;
 return 16 * CYCLE_UNIT / 2;
@@ -35900,18 +33924,16 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7f9_11)(uae_u32 opcode)
 		exception3 (opcode, dataa);
 		goto endlabel3734;
 	}
-{{	uae_s16 data = get_word (dataa);
+{{	uae_s16 data = get_word_direct (dataa);
 	regs.ir = regs.irc;
 	get_word_prefetch (8);
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
-	put_word (dataa, val);
+	put_word_direct (dataa, val);
 }}}}}	m68k_incpc (6);
 endlabel3734: ;
 return 20 * CYCLE_UNIT / 2;
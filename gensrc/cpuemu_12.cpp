@@ -34,9 +34,7 @@ void REGPARAM2 CPUFUNC(op_0000_12)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce000_prefetch (4);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -52,9 +50,7 @@ void REGPARAM2 CPUFUNC(op_0010_12)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -71,9 +67,7 @@ void REGPARAM2 CPUFUNC(op_0018_12)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -92,9 +86,7 @@ void REGPARAM2 CPUFUNC(op_0020_12)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -110,9 +102,7 @@ void REGPARAM2 CPUFUNC(op_0028_12)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -130,9 +120,7 @@ void REGPARAM2 CPUFUNC(op_0030_12)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (6));
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -147,9 +135,7 @@ void REGPARAM2 CPUFUNC(op_0038_12)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -166,9 +152,7 @@ void REGPARAM2 CPUFUNC(op_0039_12)(uae_u32 opcode)
 	dsta |= get_word_ce000_prefetch (8);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (10);
@@ -199,9 +183,7 @@ void REGPARAM2 CPUFUNC(op_0040_12)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce000_prefetch (4);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -222,9 +204,7 @@ void REGPARAM2 CPUFUNC(op_0050_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -247,9 +227,7 @@ void REGPARAM2 CPUFUNC(op_0058_12)(uae_u32 opcode)
 {{	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -274,9 +252,7 @@ void REGPARAM2 CPUFUNC(op_0060_12)(uae_u32 opcode)
 {{	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -298,9 +274,7 @@ void REGPARAM2 CPUFUNC(op_0068_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -324,9 +298,7 @@ void REGPARAM2 CPUFUNC(op_0070_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -347,9 +319,7 @@ void REGPARAM2 CPUFUNC(op_0078_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -372,9 +342,7 @@ void REGPARAM2 CPUFUNC(op_0079_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (10);
@@ -409,9 +377,7 @@ void REGPARAM2 CPUFUNC(op_0080_12)(uae_u32 opcode)
 	src |= get_word_ce000_prefetch (6);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -435,9 +401,7 @@ void REGPARAM2 CPUFUNC(op_0090_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -462,9 +426,7 @@ void REGPARAM2 CPUFUNC(op_0098_12)(uae_u32 opcode)
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	m68k_areg (regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -491,9 +453,7 @@ void REGPARAM2 CPUFUNC(op_00a0_12)(uae_u32 opcode)
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -517,9 +477,7 @@ void REGPARAM2 CPUFUNC(op_00a8_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (10);
@@ -545,9 +503,7 @@ void REGPARAM2 CPUFUNC(op_00b0_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (10);
@@ -570,9 +526,7 @@ void REGPARAM2 CPUFUNC(op_00b8_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (10);
@@ -597,9 +551,7 @@ void REGPARAM2 CPUFUNC(op_00b9_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (12);
@@ -1471,9 +1423,7 @@ void REGPARAM2 CPUFUNC(op_0200_12)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce000_prefetch (4);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -1489,9 +1439,7 @@ void REGPARAM2 CPUFUNC(op_0210_12)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -1508,9 +1456,7 @@ void REGPARAM2 CPUFUNC(op_0218_12)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -1529,9 +1475,7 @@ void REGPARAM2 CPUFUNC(op_0220_12)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -1547,9 +1491,7 @@ void REGPARAM2 CPUFUNC(op_0228_12)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -1567,9 +1509,7 @@ void REGPARAM2 CPUFUNC(op_0230_12)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (6));
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -1584,9 +1524,7 @@ void REGPARAM2 CPUFUNC(op_0238_12)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -1603,9 +1541,7 @@ void REGPARAM2 CPUFUNC(op_0239_12)(uae_u32 opcode)
 	dsta |= get_word_ce000_prefetch (8);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (10);
@@ -1636,9 +1572,7 @@ void REGPARAM2 CPUFUNC(op_0240_12)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce000_prefetch (4);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -1659,9 +1593,7 @@ void REGPARAM2 CPUFUNC(op_0250_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -1684,9 +1616,7 @@ void REGPARAM2 CPUFUNC(op_0258_12)(uae_u32 opcode)
 {{	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -1711,9 +1641,7 @@ void REGPARAM2 CPUFUNC(op_0260_12)(uae_u32 opcode)
 {{	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -1735,9 +1663,7 @@ void REGPARAM2 CPUFUNC(op_0268_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -1761,9 +1687,7 @@ void REGPARAM2 CPUFUNC(op_0270_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -1784,9 +1708,7 @@ void REGPARAM2 CPUFUNC(op_0278_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -1809,9 +1731,7 @@ void REGPARAM2 CPUFUNC(op_0279_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (10);
@@ -1846,9 +1766,7 @@ void REGPARAM2 CPUFUNC(op_0280_12)(uae_u32 opcode)
 	src |= get_word_ce000_prefetch (6);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -1872,9 +1790,7 @@ void REGPARAM2 CPUFUNC(op_0290_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -1899,9 +1815,7 @@ void REGPARAM2 CPUFUNC(op_0298_12)(uae_u32 opcode)
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	m68k_areg (regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -1928,9 +1842,7 @@ void REGPARAM2 CPUFUNC(op_02a0_12)(uae_u32 opcode)
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -1954,9 +1866,7 @@ void REGPARAM2 CPUFUNC(op_02a8_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (10);
@@ -1982,9 +1892,7 @@ void REGPARAM2 CPUFUNC(op_02b0_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (10);
@@ -2007,9 +1915,7 @@ void REGPARAM2 CPUFUNC(op_02b8_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (10);
@@ -2034,9 +1940,7 @@ void REGPARAM2 CPUFUNC(op_02b9_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (12);
@@ -2058,11 +1962,9 @@ void REGPARAM2 CPUFUNC(op_0400_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (4);
 } /* 8 (2/0) */
@@ -2081,11 +1983,9 @@ void REGPARAM2 CPUFUNC(op_0410_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -2105,11 +2005,9 @@ void REGPARAM2 CPUFUNC(op_0418_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -2131,11 +2029,9 @@ void REGPARAM2 CPUFUNC(op_0420_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 18 (3/1) */
@@ -2154,11 +2050,9 @@ void REGPARAM2 CPUFUNC(op_0428_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 } /* 20 (4/1) */
@@ -2179,11 +2073,9 @@ void REGPARAM2 CPUFUNC(op_0430_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 } /* 22 (4/1) */
@@ -2201,11 +2093,9 @@ void REGPARAM2 CPUFUNC(op_0438_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 } /* 20 (4/1) */
@@ -2225,11 +2115,9 @@ void REGPARAM2 CPUFUNC(op_0439_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (8);
 } /* 24 (5/1) */
@@ -2247,11 +2135,9 @@ void REGPARAM2 CPUFUNC(op_0440_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (4);
 } /* 8 (2/0) */
@@ -2275,11 +2161,9 @@ void REGPARAM2 CPUFUNC(op_0450_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3841: ;
@@ -2305,11 +2189,9 @@ void REGPARAM2 CPUFUNC(op_0458_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3842: ;
@@ -2337,11 +2219,9 @@ void REGPARAM2 CPUFUNC(op_0460_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3843: ;
@@ -2366,11 +2246,9 @@ void REGPARAM2 CPUFUNC(op_0468_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel3844: ;
@@ -2397,11 +2275,9 @@ void REGPARAM2 CPUFUNC(op_0470_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel3845: ;
@@ -2425,11 +2301,9 @@ void REGPARAM2 CPUFUNC(op_0478_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel3846: ;
@@ -2455,11 +2329,9 @@ void REGPARAM2 CPUFUNC(op_0479_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (8);
 endlabel3847: ;
@@ -2481,11 +2353,9 @@ void REGPARAM2 CPUFUNC(op_0480_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (6);
 } /* 16 (3/0) */
@@ -2511,11 +2381,9 @@ void REGPARAM2 CPUFUNC(op_0490_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (6);
 endlabel3849: ;
@@ -2543,11 +2411,9 @@ void REGPARAM2 CPUFUNC(op_0498_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (6);
 endlabel3850: ;
@@ -2577,11 +2443,9 @@ void REGPARAM2 CPUFUNC(op_04a0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (6);
 endlabel3851: ;
@@ -2608,11 +2472,9 @@ void REGPARAM2 CPUFUNC(op_04a8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (8);
 endlabel3852: ;
@@ -2641,11 +2503,9 @@ void REGPARAM2 CPUFUNC(op_04b0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (8);
 endlabel3853: ;
@@ -2671,11 +2531,9 @@ void REGPARAM2 CPUFUNC(op_04b8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (8);
 endlabel3854: ;
@@ -2703,11 +2561,9 @@ void REGPARAM2 CPUFUNC(op_04b9_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (10);
 endlabel3855: ;
@@ -2726,11 +2582,9 @@ void REGPARAM2 CPUFUNC(op_0600_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (4);
 } /* 8 (2/0) */
@@ -2749,11 +2603,9 @@ void REGPARAM2 CPUFUNC(op_0610_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -2773,11 +2625,9 @@ void REGPARAM2 CPUFUNC(op_0618_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -2799,11 +2649,9 @@ void REGPARAM2 CPUFUNC(op_0620_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 18 (3/1) */
@@ -2822,11 +2670,9 @@ void REGPARAM2 CPUFUNC(op_0628_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 } /* 20 (4/1) */
@@ -2847,11 +2693,9 @@ void REGPARAM2 CPUFUNC(op_0630_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 } /* 22 (4/1) */
@@ -2869,11 +2713,9 @@ void REGPARAM2 CPUFUNC(op_0638_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 } /* 20 (4/1) */
@@ -2893,11 +2735,9 @@ void REGPARAM2 CPUFUNC(op_0639_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (8);
 } /* 24 (5/1) */
@@ -2915,11 +2755,9 @@ void REGPARAM2 CPUFUNC(op_0640_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (4);
 } /* 8 (2/0) */
@@ -2943,11 +2781,9 @@ void REGPARAM2 CPUFUNC(op_0650_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3865: ;
@@ -2973,11 +2809,9 @@ void REGPARAM2 CPUFUNC(op_0658_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3866: ;
@@ -3005,11 +2839,9 @@ void REGPARAM2 CPUFUNC(op_0660_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel3867: ;
@@ -3034,11 +2866,9 @@ void REGPARAM2 CPUFUNC(op_0668_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel3868: ;
@@ -3065,11 +2895,9 @@ void REGPARAM2 CPUFUNC(op_0670_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel3869: ;
@@ -3093,11 +2921,9 @@ void REGPARAM2 CPUFUNC(op_0678_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel3870: ;
@@ -3123,11 +2949,9 @@ void REGPARAM2 CPUFUNC(op_0679_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (8);
 endlabel3871: ;
@@ -3149,11 +2973,9 @@ void REGPARAM2 CPUFUNC(op_0680_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (6);
 } /* 16 (3/0) */
@@ -3179,11 +3001,9 @@ void REGPARAM2 CPUFUNC(op_0690_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (6);
 endlabel3873: ;
@@ -3211,11 +3031,9 @@ void REGPARAM2 CPUFUNC(op_0698_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (6);
 endlabel3874: ;
@@ -3245,11 +3063,9 @@ void REGPARAM2 CPUFUNC(op_06a0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (6);
 endlabel3875: ;
@@ -3276,11 +3092,9 @@ void REGPARAM2 CPUFUNC(op_06a8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (8);
 endlabel3876: ;
@@ -3309,11 +3123,9 @@ void REGPARAM2 CPUFUNC(op_06b0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (8);
 endlabel3877: ;
@@ -3339,11 +3151,9 @@ void REGPARAM2 CPUFUNC(op_06b8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (8);
 endlabel3878: ;
@@ -3371,11 +3181,9 @@ void REGPARAM2 CPUFUNC(op_06b9_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (10);
 endlabel3879: ;
@@ -4145,9 +3953,7 @@ void REGPARAM2 CPUFUNC(op_0a00_12)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce000_prefetch (4);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -4163,9 +3969,7 @@ void REGPARAM2 CPUFUNC(op_0a10_12)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -4182,9 +3986,7 @@ void REGPARAM2 CPUFUNC(op_0a18_12)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -4203,9 +4005,7 @@ void REGPARAM2 CPUFUNC(op_0a20_12)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -4221,9 +4021,7 @@ void REGPARAM2 CPUFUNC(op_0a28_12)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -4241,9 +4039,7 @@ void REGPARAM2 CPUFUNC(op_0a30_12)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (6));
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -4258,9 +4054,7 @@ void REGPARAM2 CPUFUNC(op_0a38_12)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -4277,9 +4071,7 @@ void REGPARAM2 CPUFUNC(op_0a39_12)(uae_u32 opcode)
 	dsta |= get_word_ce000_prefetch (8);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (10);
@@ -4310,9 +4102,7 @@ void REGPARAM2 CPUFUNC(op_0a40_12)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce000_prefetch (4);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -4333,9 +4123,7 @@ void REGPARAM2 CPUFUNC(op_0a50_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -4358,9 +4146,7 @@ void REGPARAM2 CPUFUNC(op_0a58_12)(uae_u32 opcode)
 {{	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -4385,9 +4171,7 @@ void REGPARAM2 CPUFUNC(op_0a60_12)(uae_u32 opcode)
 {{	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -4409,9 +4193,7 @@ void REGPARAM2 CPUFUNC(op_0a68_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -4435,9 +4217,7 @@ void REGPARAM2 CPUFUNC(op_0a70_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -4458,9 +4238,7 @@ void REGPARAM2 CPUFUNC(op_0a78_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -4483,9 +4261,7 @@ void REGPARAM2 CPUFUNC(op_0a79_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (10);
@@ -4520,9 +4296,7 @@ void REGPARAM2 CPUFUNC(op_0a80_12)(uae_u32 opcode)
 	src |= get_word_ce000_prefetch (6);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -4549,9 +4323,7 @@ void REGPARAM2 CPUFUNC(op_0a90_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -4576,9 +4348,7 @@ void REGPARAM2 CPUFUNC(op_0a98_12)(uae_u32 opcode)
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	m68k_areg (regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -4605,9 +4375,7 @@ void REGPARAM2 CPUFUNC(op_0aa0_12)(uae_u32 opcode)
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -4631,9 +4399,7 @@ void REGPARAM2 CPUFUNC(op_0aa8_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (10);
@@ -4659,9 +4425,7 @@ void REGPARAM2 CPUFUNC(op_0ab0_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (10);
@@ -4684,9 +4448,7 @@ void REGPARAM2 CPUFUNC(op_0ab8_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (10);
@@ -4711,9 +4473,7 @@ void REGPARAM2 CPUFUNC(op_0ab9_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (12);
@@ -4735,10 +4495,8 @@ void REGPARAM2 CPUFUNC(op_0c00_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (4);
 } /* 8 (2/0) */
 
@@ -4756,10 +4514,8 @@ void REGPARAM2 CPUFUNC(op_0c10_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 } /* 12 (3/0) */
 
@@ -4778,10 +4534,8 @@ void REGPARAM2 CPUFUNC(op_0c18_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 } /* 12 (3/0) */
 
@@ -4802,10 +4556,8 @@ void REGPARAM2 CPUFUNC(op_0c20_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 } /* 14 (3/0) */
 
@@ -4823,10 +4575,8 @@ void REGPARAM2 CPUFUNC(op_0c28_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 } /* 16 (4/0) */
 
@@ -4846,10 +4596,8 @@ void REGPARAM2 CPUFUNC(op_0c30_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 } /* 18 (4/0) */
 
@@ -4866,10 +4614,8 @@ void REGPARAM2 CPUFUNC(op_0c38_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 } /* 16 (4/0) */
 
@@ -4888,10 +4634,8 @@ void REGPARAM2 CPUFUNC(op_0c39_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (8);
 } /* 20 (5/0) */
 
@@ -4908,10 +4652,8 @@ void REGPARAM2 CPUFUNC(op_0c40_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (4);
 } /* 8 (2/0) */
 
@@ -4934,10 +4676,8 @@ void REGPARAM2 CPUFUNC(op_0c50_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3956: ;
 } /* 12 (3/0) */
@@ -4962,10 +4702,8 @@ void REGPARAM2 CPUFUNC(op_0c58_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3957: ;
 } /* 12 (3/0) */
@@ -4992,10 +4730,8 @@ void REGPARAM2 CPUFUNC(op_0c60_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel3958: ;
 } /* 14 (3/0) */
@@ -5019,10 +4755,8 @@ void REGPARAM2 CPUFUNC(op_0c68_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel3959: ;
 } /* 16 (4/0) */
@@ -5048,10 +4782,8 @@ void REGPARAM2 CPUFUNC(op_0c70_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel3960: ;
 } /* 18 (4/0) */
@@ -5074,10 +4806,8 @@ void REGPARAM2 CPUFUNC(op_0c78_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel3961: ;
 } /* 16 (4/0) */
@@ -5102,10 +4832,8 @@ void REGPARAM2 CPUFUNC(op_0c79_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (8);
 endlabel3962: ;
 } /* 20 (5/0) */
@@ -5126,10 +4854,8 @@ void REGPARAM2 CPUFUNC(op_0c80_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (6);
 } /* 14 (3/0) */
 
@@ -5154,10 +4880,8 @@ void REGPARAM2 CPUFUNC(op_0c90_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel3964: ;
 } /* 20 (5/0) */
@@ -5184,10 +4908,8 @@ void REGPARAM2 CPUFUNC(op_0c98_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel3965: ;
 } /* 20 (5/0) */
@@ -5216,10 +4938,8 @@ void REGPARAM2 CPUFUNC(op_0ca0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel3966: ;
 } /* 22 (5/0) */
@@ -5245,10 +4965,8 @@ void REGPARAM2 CPUFUNC(op_0ca8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (8);
 endlabel3967: ;
 } /* 24 (6/0) */
@@ -5276,10 +4994,8 @@ void REGPARAM2 CPUFUNC(op_0cb0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (8);
 endlabel3968: ;
 } /* 26 (6/0) */
@@ -5304,10 +5020,8 @@ void REGPARAM2 CPUFUNC(op_0cb8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (8);
 endlabel3969: ;
 } /* 24 (6/0) */
@@ -5334,10 +5048,8 @@ void REGPARAM2 CPUFUNC(op_0cb9_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (10);
 endlabel3970: ;
 } /* 28 (7/0) */
@@ -5348,9 +5060,7 @@ void REGPARAM2 CPUFUNC(op_1000_12)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -5365,9 +5075,7 @@ void REGPARAM2 CPUFUNC(op_1010_12)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -5383,9 +5091,7 @@ void REGPARAM2 CPUFUNC(op_1018_12)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -5403,9 +5109,7 @@ void REGPARAM2 CPUFUNC(op_1020_12)(uae_u32 opcode)
 	do_cycles_ce000 (2);
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -5420,9 +5124,7 @@ void REGPARAM2 CPUFUNC(op_1028_12)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5439,9 +5141,7 @@ void REGPARAM2 CPUFUNC(op_1030_12)(uae_u32 opcode)
 	do_cycles_ce000 (2);
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_ce000_prefetch (4));
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5455,9 +5155,7 @@ void REGPARAM2 CPUFUNC(op_1038_12)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5473,9 +5171,7 @@ void REGPARAM2 CPUFUNC(op_1039_12)(uae_u32 opcode)
 	srca = get_word_ce000_prefetch (4) << 16;
 	srca |= get_word_ce000_prefetch (6);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -5490,9 +5186,7 @@ void REGPARAM2 CPUFUNC(op_103a_12)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5510,9 +5204,7 @@ void REGPARAM2 CPUFUNC(op_103b_12)(uae_u32 opcode)
 	do_cycles_ce000 (2);
 	srca = get_disp_ea_000 (tmppc, get_word_ce000_prefetch (4));
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5525,9 +5217,7 @@ void REGPARAM2 CPUFUNC(op_103c_12)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = (uae_u8)get_word_ce000_prefetch (4);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5542,9 +5232,7 @@ void REGPARAM2 CPUFUNC(op_1080_12)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -5560,9 +5248,7 @@ void REGPARAM2 CPUFUNC(op_1090_12)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -5579,9 +5265,7 @@ void REGPARAM2 CPUFUNC(op_1098_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -5600,9 +5284,7 @@ void REGPARAM2 CPUFUNC(op_10a0_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -5618,9 +5300,7 @@ void REGPARAM2 CPUFUNC(op_10a8_12)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5638,9 +5318,7 @@ void REGPARAM2 CPUFUNC(op_10b0_12)(uae_u32 opcode)
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_ce000_prefetch (4));
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5655,9 +5333,7 @@ void REGPARAM2 CPUFUNC(op_10b8_12)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5674,9 +5350,7 @@ void REGPARAM2 CPUFUNC(op_10b9_12)(uae_u32 opcode)
 	srca |= get_word_ce000_prefetch (6);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -5692,9 +5366,7 @@ void REGPARAM2 CPUFUNC(op_10ba_12)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5713,9 +5385,7 @@ void REGPARAM2 CPUFUNC(op_10bb_12)(uae_u32 opcode)
 	srca = get_disp_ea_000 (tmppc, get_word_ce000_prefetch (4));
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5729,9 +5399,7 @@ void REGPARAM2 CPUFUNC(op_10bc_12)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = (uae_u8)get_word_ce000_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5747,9 +5415,7 @@ void REGPARAM2 CPUFUNC(op_10c0_12)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -5766,9 +5432,7 @@ void REGPARAM2 CPUFUNC(op_10d0_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -5786,9 +5450,7 @@ void REGPARAM2 CPUFUNC(op_10d8_12)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -5808,9 +5470,7 @@ void REGPARAM2 CPUFUNC(op_10e0_12)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -5827,9 +5487,7 @@ void REGPARAM2 CPUFUNC(op_10e8_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5848,9 +5506,7 @@ void REGPARAM2 CPUFUNC(op_10f0_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5866,9 +5522,7 @@ void REGPARAM2 CPUFUNC(op_10f8_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5886,9 +5540,7 @@ void REGPARAM2 CPUFUNC(op_10f9_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -5905,9 +5557,7 @@ void REGPARAM2 CPUFUNC(op_10fa_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5927,9 +5577,7 @@ void REGPARAM2 CPUFUNC(op_10fb_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5944,9 +5592,7 @@ void REGPARAM2 CPUFUNC(op_10fc_12)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce000_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -5966,9 +5612,7 @@ void REGPARAM2 CPUFUNC(op_1100_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}} /* 8 (1/1) */
@@ -5986,9 +5630,7 @@ void REGPARAM2 CPUFUNC(op_1110_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}} /* 12 (2/1) */
@@ -6007,9 +5649,7 @@ void REGPARAM2 CPUFUNC(op_1118_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}} /* 12 (2/1) */
@@ -6030,9 +5670,7 @@ void REGPARAM2 CPUFUNC(op_1120_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}} /* 14 (2/1) */
@@ -6050,9 +5688,7 @@ void REGPARAM2 CPUFUNC(op_1128_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}} /* 16 (3/1) */
@@ -6072,9 +5708,7 @@ void REGPARAM2 CPUFUNC(op_1130_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}} /* 18 (3/1) */
@@ -6091,9 +5725,7 @@ void REGPARAM2 CPUFUNC(op_1138_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}} /* 16 (3/1) */
@@ -6112,9 +5744,7 @@ void REGPARAM2 CPUFUNC(op_1139_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}} /* 20 (4/1) */
@@ -6132,9 +5762,7 @@ void REGPARAM2 CPUFUNC(op_113a_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}} /* 16 (3/1) */
@@ -6155,9 +5783,7 @@ void REGPARAM2 CPUFUNC(op_113b_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}} /* 18 (3/1) */
@@ -6173,9 +5799,7 @@ void REGPARAM2 CPUFUNC(op_113c_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}} /* 12 (2/1) */
@@ -6187,9 +5811,7 @@ void REGPARAM2 CPUFUNC(op_1140_12)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6205,9 +5827,7 @@ void REGPARAM2 CPUFUNC(op_1150_12)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6224,9 +5844,7 @@ void REGPARAM2 CPUFUNC(op_1158_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6245,9 +5863,7 @@ void REGPARAM2 CPUFUNC(op_1160_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6263,9 +5879,7 @@ void REGPARAM2 CPUFUNC(op_1168_12)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6283,9 +5897,7 @@ void REGPARAM2 CPUFUNC(op_1170_12)(uae_u32 opcode)
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_ce000_prefetch (4));
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6300,9 +5912,7 @@ void REGPARAM2 CPUFUNC(op_1178_12)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6319,9 +5929,7 @@ void REGPARAM2 CPUFUNC(op_1179_12)(uae_u32 opcode)
 	srca |= get_word_ce000_prefetch (6);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
@@ -6337,9 +5945,7 @@ void REGPARAM2 CPUFUNC(op_117a_12)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6358,9 +5964,7 @@ void REGPARAM2 CPUFUNC(op_117b_12)(uae_u32 opcode)
 	srca = get_disp_ea_000 (tmppc, get_word_ce000_prefetch (4));
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6374,9 +5978,7 @@ void REGPARAM2 CPUFUNC(op_117c_12)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = (uae_u8)get_word_ce000_prefetch (4);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6393,9 +5995,7 @@ void REGPARAM2 CPUFUNC(op_1180_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	do_cycles_ce000 (2);
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (4));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6413,9 +6013,7 @@ void REGPARAM2 CPUFUNC(op_1190_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	do_cycles_ce000 (2);
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (4));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6434,9 +6032,7 @@ void REGPARAM2 CPUFUNC(op_1198_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	do_cycles_ce000 (2);
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (4));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6457,9 +6053,7 @@ void REGPARAM2 CPUFUNC(op_11a0_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	do_cycles_ce000 (2);
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (4));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6477,9 +6071,7 @@ void REGPARAM2 CPUFUNC(op_11a8_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	do_cycles_ce000 (2);
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (6));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6499,9 +6091,7 @@ void REGPARAM2 CPUFUNC(op_11b0_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	do_cycles_ce000 (2);
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (6));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6518,9 +6108,7 @@ void REGPARAM2 CPUFUNC(op_11b8_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	do_cycles_ce000 (2);
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (6));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6539,9 +6127,7 @@ void REGPARAM2 CPUFUNC(op_11b9_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	do_cycles_ce000 (2);
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (8));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
@@ -6559,9 +6145,7 @@ void REGPARAM2 CPUFUNC(op_11ba_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	do_cycles_ce000 (2);
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (6));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6582,9 +6166,7 @@ void REGPARAM2 CPUFUNC(op_11bb_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	do_cycles_ce000 (2);
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (6));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6600,9 +6182,7 @@ void REGPARAM2 CPUFUNC(op_11bc_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	do_cycles_ce000 (2);
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (6));
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6616,9 +6196,7 @@ void REGPARAM2 CPUFUNC(op_11c0_12)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6633,9 +6211,7 @@ void REGPARAM2 CPUFUNC(op_11d0_12)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6651,9 +6227,7 @@ void REGPARAM2 CPUFUNC(op_11d8_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6671,9 +6245,7 @@ void REGPARAM2 CPUFUNC(op_11e0_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -6688,9 +6260,7 @@ void REGPARAM2 CPUFUNC(op_11e8_12)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6707,9 +6277,7 @@ void REGPARAM2 CPUFUNC(op_11f0_12)(uae_u32 opcode)
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_ce000_prefetch (4));
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6723,9 +6291,7 @@ void REGPARAM2 CPUFUNC(op_11f8_12)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6741,9 +6307,7 @@ void REGPARAM2 CPUFUNC(op_11f9_12)(uae_u32 opcode)
 	srca |= get_word_ce000_prefetch (6);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
@@ -6758,9 +6322,7 @@ void REGPARAM2 CPUFUNC(op_11fa_12)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6778,9 +6340,7 @@ void REGPARAM2 CPUFUNC(op_11fb_12)(uae_u32 opcode)
 	srca = get_disp_ea_000 (tmppc, get_word_ce000_prefetch (4));
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6793,9 +6353,7 @@ void REGPARAM2 CPUFUNC(op_11fc_12)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_ce000_prefetch (4);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6811,9 +6369,7 @@ void REGPARAM2 CPUFUNC(op_13c0_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = get_word_ce000_prefetch (4) << 16;
 	dsta |= get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -6830,9 +6386,7 @@ void REGPARAM2 CPUFUNC(op_13d0_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = get_word_ce000_prefetch (4) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	get_word_ce000_prefetch (0);
@@ -6851,9 +6405,7 @@ void REGPARAM2 CPUFUNC(op_13d8_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = get_word_ce000_prefetch (4) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	get_word_ce000_prefetch (0);
@@ -6874,9 +6426,7 @@ void REGPARAM2 CPUFUNC(op_13e0_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = get_word_ce000_prefetch (4) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 	get_word_ce000_prefetch (0);
@@ -6894,9 +6444,7 @@ void REGPARAM2 CPUFUNC(op_13e8_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = get_word_ce000_prefetch (6) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 	get_word_ce000_prefetch (0);
@@ -6916,9 +6464,7 @@ void REGPARAM2 CPUFUNC(op_13f0_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = get_word_ce000_prefetch (6) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 	get_word_ce000_prefetch (0);
@@ -6935,9 +6481,7 @@ void REGPARAM2 CPUFUNC(op_13f8_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = get_word_ce000_prefetch (6) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 	get_word_ce000_prefetch (0);
@@ -6956,9 +6500,7 @@ void REGPARAM2 CPUFUNC(op_13f9_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = get_word_ce000_prefetch (8) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (10);
 	get_word_ce000_prefetch (0);
@@ -6976,9 +6518,7 @@ void REGPARAM2 CPUFUNC(op_13fa_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = get_word_ce000_prefetch (6) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 	get_word_ce000_prefetch (0);
@@ -6999,9 +6539,7 @@ void REGPARAM2 CPUFUNC(op_13fb_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = get_word_ce000_prefetch (6) << 16;
 	dsta |= regs.irc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 	get_word_ce000_prefetch (0);
@@ -7017,9 +6555,7 @@ void REGPARAM2 CPUFUNC(op_13fc_12)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = get_word_ce000_prefetch (6) << 16;
 	dsta |= get_word_ce000_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
@@ -7033,9 +6569,7 @@ void REGPARAM2 CPUFUNC(op_2000_12)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -7049,9 +6583,7 @@ void REGPARAM2 CPUFUNC(op_2008_12)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -7070,9 +6602,7 @@ void REGPARAM2 CPUFUNC(op_2010_12)(uae_u32 opcode)
 		goto endlabel4061;
 	}
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -7093,9 +6623,7 @@ void REGPARAM2 CPUFUNC(op_2018_12)(uae_u32 opcode)
 	}
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
 	m68k_areg (regs, srcreg) += 4;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -7118,9 +6646,7 @@ void REGPARAM2 CPUFUNC(op_2020_12)(uae_u32 opcode)
 	}
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -7141,9 +6667,7 @@ void REGPARAM2 CPUFUNC(op_2028_12)(uae_u32 opcode)
 		goto endlabel4064;
 	}
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -7166,9 +6690,7 @@ void REGPARAM2 CPUFUNC(op_2030_12)(uae_u32 opcode)
 		goto endlabel4065;
 	}
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -7188,9 +6710,7 @@ void REGPARAM2 CPUFUNC(op_2038_12)(uae_u32 opcode)
 		goto endlabel4066;
 	}
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -7212,9 +6732,7 @@ void REGPARAM2 CPUFUNC(op_2039_12)(uae_u32 opcode)
 		goto endlabel4067;
 	}
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -7235,9 +6753,7 @@ void REGPARAM2 CPUFUNC(op_203a_12)(uae_u32 opcode)
 		goto endlabel4068;
 	}
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -7261,9 +6777,7 @@ void REGPARAM2 CPUFUNC(op_203b_12)(uae_u32 opcode)
 		goto endlabel4069;
 	}
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -7279,9 +6793,7 @@ void REGPARAM2 CPUFUNC(op_203c_12)(uae_u32 opcode)
 {{	uae_s32 src;
 	src = get_word_ce000_prefetch (4) << 16;
 	src |= get_word_ce000_prefetch (6);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -7527,9 +7039,7 @@ void REGPARAM2 CPUFUNC(op_2080_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4083;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -7550,9 +7060,7 @@ void REGPARAM2 CPUFUNC(op_2088_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4084;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -7578,9 +7086,7 @@ void REGPARAM2 CPUFUNC(op_2090_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4085;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -7607,9 +7113,7 @@ void REGPARAM2 CPUFUNC(op_2098_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4086;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -7638,9 +7142,7 @@ void REGPARAM2 CPUFUNC(op_20a0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4087;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -7667,9 +7169,7 @@ void REGPARAM2 CPUFUNC(op_20a8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4088;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -7698,9 +7198,7 @@ void REGPARAM2 CPUFUNC(op_20b0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4089;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -7726,9 +7224,7 @@ void REGPARAM2 CPUFUNC(op_20b8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4090;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -7756,9 +7252,7 @@ void REGPARAM2 CPUFUNC(op_20b9_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4091;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -7785,9 +7279,7 @@ void REGPARAM2 CPUFUNC(op_20ba_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4092;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -7817,9 +7309,7 @@ void REGPARAM2 CPUFUNC(op_20bb_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4093;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -7841,9 +7331,7 @@ void REGPARAM2 CPUFUNC(op_20bc_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4094;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -7865,9 +7353,7 @@ void REGPARAM2 CPUFUNC(op_20c0_12)(uae_u32 opcode)
 		goto endlabel4095;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -7889,9 +7375,7 @@ void REGPARAM2 CPUFUNC(op_20c8_12)(uae_u32 opcode)
 		goto endlabel4096;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -7918,9 +7402,7 @@ void REGPARAM2 CPUFUNC(op_20d0_12)(uae_u32 opcode)
 		goto endlabel4097;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -7948,9 +7430,7 @@ void REGPARAM2 CPUFUNC(op_20d8_12)(uae_u32 opcode)
 		goto endlabel4098;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -7980,9 +7460,7 @@ void REGPARAM2 CPUFUNC(op_20e0_12)(uae_u32 opcode)
 		goto endlabel4099;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -8010,9 +7488,7 @@ void REGPARAM2 CPUFUNC(op_20e8_12)(uae_u32 opcode)
 		goto endlabel4100;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -8042,9 +7518,7 @@ void REGPARAM2 CPUFUNC(op_20f0_12)(uae_u32 opcode)
 		goto endlabel4101;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -8071,9 +7545,7 @@ void REGPARAM2 CPUFUNC(op_20f8_12)(uae_u32 opcode)
 		goto endlabel4102;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -8102,9 +7574,7 @@ void REGPARAM2 CPUFUNC(op_20f9_12)(uae_u32 opcode)
 		goto endlabel4103;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -8132,9 +7602,7 @@ void REGPARAM2 CPUFUNC(op_20fa_12)(uae_u32 opcode)
 		goto endlabel4104;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -8165,9 +7633,7 @@ void REGPARAM2 CPUFUNC(op_20fb_12)(uae_u32 opcode)
 		goto endlabel4105;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -8190,9 +7656,7 @@ void REGPARAM2 CPUFUNC(op_20fc_12)(uae_u32 opcode)
 		goto endlabel4106;
 	}
 {	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -8218,9 +7682,7 @@ void REGPARAM2 CPUFUNC(op_2100_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (2);
 }}}}endlabel4107: ;
@@ -8243,9 +7705,7 @@ void REGPARAM2 CPUFUNC(op_2108_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (2);
 }}}}endlabel4108: ;
@@ -8273,9 +7733,7 @@ void REGPARAM2 CPUFUNC(op_2110_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (2);
 }}}}}}endlabel4109: ;
@@ -8304,9 +7762,7 @@ void REGPARAM2 CPUFUNC(op_2118_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (2);
 }}}}}}endlabel4110: ;
@@ -8337,9 +7793,7 @@ void REGPARAM2 CPUFUNC(op_2120_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (2);
 }}}}}}endlabel4111: ;
@@ -8368,9 +7822,7 @@ void REGPARAM2 CPUFUNC(op_2128_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 }}}}}}endlabel4112: ;
@@ -8401,9 +7853,7 @@ void REGPARAM2 CPUFUNC(op_2130_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 }}}}}}endlabel4113: ;
@@ -8431,9 +7881,7 @@ void REGPARAM2 CPUFUNC(op_2138_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 }}}}}}endlabel4114: ;
@@ -8463,9 +7911,7 @@ void REGPARAM2 CPUFUNC(op_2139_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 }}}}}}endlabel4115: ;
@@ -8494,9 +7940,7 @@ void REGPARAM2 CPUFUNC(op_213a_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 }}}}}}endlabel4116: ;
@@ -8528,9 +7972,7 @@ void REGPARAM2 CPUFUNC(op_213b_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 }}}}}}endlabel4117: ;
@@ -8554,9 +7996,7 @@ void REGPARAM2 CPUFUNC(op_213c_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 }}}}endlabel4118: ;
@@ -8574,9 +8014,7 @@ void REGPARAM2 CPUFUNC(op_2140_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4119;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -8597,9 +8035,7 @@ void REGPARAM2 CPUFUNC(op_2148_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4120;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -8625,9 +8061,7 @@ void REGPARAM2 CPUFUNC(op_2150_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4121;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -8654,9 +8088,7 @@ void REGPARAM2 CPUFUNC(op_2158_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4122;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -8685,9 +8117,7 @@ void REGPARAM2 CPUFUNC(op_2160_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4123;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -8714,9 +8144,7 @@ void REGPARAM2 CPUFUNC(op_2168_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4124;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -8748,9 +8176,7 @@ void REGPARAM2 CPUFUNC(op_2170_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4125;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -8776,9 +8202,7 @@ void REGPARAM2 CPUFUNC(op_2178_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4126;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -8806,9 +8230,7 @@ void REGPARAM2 CPUFUNC(op_2179_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4127;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
@@ -8835,9 +8257,7 @@ void REGPARAM2 CPUFUNC(op_217a_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4128;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -8867,9 +8287,7 @@ void REGPARAM2 CPUFUNC(op_217b_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4129;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -8891,9 +8309,7 @@ void REGPARAM2 CPUFUNC(op_217c_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4130;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
@@ -8916,9 +8332,7 @@ void REGPARAM2 CPUFUNC(op_2180_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4131;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -8941,9 +8355,7 @@ void REGPARAM2 CPUFUNC(op_2188_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4132;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -8971,9 +8383,7 @@ void REGPARAM2 CPUFUNC(op_2190_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4133;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -9002,9 +8412,7 @@ void REGPARAM2 CPUFUNC(op_2198_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4134;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -9035,9 +8443,7 @@ void REGPARAM2 CPUFUNC(op_21a0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4135;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -9066,9 +8472,7 @@ void REGPARAM2 CPUFUNC(op_21a8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4136;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -9099,9 +8503,7 @@ void REGPARAM2 CPUFUNC(op_21b0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4137;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -9129,9 +8531,7 @@ void REGPARAM2 CPUFUNC(op_21b8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4138;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -9161,9 +8561,7 @@ void REGPARAM2 CPUFUNC(op_21b9_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4139;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
@@ -9192,9 +8590,7 @@ void REGPARAM2 CPUFUNC(op_21ba_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4140;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -9226,9 +8622,7 @@ void REGPARAM2 CPUFUNC(op_21bb_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4141;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -9252,9 +8646,7 @@ void REGPARAM2 CPUFUNC(op_21bc_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4142;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
@@ -9274,9 +8666,7 @@ void REGPARAM2 CPUFUNC(op_21c0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4143;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -9296,9 +8686,7 @@ void REGPARAM2 CPUFUNC(op_21c8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4144;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -9323,9 +8711,7 @@ void REGPARAM2 CPUFUNC(op_21d0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4145;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -9351,9 +8737,7 @@ void REGPARAM2 CPUFUNC(op_21d8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4146;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -9381,9 +8765,7 @@ void REGPARAM2 CPUFUNC(op_21e0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4147;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -9409,9 +8791,7 @@ void REGPARAM2 CPUFUNC(op_21e8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4148;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -9439,9 +8819,7 @@ void REGPARAM2 CPUFUNC(op_21f0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4149;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -9466,9 +8844,7 @@ void REGPARAM2 CPUFUNC(op_21f8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4150;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -9495,9 +8871,7 @@ void REGPARAM2 CPUFUNC(op_21f9_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4151;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
@@ -9523,9 +8897,7 @@ void REGPARAM2 CPUFUNC(op_21fa_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4152;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -9554,9 +8926,7 @@ void REGPARAM2 CPUFUNC(op_21fb_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4153;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -9577,9 +8947,7 @@ void REGPARAM2 CPUFUNC(op_21fc_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4154;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
@@ -9601,9 +8969,7 @@ void REGPARAM2 CPUFUNC(op_23c0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4155;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -9625,9 +8991,7 @@ void REGPARAM2 CPUFUNC(op_23c8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4156;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -9654,9 +9018,7 @@ void REGPARAM2 CPUFUNC(op_23d0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4157;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	get_word_ce000_prefetch (0);
@@ -9685,9 +9047,7 @@ void REGPARAM2 CPUFUNC(op_23d8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4158;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	get_word_ce000_prefetch (0);
@@ -9718,9 +9078,7 @@ void REGPARAM2 CPUFUNC(op_23e0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4159;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (6);
 	get_word_ce000_prefetch (0);
@@ -9749,9 +9107,7 @@ void REGPARAM2 CPUFUNC(op_23e8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4160;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (8);
 	get_word_ce000_prefetch (0);
@@ -9782,9 +9138,7 @@ void REGPARAM2 CPUFUNC(op_23f0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4161;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (8);
 	get_word_ce000_prefetch (0);
@@ -9812,9 +9166,7 @@ void REGPARAM2 CPUFUNC(op_23f8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4162;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (8);
 	get_word_ce000_prefetch (0);
@@ -9844,9 +9196,7 @@ void REGPARAM2 CPUFUNC(op_23f9_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4163;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (10);
 	get_word_ce000_prefetch (0);
@@ -9875,9 +9225,7 @@ void REGPARAM2 CPUFUNC(op_23fa_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4164;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (8);
 	get_word_ce000_prefetch (0);
@@ -9909,9 +9257,7 @@ void REGPARAM2 CPUFUNC(op_23fb_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4165;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (8);
 	get_word_ce000_prefetch (0);
@@ -9935,9 +9281,7 @@ void REGPARAM2 CPUFUNC(op_23fc_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4166;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src >> 16); x_put_word (dsta + 2, src);
 	m68k_incpc (10);
 	regs.ir = regs.irc;
@@ -9952,9 +9296,7 @@ void REGPARAM2 CPUFUNC(op_3000_12)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -9968,9 +9310,7 @@ void REGPARAM2 CPUFUNC(op_3008_12)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -9989,9 +9329,7 @@ void REGPARAM2 CPUFUNC(op_3010_12)(uae_u32 opcode)
 		goto endlabel4169;
 	}
 {{	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -10012,9 +9350,7 @@ void REGPARAM2 CPUFUNC(op_3018_12)(uae_u32 opcode)
 	}
 {{	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -10037,9 +9373,7 @@ void REGPARAM2 CPUFUNC(op_3020_12)(uae_u32 opcode)
 	}
 {{	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -10060,9 +9394,7 @@ void REGPARAM2 CPUFUNC(op_3028_12)(uae_u32 opcode)
 		goto endlabel4172;
 	}
 {{	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -10085,9 +9417,7 @@ void REGPARAM2 CPUFUNC(op_3030_12)(uae_u32 opcode)
 		goto endlabel4173;
 	}
 {{	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -10107,9 +9437,7 @@ void REGPARAM2 CPUFUNC(op_3038_12)(uae_u32 opcode)
 		goto endlabel4174;
 	}
 {{	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -10131,9 +9459,7 @@ void REGPARAM2 CPUFUNC(op_3039_12)(uae_u32 opcode)
 		goto endlabel4175;
 	}
 {{	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -10154,9 +9480,7 @@ void REGPARAM2 CPUFUNC(op_303a_12)(uae_u32 opcode)
 		goto endlabel4176;
 	}
 {{	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -10180,9 +9504,7 @@ void REGPARAM2 CPUFUNC(op_303b_12)(uae_u32 opcode)
 		goto endlabel4177;
 	}
 {{	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -10196,9 +9518,7 @@ void REGPARAM2 CPUFUNC(op_303c_12)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_word_ce000_prefetch (4);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -10454,9 +9774,7 @@ void REGPARAM2 CPUFUNC(op_3080_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4191;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -10477,9 +9795,7 @@ void REGPARAM2 CPUFUNC(op_3088_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4192;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -10505,9 +9821,7 @@ void REGPARAM2 CPUFUNC(op_3090_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4193;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -10534,9 +9848,7 @@ void REGPARAM2 CPUFUNC(op_3098_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4194;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -10565,9 +9877,7 @@ void REGPARAM2 CPUFUNC(op_30a0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4195;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -10594,9 +9904,7 @@ void REGPARAM2 CPUFUNC(op_30a8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4196;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -10625,9 +9933,7 @@ void REGPARAM2 CPUFUNC(op_30b0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4197;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -10653,9 +9959,7 @@ void REGPARAM2 CPUFUNC(op_30b8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4198;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -10683,9 +9987,7 @@ void REGPARAM2 CPUFUNC(op_30b9_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4199;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -10712,9 +10014,7 @@ void REGPARAM2 CPUFUNC(op_30ba_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4200;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -10744,9 +10044,7 @@ void REGPARAM2 CPUFUNC(op_30bb_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4201;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -10766,9 +10064,7 @@ void REGPARAM2 CPUFUNC(op_30bc_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4202;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -10790,9 +10086,7 @@ void REGPARAM2 CPUFUNC(op_30c0_12)(uae_u32 opcode)
 		goto endlabel4203;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -10814,9 +10108,7 @@ void REGPARAM2 CPUFUNC(op_30c8_12)(uae_u32 opcode)
 		goto endlabel4204;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -10843,9 +10135,7 @@ void REGPARAM2 CPUFUNC(op_30d0_12)(uae_u32 opcode)
 		goto endlabel4205;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -10873,9 +10163,7 @@ void REGPARAM2 CPUFUNC(op_30d8_12)(uae_u32 opcode)
 		goto endlabel4206;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -10905,9 +10193,7 @@ void REGPARAM2 CPUFUNC(op_30e0_12)(uae_u32 opcode)
 		goto endlabel4207;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -10935,9 +10221,7 @@ void REGPARAM2 CPUFUNC(op_30e8_12)(uae_u32 opcode)
 		goto endlabel4208;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -10967,9 +10251,7 @@ void REGPARAM2 CPUFUNC(op_30f0_12)(uae_u32 opcode)
 		goto endlabel4209;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -10996,9 +10278,7 @@ void REGPARAM2 CPUFUNC(op_30f8_12)(uae_u32 opcode)
 		goto endlabel4210;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -11027,9 +10307,7 @@ void REGPARAM2 CPUFUNC(op_30f9_12)(uae_u32 opcode)
 		goto endlabel4211;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -11057,9 +10335,7 @@ void REGPARAM2 CPUFUNC(op_30fa_12)(uae_u32 opcode)
 		goto endlabel4212;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -11090,9 +10366,7 @@ void REGPARAM2 CPUFUNC(op_30fb_12)(uae_u32 opcode)
 		goto endlabel4213;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -11113,9 +10387,7 @@ void REGPARAM2 CPUFUNC(op_30fc_12)(uae_u32 opcode)
 		goto endlabel4214;
 	}
 {	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -11141,9 +10413,7 @@ void REGPARAM2 CPUFUNC(op_3100_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}endlabel4215: ;
@@ -11166,9 +10436,7 @@ void REGPARAM2 CPUFUNC(op_3108_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}endlabel4216: ;
@@ -11196,9 +10464,7 @@ void REGPARAM2 CPUFUNC(op_3110_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}}}endlabel4217: ;
@@ -11227,9 +10493,7 @@ void REGPARAM2 CPUFUNC(op_3118_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}}}endlabel4218: ;
@@ -11260,9 +10524,7 @@ void REGPARAM2 CPUFUNC(op_3120_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}}}endlabel4219: ;
@@ -11291,9 +10553,7 @@ void REGPARAM2 CPUFUNC(op_3128_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}}}endlabel4220: ;
@@ -11324,9 +10584,7 @@ void REGPARAM2 CPUFUNC(op_3130_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}}}endlabel4221: ;
@@ -11354,9 +10612,7 @@ void REGPARAM2 CPUFUNC(op_3138_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}}}endlabel4222: ;
@@ -11386,9 +10642,7 @@ void REGPARAM2 CPUFUNC(op_3139_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}}}endlabel4223: ;
@@ -11417,9 +10671,7 @@ void REGPARAM2 CPUFUNC(op_313a_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}}}endlabel4224: ;
@@ -11451,9 +10703,7 @@ void REGPARAM2 CPUFUNC(op_313b_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}}}endlabel4225: ;
@@ -11475,9 +10725,7 @@ void REGPARAM2 CPUFUNC(op_313c_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}endlabel4226: ;
@@ -11495,9 +10743,7 @@ void REGPARAM2 CPUFUNC(op_3140_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4227;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -11518,9 +10764,7 @@ void REGPARAM2 CPUFUNC(op_3148_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4228;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -11546,9 +10790,7 @@ void REGPARAM2 CPUFUNC(op_3150_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4229;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -11575,9 +10817,7 @@ void REGPARAM2 CPUFUNC(op_3158_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4230;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -11606,9 +10846,7 @@ void REGPARAM2 CPUFUNC(op_3160_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4231;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -11635,9 +10873,7 @@ void REGPARAM2 CPUFUNC(op_3168_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4232;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -11666,9 +10902,7 @@ void REGPARAM2 CPUFUNC(op_3170_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4233;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -11694,9 +10928,7 @@ void REGPARAM2 CPUFUNC(op_3178_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4234;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -11724,9 +10956,7 @@ void REGPARAM2 CPUFUNC(op_3179_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4235;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
@@ -11753,9 +10983,7 @@ void REGPARAM2 CPUFUNC(op_317a_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4236;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -11785,9 +11013,7 @@ void REGPARAM2 CPUFUNC(op_317b_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4237;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -11807,9 +11033,7 @@ void REGPARAM2 CPUFUNC(op_317c_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4238;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -11832,9 +11056,7 @@ void REGPARAM2 CPUFUNC(op_3180_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4239;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -11857,9 +11079,7 @@ void REGPARAM2 CPUFUNC(op_3188_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4240;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -11887,9 +11107,7 @@ void REGPARAM2 CPUFUNC(op_3190_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4241;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -11918,9 +11136,7 @@ void REGPARAM2 CPUFUNC(op_3198_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4242;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -11951,9 +11167,7 @@ void REGPARAM2 CPUFUNC(op_31a0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4243;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -11982,9 +11196,7 @@ void REGPARAM2 CPUFUNC(op_31a8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4244;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -12015,9 +11227,7 @@ void REGPARAM2 CPUFUNC(op_31b0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4245;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -12045,9 +11255,7 @@ void REGPARAM2 CPUFUNC(op_31b8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4246;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -12077,9 +11285,7 @@ void REGPARAM2 CPUFUNC(op_31b9_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4247;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
@@ -12108,9 +11314,7 @@ void REGPARAM2 CPUFUNC(op_31ba_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4248;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -12142,9 +11346,7 @@ void REGPARAM2 CPUFUNC(op_31bb_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4249;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -12166,9 +11368,7 @@ void REGPARAM2 CPUFUNC(op_31bc_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4250;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -12188,9 +11388,7 @@ void REGPARAM2 CPUFUNC(op_31c0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4251;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -12210,9 +11408,7 @@ void REGPARAM2 CPUFUNC(op_31c8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4252;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -12237,9 +11433,7 @@ void REGPARAM2 CPUFUNC(op_31d0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4253;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -12265,9 +11459,7 @@ void REGPARAM2 CPUFUNC(op_31d8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4254;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -12295,9 +11487,7 @@ void REGPARAM2 CPUFUNC(op_31e0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4255;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 	regs.ir = regs.irc;
@@ -12323,9 +11513,7 @@ void REGPARAM2 CPUFUNC(op_31e8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4256;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -12353,9 +11541,7 @@ void REGPARAM2 CPUFUNC(op_31f0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4257;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -12380,9 +11566,7 @@ void REGPARAM2 CPUFUNC(op_31f8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4258;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -12409,9 +11593,7 @@ void REGPARAM2 CPUFUNC(op_31f9_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4259;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
@@ -12437,9 +11619,7 @@ void REGPARAM2 CPUFUNC(op_31fa_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4260;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -12468,9 +11648,7 @@ void REGPARAM2 CPUFUNC(op_31fb_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4261;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -12489,9 +11667,7 @@ void REGPARAM2 CPUFUNC(op_31fc_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4262;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -12513,9 +11689,7 @@ void REGPARAM2 CPUFUNC(op_33c0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4263;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -12537,9 +11711,7 @@ void REGPARAM2 CPUFUNC(op_33c8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4264;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	regs.ir = regs.irc;
@@ -12566,9 +11738,7 @@ void REGPARAM2 CPUFUNC(op_33d0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4265;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	get_word_ce000_prefetch (0);
@@ -12597,9 +11767,7 @@ void REGPARAM2 CPUFUNC(op_33d8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4266;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	get_word_ce000_prefetch (0);
@@ -12630,9 +11798,7 @@ void REGPARAM2 CPUFUNC(op_33e0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4267;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 	get_word_ce000_prefetch (0);
@@ -12661,9 +11827,7 @@ void REGPARAM2 CPUFUNC(op_33e8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4268;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 	get_word_ce000_prefetch (0);
@@ -12694,9 +11858,7 @@ void REGPARAM2 CPUFUNC(op_33f0_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4269;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 	get_word_ce000_prefetch (0);
@@ -12724,9 +11886,7 @@ void REGPARAM2 CPUFUNC(op_33f8_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4270;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 	get_word_ce000_prefetch (0);
@@ -12756,9 +11916,7 @@ void REGPARAM2 CPUFUNC(op_33f9_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4271;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (10);
 	get_word_ce000_prefetch (0);
@@ -12787,9 +11945,7 @@ void REGPARAM2 CPUFUNC(op_33fa_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4272;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 	get_word_ce000_prefetch (0);
@@ -12821,9 +11977,7 @@ void REGPARAM2 CPUFUNC(op_33fb_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4273;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 	get_word_ce000_prefetch (0);
@@ -12845,9 +11999,7 @@ void REGPARAM2 CPUFUNC(op_33fc_12)(uae_u32 opcode)
 		exception3 (opcode, dsta);
 		goto endlabel4274;
 	}
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 	regs.ir = regs.irc;
@@ -14060,9 +13212,7 @@ void REGPARAM2 CPUFUNC(op_4200_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((0) & 0xff);
 }}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -14076,9 +13226,7 @@ void REGPARAM2 CPUFUNC(op_4210_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}}	m68k_incpc (2);
 } /* 12 (2/1) */
@@ -14093,9 +13241,7 @@ void REGPARAM2 CPUFUNC(op_4218_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}}	m68k_incpc (2);
 } /* 12 (2/1) */
@@ -14112,9 +13258,7 @@ void REGPARAM2 CPUFUNC(op_4220_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}}	m68k_incpc (2);
 } /* 14 (2/1) */
@@ -14128,9 +13272,7 @@ void REGPARAM2 CPUFUNC(op_4228_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -14146,9 +13288,7 @@ void REGPARAM2 CPUFUNC(op_4230_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}}	m68k_incpc (4);
 } /* 18 (3/1) */
@@ -14161,9 +13301,7 @@ void REGPARAM2 CPUFUNC(op_4238_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -14178,9 +13316,7 @@ void REGPARAM2 CPUFUNC(op_4239_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}}	m68k_incpc (6);
 } /* 20 (4/1) */
@@ -14193,9 +13329,7 @@ void REGPARAM2 CPUFUNC(op_4240_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((0) & 0xffff);
 }}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -14213,9 +13347,7 @@ void REGPARAM2 CPUFUNC(op_4250_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}}}	m68k_incpc (2);
 endlabel4334: ;
@@ -14235,9 +13367,7 @@ void REGPARAM2 CPUFUNC(op_4258_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}}}	m68k_incpc (2);
 endlabel4335: ;
@@ -14259,9 +13389,7 @@ void REGPARAM2 CPUFUNC(op_4260_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}}}	m68k_incpc (2);
 endlabel4336: ;
@@ -14280,9 +13408,7 @@ void REGPARAM2 CPUFUNC(op_4268_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}}}	m68k_incpc (4);
 endlabel4337: ;
@@ -14303,9 +13429,7 @@ void REGPARAM2 CPUFUNC(op_4270_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}}}	m68k_incpc (4);
 endlabel4338: ;
@@ -14323,9 +13447,7 @@ void REGPARAM2 CPUFUNC(op_4278_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}}}	m68k_incpc (4);
 endlabel4339: ;
@@ -14345,9 +13467,7 @@ void REGPARAM2 CPUFUNC(op_4279_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}}}	m68k_incpc (6);
 endlabel4340: ;
@@ -14362,9 +13482,7 @@ void REGPARAM2 CPUFUNC(op_4280_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
 	do_cycles_ce000 (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (0);
 }}	m68k_incpc (2);
 } /* 6 (1/0) */
@@ -14382,9 +13500,7 @@ void REGPARAM2 CPUFUNC(op_4290_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca + 2, 0); x_put_word (srca, 0 >> 16);
 }}}}	m68k_incpc (2);
 endlabel4342: ;
@@ -14404,9 +13520,7 @@ void REGPARAM2 CPUFUNC(op_4298_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca + 2, 0); x_put_word (srca, 0 >> 16);
 }}}}	m68k_incpc (2);
 endlabel4343: ;
@@ -14428,9 +13542,7 @@ void REGPARAM2 CPUFUNC(op_42a0_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca + 2, 0); x_put_word (srca, 0 >> 16);
 }}}}	m68k_incpc (2);
 endlabel4344: ;
@@ -14449,9 +13561,7 @@ void REGPARAM2 CPUFUNC(op_42a8_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca + 2, 0); x_put_word (srca, 0 >> 16);
 }}}}	m68k_incpc (4);
 endlabel4345: ;
@@ -14472,9 +13582,7 @@ void REGPARAM2 CPUFUNC(op_42b0_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca + 2, 0); x_put_word (srca, 0 >> 16);
 }}}}	m68k_incpc (4);
 endlabel4346: ;
@@ -14492,9 +13600,7 @@ void REGPARAM2 CPUFUNC(op_42b8_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca + 2, 0); x_put_word (srca, 0 >> 16);
 }}}}	m68k_incpc (4);
 endlabel4347: ;
@@ -14514,9 +13620,7 @@ void REGPARAM2 CPUFUNC(op_42b9_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca + 2, 0); x_put_word (srca, 0 >> 16);
 }}}}	m68k_incpc (6);
 endlabel4348: ;
@@ -14537,11 +13641,9 @@ void REGPARAM2 CPUFUNC(op_4400_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -14559,11 +13661,9 @@ void REGPARAM2 CPUFUNC(op_4410_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	m68k_incpc (2);
 } /* 12 (2/1) */
@@ -14582,11 +13682,9 @@ void REGPARAM2 CPUFUNC(op_4418_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	m68k_incpc (2);
 } /* 12 (2/1) */
@@ -14607,11 +13705,9 @@ void REGPARAM2 CPUFUNC(op_4420_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	m68k_incpc (2);
 } /* 14 (2/1) */
@@ -14629,11 +13725,9 @@ void REGPARAM2 CPUFUNC(op_4428_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -14653,11 +13747,9 @@ void REGPARAM2 CPUFUNC(op_4430_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	m68k_incpc (4);
 } /* 18 (3/1) */
@@ -14674,11 +13766,9 @@ void REGPARAM2 CPUFUNC(op_4438_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -14697,11 +13787,9 @@ void REGPARAM2 CPUFUNC(op_4439_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	m68k_incpc (6);
 } /* 20 (4/1) */
@@ -14718,11 +13806,9 @@ void REGPARAM2 CPUFUNC(op_4440_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -14744,11 +13830,9 @@ void REGPARAM2 CPUFUNC(op_4450_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}}	m68k_incpc (2);
 endlabel4358: ;
@@ -14772,11 +13856,9 @@ void REGPARAM2 CPUFUNC(op_4458_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}}	m68k_incpc (2);
 endlabel4359: ;
@@ -14802,11 +13884,9 @@ void REGPARAM2 CPUFUNC(op_4460_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}}	m68k_incpc (2);
 endlabel4360: ;
@@ -14829,11 +13909,9 @@ void REGPARAM2 CPUFUNC(op_4468_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}}	m68k_incpc (4);
 endlabel4361: ;
@@ -14858,11 +13936,9 @@ void REGPARAM2 CPUFUNC(op_4470_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}}	m68k_incpc (4);
 endlabel4362: ;
@@ -14884,11 +13960,9 @@ void REGPARAM2 CPUFUNC(op_4478_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}}	m68k_incpc (4);
 endlabel4363: ;
@@ -14912,11 +13986,9 @@ void REGPARAM2 CPUFUNC(op_4479_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}}	m68k_incpc (6);
 endlabel4364: ;
@@ -14935,11 +14007,9 @@ void REGPARAM2 CPUFUNC(op_4480_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (dst);
 }}}}}	m68k_incpc (2);
 } /* 6 (1/0) */
@@ -14961,11 +14031,9 @@ void REGPARAM2 CPUFUNC(op_4490_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca + 2, dst); x_put_word (srca, dst >> 16);
 }}}}}}}	m68k_incpc (2);
 endlabel4366: ;
@@ -14989,11 +14057,9 @@ void REGPARAM2 CPUFUNC(op_4498_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca + 2, dst); x_put_word (srca, dst >> 16);
 }}}}}}}	m68k_incpc (2);
 endlabel4367: ;
@@ -15019,11 +14085,9 @@ void REGPARAM2 CPUFUNC(op_44a0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca + 2, dst); x_put_word (srca, dst >> 16);
 }}}}}}}	m68k_incpc (2);
 endlabel4368: ;
@@ -15046,11 +14110,9 @@ void REGPARAM2 CPUFUNC(op_44a8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca + 2, dst); x_put_word (srca, dst >> 16);
 }}}}}}}	m68k_incpc (4);
 endlabel4369: ;
@@ -15075,11 +14137,9 @@ void REGPARAM2 CPUFUNC(op_44b0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca + 2, dst); x_put_word (srca, dst >> 16);
 }}}}}}}	m68k_incpc (4);
 endlabel4370: ;
@@ -15101,11 +14161,9 @@ void REGPARAM2 CPUFUNC(op_44b8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca + 2, dst); x_put_word (srca, dst >> 16);
 }}}}}}}	m68k_incpc (4);
 endlabel4371: ;
@@ -15129,11 +14187,9 @@ void REGPARAM2 CPUFUNC(op_44b9_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca + 2, dst); x_put_word (srca, dst >> 16);
 }}}}}}}	m68k_incpc (6);
 endlabel4372: ;
@@ -15397,9 +14453,7 @@ void REGPARAM2 CPUFUNC(op_4600_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -15414,9 +14468,7 @@ void REGPARAM2 CPUFUNC(op_4610_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	m68k_incpc (2);
 } /* 12 (2/1) */
@@ -15432,9 +14484,7 @@ void REGPARAM2 CPUFUNC(op_4618_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	m68k_incpc (2);
 } /* 12 (2/1) */
@@ -15452,9 +14502,7 @@ void REGPARAM2 CPUFUNC(op_4620_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	m68k_incpc (2);
 } /* 14 (2/1) */
@@ -15469,9 +14517,7 @@ void REGPARAM2 CPUFUNC(op_4628_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -15488,9 +14534,7 @@ void REGPARAM2 CPUFUNC(op_4630_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	m68k_incpc (4);
 } /* 18 (3/1) */
@@ -15504,9 +14548,7 @@ void REGPARAM2 CPUFUNC(op_4638_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -15522,9 +14564,7 @@ void REGPARAM2 CPUFUNC(op_4639_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	m68k_incpc (6);
 } /* 20 (4/1) */
@@ -15538,9 +14578,7 @@ void REGPARAM2 CPUFUNC(op_4640_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -15559,9 +14597,7 @@ void REGPARAM2 CPUFUNC(op_4650_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}}	m68k_incpc (2);
 endlabel4393: ;
@@ -15582,9 +14618,7 @@ void REGPARAM2 CPUFUNC(op_4658_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}}	m68k_incpc (2);
 endlabel4394: ;
@@ -15607,9 +14641,7 @@ void REGPARAM2 CPUFUNC(op_4660_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}}	m68k_incpc (2);
 endlabel4395: ;
@@ -15629,9 +14661,7 @@ void REGPARAM2 CPUFUNC(op_4668_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}}	m68k_incpc (4);
 endlabel4396: ;
@@ -15653,9 +14683,7 @@ void REGPARAM2 CPUFUNC(op_4670_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}}	m68k_incpc (4);
 endlabel4397: ;
@@ -15674,9 +14702,7 @@ void REGPARAM2 CPUFUNC(op_4678_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}}	m68k_incpc (4);
 endlabel4398: ;
@@ -15697,9 +14723,7 @@ void REGPARAM2 CPUFUNC(op_4679_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}}	m68k_incpc (6);
 endlabel4399: ;
@@ -15715,9 +14739,7 @@ void REGPARAM2 CPUFUNC(op_4680_12)(uae_u32 opcode)
 	get_word_ce000_prefetch (4);
 	do_cycles_ce000 (2);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	m68k_incpc (2);
 } /* 6 (1/0) */
@@ -15736,9 +14758,7 @@ void REGPARAM2 CPUFUNC(op_4690_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca + 2, dst); x_put_word (srca, dst >> 16);
 }}}}}	m68k_incpc (2);
 endlabel4401: ;
@@ -15759,9 +14779,7 @@ void REGPARAM2 CPUFUNC(op_4698_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca + 2, dst); x_put_word (srca, dst >> 16);
 }}}}}	m68k_incpc (2);
 endlabel4402: ;
@@ -15784,9 +14802,7 @@ void REGPARAM2 CPUFUNC(op_46a0_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca + 2, dst); x_put_word (srca, dst >> 16);
 }}}}}	m68k_incpc (2);
 endlabel4403: ;
@@ -15806,9 +14822,7 @@ void REGPARAM2 CPUFUNC(op_46a8_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca + 2, dst); x_put_word (srca, dst >> 16);
 }}}}}	m68k_incpc (4);
 endlabel4404: ;
@@ -15830,9 +14844,7 @@ void REGPARAM2 CPUFUNC(op_46b0_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca + 2, dst); x_put_word (srca, dst >> 16);
 }}}}}	m68k_incpc (4);
 endlabel4405: ;
@@ -15851,9 +14863,7 @@ void REGPARAM2 CPUFUNC(op_46b8_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca + 2, dst); x_put_word (srca, dst >> 16);
 }}}}}	m68k_incpc (4);
 endlabel4406: ;
@@ -15874,9 +14884,7 @@ void REGPARAM2 CPUFUNC(op_46b9_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca + 2, dst); x_put_word (srca, dst >> 16);
 }}}}}	m68k_incpc (6);
 endlabel4407: ;
@@ -16329,9 +15337,7 @@ void REGPARAM2 CPUFUNC(op_4840_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
 {	uae_u32 dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -16498,9 +15504,7 @@ void REGPARAM2 CPUFUNC(op_4880_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
 {	uae_u16 dst = (uae_s16)(uae_s8)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -16644,9 +15648,7 @@ void REGPARAM2 CPUFUNC(op_48c0_12)(uae_u32 opcode)
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
 {	uae_u32 dst = (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -16789,9 +15791,7 @@ void REGPARAM2 CPUFUNC(op_4a00_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (2);
 } /* 4 (1/0) */
 
@@ -16804,9 +15804,7 @@ void REGPARAM2 CPUFUNC(op_4a10_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (2);
 } /* 8 (2/0) */
 
@@ -16820,9 +15818,7 @@ void REGPARAM2 CPUFUNC(op_4a18_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (2);
 } /* 8 (2/0) */
 
@@ -16838,9 +15834,7 @@ void REGPARAM2 CPUFUNC(op_4a20_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (2);
 } /* 10 (2/0) */
 
@@ -16853,9 +15847,7 @@ void REGPARAM2 CPUFUNC(op_4a28_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (4);
 } /* 12 (3/0) */
 
@@ -16870,9 +15862,7 @@ void REGPARAM2 CPUFUNC(op_4a30_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (4);
 } /* 14 (3/0) */
 
@@ -16884,9 +15874,7 @@ void REGPARAM2 CPUFUNC(op_4a38_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (4);
 } /* 12 (3/0) */
 
@@ -16900,9 +15888,7 @@ void REGPARAM2 CPUFUNC(op_4a39_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (6);
 } /* 16 (4/0) */
 
@@ -16913,9 +15899,7 @@ void REGPARAM2 CPUFUNC(op_4a3c_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (4);
 } /* 8 (2/0) */
 
@@ -16927,9 +15911,7 @@ void REGPARAM2 CPUFUNC(op_4a40_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (2);
 } /* 4 (1/0) */
 
@@ -16946,9 +15928,7 @@ void REGPARAM2 CPUFUNC(op_4a50_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (2);
 endlabel4459: ;
 } /* 8 (2/0) */
@@ -16967,9 +15947,7 @@ void REGPARAM2 CPUFUNC(op_4a58_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (2);
 endlabel4460: ;
 } /* 8 (2/0) */
@@ -16990,9 +15968,7 @@ void REGPARAM2 CPUFUNC(op_4a60_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (2);
 endlabel4461: ;
 } /* 10 (2/0) */
@@ -17010,9 +15986,7 @@ void REGPARAM2 CPUFUNC(op_4a68_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (4);
 endlabel4462: ;
 } /* 12 (3/0) */
@@ -17032,9 +16006,7 @@ void REGPARAM2 CPUFUNC(op_4a70_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (4);
 endlabel4463: ;
 } /* 14 (3/0) */
@@ -17051,9 +16023,7 @@ void REGPARAM2 CPUFUNC(op_4a78_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (4);
 endlabel4464: ;
 } /* 12 (3/0) */
@@ -17072,9 +16042,7 @@ void REGPARAM2 CPUFUNC(op_4a79_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (6);
 endlabel4465: ;
 } /* 16 (4/0) */
@@ -17086,9 +16054,7 @@ void REGPARAM2 CPUFUNC(op_4a7c_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (4);
 } /* 8 (2/0) */
 
@@ -17100,9 +16066,7 @@ void REGPARAM2 CPUFUNC(op_4a80_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (2);
 } /* 4 (1/0) */
 
@@ -17119,9 +16083,7 @@ void REGPARAM2 CPUFUNC(op_4a90_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (2);
 endlabel4468: ;
 } /* 12 (3/0) */
@@ -17140,9 +16102,7 @@ void REGPARAM2 CPUFUNC(op_4a98_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (2);
 endlabel4469: ;
 } /* 12 (3/0) */
@@ -17163,9 +16123,7 @@ void REGPARAM2 CPUFUNC(op_4aa0_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (2);
 endlabel4470: ;
 } /* 14 (3/0) */
@@ -17183,9 +16141,7 @@ void REGPARAM2 CPUFUNC(op_4aa8_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (4);
 endlabel4471: ;
 } /* 16 (4/0) */
@@ -17205,9 +16161,7 @@ void REGPARAM2 CPUFUNC(op_4ab0_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (4);
 endlabel4472: ;
 } /* 18 (4/0) */
@@ -17224,9 +16178,7 @@ void REGPARAM2 CPUFUNC(op_4ab8_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (4);
 endlabel4473: ;
 } /* 16 (4/0) */
@@ -17245,9 +16197,7 @@ void REGPARAM2 CPUFUNC(op_4ab9_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	m68k_incpc (6);
 endlabel4474: ;
 } /* 20 (5/0) */
@@ -17261,9 +16211,7 @@ void REGPARAM2 CPUFUNC(op_4abc_12)(uae_u32 opcode)
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (6);
 } /* 12 (3/0) */
 
@@ -17272,9 +16220,7 @@ void REGPARAM2 CPUFUNC(op_4ac0_12)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -17289,9 +16235,7 @@ void REGPARAM2 CPUFUNC(op_4ad0_12)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	do_cycles_ce000 (2);
 	regs.ir = regs.irc;
 	ipl_fetch ();
@@ -17312,9 +16256,7 @@ void REGPARAM2 CPUFUNC(op_4ad8_12)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	do_cycles_ce000 (2);
 	regs.ir = regs.irc;
 	ipl_fetch ();
@@ -17337,9 +16279,7 @@ void REGPARAM2 CPUFUNC(op_4ae0_12)(uae_u32 opcode)
 	do_cycles_ce000 (2);
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	do_cycles_ce000 (2);
 	regs.ir = regs.irc;
 	ipl_fetch ();
@@ -17359,9 +16299,7 @@ void REGPARAM2 CPUFUNC(op_4ae8_12)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	do_cycles_ce000 (2);
 	regs.ir = regs.irc;
 	ipl_fetch ();
@@ -17383,9 +16321,7 @@ void REGPARAM2 CPUFUNC(op_4af0_12)(uae_u32 opcode)
 	do_cycles_ce000 (2);
 	srca = get_disp_ea_000 (m68k_areg (regs, srcreg), get_word_ce000_prefetch (4));
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	do_cycles_ce000 (2);
 	regs.ir = regs.irc;
 	ipl_fetch ();
@@ -17404,9 +16340,7 @@ void REGPARAM2 CPUFUNC(op_4af8_12)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	do_cycles_ce000 (2);
 	regs.ir = regs.irc;
 	ipl_fetch ();
@@ -17427,9 +16361,7 @@ void REGPARAM2 CPUFUNC(op_4af9_12)(uae_u32 opcode)
 	srca = get_word_ce000_prefetch (4) << 16;
 	srca |= get_word_ce000_prefetch (6);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	do_cycles_ce000 (2);
 	regs.ir = regs.irc;
 	ipl_fetch ();
@@ -18358,11 +17290,9 @@ void REGPARAM2 CPUFUNC(op_5000_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -18382,11 +17312,9 @@ void REGPARAM2 CPUFUNC(op_5010_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 } /* 12 (2/1) */
@@ -18407,11 +17335,9 @@ void REGPARAM2 CPUFUNC(op_5018_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 } /* 12 (2/1) */
@@ -18434,11 +17360,9 @@ void REGPARAM2 CPUFUNC(op_5020_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 } /* 14 (2/1) */
@@ -18458,11 +17382,9 @@ void REGPARAM2 CPUFUNC(op_5028_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -18484,11 +17406,9 @@ void REGPARAM2 CPUFUNC(op_5030_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 18 (3/1) */
@@ -18507,11 +17427,9 @@ void REGPARAM2 CPUFUNC(op_5038_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -18532,11 +17450,9 @@ void REGPARAM2 CPUFUNC(op_5039_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 } /* 20 (4/1) */
@@ -18555,11 +17471,9 @@ void REGPARAM2 CPUFUNC(op_5040_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -18599,11 +17513,9 @@ void REGPARAM2 CPUFUNC(op_5050_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel4537: ;
@@ -18629,11 +17541,9 @@ void REGPARAM2 CPUFUNC(op_5058_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel4538: ;
@@ -18661,11 +17571,9 @@ void REGPARAM2 CPUFUNC(op_5060_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel4539: ;
@@ -18690,11 +17598,9 @@ void REGPARAM2 CPUFUNC(op_5068_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel4540: ;
@@ -18721,11 +17627,9 @@ void REGPARAM2 CPUFUNC(op_5070_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel4541: ;
@@ -18752,11 +17656,9 @@ void REGPARAM2 CPUFUNC(op_5078_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel4542: ;
@@ -18782,11 +17684,9 @@ void REGPARAM2 CPUFUNC(op_5079_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel4543: ;
@@ -18807,11 +17707,9 @@ void REGPARAM2 CPUFUNC(op_5080_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 } /* 8 (1/0) */
@@ -18851,11 +17749,9 @@ void REGPARAM2 CPUFUNC(op_5090_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (2);
 endlabel4546: ;
@@ -18881,11 +17777,9 @@ void REGPARAM2 CPUFUNC(op_5098_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (2);
 endlabel4547: ;
@@ -18913,11 +17807,9 @@ void REGPARAM2 CPUFUNC(op_50a0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (2);
 endlabel4548: ;
@@ -18942,11 +17834,9 @@ void REGPARAM2 CPUFUNC(op_50a8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (4);
 endlabel4549: ;
@@ -18973,11 +17863,9 @@ void REGPARAM2 CPUFUNC(op_50b0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (4);
 endlabel4550: ;
@@ -19001,11 +17889,9 @@ void REGPARAM2 CPUFUNC(op_50b8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (4);
 endlabel4551: ;
@@ -19031,11 +17917,9 @@ void REGPARAM2 CPUFUNC(op_50b9_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (6);
 endlabel4552: ;
@@ -19222,11 +18106,9 @@ void REGPARAM2 CPUFUNC(op_5100_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -19246,11 +18128,9 @@ void REGPARAM2 CPUFUNC(op_5110_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 } /* 12 (2/1) */
@@ -19271,11 +18151,9 @@ void REGPARAM2 CPUFUNC(op_5118_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 } /* 12 (2/1) */
@@ -19298,11 +18176,9 @@ void REGPARAM2 CPUFUNC(op_5120_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 } /* 14 (2/1) */
@@ -19322,11 +18198,9 @@ void REGPARAM2 CPUFUNC(op_5128_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -19348,11 +18222,9 @@ void REGPARAM2 CPUFUNC(op_5130_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 18 (3/1) */
@@ -19371,11 +18243,9 @@ void REGPARAM2 CPUFUNC(op_5138_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -19396,11 +18266,9 @@ void REGPARAM2 CPUFUNC(op_5139_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 } /* 20 (4/1) */
@@ -19419,11 +18287,9 @@ void REGPARAM2 CPUFUNC(op_5140_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -19463,11 +18329,9 @@ void REGPARAM2 CPUFUNC(op_5150_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel4572: ;
@@ -19493,11 +18357,9 @@ void REGPARAM2 CPUFUNC(op_5158_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel4573: ;
@@ -19525,11 +18387,9 @@ void REGPARAM2 CPUFUNC(op_5160_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel4574: ;
@@ -19554,11 +18414,9 @@ void REGPARAM2 CPUFUNC(op_5168_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel4575: ;
@@ -19585,11 +18443,9 @@ void REGPARAM2 CPUFUNC(op_5170_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel4576: ;
@@ -19613,11 +18469,9 @@ void REGPARAM2 CPUFUNC(op_5178_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel4577: ;
@@ -19643,11 +18497,9 @@ void REGPARAM2 CPUFUNC(op_5179_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel4578: ;
@@ -19668,11 +18520,9 @@ void REGPARAM2 CPUFUNC(op_5180_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 } /* 8 (1/0) */
@@ -19712,11 +18562,9 @@ void REGPARAM2 CPUFUNC(op_5190_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (2);
 endlabel4581: ;
@@ -19742,11 +18590,9 @@ void REGPARAM2 CPUFUNC(op_5198_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (2);
 endlabel4582: ;
@@ -19774,11 +18620,9 @@ void REGPARAM2 CPUFUNC(op_51a0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (2);
 endlabel4583: ;
@@ -19803,11 +18647,9 @@ void REGPARAM2 CPUFUNC(op_51a8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (4);
 endlabel4584: ;
@@ -19834,11 +18676,9 @@ void REGPARAM2 CPUFUNC(op_51b0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (4);
 endlabel4585: ;
@@ -19862,11 +18702,9 @@ void REGPARAM2 CPUFUNC(op_51b8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (4);
 endlabel4586: ;
@@ -19892,11 +18730,9 @@ void REGPARAM2 CPUFUNC(op_51b9_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (6);
 endlabel4587: ;
@@ -23809,9 +22645,7 @@ void REGPARAM2 CPUFUNC(op_7000_12)(uae_u32 opcode)
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_u32 src = srcreg;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 	regs.ir = regs.irc;
@@ -23827,9 +22661,7 @@ void REGPARAM2 CPUFUNC(op_8000_12)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -23846,9 +22678,7 @@ void REGPARAM2 CPUFUNC(op_8010_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -23866,9 +22696,7 @@ void REGPARAM2 CPUFUNC(op_8018_12)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -23888,9 +22716,7 @@ void REGPARAM2 CPUFUNC(op_8020_12)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -23907,9 +22733,7 @@ void REGPARAM2 CPUFUNC(op_8028_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -23928,9 +22752,7 @@ void REGPARAM2 CPUFUNC(op_8030_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -23946,9 +22768,7 @@ void REGPARAM2 CPUFUNC(op_8038_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -23966,9 +22786,7 @@ void REGPARAM2 CPUFUNC(op_8039_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -23985,9 +22803,7 @@ void REGPARAM2 CPUFUNC(op_803a_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -24007,9 +22823,7 @@ void REGPARAM2 CPUFUNC(op_803b_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -24024,9 +22838,7 @@ void REGPARAM2 CPUFUNC(op_803c_12)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce000_prefetch (4);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -24042,9 +22854,7 @@ void REGPARAM2 CPUFUNC(op_8040_12)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -24065,9 +22875,7 @@ void REGPARAM2 CPUFUNC(op_8050_12)(uae_u32 opcode)
 {{	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -24090,9 +22898,7 @@ void REGPARAM2 CPUFUNC(op_8058_12)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -24117,9 +22923,7 @@ void REGPARAM2 CPUFUNC(op_8060_12)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -24141,9 +22945,7 @@ void REGPARAM2 CPUFUNC(op_8068_12)(uae_u32 opcode)
 {{	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -24167,9 +22969,7 @@ void REGPARAM2 CPUFUNC(op_8070_12)(uae_u32 opcode)
 {{	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -24190,9 +22990,7 @@ void REGPARAM2 CPUFUNC(op_8078_12)(uae_u32 opcode)
 {{	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -24215,9 +23013,7 @@ void REGPARAM2 CPUFUNC(op_8079_12)(uae_u32 opcode)
 {{	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -24239,9 +23035,7 @@ void REGPARAM2 CPUFUNC(op_807a_12)(uae_u32 opcode)
 {{	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -24266,9 +23060,7 @@ void REGPARAM2 CPUFUNC(op_807b_12)(uae_u32 opcode)
 {{	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -24284,9 +23076,7 @@ void REGPARAM2 CPUFUNC(op_807c_12)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce000_prefetch (4);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -24302,9 +23092,7 @@ void REGPARAM2 CPUFUNC(op_8080_12)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -24326,9 +23114,7 @@ void REGPARAM2 CPUFUNC(op_8090_12)(uae_u32 opcode)
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -24352,9 +23138,7 @@ void REGPARAM2 CPUFUNC(op_8098_12)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -24380,9 +23164,7 @@ void REGPARAM2 CPUFUNC(op_80a0_12)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -24405,9 +23187,7 @@ void REGPARAM2 CPUFUNC(op_80a8_12)(uae_u32 opcode)
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -24432,9 +23212,7 @@ void REGPARAM2 CPUFUNC(op_80b0_12)(uae_u32 opcode)
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -24456,9 +23234,7 @@ void REGPARAM2 CPUFUNC(op_80b8_12)(uae_u32 opcode)
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -24482,9 +23258,7 @@ void REGPARAM2 CPUFUNC(op_80b9_12)(uae_u32 opcode)
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -24507,9 +23281,7 @@ void REGPARAM2 CPUFUNC(op_80ba_12)(uae_u32 opcode)
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -24535,9 +23307,7 @@ void REGPARAM2 CPUFUNC(op_80bb_12)(uae_u32 opcode)
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -24556,9 +23326,7 @@ void REGPARAM2 CPUFUNC(op_80bc_12)(uae_u32 opcode)
 	src |= get_word_ce000_prefetch (6);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -24591,9 +23359,7 @@ void REGPARAM2 CPUFUNC(op_80c0_12)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24631,9 +23397,7 @@ void REGPARAM2 CPUFUNC(op_80d0_12)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24672,9 +23436,7 @@ void REGPARAM2 CPUFUNC(op_80d8_12)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24715,9 +23477,7 @@ void REGPARAM2 CPUFUNC(op_80e0_12)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24755,9 +23515,7 @@ void REGPARAM2 CPUFUNC(op_80e8_12)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24797,9 +23555,7 @@ void REGPARAM2 CPUFUNC(op_80f0_12)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24836,9 +23592,7 @@ void REGPARAM2 CPUFUNC(op_80f8_12)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24877,9 +23631,7 @@ void REGPARAM2 CPUFUNC(op_80f9_12)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24917,9 +23669,7 @@ void REGPARAM2 CPUFUNC(op_80fa_12)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24960,9 +23710,7 @@ void REGPARAM2 CPUFUNC(op_80fb_12)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -24994,9 +23742,7 @@ void REGPARAM2 CPUFUNC(op_80fc_12)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -25074,9 +23820,7 @@ void REGPARAM2 CPUFUNC(op_8110_12)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -25094,9 +23838,7 @@ void REGPARAM2 CPUFUNC(op_8118_12)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -25116,9 +23858,7 @@ void REGPARAM2 CPUFUNC(op_8120_12)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -25135,9 +23875,7 @@ void REGPARAM2 CPUFUNC(op_8128_12)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -25156,9 +23894,7 @@ void REGPARAM2 CPUFUNC(op_8130_12)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (4));
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -25174,9 +23910,7 @@ void REGPARAM2 CPUFUNC(op_8138_12)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -25194,9 +23928,7 @@ void REGPARAM2 CPUFUNC(op_8139_12)(uae_u32 opcode)
 	dsta |= get_word_ce000_prefetch (6);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -25217,9 +23949,7 @@ void REGPARAM2 CPUFUNC(op_8150_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -25242,9 +23972,7 @@ void REGPARAM2 CPUFUNC(op_8158_12)(uae_u32 opcode)
 {{	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -25269,9 +23997,7 @@ void REGPARAM2 CPUFUNC(op_8160_12)(uae_u32 opcode)
 {{	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -25293,9 +24019,7 @@ void REGPARAM2 CPUFUNC(op_8168_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -25319,9 +24043,7 @@ void REGPARAM2 CPUFUNC(op_8170_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -25342,9 +24064,7 @@ void REGPARAM2 CPUFUNC(op_8178_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -25367,9 +24087,7 @@ void REGPARAM2 CPUFUNC(op_8179_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -25391,9 +24109,7 @@ void REGPARAM2 CPUFUNC(op_8190_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -25416,9 +24132,7 @@ void REGPARAM2 CPUFUNC(op_8198_12)(uae_u32 opcode)
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	m68k_areg (regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -25443,9 +24157,7 @@ void REGPARAM2 CPUFUNC(op_81a0_12)(uae_u32 opcode)
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -25467,9 +24179,7 @@ void REGPARAM2 CPUFUNC(op_81a8_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -25493,9 +24203,7 @@ void REGPARAM2 CPUFUNC(op_81b0_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -25516,9 +24224,7 @@ void REGPARAM2 CPUFUNC(op_81b8_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -25541,9 +24247,7 @@ void REGPARAM2 CPUFUNC(op_81b9_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -25577,9 +24281,7 @@ void REGPARAM2 CPUFUNC(op_81c0_12)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -25618,9 +24320,7 @@ void REGPARAM2 CPUFUNC(op_81d0_12)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -25660,9 +24360,7 @@ void REGPARAM2 CPUFUNC(op_81d8_12)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -25704,9 +24402,7 @@ void REGPARAM2 CPUFUNC(op_81e0_12)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -25745,9 +24441,7 @@ void REGPARAM2 CPUFUNC(op_81e8_12)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -25788,9 +24482,7 @@ void REGPARAM2 CPUFUNC(op_81f0_12)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -25828,9 +24520,7 @@ void REGPARAM2 CPUFUNC(op_81f8_12)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -25870,9 +24560,7 @@ void REGPARAM2 CPUFUNC(op_81f9_12)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -25911,9 +24599,7 @@ void REGPARAM2 CPUFUNC(op_81fa_12)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -25955,9 +24641,7 @@ void REGPARAM2 CPUFUNC(op_81fb_12)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -25990,9 +24674,7 @@ void REGPARAM2 CPUFUNC(op_81fc_12)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -26015,11 +24697,9 @@ void REGPARAM2 CPUFUNC(op_9000_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -26039,11 +24719,9 @@ void REGPARAM2 CPUFUNC(op_9010_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 } /* 8 (2/0) */
@@ -26064,11 +24742,9 @@ void REGPARAM2 CPUFUNC(op_9018_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 } /* 8 (2/0) */
@@ -26091,11 +24767,9 @@ void REGPARAM2 CPUFUNC(op_9020_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 } /* 10 (2/0) */
@@ -26115,11 +24789,9 @@ void REGPARAM2 CPUFUNC(op_9028_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 } /* 12 (3/0) */
@@ -26141,11 +24813,9 @@ void REGPARAM2 CPUFUNC(op_9030_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 } /* 14 (3/0) */
@@ -26164,11 +24834,9 @@ void REGPARAM2 CPUFUNC(op_9038_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 } /* 12 (3/0) */
@@ -26189,11 +24857,9 @@ void REGPARAM2 CPUFUNC(op_9039_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (6);
 } /* 16 (4/0) */
@@ -26213,11 +24879,9 @@ void REGPARAM2 CPUFUNC(op_903a_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 } /* 12 (3/0) */
@@ -26240,11 +24904,9 @@ void REGPARAM2 CPUFUNC(op_903b_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 } /* 14 (3/0) */
@@ -26262,11 +24924,9 @@ void REGPARAM2 CPUFUNC(op_903c_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (4);
 } /* 8 (2/0) */
@@ -26285,11 +24945,9 @@ void REGPARAM2 CPUFUNC(op_9040_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -26308,11 +24966,9 @@ void REGPARAM2 CPUFUNC(op_9048_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -26336,11 +24992,9 @@ void REGPARAM2 CPUFUNC(op_9050_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (2);
 endlabel4863: ;
@@ -26366,11 +25020,9 @@ void REGPARAM2 CPUFUNC(op_9058_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (2);
 endlabel4864: ;
@@ -26398,11 +25050,9 @@ void REGPARAM2 CPUFUNC(op_9060_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (2);
 endlabel4865: ;
@@ -26427,11 +25077,9 @@ void REGPARAM2 CPUFUNC(op_9068_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel4866: ;
@@ -26458,11 +25106,9 @@ void REGPARAM2 CPUFUNC(op_9070_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel4867: ;
@@ -26486,11 +25132,9 @@ void REGPARAM2 CPUFUNC(op_9078_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel4868: ;
@@ -26516,11 +25160,9 @@ void REGPARAM2 CPUFUNC(op_9079_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (6);
 endlabel4869: ;
@@ -26545,11 +25187,9 @@ void REGPARAM2 CPUFUNC(op_907a_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel4870: ;
@@ -26577,11 +25217,9 @@ void REGPARAM2 CPUFUNC(op_907b_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel4871: ;
@@ -26600,11 +25238,9 @@ void REGPARAM2 CPUFUNC(op_907c_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (4);
 } /* 8 (2/0) */
@@ -26624,11 +25260,9 @@ void REGPARAM2 CPUFUNC(op_9080_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 } /* 8 (1/0) */
@@ -26648,11 +25282,9 @@ void REGPARAM2 CPUFUNC(op_9088_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 } /* 6 (1/0) */
@@ -26677,11 +25309,9 @@ void REGPARAM2 CPUFUNC(op_9090_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel4875: ;
@@ -26708,11 +25338,9 @@ void REGPARAM2 CPUFUNC(op_9098_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel4876: ;
@@ -26741,11 +25369,9 @@ void REGPARAM2 CPUFUNC(op_90a0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel4877: ;
@@ -26771,11 +25397,9 @@ void REGPARAM2 CPUFUNC(op_90a8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel4878: ;
@@ -26803,11 +25427,9 @@ void REGPARAM2 CPUFUNC(op_90b0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel4879: ;
@@ -26832,11 +25454,9 @@ void REGPARAM2 CPUFUNC(op_90b8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel4880: ;
@@ -26863,11 +25483,9 @@ void REGPARAM2 CPUFUNC(op_90b9_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel4881: ;
@@ -26893,11 +25511,9 @@ void REGPARAM2 CPUFUNC(op_90ba_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel4882: ;
@@ -26926,11 +25542,9 @@ void REGPARAM2 CPUFUNC(op_90bb_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel4883: ;
@@ -26952,11 +25566,9 @@ void REGPARAM2 CPUFUNC(op_90bc_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (6);
 } /* 16 (3/0) */
@@ -27283,11 +25895,9 @@ void REGPARAM2 CPUFUNC(op_9110_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 } /* 12 (2/1) */
@@ -27308,11 +25918,9 @@ void REGPARAM2 CPUFUNC(op_9118_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 } /* 12 (2/1) */
@@ -27335,11 +25943,9 @@ void REGPARAM2 CPUFUNC(op_9120_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 } /* 14 (2/1) */
@@ -27359,11 +25965,9 @@ void REGPARAM2 CPUFUNC(op_9128_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -27385,11 +25989,9 @@ void REGPARAM2 CPUFUNC(op_9130_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 18 (3/1) */
@@ -27408,11 +26010,9 @@ void REGPARAM2 CPUFUNC(op_9138_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -27433,11 +26033,9 @@ void REGPARAM2 CPUFUNC(op_9139_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 } /* 20 (4/1) */
@@ -27523,11 +26121,9 @@ void REGPARAM2 CPUFUNC(op_9150_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel4908: ;
@@ -27553,11 +26149,9 @@ void REGPARAM2 CPUFUNC(op_9158_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel4909: ;
@@ -27585,11 +26179,9 @@ void REGPARAM2 CPUFUNC(op_9160_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel4910: ;
@@ -27614,11 +26206,9 @@ void REGPARAM2 CPUFUNC(op_9168_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel4911: ;
@@ -27645,11 +26235,9 @@ void REGPARAM2 CPUFUNC(op_9170_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel4912: ;
@@ -27673,11 +26261,9 @@ void REGPARAM2 CPUFUNC(op_9178_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel4913: ;
@@ -27703,11 +26289,9 @@ void REGPARAM2 CPUFUNC(op_9179_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel4914: ;
@@ -27795,11 +26379,9 @@ void REGPARAM2 CPUFUNC(op_9190_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (2);
 endlabel4917: ;
@@ -27825,11 +26407,9 @@ void REGPARAM2 CPUFUNC(op_9198_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (2);
 endlabel4918: ;
@@ -27857,11 +26437,9 @@ void REGPARAM2 CPUFUNC(op_91a0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (2);
 endlabel4919: ;
@@ -27886,11 +26464,9 @@ void REGPARAM2 CPUFUNC(op_91a8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (4);
 endlabel4920: ;
@@ -27917,11 +26493,9 @@ void REGPARAM2 CPUFUNC(op_91b0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (4);
 endlabel4921: ;
@@ -27945,11 +26519,9 @@ void REGPARAM2 CPUFUNC(op_91b8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (4);
 endlabel4922: ;
@@ -27975,11 +26547,9 @@ void REGPARAM2 CPUFUNC(op_91b9_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (6);
 endlabel4923: ;
@@ -28255,10 +26825,8 @@ void REGPARAM2 CPUFUNC(op_b000_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 } /* 4 (1/0) */
 
@@ -28277,10 +26845,8 @@ void REGPARAM2 CPUFUNC(op_b010_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 } /* 8 (2/0) */
 
@@ -28300,10 +26866,8 @@ void REGPARAM2 CPUFUNC(op_b018_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 } /* 8 (2/0) */
 
@@ -28325,10 +26889,8 @@ void REGPARAM2 CPUFUNC(op_b020_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 } /* 10 (2/0) */
 
@@ -28347,10 +26909,8 @@ void REGPARAM2 CPUFUNC(op_b028_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 } /* 12 (3/0) */
 
@@ -28371,10 +26931,8 @@ void REGPARAM2 CPUFUNC(op_b030_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 } /* 14 (3/0) */
 
@@ -28392,10 +26950,8 @@ void REGPARAM2 CPUFUNC(op_b038_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 } /* 12 (3/0) */
 
@@ -28415,10 +26971,8 @@ void REGPARAM2 CPUFUNC(op_b039_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 } /* 16 (4/0) */
 
@@ -28437,10 +26991,8 @@ void REGPARAM2 CPUFUNC(op_b03a_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 } /* 12 (3/0) */
 
@@ -28462,10 +27014,8 @@ void REGPARAM2 CPUFUNC(op_b03b_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 } /* 14 (3/0) */
 
@@ -28482,10 +27032,8 @@ void REGPARAM2 CPUFUNC(op_b03c_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (4);
 } /* 8 (2/0) */
 
@@ -28503,10 +27051,8 @@ void REGPARAM2 CPUFUNC(op_b040_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 } /* 4 (1/0) */
 
@@ -28524,10 +27070,8 @@ void REGPARAM2 CPUFUNC(op_b048_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 } /* 4 (1/0) */
 
@@ -28550,10 +27094,8 @@ void REGPARAM2 CPUFUNC(op_b050_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel4949: ;
 } /* 8 (2/0) */
@@ -28578,10 +27120,8 @@ void REGPARAM2 CPUFUNC(op_b058_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel4950: ;
 } /* 8 (2/0) */
@@ -28608,10 +27148,8 @@ void REGPARAM2 CPUFUNC(op_b060_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel4951: ;
 } /* 10 (2/0) */
@@ -28635,10 +27173,8 @@ void REGPARAM2 CPUFUNC(op_b068_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel4952: ;
 } /* 12 (3/0) */
@@ -28664,10 +27200,8 @@ void REGPARAM2 CPUFUNC(op_b070_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel4953: ;
 } /* 14 (3/0) */
@@ -28690,10 +27224,8 @@ void REGPARAM2 CPUFUNC(op_b078_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel4954: ;
 } /* 12 (3/0) */
@@ -28718,10 +27250,8 @@ void REGPARAM2 CPUFUNC(op_b079_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel4955: ;
 } /* 16 (4/0) */
@@ -28745,10 +27275,8 @@ void REGPARAM2 CPUFUNC(op_b07a_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel4956: ;
 } /* 12 (3/0) */
@@ -28775,10 +27303,8 @@ void REGPARAM2 CPUFUNC(op_b07b_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel4957: ;
 } /* 14 (3/0) */
@@ -28796,10 +27322,8 @@ void REGPARAM2 CPUFUNC(op_b07c_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (4);
 } /* 8 (2/0) */
 
@@ -28818,10 +27342,8 @@ void REGPARAM2 CPUFUNC(op_b080_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 } /* 6 (1/0) */
 
@@ -28840,10 +27362,8 @@ void REGPARAM2 CPUFUNC(op_b088_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 } /* 6 (1/0) */
 
@@ -28870,10 +27390,8 @@ void REGPARAM2 CPUFUNC(op_b090_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel4961: ;
 } /* 14 (3/0) */
@@ -28899,10 +27417,8 @@ void REGPARAM2 CPUFUNC(op_b098_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel4962: ;
 } /* 14 (3/0) */
@@ -28930,10 +27446,8 @@ void REGPARAM2 CPUFUNC(op_b0a0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel4963: ;
 } /* 16 (3/0) */
@@ -28958,10 +27472,8 @@ void REGPARAM2 CPUFUNC(op_b0a8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel4964: ;
 } /* 18 (4/0) */
@@ -28988,10 +27500,8 @@ void REGPARAM2 CPUFUNC(op_b0b0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel4965: ;
 } /* 20 (4/0) */
@@ -29015,10 +27525,8 @@ void REGPARAM2 CPUFUNC(op_b0b8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel4966: ;
 } /* 18 (4/0) */
@@ -29044,10 +27552,8 @@ void REGPARAM2 CPUFUNC(op_b0b9_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel4967: ;
 } /* 22 (5/0) */
@@ -29072,10 +27578,8 @@ void REGPARAM2 CPUFUNC(op_b0ba_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel4968: ;
 } /* 18 (4/0) */
@@ -29103,10 +27607,8 @@ void REGPARAM2 CPUFUNC(op_b0bb_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel4969: ;
 } /* 20 (4/0) */
@@ -29127,10 +27629,8 @@ void REGPARAM2 CPUFUNC(op_b0bc_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (6);
 } /* 14 (3/0) */
 
@@ -29149,10 +27649,8 @@ void REGPARAM2 CPUFUNC(op_b0c0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 } /* 6 (1/0) */
 
@@ -29171,10 +27669,8 @@ void REGPARAM2 CPUFUNC(op_b0c8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 } /* 6 (1/0) */
 
@@ -29198,10 +27694,8 @@ void REGPARAM2 CPUFUNC(op_b0d0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel4973: ;
 } /* 10 (2/0) */
@@ -29227,10 +27721,8 @@ void REGPARAM2 CPUFUNC(op_b0d8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel4974: ;
 } /* 10 (2/0) */
@@ -29258,10 +27750,8 @@ void REGPARAM2 CPUFUNC(op_b0e0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel4975: ;
 } /* 12 (2/0) */
@@ -29286,10 +27776,8 @@ void REGPARAM2 CPUFUNC(op_b0e8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel4976: ;
 } /* 14 (3/0) */
@@ -29316,10 +27804,8 @@ void REGPARAM2 CPUFUNC(op_b0f0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel4977: ;
 } /* 16 (3/0) */
@@ -29343,10 +27829,8 @@ void REGPARAM2 CPUFUNC(op_b0f8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel4978: ;
 } /* 14 (3/0) */
@@ -29372,10 +27856,8 @@ void REGPARAM2 CPUFUNC(op_b0f9_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel4979: ;
 } /* 18 (4/0) */
@@ -29400,10 +27882,8 @@ void REGPARAM2 CPUFUNC(op_b0fa_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel4980: ;
 } /* 14 (3/0) */
@@ -29431,10 +27911,8 @@ void REGPARAM2 CPUFUNC(op_b0fb_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel4981: ;
 } /* 16 (3/0) */
@@ -29453,10 +27931,8 @@ void REGPARAM2 CPUFUNC(op_b0fc_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (4);
 } /* 10 (2/0) */
 
@@ -29468,9 +27944,7 @@ void REGPARAM2 CPUFUNC(op_b100_12)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -29496,10 +27970,8 @@ void REGPARAM2 CPUFUNC(op_b108_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 } /* 12 (3/0) */
 
@@ -29512,9 +27984,7 @@ void REGPARAM2 CPUFUNC(op_b110_12)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -29532,9 +28002,7 @@ void REGPARAM2 CPUFUNC(op_b118_12)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -29554,9 +28022,7 @@ void REGPARAM2 CPUFUNC(op_b120_12)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -29573,9 +28039,7 @@ void REGPARAM2 CPUFUNC(op_b128_12)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -29594,9 +28058,7 @@ void REGPARAM2 CPUFUNC(op_b130_12)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (4));
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -29612,9 +28074,7 @@ void REGPARAM2 CPUFUNC(op_b138_12)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -29632,9 +28092,7 @@ void REGPARAM2 CPUFUNC(op_b139_12)(uae_u32 opcode)
 	dsta |= get_word_ce000_prefetch (6);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -29650,9 +28108,7 @@ void REGPARAM2 CPUFUNC(op_b140_12)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -29686,10 +28142,8 @@ void REGPARAM2 CPUFUNC(op_b148_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}}}	m68k_incpc (2);
 endlabel4993: ;
 } /* 12 (3/0) */
@@ -29707,9 +28161,7 @@ void REGPARAM2 CPUFUNC(op_b150_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -29732,9 +28184,7 @@ void REGPARAM2 CPUFUNC(op_b158_12)(uae_u32 opcode)
 {{	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -29759,9 +28209,7 @@ void REGPARAM2 CPUFUNC(op_b160_12)(uae_u32 opcode)
 {{	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -29783,9 +28231,7 @@ void REGPARAM2 CPUFUNC(op_b168_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -29809,9 +28255,7 @@ void REGPARAM2 CPUFUNC(op_b170_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -29832,9 +28276,7 @@ void REGPARAM2 CPUFUNC(op_b178_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -29857,9 +28299,7 @@ void REGPARAM2 CPUFUNC(op_b179_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -29876,9 +28316,7 @@ void REGPARAM2 CPUFUNC(op_b180_12)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -29913,10 +28351,8 @@ void REGPARAM2 CPUFUNC(op_b188_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}}}	m68k_incpc (2);
 endlabel5002: ;
 } /* 20 (5/0) */
@@ -29934,9 +28370,7 @@ void REGPARAM2 CPUFUNC(op_b190_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -29959,9 +28393,7 @@ void REGPARAM2 CPUFUNC(op_b198_12)(uae_u32 opcode)
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	m68k_areg (regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -29986,9 +28418,7 @@ void REGPARAM2 CPUFUNC(op_b1a0_12)(uae_u32 opcode)
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -30010,9 +28440,7 @@ void REGPARAM2 CPUFUNC(op_b1a8_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -30036,9 +28464,7 @@ void REGPARAM2 CPUFUNC(op_b1b0_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -30059,9 +28485,7 @@ void REGPARAM2 CPUFUNC(op_b1b8_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -30084,9 +28508,7 @@ void REGPARAM2 CPUFUNC(op_b1b9_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -30110,10 +28532,8 @@ void REGPARAM2 CPUFUNC(op_b1c0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 } /* 6 (1/0) */
 
@@ -30132,10 +28552,8 @@ void REGPARAM2 CPUFUNC(op_b1c8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 } /* 6 (1/0) */
 
@@ -30159,10 +28577,8 @@ void REGPARAM2 CPUFUNC(op_b1d0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel5012: ;
 } /* 14 (3/0) */
@@ -30188,10 +28604,8 @@ void REGPARAM2 CPUFUNC(op_b1d8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel5013: ;
 } /* 14 (3/0) */
@@ -30219,10 +28633,8 @@ void REGPARAM2 CPUFUNC(op_b1e0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 endlabel5014: ;
 } /* 16 (3/0) */
@@ -30247,10 +28659,8 @@ void REGPARAM2 CPUFUNC(op_b1e8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel5015: ;
 } /* 18 (4/0) */
@@ -30277,10 +28687,8 @@ void REGPARAM2 CPUFUNC(op_b1f0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel5016: ;
 } /* 20 (4/0) */
@@ -30304,10 +28712,8 @@ void REGPARAM2 CPUFUNC(op_b1f8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel5017: ;
 } /* 18 (4/0) */
@@ -30333,10 +28739,8 @@ void REGPARAM2 CPUFUNC(op_b1f9_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (6);
 endlabel5018: ;
 } /* 22 (5/0) */
@@ -30361,10 +28765,8 @@ void REGPARAM2 CPUFUNC(op_b1fa_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel5019: ;
 } /* 18 (4/0) */
@@ -30392,10 +28794,8 @@ void REGPARAM2 CPUFUNC(op_b1fb_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (4);
 endlabel5020: ;
 } /* 20 (4/0) */
@@ -30416,10 +28816,8 @@ void REGPARAM2 CPUFUNC(op_b1fc_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (6);
 } /* 14 (3/0) */
 
@@ -30431,9 +28829,7 @@ void REGPARAM2 CPUFUNC(op_c000_12)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -30450,9 +28846,7 @@ void REGPARAM2 CPUFUNC(op_c010_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -30470,9 +28864,7 @@ void REGPARAM2 CPUFUNC(op_c018_12)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -30492,9 +28884,7 @@ void REGPARAM2 CPUFUNC(op_c020_12)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -30511,9 +28901,7 @@ void REGPARAM2 CPUFUNC(op_c028_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -30532,9 +28920,7 @@ void REGPARAM2 CPUFUNC(op_c030_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -30550,9 +28936,7 @@ void REGPARAM2 CPUFUNC(op_c038_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -30570,9 +28954,7 @@ void REGPARAM2 CPUFUNC(op_c039_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -30589,9 +28971,7 @@ void REGPARAM2 CPUFUNC(op_c03a_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -30611,9 +28991,7 @@ void REGPARAM2 CPUFUNC(op_c03b_12)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -30628,9 +29006,7 @@ void REGPARAM2 CPUFUNC(op_c03c_12)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce000_prefetch (4);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -30646,9 +29022,7 @@ void REGPARAM2 CPUFUNC(op_c040_12)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -30669,9 +29043,7 @@ void REGPARAM2 CPUFUNC(op_c050_12)(uae_u32 opcode)
 {{	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -30694,9 +29066,7 @@ void REGPARAM2 CPUFUNC(op_c058_12)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -30721,9 +29091,7 @@ void REGPARAM2 CPUFUNC(op_c060_12)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -30745,9 +29113,7 @@ void REGPARAM2 CPUFUNC(op_c068_12)(uae_u32 opcode)
 {{	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -30771,9 +29137,7 @@ void REGPARAM2 CPUFUNC(op_c070_12)(uae_u32 opcode)
 {{	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -30794,9 +29158,7 @@ void REGPARAM2 CPUFUNC(op_c078_12)(uae_u32 opcode)
 {{	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -30819,9 +29181,7 @@ void REGPARAM2 CPUFUNC(op_c079_12)(uae_u32 opcode)
 {{	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -30843,9 +29203,7 @@ void REGPARAM2 CPUFUNC(op_c07a_12)(uae_u32 opcode)
 {{	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -30870,9 +29228,7 @@ void REGPARAM2 CPUFUNC(op_c07b_12)(uae_u32 opcode)
 {{	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -30888,9 +29244,7 @@ void REGPARAM2 CPUFUNC(op_c07c_12)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce000_prefetch (4);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -30906,9 +29260,7 @@ void REGPARAM2 CPUFUNC(op_c080_12)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -30930,9 +29282,7 @@ void REGPARAM2 CPUFUNC(op_c090_12)(uae_u32 opcode)
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -30956,9 +29306,7 @@ void REGPARAM2 CPUFUNC(op_c098_12)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -30984,9 +29332,7 @@ void REGPARAM2 CPUFUNC(op_c0a0_12)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -31009,9 +29355,7 @@ void REGPARAM2 CPUFUNC(op_c0a8_12)(uae_u32 opcode)
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -31036,9 +29380,7 @@ void REGPARAM2 CPUFUNC(op_c0b0_12)(uae_u32 opcode)
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -31060,9 +29402,7 @@ void REGPARAM2 CPUFUNC(op_c0b8_12)(uae_u32 opcode)
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -31086,9 +29426,7 @@ void REGPARAM2 CPUFUNC(op_c0b9_12)(uae_u32 opcode)
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -31111,9 +29449,7 @@ void REGPARAM2 CPUFUNC(op_c0ba_12)(uae_u32 opcode)
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -31139,9 +29475,7 @@ void REGPARAM2 CPUFUNC(op_c0bb_12)(uae_u32 opcode)
 {{	uae_s32 src = x_get_word (srca) << 16; src |= x_get_word (srca + 2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -31160,9 +29494,7 @@ void REGPARAM2 CPUFUNC(op_c0bc_12)(uae_u32 opcode)
 	src |= get_word_ce000_prefetch (6);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -31183,9 +29515,7 @@ void REGPARAM2 CPUFUNC(op_c0c0_12)(uae_u32 opcode)
 	get_word_ce000_prefetch (4);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	int cycles = 38 - 4, bits;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	for(bits = 0; bits < 16 && src; bits++, src >>= 1)
 		if (src & 1) cycles += 2;
 	if (cycles > 0) do_cycles_ce000 (cycles);
@@ -31210,9 +29540,7 @@ void REGPARAM2 CPUFUNC(op_c0d0_12)(uae_u32 opcode)
 	get_word_ce000_prefetch (4);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	int cycles = 38 - 4, bits;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	for(bits = 0; bits < 16 && src; bits++, src >>= 1)
 		if (src & 1) cycles += 2;
 	if (cycles > 0) do_cycles_ce000 (cycles);
@@ -31239,9 +29567,7 @@ void REGPARAM2 CPUFUNC(op_c0d8_12)(uae_u32 opcode)
 	get_word_ce000_prefetch (4);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	int cycles = 38 - 4, bits;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	for(bits = 0; bits < 16 && src; bits++, src >>= 1)
 		if (src & 1) cycles += 2;
 	if (cycles > 0) do_cycles_ce000 (cycles);
@@ -31270,9 +29596,7 @@ void REGPARAM2 CPUFUNC(op_c0e0_12)(uae_u32 opcode)
 	get_word_ce000_prefetch (4);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	int cycles = 38 - 4, bits;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	for(bits = 0; bits < 16 && src; bits++, src >>= 1)
 		if (src & 1) cycles += 2;
 	if (cycles > 0) do_cycles_ce000 (cycles);
@@ -31298,9 +29622,7 @@ void REGPARAM2 CPUFUNC(op_c0e8_12)(uae_u32 opcode)
 	get_word_ce000_prefetch (6);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	int cycles = 38 - 4, bits;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	for(bits = 0; bits < 16 && src; bits++, src >>= 1)
 		if (src & 1) cycles += 2;
 	if (cycles > 0) do_cycles_ce000 (cycles);
@@ -31328,9 +29650,7 @@ void REGPARAM2 CPUFUNC(op_c0f0_12)(uae_u32 opcode)
 	get_word_ce000_prefetch (6);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	int cycles = 38 - 4, bits;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	for(bits = 0; bits < 16 && src; bits++, src >>= 1)
 		if (src & 1) cycles += 2;
 	if (cycles > 0) do_cycles_ce000 (cycles);
@@ -31355,9 +29675,7 @@ void REGPARAM2 CPUFUNC(op_c0f8_12)(uae_u32 opcode)
 	get_word_ce000_prefetch (6);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	int cycles = 38 - 4, bits;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	for(bits = 0; bits < 16 && src; bits++, src >>= 1)
 		if (src & 1) cycles += 2;
 	if (cycles > 0) do_cycles_ce000 (cycles);
@@ -31384,9 +29702,7 @@ void REGPARAM2 CPUFUNC(op_c0f9_12)(uae_u32 opcode)
 	get_word_ce000_prefetch (8);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	int cycles = 38 - 4, bits;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	for(bits = 0; bits < 16 && src; bits++, src >>= 1)
 		if (src & 1) cycles += 2;
 	if (cycles > 0) do_cycles_ce000 (cycles);
@@ -31412,9 +29728,7 @@ void REGPARAM2 CPUFUNC(op_c0fa_12)(uae_u32 opcode)
 	get_word_ce000_prefetch (6);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	int cycles = 38 - 4, bits;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	for(bits = 0; bits < 16 && src; bits++, src >>= 1)
 		if (src & 1) cycles += 2;
 	if (cycles > 0) do_cycles_ce000 (cycles);
@@ -31443,9 +29757,7 @@ void REGPARAM2 CPUFUNC(op_c0fb_12)(uae_u32 opcode)
 	get_word_ce000_prefetch (6);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	int cycles = 38 - 4, bits;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	for(bits = 0; bits < 16 && src; bits++, src >>= 1)
 		if (src & 1) cycles += 2;
 	if (cycles > 0) do_cycles_ce000 (cycles);
@@ -31465,9 +29777,7 @@ void REGPARAM2 CPUFUNC(op_c0fc_12)(uae_u32 opcode)
 	get_word_ce000_prefetch (6);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	int cycles = 38 - 4, bits;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	for(bits = 0; bits < 16 && src; bits++, src >>= 1)
 		if (src & 1) cycles += 2;
 	if (cycles > 0) do_cycles_ce000 (cycles);
@@ -31544,9 +29854,7 @@ void REGPARAM2 CPUFUNC(op_c110_12)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -31564,9 +29872,7 @@ void REGPARAM2 CPUFUNC(op_c118_12)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -31586,9 +29892,7 @@ void REGPARAM2 CPUFUNC(op_c120_12)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -31605,9 +29909,7 @@ void REGPARAM2 CPUFUNC(op_c128_12)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -31626,9 +29928,7 @@ void REGPARAM2 CPUFUNC(op_c130_12)(uae_u32 opcode)
 	dsta = get_disp_ea_000 (m68k_areg (regs, dstreg), get_word_ce000_prefetch (4));
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -31644,9 +29944,7 @@ void REGPARAM2 CPUFUNC(op_c138_12)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce000_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -31664,9 +29962,7 @@ void REGPARAM2 CPUFUNC(op_c139_12)(uae_u32 opcode)
 	dsta |= get_word_ce000_prefetch (6);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -31719,9 +30015,7 @@ void REGPARAM2 CPUFUNC(op_c150_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -31744,9 +30038,7 @@ void REGPARAM2 CPUFUNC(op_c158_12)(uae_u32 opcode)
 {{	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -31771,9 +30063,7 @@ void REGPARAM2 CPUFUNC(op_c160_12)(uae_u32 opcode)
 {{	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -31795,9 +30085,7 @@ void REGPARAM2 CPUFUNC(op_c168_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -31821,9 +30109,7 @@ void REGPARAM2 CPUFUNC(op_c170_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -31844,9 +30130,7 @@ void REGPARAM2 CPUFUNC(op_c178_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -31869,9 +30153,7 @@ void REGPARAM2 CPUFUNC(op_c179_12)(uae_u32 opcode)
 	}
 {{	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -31909,9 +30191,7 @@ void REGPARAM2 CPUFUNC(op_c190_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -31934,9 +30214,7 @@ void REGPARAM2 CPUFUNC(op_c198_12)(uae_u32 opcode)
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	m68k_areg (regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -31961,9 +30239,7 @@ void REGPARAM2 CPUFUNC(op_c1a0_12)(uae_u32 opcode)
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (4);
@@ -31985,9 +30261,7 @@ void REGPARAM2 CPUFUNC(op_c1a8_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -32011,9 +30285,7 @@ void REGPARAM2 CPUFUNC(op_c1b0_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -32034,9 +30306,7 @@ void REGPARAM2 CPUFUNC(op_c1b8_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (6);
@@ -32059,9 +30329,7 @@ void REGPARAM2 CPUFUNC(op_c1b9_12)(uae_u32 opcode)
 	}
 {{	uae_s32 dst = x_get_word (dsta) << 16; dst |= x_get_word (dsta + 2);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.ir = regs.irc;
 	ipl_fetch ();
 	get_word_ce000_prefetch (8);
@@ -32083,9 +30351,7 @@ void REGPARAM2 CPUFUNC(op_c1c0_12)(uae_u32 opcode)
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	int cycles = 38 - 4, bits;
 	uae_u32 usrc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	usrc = ((uae_u32)src) << 1;
 	for(bits = 0; bits < 16 && usrc; bits++, usrc >>= 1)
 		if ((usrc & 3) == 1 || (usrc & 3) == 2) cycles += 2;
@@ -32112,9 +30378,7 @@ void REGPARAM2 CPUFUNC(op_c1d0_12)(uae_u32 opcode)
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	int cycles = 38 - 4, bits;
 	uae_u32 usrc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	usrc = ((uae_u32)src) << 1;
 	for(bits = 0; bits < 16 && usrc; bits++, usrc >>= 1)
 		if ((usrc & 3) == 1 || (usrc & 3) == 2) cycles += 2;
@@ -32143,9 +30407,7 @@ void REGPARAM2 CPUFUNC(op_c1d8_12)(uae_u32 opcode)
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	int cycles = 38 - 4, bits;
 	uae_u32 usrc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	usrc = ((uae_u32)src) << 1;
 	for(bits = 0; bits < 16 && usrc; bits++, usrc >>= 1)
 		if ((usrc & 3) == 1 || (usrc & 3) == 2) cycles += 2;
@@ -32176,9 +30438,7 @@ void REGPARAM2 CPUFUNC(op_c1e0_12)(uae_u32 opcode)
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	int cycles = 38 - 4, bits;
 	uae_u32 usrc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	usrc = ((uae_u32)src) << 1;
 	for(bits = 0; bits < 16 && usrc; bits++, usrc >>= 1)
 		if ((usrc & 3) == 1 || (usrc & 3) == 2) cycles += 2;
@@ -32206,9 +30466,7 @@ void REGPARAM2 CPUFUNC(op_c1e8_12)(uae_u32 opcode)
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	int cycles = 38 - 4, bits;
 	uae_u32 usrc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	usrc = ((uae_u32)src) << 1;
 	for(bits = 0; bits < 16 && usrc; bits++, usrc >>= 1)
 		if ((usrc & 3) == 1 || (usrc & 3) == 2) cycles += 2;
@@ -32238,9 +30496,7 @@ void REGPARAM2 CPUFUNC(op_c1f0_12)(uae_u32 opcode)
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	int cycles = 38 - 4, bits;
 	uae_u32 usrc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	usrc = ((uae_u32)src) << 1;
 	for(bits = 0; bits < 16 && usrc; bits++, usrc >>= 1)
 		if ((usrc & 3) == 1 || (usrc & 3) == 2) cycles += 2;
@@ -32267,9 +30523,7 @@ void REGPARAM2 CPUFUNC(op_c1f8_12)(uae_u32 opcode)
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	int cycles = 38 - 4, bits;
 	uae_u32 usrc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	usrc = ((uae_u32)src) << 1;
 	for(bits = 0; bits < 16 && usrc; bits++, usrc >>= 1)
 		if ((usrc & 3) == 1 || (usrc & 3) == 2) cycles += 2;
@@ -32298,9 +30552,7 @@ void REGPARAM2 CPUFUNC(op_c1f9_12)(uae_u32 opcode)
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	int cycles = 38 - 4, bits;
 	uae_u32 usrc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	usrc = ((uae_u32)src) << 1;
 	for(bits = 0; bits < 16 && usrc; bits++, usrc >>= 1)
 		if ((usrc & 3) == 1 || (usrc & 3) == 2) cycles += 2;
@@ -32328,9 +30580,7 @@ void REGPARAM2 CPUFUNC(op_c1fa_12)(uae_u32 opcode)
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	int cycles = 38 - 4, bits;
 	uae_u32 usrc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	usrc = ((uae_u32)src) << 1;
 	for(bits = 0; bits < 16 && usrc; bits++, usrc >>= 1)
 		if ((usrc & 3) == 1 || (usrc & 3) == 2) cycles += 2;
@@ -32361,9 +30611,7 @@ void REGPARAM2 CPUFUNC(op_c1fb_12)(uae_u32 opcode)
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	int cycles = 38 - 4, bits;
 	uae_u32 usrc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	usrc = ((uae_u32)src) << 1;
 	for(bits = 0; bits < 16 && usrc; bits++, usrc >>= 1)
 		if ((usrc & 3) == 1 || (usrc & 3) == 2) cycles += 2;
@@ -32385,9 +30633,7 @@ void REGPARAM2 CPUFUNC(op_c1fc_12)(uae_u32 opcode)
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	int cycles = 38 - 4, bits;
 	uae_u32 usrc;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	usrc = ((uae_u32)src) << 1;
 	for(bits = 0; bits < 16 && usrc; bits++, usrc >>= 1)
 		if ((usrc & 3) == 1 || (usrc & 3) == 2) cycles += 2;
@@ -32410,11 +30656,9 @@ void REGPARAM2 CPUFUNC(op_d000_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -32434,11 +30678,9 @@ void REGPARAM2 CPUFUNC(op_d010_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 } /* 8 (2/0) */
@@ -32459,11 +30701,9 @@ void REGPARAM2 CPUFUNC(op_d018_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 } /* 8 (2/0) */
@@ -32486,11 +30726,9 @@ void REGPARAM2 CPUFUNC(op_d020_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 } /* 10 (2/0) */
@@ -32510,11 +30748,9 @@ void REGPARAM2 CPUFUNC(op_d028_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 } /* 12 (3/0) */
@@ -32536,11 +30772,9 @@ void REGPARAM2 CPUFUNC(op_d030_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 } /* 14 (3/0) */
@@ -32559,11 +30793,9 @@ void REGPARAM2 CPUFUNC(op_d038_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 } /* 12 (3/0) */
@@ -32584,11 +30816,9 @@ void REGPARAM2 CPUFUNC(op_d039_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (6);
 } /* 16 (4/0) */
@@ -32608,11 +30838,9 @@ void REGPARAM2 CPUFUNC(op_d03a_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 } /* 12 (3/0) */
@@ -32635,11 +30863,9 @@ void REGPARAM2 CPUFUNC(op_d03b_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 } /* 14 (3/0) */
@@ -32657,11 +30883,9 @@ void REGPARAM2 CPUFUNC(op_d03c_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (4);
 } /* 8 (2/0) */
@@ -32680,11 +30904,9 @@ void REGPARAM2 CPUFUNC(op_d040_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -32703,11 +30925,9 @@ void REGPARAM2 CPUFUNC(op_d048_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 } /* 4 (1/0) */
@@ -32731,11 +30951,9 @@ void REGPARAM2 CPUFUNC(op_d050_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (2);
 endlabel5116: ;
@@ -32761,11 +30979,9 @@ void REGPARAM2 CPUFUNC(op_d058_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (2);
 endlabel5117: ;
@@ -32793,11 +31009,9 @@ void REGPARAM2 CPUFUNC(op_d060_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (2);
 endlabel5118: ;
@@ -32822,11 +31036,9 @@ void REGPARAM2 CPUFUNC(op_d068_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel5119: ;
@@ -32853,11 +31065,9 @@ void REGPARAM2 CPUFUNC(op_d070_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel5120: ;
@@ -32881,11 +31091,9 @@ void REGPARAM2 CPUFUNC(op_d078_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel5121: ;
@@ -32911,11 +31119,9 @@ void REGPARAM2 CPUFUNC(op_d079_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (6);
 endlabel5122: ;
@@ -32940,11 +31146,9 @@ void REGPARAM2 CPUFUNC(op_d07a_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel5123: ;
@@ -32972,11 +31176,9 @@ void REGPARAM2 CPUFUNC(op_d07b_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	m68k_incpc (4);
 endlabel5124: ;
@@ -32995,11 +31197,9 @@ void REGPARAM2 CPUFUNC(op_d07c_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (4);
 } /* 8 (2/0) */
@@ -33019,11 +31219,9 @@ void REGPARAM2 CPUFUNC(op_d080_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 } /* 8 (1/0) */
@@ -33043,11 +31241,9 @@ void REGPARAM2 CPUFUNC(op_d088_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 } /* 6 (1/0) */
@@ -33072,11 +31268,9 @@ void REGPARAM2 CPUFUNC(op_d090_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel5128: ;
@@ -33103,11 +31297,9 @@ void REGPARAM2 CPUFUNC(op_d098_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel5129: ;
@@ -33136,11 +31328,9 @@ void REGPARAM2 CPUFUNC(op_d0a0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel5130: ;
@@ -33166,11 +31356,9 @@ void REGPARAM2 CPUFUNC(op_d0a8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel5131: ;
@@ -33198,11 +31386,9 @@ void REGPARAM2 CPUFUNC(op_d0b0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel5132: ;
@@ -33227,11 +31413,9 @@ void REGPARAM2 CPUFUNC(op_d0b8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel5133: ;
@@ -33258,11 +31442,9 @@ void REGPARAM2 CPUFUNC(op_d0b9_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel5134: ;
@@ -33288,11 +31470,9 @@ void REGPARAM2 CPUFUNC(op_d0ba_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel5135: ;
@@ -33321,11 +31501,9 @@ void REGPARAM2 CPUFUNC(op_d0bb_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel5136: ;
@@ -33347,11 +31525,9 @@ void REGPARAM2 CPUFUNC(op_d0bc_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (6);
 } /* 16 (3/0) */
@@ -33678,11 +31854,9 @@ void REGPARAM2 CPUFUNC(op_d110_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 } /* 12 (2/1) */
@@ -33703,11 +31877,9 @@ void REGPARAM2 CPUFUNC(op_d118_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 } /* 12 (2/1) */
@@ -33730,11 +31902,9 @@ void REGPARAM2 CPUFUNC(op_d120_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 } /* 14 (2/1) */
@@ -33754,11 +31924,9 @@ void REGPARAM2 CPUFUNC(op_d128_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -33780,11 +31948,9 @@ void REGPARAM2 CPUFUNC(op_d130_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 18 (3/1) */
@@ -33803,11 +31969,9 @@ void REGPARAM2 CPUFUNC(op_d138_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 } /* 16 (3/1) */
@@ -33828,11 +31992,9 @@ void REGPARAM2 CPUFUNC(op_d139_12)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 } /* 20 (4/1) */
@@ -33918,11 +32080,9 @@ void REGPARAM2 CPUFUNC(op_d150_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel5161: ;
@@ -33948,11 +32108,9 @@ void REGPARAM2 CPUFUNC(op_d158_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel5162: ;
@@ -33980,11 +32138,9 @@ void REGPARAM2 CPUFUNC(op_d160_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (2);
 endlabel5163: ;
@@ -34009,11 +32165,9 @@ void REGPARAM2 CPUFUNC(op_d168_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel5164: ;
@@ -34040,11 +32194,9 @@ void REGPARAM2 CPUFUNC(op_d170_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel5165: ;
@@ -34068,11 +32220,9 @@ void REGPARAM2 CPUFUNC(op_d178_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (4);
 endlabel5166: ;
@@ -34098,11 +32248,9 @@ void REGPARAM2 CPUFUNC(op_d179_12)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	m68k_incpc (6);
 endlabel5167: ;
@@ -34190,11 +32338,9 @@ void REGPARAM2 CPUFUNC(op_d190_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (2);
 endlabel5170: ;
@@ -34220,11 +32366,9 @@ void REGPARAM2 CPUFUNC(op_d198_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (2);
 endlabel5171: ;
@@ -34252,11 +32396,9 @@ void REGPARAM2 CPUFUNC(op_d1a0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (2);
 endlabel5172: ;
@@ -34281,11 +32423,9 @@ void REGPARAM2 CPUFUNC(op_d1a8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (4);
 endlabel5173: ;
@@ -34312,11 +32452,9 @@ void REGPARAM2 CPUFUNC(op_d1b0_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (4);
 endlabel5174: ;
@@ -34340,11 +32478,9 @@ void REGPARAM2 CPUFUNC(op_d1b8_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (4);
 endlabel5175: ;
@@ -34370,11 +32506,9 @@ void REGPARAM2 CPUFUNC(op_d1b9_12)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta + 2, newv); x_put_word (dsta, newv >> 16);
 }}}}}}}}	m68k_incpc (6);
 endlabel5176: ;
@@ -35529,9 +33663,7 @@ void REGPARAM2 CPUFUNC(op_e0d0_12)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -35557,9 +33689,7 @@ void REGPARAM2 CPUFUNC(op_e0d8_12)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -35587,9 +33717,7 @@ void REGPARAM2 CPUFUNC(op_e0e0_12)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -35614,9 +33742,7 @@ void REGPARAM2 CPUFUNC(op_e0e8_12)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -35643,9 +33769,7 @@ void REGPARAM2 CPUFUNC(op_e0f0_12)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -35669,9 +33793,7 @@ void REGPARAM2 CPUFUNC(op_e0f8_12)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -35697,9 +33819,7 @@ void REGPARAM2 CPUFUNC(op_e0f9_12)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -36594,9 +34714,7 @@ void REGPARAM2 CPUFUNC(op_e1d0_12)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -36624,9 +34742,7 @@ void REGPARAM2 CPUFUNC(op_e1d8_12)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -36656,9 +34772,7 @@ void REGPARAM2 CPUFUNC(op_e1e0_12)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -36685,9 +34799,7 @@ void REGPARAM2 CPUFUNC(op_e1e8_12)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -36716,9 +34828,7 @@ void REGPARAM2 CPUFUNC(op_e1f0_12)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -36744,9 +34854,7 @@ void REGPARAM2 CPUFUNC(op_e1f8_12)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -36774,9 +34882,7 @@ void REGPARAM2 CPUFUNC(op_e1f9_12)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -36802,9 +34908,7 @@ void REGPARAM2 CPUFUNC(op_e2d0_12)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -36829,9 +34933,7 @@ void REGPARAM2 CPUFUNC(op_e2d8_12)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -36858,9 +34960,7 @@ void REGPARAM2 CPUFUNC(op_e2e0_12)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -36884,9 +34984,7 @@ void REGPARAM2 CPUFUNC(op_e2e8_12)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -36912,9 +35010,7 @@ void REGPARAM2 CPUFUNC(op_e2f0_12)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -36937,9 +35033,7 @@ void REGPARAM2 CPUFUNC(op_e2f8_12)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -36964,9 +35058,7 @@ void REGPARAM2 CPUFUNC(op_e2f9_12)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -36990,9 +35082,7 @@ void REGPARAM2 CPUFUNC(op_e3d0_12)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37017,9 +35107,7 @@ void REGPARAM2 CPUFUNC(op_e3d8_12)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37046,9 +35134,7 @@ void REGPARAM2 CPUFUNC(op_e3e0_12)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37072,9 +35158,7 @@ void REGPARAM2 CPUFUNC(op_e3e8_12)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37100,9 +35184,7 @@ void REGPARAM2 CPUFUNC(op_e3f0_12)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37125,9 +35207,7 @@ void REGPARAM2 CPUFUNC(op_e3f8_12)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37152,9 +35232,7 @@ void REGPARAM2 CPUFUNC(op_e3f9_12)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37179,9 +35257,7 @@ void REGPARAM2 CPUFUNC(op_e4d0_12)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37207,9 +35283,7 @@ void REGPARAM2 CPUFUNC(op_e4d8_12)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37237,9 +35311,7 @@ void REGPARAM2 CPUFUNC(op_e4e0_12)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37264,9 +35336,7 @@ void REGPARAM2 CPUFUNC(op_e4e8_12)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37293,9 +35363,7 @@ void REGPARAM2 CPUFUNC(op_e4f0_12)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37319,9 +35387,7 @@ void REGPARAM2 CPUFUNC(op_e4f8_12)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37347,9 +35413,7 @@ void REGPARAM2 CPUFUNC(op_e4f9_12)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37374,9 +35438,7 @@ void REGPARAM2 CPUFUNC(op_e5d0_12)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37402,9 +35464,7 @@ void REGPARAM2 CPUFUNC(op_e5d8_12)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37432,9 +35492,7 @@ void REGPARAM2 CPUFUNC(op_e5e0_12)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37459,9 +35517,7 @@ void REGPARAM2 CPUFUNC(op_e5e8_12)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37488,9 +35544,7 @@ void REGPARAM2 CPUFUNC(op_e5f0_12)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37514,9 +35568,7 @@ void REGPARAM2 CPUFUNC(op_e5f8_12)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37542,9 +35594,7 @@ void REGPARAM2 CPUFUNC(op_e5f9_12)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -37569,9 +35619,7 @@ void REGPARAM2 CPUFUNC(op_e6d0_12)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}}	m68k_incpc (2);
@@ -37596,9 +35644,7 @@ void REGPARAM2 CPUFUNC(op_e6d8_12)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}}	m68k_incpc (2);
@@ -37625,9 +35671,7 @@ void REGPARAM2 CPUFUNC(op_e6e0_12)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}}	m68k_incpc (2);
@@ -37651,9 +35695,7 @@ void REGPARAM2 CPUFUNC(op_e6e8_12)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}}	m68k_incpc (4);
@@ -37679,9 +35721,7 @@ void REGPARAM2 CPUFUNC(op_e6f0_12)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}}	m68k_incpc (4);
@@ -37704,9 +35744,7 @@ void REGPARAM2 CPUFUNC(op_e6f8_12)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}}	m68k_incpc (4);
@@ -37731,9 +35769,7 @@ void REGPARAM2 CPUFUNC(op_e6f9_12)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}}	m68k_incpc (6);
@@ -37757,9 +35793,7 @@ void REGPARAM2 CPUFUNC(op_e7d0_12)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}}	m68k_incpc (2);
@@ -37784,9 +35818,7 @@ void REGPARAM2 CPUFUNC(op_e7d8_12)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}}	m68k_incpc (2);
@@ -37813,9 +35845,7 @@ void REGPARAM2 CPUFUNC(op_e7e0_12)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}}	m68k_incpc (2);
@@ -37839,9 +35869,7 @@ void REGPARAM2 CPUFUNC(op_e7e8_12)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}}	m68k_incpc (4);
@@ -37867,9 +35895,7 @@ void REGPARAM2 CPUFUNC(op_e7f0_12)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}}	m68k_incpc (4);
@@ -37892,9 +35918,7 @@ void REGPARAM2 CPUFUNC(op_e7f8_12)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}}	m68k_incpc (4);
@@ -37919,9 +35943,7 @@ void REGPARAM2 CPUFUNC(op_e7f9_12)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}}	m68k_incpc (6);
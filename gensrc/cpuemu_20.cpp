@@ -34,9 +34,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0000_20)(uae_u32 opcode)
 {{	uae_s8 src = x_get_ibyte (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -50,9 +48,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0010_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
@@ -67,9 +63,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0018_20)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
@@ -85,9 +79,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0020_20)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (4);
 return 22 * CYCLE_UNIT / 2;
@@ -101,9 +93,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0028_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
@@ -119,9 +109,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0030_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -133,9 +121,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0038_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
@@ -148,9 +134,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0039_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (8);
 return 28 * CYCLE_UNIT / 2;
@@ -175,9 +159,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0040_20)(uae_u32 opcode)
 {{	uae_s16 src = get_word_020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
@@ -191,9 +173,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0050_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -208,9 +188,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0058_20)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -226,9 +204,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0060_20)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
@@ -242,9 +218,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0068_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -260,9 +234,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0070_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
 }
@@ -274,9 +246,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0078_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -289,9 +259,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0079_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (8);
 return 24 * CYCLE_UNIT / 2;
@@ -317,9 +285,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0080_20)(uae_u32 opcode)
 {{	uae_s32 src = get_long_020_prefetch (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
@@ -333,9 +299,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0090_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -350,9 +314,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0098_20)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -368,9 +330,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_00a0_20)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (6);
 return 30 * CYCLE_UNIT / 2;
@@ -384,9 +344,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_00a8_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (8);
 return 32 * CYCLE_UNIT / 2;
@@ -402,9 +360,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_00b0_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 32 * CYCLE_UNIT / 2;
 }
@@ -416,9 +372,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_00b8_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (8);
 return 32 * CYCLE_UNIT / 2;
@@ -431,9 +385,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_00b9_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (10);
 return 36 * CYCLE_UNIT / 2;
@@ -1291,9 +1243,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0200_20)(uae_u32 opcode)
 {{	uae_s8 src = x_get_ibyte (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -1307,9 +1257,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0210_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
@@ -1324,9 +1272,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0218_20)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
@@ -1342,9 +1288,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0220_20)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (4);
 return 22 * CYCLE_UNIT / 2;
@@ -1358,9 +1302,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0228_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
@@ -1376,9 +1318,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0230_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -1390,9 +1330,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0238_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
@@ -1405,9 +1343,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0239_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (8);
 return 28 * CYCLE_UNIT / 2;
@@ -1432,9 +1368,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0240_20)(uae_u32 opcode)
 {{	uae_s16 src = get_word_020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
@@ -1448,9 +1382,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0250_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -1465,9 +1397,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0258_20)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -1483,9 +1413,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0260_20)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
@@ -1499,9 +1427,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0268_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -1517,9 +1443,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0270_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
 }
@@ -1531,9 +1455,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0278_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -1546,9 +1468,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0279_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (8);
 return 24 * CYCLE_UNIT / 2;
@@ -1574,9 +1494,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0280_20)(uae_u32 opcode)
 {{	uae_s32 src = get_long_020_prefetch (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
@@ -1590,9 +1508,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0290_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -1607,9 +1523,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0298_20)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -1625,9 +1539,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_02a0_20)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (6);
 return 30 * CYCLE_UNIT / 2;
@@ -1641,9 +1553,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_02a8_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (8);
 return 32 * CYCLE_UNIT / 2;
@@ -1659,9 +1569,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_02b0_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 32 * CYCLE_UNIT / 2;
 }
@@ -1673,9 +1581,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_02b8_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (8);
 return 32 * CYCLE_UNIT / 2;
@@ -1688,9 +1594,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_02b9_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (10);
 return 36 * CYCLE_UNIT / 2;
@@ -1849,11 +1753,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0400_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -1870,11 +1772,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0410_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
@@ -1892,11 +1792,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0418_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
@@ -1915,11 +1813,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0420_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 22 * CYCLE_UNIT / 2;
@@ -1936,11 +1832,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0428_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
@@ -1959,11 +1853,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0430_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -1978,11 +1870,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0438_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
@@ -1998,11 +1888,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0439_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (8);
 return 28 * CYCLE_UNIT / 2;
@@ -2018,11 +1906,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0440_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
@@ -2039,11 +1925,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0450_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -2061,11 +1945,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0458_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -2084,11 +1966,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0460_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
@@ -2105,11 +1985,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0468_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -2128,11 +2006,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0470_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}return 20 * CYCLE_UNIT / 2;
 }
@@ -2147,11 +2023,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0478_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -2167,11 +2041,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0479_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (8);
 return 24 * CYCLE_UNIT / 2;
@@ -2187,11 +2059,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0480_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
@@ -2208,11 +2078,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0490_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -2230,11 +2098,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0498_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -2253,11 +2119,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_04a0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 30 * CYCLE_UNIT / 2;
@@ -2274,11 +2138,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_04a8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (8);
 return 32 * CYCLE_UNIT / 2;
@@ -2297,11 +2159,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_04b0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}return 32 * CYCLE_UNIT / 2;
 }
@@ -2316,11 +2176,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_04b8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (8);
 return 32 * CYCLE_UNIT / 2;
@@ -2336,11 +2194,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_04b9_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (10);
 return 36 * CYCLE_UNIT / 2;
@@ -2492,11 +2348,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0600_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -2513,11 +2367,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0610_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
@@ -2535,11 +2387,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0618_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
@@ -2558,11 +2408,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0620_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 22 * CYCLE_UNIT / 2;
@@ -2579,11 +2427,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0628_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
@@ -2602,11 +2448,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0630_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -2621,11 +2465,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0638_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
@@ -2641,11 +2483,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0639_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (8);
 return 28 * CYCLE_UNIT / 2;
@@ -2661,11 +2501,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0640_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
@@ -2682,11 +2520,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0650_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -2704,11 +2540,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0658_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -2727,11 +2561,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0660_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
@@ -2748,11 +2580,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0668_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -2771,11 +2601,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0670_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}return 20 * CYCLE_UNIT / 2;
 }
@@ -2790,11 +2618,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0678_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -2810,11 +2636,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0679_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (8);
 return 24 * CYCLE_UNIT / 2;
@@ -2830,11 +2654,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0680_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
@@ -2851,11 +2673,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0690_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -2873,11 +2693,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0698_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -2896,11 +2714,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_06a0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 30 * CYCLE_UNIT / 2;
@@ -2917,11 +2733,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_06a8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (8);
 return 32 * CYCLE_UNIT / 2;
@@ -2940,11 +2754,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_06b0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}return 32 * CYCLE_UNIT / 2;
 }
@@ -2959,11 +2771,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_06b8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (8);
 return 32 * CYCLE_UNIT / 2;
@@ -2979,11 +2789,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_06b9_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (10);
 return 36 * CYCLE_UNIT / 2;
@@ -3702,9 +3510,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a00_20)(uae_u32 opcode)
 {{	uae_s8 src = x_get_ibyte (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -3718,9 +3524,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a10_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
@@ -3735,9 +3539,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a18_20)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (4);
 return 20 * CYCLE_UNIT / 2;
@@ -3753,9 +3555,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a20_20)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (4);
 return 22 * CYCLE_UNIT / 2;
@@ -3769,9 +3569,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a28_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
@@ -3787,9 +3585,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a30_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -3801,9 +3597,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a38_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (6);
 return 24 * CYCLE_UNIT / 2;
@@ -3816,9 +3610,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a39_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (8);
 return 28 * CYCLE_UNIT / 2;
@@ -3843,9 +3635,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a40_20)(uae_u32 opcode)
 {{	uae_s16 src = get_word_020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
@@ -3859,9 +3649,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a50_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -3876,9 +3664,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a58_20)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -3894,9 +3680,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a60_20)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
@@ -3910,9 +3694,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a68_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -3928,9 +3710,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a70_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
 }
@@ -3942,9 +3722,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a78_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -3957,9 +3735,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a79_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (8);
 return 24 * CYCLE_UNIT / 2;
@@ -3985,9 +3761,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a80_20)(uae_u32 opcode)
 {{	uae_s32 src = get_long_020_prefetch (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
@@ -4004,9 +3778,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a90_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -4021,9 +3793,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a98_20)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -4039,9 +3809,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0aa0_20)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (6);
 return 30 * CYCLE_UNIT / 2;
@@ -4055,9 +3823,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0aa8_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (8);
 return 32 * CYCLE_UNIT / 2;
@@ -4073,9 +3839,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ab0_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 32 * CYCLE_UNIT / 2;
 }
@@ -4087,9 +3851,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ab8_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (8);
 return 32 * CYCLE_UNIT / 2;
@@ -4102,9 +3864,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ab9_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (10);
 return 36 * CYCLE_UNIT / 2;
@@ -4124,10 +3884,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ad0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4150,10 +3908,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ad8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4177,10 +3933,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ae0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4202,10 +3956,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ae8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4229,10 +3981,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0af0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
 }}}}}}}}}return 20 * CYCLE_UNIT / 2;
@@ -4252,10 +4002,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0af8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4276,10 +4024,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0af9_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (8);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4297,10 +4043,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c00_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -4316,10 +4060,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c10_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -4336,10 +4078,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c18_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -4357,10 +4097,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c20_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 18 * CYCLE_UNIT / 2;
 }
@@ -4376,10 +4114,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c28_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -4397,10 +4133,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c30_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 20 * CYCLE_UNIT / 2;
 }
 
@@ -4414,10 +4148,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c38_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -4432,10 +4164,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c39_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (8);
 return 24 * CYCLE_UNIT / 2;
 }
@@ -4453,10 +4183,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c3a_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -4478,10 +4206,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c3b_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 20 * CYCLE_UNIT / 2;
 }
 
@@ -4496,10 +4222,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c40_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -4515,10 +4239,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c50_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -4535,10 +4257,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c58_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -4556,10 +4276,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c60_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 14 * CYCLE_UNIT / 2;
 }
@@ -4575,10 +4293,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c68_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -4596,10 +4312,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c70_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
 
@@ -4613,10 +4327,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c78_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -4631,10 +4343,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c79_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (8);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -4652,10 +4362,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c7a_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -4677,10 +4385,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c7b_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
 
@@ -4695,10 +4401,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c80_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -4714,10 +4418,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c90_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -4734,10 +4436,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c98_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -4755,10 +4455,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ca0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 22 * CYCLE_UNIT / 2;
 }
@@ -4774,10 +4472,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ca8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (8);
 return 24 * CYCLE_UNIT / 2;
 }
@@ -4795,10 +4491,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cb0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 24 * CYCLE_UNIT / 2;
 }
 
@@ -4812,10 +4506,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cb8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (8);
 return 24 * CYCLE_UNIT / 2;
 }
@@ -4830,10 +4522,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cb9_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (10);
 return 28 * CYCLE_UNIT / 2;
 }
@@ -4851,10 +4541,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cba_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (8);
 return 24 * CYCLE_UNIT / 2;
 }
@@ -4876,10 +4564,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cbb_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 24 * CYCLE_UNIT / 2;
 }
 
@@ -4898,10 +4584,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cd0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -4924,10 +4608,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cd8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -4951,10 +4633,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ce0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -4976,10 +4656,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ce8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -5003,10 +4681,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cf0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
 }}}}}}}}}return 20 * CYCLE_UNIT / 2;
@@ -5026,10 +4702,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cf8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -5050,10 +4724,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cf9_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (8);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -5073,19 +4745,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cfc_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, (extra >> 16) & 7))) < 0;
 	int flgo = ((uae_s16)(dst1)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, (extra >> 16) & 7))) > ((uae_u16)(dst1)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, (extra >> 16) & 7))) > ((uae_u16)(dst1))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()) {
 {uae_u32 newv = ((uae_s16)(dst2)) - ((uae_s16)(m68k_dreg (regs, extra & 7)));
 {	int flgs = ((uae_s16)(m68k_dreg (regs, extra & 7))) < 0;
 	int flgo = ((uae_s16)(dst2)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, extra & 7))) > ((uae_u16)(dst2)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, extra & 7))) > ((uae_u16)(dst2))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()) {
 	x_put_word (rn1, m68k_dreg (regs, (extra >> 22) & 7));
 	x_put_word (rn2, m68k_dreg (regs, (extra >> 6) & 7));
@@ -5638,10 +5306,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ed0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -5664,10 +5330,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ed8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -5691,10 +5355,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ee0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -5716,10 +5378,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ee8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -5743,10 +5403,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ef0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
 }}}}}}}}}return 28 * CYCLE_UNIT / 2;
@@ -5766,10 +5424,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ef8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -5790,10 +5446,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ef9_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (8);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -5813,19 +5467,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0efc_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, (extra >> 16) & 7))) < 0;
 	int flgo = ((uae_s32)(dst1)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, (extra >> 16) & 7))) > ((uae_u32)(dst1)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, (extra >> 16) & 7))) > ((uae_u32)(dst1))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()) {
 {uae_u32 newv = ((uae_s32)(dst2)) - ((uae_s32)(m68k_dreg (regs, extra & 7)));
 {	int flgs = ((uae_s32)(m68k_dreg (regs, extra & 7))) < 0;
 	int flgo = ((uae_s32)(dst2)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, extra & 7))) > ((uae_u32)(dst2)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, extra & 7))) > ((uae_u32)(dst2))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()) {
 	x_put_long (rn1, m68k_dreg (regs, (extra >> 22) & 7));
 	x_put_long (rn2, m68k_dreg (regs, (extra >> 6) & 7));
@@ -5845,9 +5495,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1000_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 }}}return 4 * CYCLE_UNIT / 2;
@@ -5860,9 +5508,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1010_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 }}}}return 8 * CYCLE_UNIT / 2;
@@ -5876,9 +5522,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1018_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 }}}}return 8 * CYCLE_UNIT / 2;
@@ -5893,9 +5537,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1020_20)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 }}}}return 10 * CYCLE_UNIT / 2;
@@ -5908,9 +5550,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1028_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -5925,9 +5565,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1030_20)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -5938,9 +5576,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1038_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -5952,9 +5588,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1039_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (6);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -5967,9 +5601,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_103a_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -5985,9 +5617,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_103b_20)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -5997,9 +5627,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_103c_20)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = x_get_ibyte (2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -6012,9 +5640,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1080_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}return 8 * CYCLE_UNIT / 2;
@@ -6028,9 +5654,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1090_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -6045,9 +5669,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1098_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -6063,9 +5685,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10a0_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}return 14 * CYCLE_UNIT / 2;
@@ -6079,9 +5699,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10a8_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -6097,9 +5715,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10b0_20)(uae_u32 opcode)
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -6111,9 +5727,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10b8_20)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -6126,9 +5740,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10b9_20)(uae_u32 opcode)
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -6142,9 +5754,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10ba_20)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -6161,9 +5771,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10bb_20)(uae_u32 opcode)
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -6174,9 +5782,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10bc_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = x_get_ibyte (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}return 16 * CYCLE_UNIT / 2;
@@ -6190,9 +5796,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10c0_20)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}return 8 * CYCLE_UNIT / 2;
@@ -6207,9 +5811,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10d0_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -6225,9 +5827,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10d8_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -6244,9 +5844,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10e0_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}return 14 * CYCLE_UNIT / 2;
@@ -6261,9 +5859,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10e8_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -6280,9 +5876,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10f0_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -6295,9 +5889,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10f8_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -6311,9 +5903,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10f9_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -6328,9 +5918,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10fa_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -6348,9 +5936,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10fb_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -6362,9 +5948,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10fc_20)(uae_u32 opcode)
 {{	uae_s8 src = x_get_ibyte (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}return 16 * CYCLE_UNIT / 2;
@@ -6379,9 +5963,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1100_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}return 8 * CYCLE_UNIT / 2;
@@ -6397,9 +5979,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1110_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -6416,9 +5996,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1118_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -6436,9 +6014,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1120_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}return 14 * CYCLE_UNIT / 2;
@@ -6454,9 +6030,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1128_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -6474,9 +6048,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1130_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -6490,9 +6062,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1138_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -6507,9 +6077,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1139_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -6525,9 +6093,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_113a_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -6546,9 +6112,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_113b_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -6561,9 +6125,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_113c_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}return 16 * CYCLE_UNIT / 2;
@@ -6576,9 +6138,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1140_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -6592,9 +6152,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1150_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -6609,9 +6167,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1158_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -6627,9 +6183,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1160_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}return 18 * CYCLE_UNIT / 2;
@@ -6643,9 +6197,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1168_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -6661,9 +6213,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1170_20)(uae_u32 opcode)
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -6676,9 +6226,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1178_20)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -6691,9 +6239,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1179_20)(uae_u32 opcode)
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -6707,9 +6253,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_117a_20)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -6726,9 +6270,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_117b_20)(uae_u32 opcode)
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -6740,9 +6282,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_117c_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = x_get_ibyte (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}return 20 * CYCLE_UNIT / 2;
@@ -6757,9 +6297,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1180_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -6774,9 +6312,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1190_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -6792,9 +6328,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1198_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -6811,9 +6345,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11a0_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 18 * CYCLE_UNIT / 2;
 }
@@ -6828,9 +6360,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11a8_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
 }
@@ -6846,9 +6376,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11b0_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta;
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}}return 20 * CYCLE_UNIT / 2;
 }
@@ -6862,9 +6390,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11b8_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
 }
@@ -6878,9 +6404,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11b9_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (6);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -6895,9 +6419,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11ba_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
 }
@@ -6914,9 +6436,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11bb_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta;
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}}return 20 * CYCLE_UNIT / 2;
 }
@@ -6929,9 +6449,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11bc_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}return 20 * CYCLE_UNIT / 2;
 }
@@ -6942,9 +6460,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11c0_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -6957,9 +6473,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11d0_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -6973,9 +6487,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11d8_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -6990,9 +6502,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11e0_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}return 18 * CYCLE_UNIT / 2;
@@ -7005,9 +6515,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11e8_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -7022,9 +6530,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11f0_20)(uae_u32 opcode)
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -7036,9 +6542,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11f8_20)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -7050,9 +6554,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11f9_20)(uae_u32 opcode)
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -7065,9 +6567,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11fa_20)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -7083,9 +6583,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11fb_20)(uae_u32 opcode)
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -7096,9 +6594,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11fc_20)(uae_u32 opcode)
 {
 {{	uae_s8 src = x_get_ibyte (2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}return 20 * CYCLE_UNIT / 2;
@@ -7110,9 +6606,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13c0_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}return 16 * CYCLE_UNIT / 2;
@@ -7125,9 +6619,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13d0_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -7141,9 +6633,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13d8_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -7158,9 +6648,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13e0_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}return 22 * CYCLE_UNIT / 2;
@@ -7173,9 +6661,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13e8_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -7190,9 +6676,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13f0_20)(uae_u32 opcode)
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -7204,9 +6688,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13f8_20)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -7218,9 +6700,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13f9_20)(uae_u32 opcode)
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (10);
 }}}}return 28 * CYCLE_UNIT / 2;
@@ -7233,9 +6713,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13fa_20)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -7251,9 +6729,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13fb_20)(uae_u32 opcode)
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -7264,9 +6740,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13fc_20)(uae_u32 opcode)
 {
 {{	uae_s8 src = x_get_ibyte (2);
 {	uaecptr dsta = get_long_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}return 24 * CYCLE_UNIT / 2;
@@ -7278,9 +6752,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2000_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}return 4 * CYCLE_UNIT / 2;
@@ -7292,9 +6764,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2008_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}return 4 * CYCLE_UNIT / 2;
@@ -7307,9 +6777,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2010_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -7323,9 +6791,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2018_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -7340,9 +6806,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2020_20)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - 4;
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}}return 14 * CYCLE_UNIT / 2;
@@ -7355,9 +6819,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2028_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -7372,9 +6834,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2030_20)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -7385,9 +6845,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2038_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -7399,9 +6857,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2039_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -7414,9 +6870,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_203a_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -7432,9 +6886,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_203b_20)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -7444,9 +6896,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_203c_20)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_long_020_prefetch (2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (6);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -7603,9 +7053,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2080_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -7618,9 +7066,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2088_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -7634,9 +7080,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2090_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -7651,9 +7095,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2098_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -7669,9 +7111,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20a0_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}return 22 * CYCLE_UNIT / 2;
@@ -7685,9 +7125,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20a8_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -7703,9 +7141,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20b0_20)(uae_u32 opcode)
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -7717,9 +7153,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20b8_20)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -7732,9 +7166,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20b9_20)(uae_u32 opcode)
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}return 28 * CYCLE_UNIT / 2;
@@ -7748,9 +7180,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20ba_20)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -7767,9 +7197,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20bb_20)(uae_u32 opcode)
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -7780,9 +7208,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20bc_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_long_020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}return 20 * CYCLE_UNIT / 2;
@@ -7796,9 +7222,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20c0_20)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -7812,9 +7236,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20c8_20)(uae_u32 opcode)
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -7829,9 +7251,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20d0_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -7847,9 +7267,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20d8_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -7866,9 +7284,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20e0_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}return 22 * CYCLE_UNIT / 2;
@@ -7883,9 +7299,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20e8_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -7902,9 +7316,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20f0_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -7917,9 +7329,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20f8_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -7933,9 +7343,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20f9_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}return 28 * CYCLE_UNIT / 2;
@@ -7950,9 +7358,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20fa_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -7970,9 +7376,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20fb_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -7984,9 +7388,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20fc_20)(uae_u32 opcode)
 {{	uae_s32 src = get_long_020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}return 20 * CYCLE_UNIT / 2;
@@ -8001,9 +7403,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2100_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -8018,9 +7418,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2108_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -8036,9 +7434,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2110_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -8055,9 +7451,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2118_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -8075,9 +7469,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2120_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}return 22 * CYCLE_UNIT / 2;
@@ -8093,9 +7485,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2128_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -8113,9 +7503,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2130_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -8129,9 +7517,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2138_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -8146,9 +7532,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2139_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}return 28 * CYCLE_UNIT / 2;
@@ -8164,9 +7548,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_213a_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -8185,9 +7567,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_213b_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -8200,9 +7580,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_213c_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}return 20 * CYCLE_UNIT / 2;
@@ -8215,9 +7593,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2140_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}return 16 * CYCLE_UNIT / 2;
@@ -8230,9 +7606,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2148_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}return 16 * CYCLE_UNIT / 2;
@@ -8246,9 +7620,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2150_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -8263,9 +7635,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2158_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -8281,9 +7651,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2160_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}return 26 * CYCLE_UNIT / 2;
@@ -8297,9 +7665,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2168_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}return 28 * CYCLE_UNIT / 2;
@@ -8318,9 +7684,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2170_20)(uae_u32 opcode)
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}}return 28 * CYCLE_UNIT / 2;
@@ -8333,9 +7697,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2178_20)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}return 28 * CYCLE_UNIT / 2;
@@ -8348,9 +7710,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2179_20)(uae_u32 opcode)
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}}return 32 * CYCLE_UNIT / 2;
@@ -8364,9 +7724,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_217a_20)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}return 28 * CYCLE_UNIT / 2;
@@ -8383,9 +7741,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_217b_20)(uae_u32 opcode)
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}}return 28 * CYCLE_UNIT / 2;
@@ -8397,9 +7753,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_217c_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_long_020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}return 24 * CYCLE_UNIT / 2;
@@ -8414,9 +7768,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2180_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -8430,9 +7782,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2188_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -8447,9 +7797,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2190_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -8465,9 +7813,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2198_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -8484,9 +7830,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21a0_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 26 * CYCLE_UNIT / 2;
 }
@@ -8501,9 +7845,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21a8_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 28 * CYCLE_UNIT / 2;
 }
@@ -8519,9 +7861,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21b0_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta;
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}}return 28 * CYCLE_UNIT / 2;
 }
@@ -8535,9 +7875,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21b8_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 28 * CYCLE_UNIT / 2;
 }
@@ -8551,9 +7889,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21b9_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (6);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 32 * CYCLE_UNIT / 2;
 }
@@ -8568,9 +7904,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21ba_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 28 * CYCLE_UNIT / 2;
 }
@@ -8587,9 +7921,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21bb_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta;
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}}return 28 * CYCLE_UNIT / 2;
 }
@@ -8602,9 +7934,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21bc_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (6);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -8615,9 +7945,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21c0_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}return 16 * CYCLE_UNIT / 2;
@@ -8629,9 +7957,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21c8_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}return 16 * CYCLE_UNIT / 2;
@@ -8644,9 +7970,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21d0_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -8660,9 +7984,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21d8_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -8677,9 +7999,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21e0_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}return 26 * CYCLE_UNIT / 2;
@@ -8692,9 +8012,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21e8_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}return 28 * CYCLE_UNIT / 2;
@@ -8709,9 +8027,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21f0_20)(uae_u32 opcode)
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}}return 28 * CYCLE_UNIT / 2;
@@ -8723,9 +8039,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21f8_20)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}return 28 * CYCLE_UNIT / 2;
@@ -8737,9 +8051,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21f9_20)(uae_u32 opcode)
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}}return 32 * CYCLE_UNIT / 2;
@@ -8752,9 +8064,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21fa_20)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}return 28 * CYCLE_UNIT / 2;
@@ -8770,9 +8080,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21fb_20)(uae_u32 opcode)
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}}return 28 * CYCLE_UNIT / 2;
@@ -8783,9 +8091,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21fc_20)(uae_u32 opcode)
 {
 {{	uae_s32 src = get_long_020_prefetch (2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}return 24 * CYCLE_UNIT / 2;
@@ -8797,9 +8103,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23c0_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}return 20 * CYCLE_UNIT / 2;
@@ -8811,9 +8115,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23c8_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}return 20 * CYCLE_UNIT / 2;
@@ -8826,9 +8128,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23d0_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}return 28 * CYCLE_UNIT / 2;
@@ -8842,9 +8142,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23d8_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}return 28 * CYCLE_UNIT / 2;
@@ -8859,9 +8157,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23e0_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}return 30 * CYCLE_UNIT / 2;
@@ -8874,9 +8170,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23e8_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}}return 32 * CYCLE_UNIT / 2;
@@ -8891,9 +8185,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23f0_20)(uae_u32 opcode)
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}}return 32 * CYCLE_UNIT / 2;
@@ -8905,9 +8197,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23f8_20)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}}return 32 * CYCLE_UNIT / 2;
@@ -8919,9 +8209,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23f9_20)(uae_u32 opcode)
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (10);
 }}}}return 36 * CYCLE_UNIT / 2;
@@ -8934,9 +8222,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23fa_20)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}}return 32 * CYCLE_UNIT / 2;
@@ -8952,9 +8238,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23fb_20)(uae_u32 opcode)
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}}return 32 * CYCLE_UNIT / 2;
@@ -8965,9 +8249,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23fc_20)(uae_u32 opcode)
 {
 {{	uae_s32 src = get_long_020_prefetch (2);
 {	uaecptr dsta = get_long_020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (10);
 }}}return 28 * CYCLE_UNIT / 2;
@@ -8979,9 +8261,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3000_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 }}}return 4 * CYCLE_UNIT / 2;
@@ -8993,9 +8273,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3008_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 }}}return 4 * CYCLE_UNIT / 2;
@@ -9008,9 +8286,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3010_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 }}}}return 8 * CYCLE_UNIT / 2;
@@ -9024,9 +8300,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3018_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 }}}}return 8 * CYCLE_UNIT / 2;
@@ -9041,9 +8315,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3020_20)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - 2;
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 }}}}return 10 * CYCLE_UNIT / 2;
@@ -9056,9 +8328,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3028_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -9073,9 +8343,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3030_20)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -9086,9 +8354,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3038_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -9100,9 +8366,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3039_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (6);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -9115,9 +8379,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_303a_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -9133,9 +8395,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_303b_20)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -9145,9 +8405,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_303c_20)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_word_020_prefetch (2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 }}}return 8 * CYCLE_UNIT / 2;
@@ -9316,9 +8574,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3080_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}return 8 * CYCLE_UNIT / 2;
@@ -9331,9 +8587,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3088_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}return 8 * CYCLE_UNIT / 2;
@@ -9347,9 +8601,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3090_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -9364,9 +8616,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3098_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -9382,9 +8632,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30a0_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}return 14 * CYCLE_UNIT / 2;
@@ -9398,9 +8646,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30a8_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -9416,9 +8662,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30b0_20)(uae_u32 opcode)
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -9430,9 +8674,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30b8_20)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -9445,9 +8687,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30b9_20)(uae_u32 opcode)
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -9461,9 +8701,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30ba_20)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -9480,9 +8718,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30bb_20)(uae_u32 opcode)
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -9493,9 +8729,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30bc_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_word_020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -9509,9 +8743,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30c0_20)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}return 8 * CYCLE_UNIT / 2;
@@ -9525,9 +8757,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30c8_20)(uae_u32 opcode)
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}return 8 * CYCLE_UNIT / 2;
@@ -9542,9 +8772,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30d0_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -9560,9 +8788,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30d8_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -9579,9 +8805,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30e0_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}return 14 * CYCLE_UNIT / 2;
@@ -9596,9 +8820,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30e8_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -9615,9 +8837,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30f0_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -9630,9 +8850,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30f8_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -9646,9 +8864,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30f9_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -9663,9 +8879,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30fa_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -9683,9 +8897,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30fb_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -9697,9 +8909,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30fc_20)(uae_u32 opcode)
 {{	uae_s16 src = get_word_020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -9714,9 +8924,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3100_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}return 8 * CYCLE_UNIT / 2;
@@ -9731,9 +8939,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3108_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}return 8 * CYCLE_UNIT / 2;
@@ -9749,9 +8955,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3110_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -9768,9 +8972,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3118_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -9788,9 +8990,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3120_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}return 14 * CYCLE_UNIT / 2;
@@ -9806,9 +9006,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3128_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -9826,9 +9024,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3130_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -9842,9 +9038,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3138_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -9859,9 +9053,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3139_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -9877,9 +9069,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_313a_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -9898,9 +9088,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_313b_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -9913,9 +9101,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_313c_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -9928,9 +9114,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3140_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -9943,9 +9127,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3148_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -9959,9 +9141,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3150_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -9976,9 +9156,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3158_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -9994,9 +9172,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3160_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}return 18 * CYCLE_UNIT / 2;
@@ -10010,9 +9186,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3168_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -10028,9 +9202,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3170_20)(uae_u32 opcode)
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -10043,9 +9215,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3178_20)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -10058,9 +9228,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3179_20)(uae_u32 opcode)
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -10074,9 +9242,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_317a_20)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -10093,9 +9259,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_317b_20)(uae_u32 opcode)
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -10107,9 +9271,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_317c_20)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_word_020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}return 16 * CYCLE_UNIT / 2;
@@ -10124,9 +9286,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3180_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -10140,9 +9300,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3188_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -10157,9 +9315,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3190_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -10175,9 +9331,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3198_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -10194,9 +9348,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31a0_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 18 * CYCLE_UNIT / 2;
 }
@@ -10211,9 +9363,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31a8_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
 }
@@ -10229,9 +9379,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31b0_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta;
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}}return 20 * CYCLE_UNIT / 2;
 }
@@ -10245,9 +9393,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31b8_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
 }
@@ -10261,9 +9407,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31b9_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (6);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -10278,9 +9422,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31ba_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
 }
@@ -10297,9 +9439,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31bb_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta;
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}}return 20 * CYCLE_UNIT / 2;
 }
@@ -10312,9 +9452,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31bc_20)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -10325,9 +9463,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31c0_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -10339,9 +9475,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31c8_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -10354,9 +9488,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31d0_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -10370,9 +9502,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31d8_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -10387,9 +9517,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31e0_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}return 18 * CYCLE_UNIT / 2;
@@ -10402,9 +9530,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31e8_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -10419,9 +9545,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31f0_20)(uae_u32 opcode)
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -10433,9 +9557,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31f8_20)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -10447,9 +9569,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31f9_20)(uae_u32 opcode)
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -10462,9 +9582,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31fa_20)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -10480,9 +9598,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31fb_20)(uae_u32 opcode)
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -10493,9 +9609,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31fc_20)(uae_u32 opcode)
 {
 {{	uae_s16 src = get_word_020_prefetch (2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}return 16 * CYCLE_UNIT / 2;
@@ -10507,9 +9621,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33c0_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}return 16 * CYCLE_UNIT / 2;
@@ -10521,9 +9633,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33c8_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}return 16 * CYCLE_UNIT / 2;
@@ -10536,9 +9646,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33d0_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -10552,9 +9660,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33d8_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -10569,9 +9675,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33e0_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}return 22 * CYCLE_UNIT / 2;
@@ -10584,9 +9688,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33e8_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -10601,9 +9703,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33f0_20)(uae_u32 opcode)
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -10615,9 +9715,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33f8_20)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -10629,9 +9727,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33f9_20)(uae_u32 opcode)
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (10);
 }}}}return 28 * CYCLE_UNIT / 2;
@@ -10644,9 +9740,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33fa_20)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -10662,9 +9756,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33fb_20)(uae_u32 opcode)
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -10675,9 +9767,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33fc_20)(uae_u32 opcode)
 {
 {{	uae_s16 src = get_word_020_prefetch (2);
 {	uaecptr dsta = get_long_020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}return 20 * CYCLE_UNIT / 2;
@@ -11883,9 +10973,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_41fb_20)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_4200_20)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+{{	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((0) & 0xff);
 }}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -11896,9 +10984,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4210_20)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -11910,9 +10996,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4218_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -11925,9 +11009,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4220_20)(uae_u32 opcode)
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
@@ -11938,9 +11020,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4228_20)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -11953,9 +11033,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4230_20)(uae_u32 opcode)
 {{	uaecptr srca;
 	m68k_incpc (2);
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}}return 12 * CYCLE_UNIT / 2;
 }
@@ -11964,9 +11042,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4230_20)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_4238_20)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -11976,9 +11052,7 @@ return 12 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4239_20)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
@@ -11988,9 +11062,7 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4240_20)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+{{	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((0) & 0xffff);
 }}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -12001,9 +11073,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4250_20)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -12015,9 +11085,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4258_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -12030,9 +11098,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4260_20)(uae_u32 opcode)
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - 2;
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
@@ -12043,9 +11109,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4268_20)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -12058,9 +11122,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4270_20)(uae_u32 opcode)
 {{	uaecptr srca;
 	m68k_incpc (2);
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}}return 12 * CYCLE_UNIT / 2;
 }
@@ -12069,9 +11131,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4270_20)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_4278_20)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -12081,9 +11141,7 @@ return 12 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4279_20)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
@@ -12093,9 +11151,7 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_4280_20)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+{{	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (0);
 }}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -12106,9 +11162,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4290_20)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -12120,9 +11174,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4298_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -12135,9 +11187,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_42a0_20)(uae_u32 opcode)
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - 4;
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -12148,9 +11198,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_42a8_20)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -12163,9 +11211,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_42b0_20)(uae_u32 opcode)
 {{	uaecptr srca;
 	m68k_incpc (2);
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}}return 16 * CYCLE_UNIT / 2;
 }
@@ -12174,9 +11220,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_42b0_20)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_42b8_20)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -12186,9 +11230,7 @@ return 16 * CYCLE_UNIT / 2;
 uae_u32 REGPARAM2 CPUFUNC(op_42b9_20)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -12311,11 +11353,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4400_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -12331,11 +11371,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4410_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -12352,11 +11390,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4418_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -12374,11 +11410,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4420_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -12394,11 +11428,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4428_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -12416,11 +11448,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4430_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -12434,11 +11464,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4438_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -12453,11 +11481,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4439_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -12472,11 +11498,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4440_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -12492,11 +11516,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4450_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -12513,11 +11535,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4458_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -12535,11 +11555,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4460_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -12555,11 +11573,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4468_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -12577,11 +11593,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4470_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -12595,11 +11609,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4478_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -12614,11 +11626,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4479_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -12633,11 +11643,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4480_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (dst);
 }}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -12653,11 +11661,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4490_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -12674,11 +11680,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4498_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -12696,11 +11700,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_44a0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	m68k_incpc (2);
 return 22 * CYCLE_UNIT / 2;
@@ -12716,11 +11718,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_44a8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -12738,11 +11738,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_44b0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -12756,11 +11754,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_44b8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -12775,11 +11771,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_44b9_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -12946,9 +11940,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4600_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -12961,9 +11953,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4610_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -12977,9 +11967,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4618_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -12994,9 +11982,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4620_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -13009,9 +11995,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4628_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -13026,9 +12010,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4630_20)(uae_u32 opcode)
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s8 src = x_get_byte (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -13039,9 +12021,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4638_20)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -13053,9 +12033,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4639_20)(uae_u32 opcode)
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -13067,9 +12045,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4640_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -13082,9 +12058,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4650_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -13098,9 +12072,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4658_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -13115,9 +12087,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4660_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -13130,9 +12100,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4668_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -13147,9 +12115,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4670_20)(uae_u32 opcode)
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s16 src = x_get_word (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -13160,9 +12126,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4678_20)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -13174,9 +12138,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4679_20)(uae_u32 opcode)
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -13188,9 +12150,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4680_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -13203,9 +12163,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4690_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -13219,9 +12177,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4698_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -13236,9 +12192,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46a0_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	m68k_incpc (2);
 return 22 * CYCLE_UNIT / 2;
@@ -13251,9 +12205,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46a8_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -13268,9 +12220,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46b0_20)(uae_u32 opcode)
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s32 src = x_get_long (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -13281,9 +12231,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46b8_20)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -13295,9 +12243,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46b9_20)(uae_u32 opcode)
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -13659,9 +12605,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4840_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -13776,9 +12720,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4880_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u16 dst = (uae_s16)(uae_s8)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -13875,9 +12817,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_48c0_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -13975,9 +12915,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_49c0_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s8)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -13989,9 +12927,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a00_20)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -14002,9 +12938,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a10_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -14016,9 +12950,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a18_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -14031,9 +12963,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a20_20)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
 }
@@ -14044,9 +12974,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a28_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14059,9 +12987,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a30_20)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -14070,9 +12996,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a38_20)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14082,9 +13006,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a39_20)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -14096,9 +13018,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a3a_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14114,9 +13034,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a3b_20)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -14125,9 +13043,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a3b_20)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_4a3c_20)(uae_u32 opcode)
 {
 {{	uae_s8 src = x_get_ibyte (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14137,9 +13053,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a40_20)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -14150,9 +13064,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a48_20)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -14164,9 +13076,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a50_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -14178,9 +13088,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a58_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -14193,9 +13101,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a60_20)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - 2;
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
 }
@@ -14206,9 +13112,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a68_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14221,9 +13125,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a70_20)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -14232,9 +13134,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a78_20)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14244,9 +13144,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a79_20)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -14258,9 +13156,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a7a_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14276,9 +13172,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a7b_20)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -14287,9 +13181,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a7b_20)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_4a7c_20)(uae_u32 opcode)
 {
 {{	uae_s16 src = get_word_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -14299,9 +13191,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a80_20)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -14312,9 +13202,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a88_20)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -14326,9 +13214,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a90_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14340,9 +13226,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a98_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14355,9 +13239,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4aa0_20)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - 4;
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 }
@@ -14368,9 +13250,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4aa8_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -14383,9 +13263,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ab0_20)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}return 16 * CYCLE_UNIT / 2;
 }
 
@@ -14394,9 +13272,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ab8_20)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -14406,9 +13282,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ab9_20)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -14420,9 +13294,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4aba_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -14438,9 +13310,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4abb_20)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = get_disp_ea_020 (tmppc, next_iword_020 ());
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}return 16 * CYCLE_UNIT / 2;
 }
 
@@ -14449,9 +13319,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4abb_20)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_4abc_20)(uae_u32 opcode)
 {
 {{	uae_s32 src = get_long_020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14461,9 +13329,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ac0_20)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((src) & 0xff);
 }}	m68k_incpc (2);
@@ -14476,9 +13342,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ad0_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	m68k_incpc (2);
@@ -14492,9 +13356,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ad8_20)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	m68k_incpc (2);
@@ -14509,9 +13371,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ae0_20)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	m68k_incpc (2);
@@ -14524,9 +13384,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ae8_20)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	m68k_incpc (4);
@@ -14541,9 +13399,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4af0_20)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_020 ());
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -14554,9 +13410,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4af8_20)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	m68k_incpc (4);
@@ -14568,9 +13422,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4af9_20)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	m68k_incpc (6);
@@ -15568,11 +14420,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5000_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -15590,11 +14440,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5010_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -15613,11 +14461,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5018_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -15637,11 +14483,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5020_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -15659,11 +14503,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5028_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -15683,11 +14525,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5030_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -15703,11 +14543,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5038_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -15724,11 +14562,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5039_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -15745,11 +14581,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5040_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -15780,11 +14614,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5050_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -15803,11 +14635,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5058_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -15827,11 +14657,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5060_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -15849,11 +14677,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5068_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -15873,11 +14699,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5070_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -15896,11 +14720,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5078_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -15917,11 +14739,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5079_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -15938,11 +14758,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5080_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -15973,11 +14791,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5090_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -15996,11 +14812,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5098_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -16020,11 +14834,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_50a0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 22 * CYCLE_UNIT / 2;
@@ -16042,11 +14854,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_50a8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -16066,11 +14876,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_50b0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -16086,11 +14894,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_50b8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -16107,11 +14913,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_50b9_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -16276,11 +15080,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5100_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -16298,11 +15100,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5110_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -16321,11 +15121,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5118_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -16345,11 +15143,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5120_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -16367,11 +15163,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5128_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -16391,11 +15185,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5130_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -16411,11 +15203,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5138_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -16432,11 +15222,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5139_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -16453,11 +15241,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5140_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -16488,11 +15274,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5150_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -16511,11 +15295,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5158_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -16535,11 +15317,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5160_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -16557,11 +15337,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5168_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -16581,11 +15359,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5170_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -16601,11 +15377,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5178_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -16622,11 +15396,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5179_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -16643,11 +15415,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5180_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -16678,11 +15448,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5190_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -16701,11 +15469,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5198_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -16725,11 +15491,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_51a0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 22 * CYCLE_UNIT / 2;
@@ -16747,11 +15511,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_51a8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -16771,11 +15533,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_51b0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -16791,11 +15551,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_51b8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -16812,11 +15570,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_51b9_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -19877,9 +18633,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_7000_20)(uae_u32 opcode)
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_u32 src = srcreg;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}return 4 * CYCLE_UNIT / 2;
@@ -19893,9 +18647,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8000_20)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -19910,9 +18662,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8010_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -19928,9 +18678,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8018_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -19947,9 +18695,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8020_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
@@ -19964,9 +18710,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8028_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -19983,9 +18727,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8030_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -19998,9 +18740,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8038_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -20014,9 +18754,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8039_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
@@ -20031,9 +18769,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_803a_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -20051,9 +18787,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_803b_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -20065,9 +18799,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_803c_20)(uae_u32 opcode)
 {{	uae_s8 src = x_get_ibyte (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -20081,9 +18813,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8040_20)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -20098,9 +18828,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8050_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -20116,9 +18844,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8058_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -20135,9 +18861,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8060_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
@@ -20152,9 +18876,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8068_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -20171,9 +18893,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8070_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -20186,9 +18906,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8078_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -20202,9 +18920,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8079_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
@@ -20219,9 +18935,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_807a_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -20239,9 +18953,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_807b_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -20253,9 +18965,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_807c_20)(uae_u32 opcode)
 {{	uae_s16 src = get_word_020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
@@ -20269,9 +18979,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8080_20)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -20286,9 +18994,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8090_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -20304,9 +19010,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8098_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -20323,9 +19027,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80a0_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -20340,9 +19042,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80a8_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -20359,9 +19059,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80b0_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -20374,9 +19072,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80b8_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -20390,9 +19086,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80b9_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -20407,9 +19101,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80ba_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -20427,9 +19119,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80bb_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -20441,9 +19131,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80bc_20)(uae_u32 opcode)
 {{	uae_s32 src = get_long_020_prefetch (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
@@ -20470,9 +19158,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80c0_20)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -20504,9 +19190,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80d0_20)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -20539,9 +19223,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80d8_20)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -20575,9 +19257,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80e0_20)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -20609,9 +19289,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80e8_20)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -20645,9 +19323,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80f0_20)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -20677,9 +19353,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80f8_20)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -20710,9 +19384,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80f9_20)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -20744,9 +19416,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80fa_20)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -20781,9 +19451,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80fb_20)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -20812,9 +19480,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80fc_20)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -20887,9 +19553,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8110_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -20905,9 +19569,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8118_20)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -20924,9 +19586,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8120_20)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -20941,9 +19601,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8128_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -20960,9 +19618,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8130_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -20975,9 +19631,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8138_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -20991,9 +19645,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8139_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -21039,9 +19691,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8150_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -21057,9 +19707,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8158_20)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -21076,9 +19724,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8160_20)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -21093,9 +19739,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8168_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -21112,9 +19756,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8170_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -21127,9 +19769,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8178_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -21143,9 +19783,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8179_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -21192,9 +19830,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8190_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -21210,9 +19846,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8198_20)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -21229,9 +19863,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81a0_20)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (2);
 return 22 * CYCLE_UNIT / 2;
@@ -21246,9 +19878,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81a8_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -21265,9 +19895,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81b0_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -21280,9 +19908,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81b8_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -21296,9 +19922,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81b9_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -21326,9 +19950,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81c0_20)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21361,9 +19983,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81d0_20)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21397,9 +20017,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81d8_20)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21434,9 +20052,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81e0_20)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21469,9 +20085,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81e8_20)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21506,9 +20120,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81f0_20)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21539,9 +20151,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81f8_20)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21573,9 +20183,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81f9_20)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21608,9 +20216,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81fa_20)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21646,9 +20252,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81fb_20)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21678,9 +20282,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81fc_20)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21701,11 +20303,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9000_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -21723,11 +20323,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9010_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -21746,11 +20344,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9018_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -21770,11 +20366,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9020_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
@@ -21792,11 +20386,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9028_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -21816,11 +20408,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9030_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -21836,11 +20426,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9038_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -21857,11 +20445,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9039_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
@@ -21879,11 +20465,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_903a_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -21904,11 +20488,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_903b_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -21923,11 +20505,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_903c_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -21944,11 +20524,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9040_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -21965,11 +20543,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9048_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -21987,11 +20563,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9050_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -22010,11 +20584,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9058_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -22034,11 +20606,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9060_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
@@ -22056,11 +20626,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9068_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -22080,11 +20648,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9070_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -22100,11 +20666,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9078_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -22121,11 +20685,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9079_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
@@ -22143,11 +20705,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_907a_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -22168,11 +20728,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_907b_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -22187,11 +20745,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_907c_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
@@ -22208,11 +20764,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9080_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -22229,11 +20783,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9088_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -22251,11 +20803,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9090_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -22274,11 +20824,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9098_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -22298,11 +20846,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90a0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -22320,11 +20866,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90a8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -22344,11 +20888,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90b0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -22364,11 +20906,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90b8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -22385,11 +20925,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90b9_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -22407,11 +20945,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90ba_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -22432,11 +20968,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90bb_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -22451,11 +20985,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90bc_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
@@ -22689,11 +21221,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9110_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -22712,11 +21242,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9118_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -22736,11 +21264,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9120_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -22758,11 +21284,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9128_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -22782,11 +21306,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9130_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -22802,11 +21324,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9138_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -22823,11 +21343,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9139_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -22893,11 +21411,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9150_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -22916,11 +21432,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9158_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -22940,11 +21454,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9160_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -22962,11 +21474,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9168_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -22986,11 +21496,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9170_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -23006,11 +21514,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9178_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -23027,11 +21533,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9179_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -23097,11 +21601,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9190_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -23120,11 +21622,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9198_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -23144,11 +21644,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_91a0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 22 * CYCLE_UNIT / 2;
@@ -23166,11 +21664,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_91a8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -23190,11 +21686,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_91b0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -23210,11 +21704,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_91b8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -23231,11 +21723,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_91b9_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -23420,10 +21910,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b000_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -23440,10 +21928,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b010_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -23461,10 +21947,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b018_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -23483,10 +21967,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b020_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
 }
@@ -23503,10 +21985,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b028_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -23525,10 +22005,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b030_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -23543,10 +22021,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b038_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -23562,10 +22038,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b039_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -23582,10 +22056,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b03a_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -23605,10 +22077,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b03b_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -23622,10 +22092,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b03c_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -23641,10 +22109,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b040_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -23660,10 +22126,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b048_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -23680,10 +22144,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b050_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -23701,10 +22163,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b058_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -23723,10 +22183,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b060_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
 }
@@ -23743,10 +22201,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b068_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -23765,10 +22221,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b070_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -23783,10 +22237,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b078_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -23802,10 +22254,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b079_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -23822,10 +22272,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b07a_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -23845,10 +22293,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b07b_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -23862,10 +22308,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b07c_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -23881,10 +22325,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b080_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -23900,10 +22342,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b088_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -23923,10 +22363,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b090_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -23944,10 +22382,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b098_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -23966,10 +22402,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0a0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 }
@@ -23986,10 +22420,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0a8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -24008,10 +22440,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0b0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
 
@@ -24026,10 +22456,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0b8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -24045,10 +22473,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0b9_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -24065,10 +22491,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0ba_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -24088,10 +22512,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0bb_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
 
@@ -24105,10 +22527,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0bc_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24124,10 +22544,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0c0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -24143,10 +22561,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0c8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -24163,10 +22579,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0d0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -24184,10 +22598,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0d8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -24206,10 +22618,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0e0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
 }
@@ -24226,10 +22636,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0e8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24248,10 +22656,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0f0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -24266,10 +22672,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0f8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24285,10 +22689,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0f9_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -24305,10 +22707,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0fa_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24328,10 +22728,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0fb_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -24345,10 +22743,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0fc_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -24361,9 +22757,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b100_20)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -24384,10 +22778,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b108_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24401,9 +22793,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b110_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -24419,9 +22809,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b118_20)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -24438,9 +22826,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b120_20)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -24455,9 +22841,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b128_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -24474,9 +22858,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b130_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -24489,9 +22871,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b138_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -24505,9 +22885,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b139_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -24521,9 +22899,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b140_20)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -24544,10 +22920,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b148_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24561,9 +22935,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b150_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -24579,9 +22951,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b158_20)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -24598,9 +22968,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b160_20)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -24615,9 +22983,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b168_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -24634,9 +23000,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b170_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -24649,9 +23013,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b178_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -24665,9 +23027,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b179_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -24681,9 +23041,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b180_20)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -24704,10 +23062,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b188_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -24721,9 +23077,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b190_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -24739,9 +23093,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b198_20)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -24758,9 +23110,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1a0_20)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (2);
 return 22 * CYCLE_UNIT / 2;
@@ -24775,9 +23125,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1a8_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -24794,9 +23142,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1b0_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -24809,9 +23155,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1b8_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -24825,9 +23169,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1b9_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -24844,10 +23186,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1c0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -24863,10 +23203,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1c8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -24883,10 +23221,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1d0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24904,10 +23240,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1d8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24926,10 +23260,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1e0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
 }
@@ -24946,10 +23278,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1e8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -24968,10 +23298,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1f0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
 
@@ -24986,10 +23314,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1f8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -25005,10 +23331,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1f9_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -25025,10 +23349,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1fa_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -25048,10 +23370,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1fb_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
 
@@ -25065,10 +23385,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1fc_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -25081,9 +23399,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c000_20)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -25098,9 +23414,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c010_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -25116,9 +23430,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c018_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -25135,9 +23447,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c020_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
@@ -25152,9 +23462,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c028_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -25171,9 +23479,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c030_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -25186,9 +23492,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c038_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -25202,9 +23506,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c039_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
@@ -25219,9 +23521,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c03a_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -25239,9 +23539,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c03b_20)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -25253,9 +23551,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c03c_20)(uae_u32 opcode)
 {{	uae_s8 src = x_get_ibyte (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -25269,9 +23565,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c040_20)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -25286,9 +23580,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c050_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -25304,9 +23596,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c058_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -25323,9 +23613,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c060_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
@@ -25340,9 +23628,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c068_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -25359,9 +23645,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c070_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -25374,9 +23658,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c078_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -25390,9 +23672,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c079_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
@@ -25407,9 +23687,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c07a_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -25427,9 +23705,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c07b_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -25441,9 +23717,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c07c_20)(uae_u32 opcode)
 {{	uae_s16 src = get_word_020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
@@ -25457,9 +23731,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c080_20)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -25474,9 +23746,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c090_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -25492,9 +23762,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c098_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -25511,9 +23779,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0a0_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -25528,9 +23794,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0a8_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -25547,9 +23811,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0b0_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -25562,9 +23824,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0b8_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -25578,9 +23838,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0b9_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -25595,9 +23853,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0ba_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -25615,9 +23871,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0bb_20)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -25629,9 +23883,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0bc_20)(uae_u32 opcode)
 {{	uae_s32 src = get_long_020_prefetch (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
@@ -25645,9 +23897,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0c0_20)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (2);
 }}}}return 58 * CYCLE_UNIT / 2;
@@ -25662,9 +23912,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0d0_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (2);
 }}}}}return 62 * CYCLE_UNIT / 2;
@@ -25680,9 +23928,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0d8_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (2);
 }}}}}return 62 * CYCLE_UNIT / 2;
@@ -25699,9 +23945,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0e0_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (2);
 }}}}}return 64 * CYCLE_UNIT / 2;
@@ -25716,9 +23960,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0e8_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
 }}}}}return 66 * CYCLE_UNIT / 2;
@@ -25735,9 +23977,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0f0_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}return 66 * CYCLE_UNIT / 2;
 }
@@ -25750,9 +23990,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0f8_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
 }}}}}return 66 * CYCLE_UNIT / 2;
@@ -25766,9 +24004,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0f9_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (6);
 }}}}}return 70 * CYCLE_UNIT / 2;
@@ -25783,9 +24019,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0fa_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
 }}}}}return 66 * CYCLE_UNIT / 2;
@@ -25803,9 +24037,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0fb_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}return 66 * CYCLE_UNIT / 2;
 }
@@ -25817,9 +24049,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0fc_20)(uae_u32 opcode)
 {{	uae_s16 src = get_word_020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
 }}}}return 62 * CYCLE_UNIT / 2;
@@ -25888,9 +24118,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c110_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -25906,9 +24134,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c118_20)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -25925,9 +24151,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c120_20)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -25942,9 +24166,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c128_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -25961,9 +24183,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c130_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -25976,9 +24196,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c138_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -25992,9 +24210,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c139_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -26035,9 +24251,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c150_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -26053,9 +24267,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c158_20)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -26072,9 +24284,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c160_20)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -26089,9 +24299,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c168_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -26108,9 +24316,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c170_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -26123,9 +24329,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c178_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -26139,9 +24343,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c179_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -26169,9 +24371,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c190_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -26187,9 +24387,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c198_20)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -26206,9 +24404,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1a0_20)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (2);
 return 22 * CYCLE_UNIT / 2;
@@ -26223,9 +24419,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1a8_20)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -26242,9 +24436,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1b0_20)(uae_u32 opcode)
 {	dsta = get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_020 ());
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -26257,9 +24449,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1b8_20)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -26273,9 +24463,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1b9_20)(uae_u32 opcode)
 {	uaecptr dsta = get_long_020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -26289,9 +24477,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1c0_20)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}	m68k_incpc (2);
 return 58 * CYCLE_UNIT / 2;
@@ -26306,9 +24492,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1d0_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (2);
 return 62 * CYCLE_UNIT / 2;
@@ -26324,9 +24508,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1d8_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (2);
 return 62 * CYCLE_UNIT / 2;
@@ -26343,9 +24525,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1e0_20)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (2);
 return 64 * CYCLE_UNIT / 2;
@@ -26360,9 +24540,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1e8_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (4);
 return 66 * CYCLE_UNIT / 2;
@@ -26379,9 +24557,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1f0_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}return 66 * CYCLE_UNIT / 2;
 }
@@ -26394,9 +24570,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1f8_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (4);
 return 66 * CYCLE_UNIT / 2;
@@ -26410,9 +24584,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1f9_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (6);
 return 70 * CYCLE_UNIT / 2;
@@ -26427,9 +24599,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1fa_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (4);
 return 66 * CYCLE_UNIT / 2;
@@ -26447,9 +24617,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1fb_20)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}return 66 * CYCLE_UNIT / 2;
 }
@@ -26461,9 +24629,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1fc_20)(uae_u32 opcode)
 {{	uae_s16 src = get_word_020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}	m68k_incpc (4);
 return 62 * CYCLE_UNIT / 2;
@@ -26480,11 +24646,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d000_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -26502,11 +24666,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d010_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -26525,11 +24687,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d018_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -26549,11 +24709,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d020_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
@@ -26571,11 +24729,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d028_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -26595,11 +24751,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d030_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -26615,11 +24769,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d038_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -26636,11 +24788,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d039_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
@@ -26658,11 +24808,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d03a_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -26683,11 +24831,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d03b_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -26702,11 +24848,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d03c_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -26723,11 +24867,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d040_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -26744,11 +24886,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d048_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -26766,11 +24906,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d050_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -26789,11 +24927,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d058_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpc (2);
 return 8 * CYCLE_UNIT / 2;
@@ -26813,11 +24949,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d060_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpc (2);
 return 10 * CYCLE_UNIT / 2;
@@ -26835,11 +24969,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d068_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -26859,11 +24991,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d070_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -26879,11 +25009,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d078_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -26900,11 +25028,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d079_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpc (6);
 return 16 * CYCLE_UNIT / 2;
@@ -26922,11 +25048,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d07a_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpc (4);
 return 12 * CYCLE_UNIT / 2;
@@ -26947,11 +25071,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d07b_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -26966,11 +25088,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d07c_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpc (4);
 return 8 * CYCLE_UNIT / 2;
@@ -26987,11 +25107,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d080_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -27008,11 +25126,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d088_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (2);
 return 4 * CYCLE_UNIT / 2;
@@ -27030,11 +25146,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d090_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -27053,11 +25167,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d098_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -27077,11 +25189,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0a0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -27099,11 +25209,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0a8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -27123,11 +25231,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0b0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -27143,11 +25249,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0b8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -27164,11 +25268,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0b9_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -27186,11 +25288,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0ba_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -27211,11 +25311,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0bb_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -27230,11 +25328,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0bc_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpc (6);
 return 12 * CYCLE_UNIT / 2;
@@ -27468,11 +25564,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d110_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -27491,11 +25585,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d118_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -27515,11 +25607,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d120_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -27537,11 +25627,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d128_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -27561,11 +25649,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d130_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -27581,11 +25667,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d138_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -27602,11 +25686,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d139_20)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -27672,11 +25754,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d150_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -27695,11 +25775,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d158_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 12 * CYCLE_UNIT / 2;
@@ -27719,11 +25797,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d160_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 14 * CYCLE_UNIT / 2;
@@ -27741,11 +25817,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d168_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -27765,11 +25839,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d170_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -27785,11 +25857,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d178_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 16 * CYCLE_UNIT / 2;
@@ -27806,11 +25876,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d179_20)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 20 * CYCLE_UNIT / 2;
@@ -27876,11 +25944,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d190_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -27899,11 +25965,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d198_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 20 * CYCLE_UNIT / 2;
@@ -27923,11 +25987,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1a0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (2);
 return 22 * CYCLE_UNIT / 2;
@@ -27945,11 +26007,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1a8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -27969,11 +26029,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1b0_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}return 24 * CYCLE_UNIT / 2;
 }
@@ -27989,11 +26047,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1b8_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (4);
 return 24 * CYCLE_UNIT / 2;
@@ -28010,11 +26066,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1b9_20)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	m68k_incpc (6);
 return 28 * CYCLE_UNIT / 2;
@@ -28906,9 +26960,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0d0_20)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -28927,9 +26979,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0d8_20)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -28949,9 +26999,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0e0_20)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -28969,9 +27017,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0e8_20)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -28991,9 +27037,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0f0_20)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -29009,9 +27053,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0f8_20)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -29028,9 +27070,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0f9_20)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -29750,9 +27790,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1d0_20)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -29773,9 +27811,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1d8_20)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -29797,9 +27833,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1e0_20)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -29819,9 +27853,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1e8_20)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -29843,9 +27875,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1f0_20)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -29863,9 +27893,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1f8_20)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -29884,9 +27912,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1f9_20)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -29905,9 +27931,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2d0_20)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -29925,9 +27949,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2d8_20)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -29946,9 +27968,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2e0_20)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -29965,9 +27985,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2e8_20)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -29986,9 +28004,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2f0_20)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30003,9 +28019,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2f8_20)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30021,9 +28035,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2f9_20)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30040,9 +28052,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3d0_20)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30060,9 +28070,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3d8_20)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30081,9 +28089,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3e0_20)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30100,9 +28106,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3e8_20)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30121,9 +28125,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3f0_20)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30138,9 +28140,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3f8_20)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30156,9 +28156,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3f9_20)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30176,9 +28174,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4d0_20)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30197,9 +28193,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4d8_20)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30219,9 +28213,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4e0_20)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30239,9 +28231,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4e8_20)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30261,9 +28251,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4f0_20)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30279,9 +28267,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4f8_20)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30298,9 +28284,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4f9_20)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30318,9 +28302,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5d0_20)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30339,9 +28321,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5d8_20)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30361,9 +28341,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5e0_20)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30381,9 +28359,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5e8_20)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30403,9 +28379,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5f0_20)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30421,9 +28395,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5f8_20)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30440,9 +28412,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5f9_20)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30460,9 +28430,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6d0_20)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	m68k_incpc (2);
@@ -30480,9 +28448,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6d8_20)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	m68k_incpc (2);
@@ -30501,9 +28467,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6e0_20)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	m68k_incpc (2);
@@ -30520,9 +28484,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6e8_20)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	m68k_incpc (4);
@@ -30541,9 +28503,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6f0_20)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -30558,9 +28518,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6f8_20)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	m68k_incpc (4);
@@ -30576,9 +28534,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6f9_20)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	m68k_incpc (6);
@@ -30595,9 +28551,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7d0_20)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	m68k_incpc (2);
@@ -30615,9 +28569,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7d8_20)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	m68k_incpc (2);
@@ -30636,9 +28588,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7e0_20)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	m68k_incpc (2);
@@ -30655,9 +28605,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7e8_20)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	m68k_incpc (4);
@@ -30676,9 +28624,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7f0_20)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -30693,9 +28639,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7f8_20)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	m68k_incpc (4);
@@ -30711,9 +28655,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7f9_20)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	m68k_incpc (6);
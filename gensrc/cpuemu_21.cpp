@@ -34,9 +34,7 @@ void REGPARAM2 CPUFUNC(op_0000_21)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -51,9 +49,7 @@ void REGPARAM2 CPUFUNC(op_0010_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -69,9 +65,7 @@ void REGPARAM2 CPUFUNC(op_0018_21)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -88,9 +82,7 @@ void REGPARAM2 CPUFUNC(op_0020_21)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -105,9 +97,7 @@ void REGPARAM2 CPUFUNC(op_0028_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -124,9 +114,7 @@ void REGPARAM2 CPUFUNC(op_0030_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -139,9 +127,7 @@ void REGPARAM2 CPUFUNC(op_0038_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -155,9 +141,7 @@ void REGPARAM2 CPUFUNC(op_0039_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -184,9 +168,7 @@ void REGPARAM2 CPUFUNC(op_0040_21)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -201,9 +183,7 @@ void REGPARAM2 CPUFUNC(op_0050_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -219,9 +199,7 @@ void REGPARAM2 CPUFUNC(op_0058_21)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -238,9 +216,7 @@ void REGPARAM2 CPUFUNC(op_0060_21)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -255,9 +231,7 @@ void REGPARAM2 CPUFUNC(op_0068_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -274,9 +248,7 @@ void REGPARAM2 CPUFUNC(op_0070_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -289,9 +261,7 @@ void REGPARAM2 CPUFUNC(op_0078_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -305,9 +275,7 @@ void REGPARAM2 CPUFUNC(op_0079_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -335,9 +303,7 @@ void REGPARAM2 CPUFUNC(op_0080_21)(uae_u32 opcode)
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -352,9 +318,7 @@ void REGPARAM2 CPUFUNC(op_0090_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -370,9 +334,7 @@ void REGPARAM2 CPUFUNC(op_0098_21)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -389,9 +351,7 @@ void REGPARAM2 CPUFUNC(op_00a0_21)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -406,9 +366,7 @@ void REGPARAM2 CPUFUNC(op_00a8_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -425,9 +383,7 @@ void REGPARAM2 CPUFUNC(op_00b0_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -440,9 +396,7 @@ void REGPARAM2 CPUFUNC(op_00b8_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -456,9 +410,7 @@ void REGPARAM2 CPUFUNC(op_00b9_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (10);
@@ -1369,9 +1321,7 @@ void REGPARAM2 CPUFUNC(op_0200_21)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1386,9 +1336,7 @@ void REGPARAM2 CPUFUNC(op_0210_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1404,9 +1352,7 @@ void REGPARAM2 CPUFUNC(op_0218_21)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1423,9 +1369,7 @@ void REGPARAM2 CPUFUNC(op_0220_21)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1440,9 +1384,7 @@ void REGPARAM2 CPUFUNC(op_0228_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -1459,9 +1401,7 @@ void REGPARAM2 CPUFUNC(op_0230_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -1474,9 +1414,7 @@ void REGPARAM2 CPUFUNC(op_0238_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -1490,9 +1428,7 @@ void REGPARAM2 CPUFUNC(op_0239_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -1519,9 +1455,7 @@ void REGPARAM2 CPUFUNC(op_0240_21)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1536,9 +1470,7 @@ void REGPARAM2 CPUFUNC(op_0250_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1554,9 +1486,7 @@ void REGPARAM2 CPUFUNC(op_0258_21)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1573,9 +1503,7 @@ void REGPARAM2 CPUFUNC(op_0260_21)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1590,9 +1518,7 @@ void REGPARAM2 CPUFUNC(op_0268_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -1609,9 +1535,7 @@ void REGPARAM2 CPUFUNC(op_0270_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -1624,9 +1548,7 @@ void REGPARAM2 CPUFUNC(op_0278_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -1640,9 +1562,7 @@ void REGPARAM2 CPUFUNC(op_0279_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -1670,9 +1590,7 @@ void REGPARAM2 CPUFUNC(op_0280_21)(uae_u32 opcode)
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -1687,9 +1605,7 @@ void REGPARAM2 CPUFUNC(op_0290_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -1705,9 +1621,7 @@ void REGPARAM2 CPUFUNC(op_0298_21)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -1724,9 +1638,7 @@ void REGPARAM2 CPUFUNC(op_02a0_21)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -1741,9 +1653,7 @@ void REGPARAM2 CPUFUNC(op_02a8_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -1760,9 +1670,7 @@ void REGPARAM2 CPUFUNC(op_02b0_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -1775,9 +1683,7 @@ void REGPARAM2 CPUFUNC(op_02b8_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -1791,9 +1697,7 @@ void REGPARAM2 CPUFUNC(op_02b9_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (10);
@@ -1960,11 +1864,9 @@ void REGPARAM2 CPUFUNC(op_0400_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1982,11 +1884,9 @@ void REGPARAM2 CPUFUNC(op_0410_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2005,11 +1905,9 @@ void REGPARAM2 CPUFUNC(op_0418_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2029,11 +1927,9 @@ void REGPARAM2 CPUFUNC(op_0420_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2051,11 +1947,9 @@ void REGPARAM2 CPUFUNC(op_0428_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2075,11 +1969,9 @@ void REGPARAM2 CPUFUNC(op_0430_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -2095,11 +1987,9 @@ void REGPARAM2 CPUFUNC(op_0438_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2116,11 +2006,9 @@ void REGPARAM2 CPUFUNC(op_0439_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -2137,11 +2025,9 @@ void REGPARAM2 CPUFUNC(op_0440_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2159,11 +2045,9 @@ void REGPARAM2 CPUFUNC(op_0450_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2182,11 +2066,9 @@ void REGPARAM2 CPUFUNC(op_0458_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2206,11 +2088,9 @@ void REGPARAM2 CPUFUNC(op_0460_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2228,11 +2108,9 @@ void REGPARAM2 CPUFUNC(op_0468_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2252,11 +2130,9 @@ void REGPARAM2 CPUFUNC(op_0470_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -2272,11 +2148,9 @@ void REGPARAM2 CPUFUNC(op_0478_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2293,11 +2167,9 @@ void REGPARAM2 CPUFUNC(op_0479_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -2314,11 +2186,9 @@ void REGPARAM2 CPUFUNC(op_0480_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2336,11 +2206,9 @@ void REGPARAM2 CPUFUNC(op_0490_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2359,11 +2227,9 @@ void REGPARAM2 CPUFUNC(op_0498_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2383,11 +2249,9 @@ void REGPARAM2 CPUFUNC(op_04a0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2405,11 +2269,9 @@ void REGPARAM2 CPUFUNC(op_04a8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -2429,11 +2291,9 @@ void REGPARAM2 CPUFUNC(op_04b0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -2449,11 +2309,9 @@ void REGPARAM2 CPUFUNC(op_04b8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -2470,11 +2328,9 @@ void REGPARAM2 CPUFUNC(op_04b9_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (10);
@@ -2634,11 +2490,9 @@ void REGPARAM2 CPUFUNC(op_0600_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2656,11 +2510,9 @@ void REGPARAM2 CPUFUNC(op_0610_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2679,11 +2531,9 @@ void REGPARAM2 CPUFUNC(op_0618_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2703,11 +2553,9 @@ void REGPARAM2 CPUFUNC(op_0620_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2725,11 +2573,9 @@ void REGPARAM2 CPUFUNC(op_0628_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2749,11 +2595,9 @@ void REGPARAM2 CPUFUNC(op_0630_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -2769,11 +2613,9 @@ void REGPARAM2 CPUFUNC(op_0638_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2790,11 +2632,9 @@ void REGPARAM2 CPUFUNC(op_0639_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -2811,11 +2651,9 @@ void REGPARAM2 CPUFUNC(op_0640_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2833,11 +2671,9 @@ void REGPARAM2 CPUFUNC(op_0650_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2856,11 +2692,9 @@ void REGPARAM2 CPUFUNC(op_0658_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2880,11 +2714,9 @@ void REGPARAM2 CPUFUNC(op_0660_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2902,11 +2734,9 @@ void REGPARAM2 CPUFUNC(op_0668_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2926,11 +2756,9 @@ void REGPARAM2 CPUFUNC(op_0670_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -2946,11 +2774,9 @@ void REGPARAM2 CPUFUNC(op_0678_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2967,11 +2793,9 @@ void REGPARAM2 CPUFUNC(op_0679_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -2988,11 +2812,9 @@ void REGPARAM2 CPUFUNC(op_0680_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -3010,11 +2832,9 @@ void REGPARAM2 CPUFUNC(op_0690_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -3033,11 +2853,9 @@ void REGPARAM2 CPUFUNC(op_0698_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -3057,11 +2875,9 @@ void REGPARAM2 CPUFUNC(op_06a0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -3079,11 +2895,9 @@ void REGPARAM2 CPUFUNC(op_06a8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -3103,11 +2917,9 @@ void REGPARAM2 CPUFUNC(op_06b0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -3123,11 +2935,9 @@ void REGPARAM2 CPUFUNC(op_06b8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -3144,11 +2954,9 @@ void REGPARAM2 CPUFUNC(op_06b9_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (10);
@@ -3918,9 +3726,7 @@ void REGPARAM2 CPUFUNC(op_0a00_21)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -3935,9 +3741,7 @@ void REGPARAM2 CPUFUNC(op_0a10_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -3953,9 +3757,7 @@ void REGPARAM2 CPUFUNC(op_0a18_21)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -3972,9 +3774,7 @@ void REGPARAM2 CPUFUNC(op_0a20_21)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -3989,9 +3789,7 @@ void REGPARAM2 CPUFUNC(op_0a28_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -4008,9 +3806,7 @@ void REGPARAM2 CPUFUNC(op_0a30_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -4023,9 +3819,7 @@ void REGPARAM2 CPUFUNC(op_0a38_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -4039,9 +3833,7 @@ void REGPARAM2 CPUFUNC(op_0a39_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -4068,9 +3860,7 @@ void REGPARAM2 CPUFUNC(op_0a40_21)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -4085,9 +3875,7 @@ void REGPARAM2 CPUFUNC(op_0a50_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -4103,9 +3891,7 @@ void REGPARAM2 CPUFUNC(op_0a58_21)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -4122,9 +3908,7 @@ void REGPARAM2 CPUFUNC(op_0a60_21)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -4139,9 +3923,7 @@ void REGPARAM2 CPUFUNC(op_0a68_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -4158,9 +3940,7 @@ void REGPARAM2 CPUFUNC(op_0a70_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -4173,9 +3953,7 @@ void REGPARAM2 CPUFUNC(op_0a78_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -4189,9 +3967,7 @@ void REGPARAM2 CPUFUNC(op_0a79_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -4219,9 +3995,7 @@ void REGPARAM2 CPUFUNC(op_0a80_21)(uae_u32 opcode)
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -4239,9 +4013,7 @@ void REGPARAM2 CPUFUNC(op_0a90_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -4257,9 +4029,7 @@ void REGPARAM2 CPUFUNC(op_0a98_21)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -4276,9 +4046,7 @@ void REGPARAM2 CPUFUNC(op_0aa0_21)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -4293,9 +4061,7 @@ void REGPARAM2 CPUFUNC(op_0aa8_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -4312,9 +4078,7 @@ void REGPARAM2 CPUFUNC(op_0ab0_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -4327,9 +4091,7 @@ void REGPARAM2 CPUFUNC(op_0ab8_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -4343,9 +4105,7 @@ void REGPARAM2 CPUFUNC(op_0ab9_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (10);
@@ -4366,10 +4126,8 @@ void REGPARAM2 CPUFUNC(op_0ad0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4393,10 +4151,8 @@ void REGPARAM2 CPUFUNC(op_0ad8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4421,10 +4177,8 @@ void REGPARAM2 CPUFUNC(op_0ae0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4447,10 +4201,8 @@ void REGPARAM2 CPUFUNC(op_0ae8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4475,10 +4227,8 @@ void REGPARAM2 CPUFUNC(op_0af0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
 }}}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -4499,10 +4249,8 @@ void REGPARAM2 CPUFUNC(op_0af8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4524,10 +4272,8 @@ void REGPARAM2 CPUFUNC(op_0af9_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (8);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4546,10 +4292,8 @@ void REGPARAM2 CPUFUNC(op_0c00_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -4566,10 +4310,8 @@ void REGPARAM2 CPUFUNC(op_0c10_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -4587,10 +4329,8 @@ void REGPARAM2 CPUFUNC(op_0c18_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -4609,10 +4349,8 @@ void REGPARAM2 CPUFUNC(op_0c20_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -4629,10 +4367,8 @@ void REGPARAM2 CPUFUNC(op_0c28_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -4651,10 +4387,8 @@ void REGPARAM2 CPUFUNC(op_0c30_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -4669,10 +4403,8 @@ void REGPARAM2 CPUFUNC(op_0c38_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -4688,10 +4420,8 @@ void REGPARAM2 CPUFUNC(op_0c39_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
 return;
@@ -4710,10 +4440,8 @@ void REGPARAM2 CPUFUNC(op_0c3a_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -4736,10 +4464,8 @@ void REGPARAM2 CPUFUNC(op_0c3b_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -4755,10 +4481,8 @@ void REGPARAM2 CPUFUNC(op_0c40_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -4775,10 +4499,8 @@ void REGPARAM2 CPUFUNC(op_0c50_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -4796,10 +4518,8 @@ void REGPARAM2 CPUFUNC(op_0c58_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -4818,10 +4538,8 @@ void REGPARAM2 CPUFUNC(op_0c60_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -4838,10 +4556,8 @@ void REGPARAM2 CPUFUNC(op_0c68_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -4860,10 +4576,8 @@ void REGPARAM2 CPUFUNC(op_0c70_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -4878,10 +4592,8 @@ void REGPARAM2 CPUFUNC(op_0c78_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -4897,10 +4609,8 @@ void REGPARAM2 CPUFUNC(op_0c79_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
 return;
@@ -4919,10 +4629,8 @@ void REGPARAM2 CPUFUNC(op_0c7a_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -4945,10 +4653,8 @@ void REGPARAM2 CPUFUNC(op_0c7b_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -4964,10 +4670,8 @@ void REGPARAM2 CPUFUNC(op_0c80_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -4984,10 +4688,8 @@ void REGPARAM2 CPUFUNC(op_0c90_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -5005,10 +4707,8 @@ void REGPARAM2 CPUFUNC(op_0c98_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -5027,10 +4727,8 @@ void REGPARAM2 CPUFUNC(op_0ca0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -5047,10 +4745,8 @@ void REGPARAM2 CPUFUNC(op_0ca8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
 return;
@@ -5069,10 +4765,8 @@ void REGPARAM2 CPUFUNC(op_0cb0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -5087,10 +4781,8 @@ void REGPARAM2 CPUFUNC(op_0cb8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
 return;
@@ -5106,10 +4798,8 @@ void REGPARAM2 CPUFUNC(op_0cb9_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (10);
 return;
@@ -5128,10 +4818,8 @@ void REGPARAM2 CPUFUNC(op_0cba_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
 return;
@@ -5154,10 +4842,8 @@ void REGPARAM2 CPUFUNC(op_0cbb_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -5177,10 +4863,8 @@ void REGPARAM2 CPUFUNC(op_0cd0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -5204,10 +4888,8 @@ void REGPARAM2 CPUFUNC(op_0cd8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -5232,10 +4914,8 @@ void REGPARAM2 CPUFUNC(op_0ce0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -5258,10 +4938,8 @@ void REGPARAM2 CPUFUNC(op_0ce8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -5286,10 +4964,8 @@ void REGPARAM2 CPUFUNC(op_0cf0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
 }}}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -5310,10 +4986,8 @@ void REGPARAM2 CPUFUNC(op_0cf8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -5335,10 +5009,8 @@ void REGPARAM2 CPUFUNC(op_0cf9_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (8);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -5359,19 +5031,15 @@ void REGPARAM2 CPUFUNC(op_0cfc_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, (extra >> 16) & 7))) < 0;
 	int flgo = ((uae_s16)(dst1)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, (extra >> 16) & 7))) > ((uae_u16)(dst1)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, (extra >> 16) & 7))) > ((uae_u16)(dst1))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()) {
 {uae_u32 newv = ((uae_s16)(dst2)) - ((uae_s16)(m68k_dreg (regs, extra & 7)));
 {	int flgs = ((uae_s16)(m68k_dreg (regs, extra & 7))) < 0;
 	int flgo = ((uae_s16)(dst2)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, extra & 7))) > ((uae_u16)(dst2)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, extra & 7))) > ((uae_u16)(dst2))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()) {
 	x_put_word (rn1, m68k_dreg (regs, (extra >> 22) & 7));
 	x_put_word (rn2, m68k_dreg (regs, (extra >> 6) & 7));
@@ -5946,10 +5614,8 @@ void REGPARAM2 CPUFUNC(op_0ed0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -5973,10 +5639,8 @@ void REGPARAM2 CPUFUNC(op_0ed8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -6001,10 +5665,8 @@ void REGPARAM2 CPUFUNC(op_0ee0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -6027,10 +5689,8 @@ void REGPARAM2 CPUFUNC(op_0ee8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -6055,10 +5715,8 @@ void REGPARAM2 CPUFUNC(op_0ef0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
 }}}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6079,10 +5737,8 @@ void REGPARAM2 CPUFUNC(op_0ef8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -6104,10 +5760,8 @@ void REGPARAM2 CPUFUNC(op_0ef9_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (8);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -6128,19 +5782,15 @@ void REGPARAM2 CPUFUNC(op_0efc_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, (extra >> 16) & 7))) < 0;
 	int flgo = ((uae_s32)(dst1)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, (extra >> 16) & 7))) > ((uae_u32)(dst1)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, (extra >> 16) & 7))) > ((uae_u32)(dst1))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()) {
 {uae_u32 newv = ((uae_s32)(dst2)) - ((uae_s32)(m68k_dreg (regs, extra & 7)));
 {	int flgs = ((uae_s32)(m68k_dreg (regs, extra & 7))) < 0;
 	int flgo = ((uae_s32)(dst2)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, extra & 7))) > ((uae_u32)(dst2)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, extra & 7))) > ((uae_u32)(dst2))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()) {
 	x_put_long (rn1, m68k_dreg (regs, (extra >> 22) & 7));
 	x_put_long (rn2, m68k_dreg (regs, (extra >> 6) & 7));
@@ -6161,9 +5811,7 @@ void REGPARAM2 CPUFUNC(op_1000_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6177,9 +5825,7 @@ void REGPARAM2 CPUFUNC(op_1010_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6194,9 +5840,7 @@ void REGPARAM2 CPUFUNC(op_1018_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6212,9 +5856,7 @@ void REGPARAM2 CPUFUNC(op_1020_21)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6228,9 +5870,7 @@ void REGPARAM2 CPUFUNC(op_1028_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6246,9 +5886,7 @@ void REGPARAM2 CPUFUNC(op_1030_21)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -6260,9 +5898,7 @@ void REGPARAM2 CPUFUNC(op_1038_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6275,9 +5911,7 @@ void REGPARAM2 CPUFUNC(op_1039_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6291,9 +5925,7 @@ void REGPARAM2 CPUFUNC(op_103a_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6310,9 +5942,7 @@ void REGPARAM2 CPUFUNC(op_103b_21)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -6323,9 +5953,7 @@ void REGPARAM2 CPUFUNC(op_103c_21)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6339,9 +5967,7 @@ void REGPARAM2 CPUFUNC(op_1080_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6356,9 +5982,7 @@ void REGPARAM2 CPUFUNC(op_1090_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6374,9 +5998,7 @@ void REGPARAM2 CPUFUNC(op_1098_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6393,9 +6015,7 @@ void REGPARAM2 CPUFUNC(op_10a0_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6410,9 +6030,7 @@ void REGPARAM2 CPUFUNC(op_10a8_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6429,9 +6047,7 @@ void REGPARAM2 CPUFUNC(op_10b0_21)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -6444,9 +6060,7 @@ void REGPARAM2 CPUFUNC(op_10b8_21)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6460,9 +6074,7 @@ void REGPARAM2 CPUFUNC(op_10b9_21)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6477,9 +6089,7 @@ void REGPARAM2 CPUFUNC(op_10ba_21)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6497,9 +6107,7 @@ void REGPARAM2 CPUFUNC(op_10bb_21)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -6511,9 +6119,7 @@ void REGPARAM2 CPUFUNC(op_10bc_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6528,9 +6134,7 @@ void REGPARAM2 CPUFUNC(op_10c0_21)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6546,9 +6150,7 @@ void REGPARAM2 CPUFUNC(op_10d0_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6565,9 +6167,7 @@ void REGPARAM2 CPUFUNC(op_10d8_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6585,9 +6185,7 @@ void REGPARAM2 CPUFUNC(op_10e0_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6603,9 +6201,7 @@ void REGPARAM2 CPUFUNC(op_10e8_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6623,9 +6219,7 @@ void REGPARAM2 CPUFUNC(op_10f0_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -6639,9 +6233,7 @@ void REGPARAM2 CPUFUNC(op_10f8_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6656,9 +6248,7 @@ void REGPARAM2 CPUFUNC(op_10f9_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6674,9 +6264,7 @@ void REGPARAM2 CPUFUNC(op_10fa_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6695,9 +6283,7 @@ void REGPARAM2 CPUFUNC(op_10fb_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -6710,9 +6296,7 @@ void REGPARAM2 CPUFUNC(op_10fc_21)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6728,9 +6312,7 @@ void REGPARAM2 CPUFUNC(op_1100_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6747,9 +6329,7 @@ void REGPARAM2 CPUFUNC(op_1110_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6767,9 +6347,7 @@ void REGPARAM2 CPUFUNC(op_1118_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6788,9 +6366,7 @@ void REGPARAM2 CPUFUNC(op_1120_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6807,9 +6383,7 @@ void REGPARAM2 CPUFUNC(op_1128_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6828,9 +6402,7 @@ void REGPARAM2 CPUFUNC(op_1130_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -6845,9 +6417,7 @@ void REGPARAM2 CPUFUNC(op_1138_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6863,9 +6433,7 @@ void REGPARAM2 CPUFUNC(op_1139_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6882,9 +6450,7 @@ void REGPARAM2 CPUFUNC(op_113a_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6904,9 +6470,7 @@ void REGPARAM2 CPUFUNC(op_113b_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -6920,9 +6484,7 @@ void REGPARAM2 CPUFUNC(op_113c_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6936,9 +6498,7 @@ void REGPARAM2 CPUFUNC(op_1140_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6953,9 +6513,7 @@ void REGPARAM2 CPUFUNC(op_1150_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6971,9 +6529,7 @@ void REGPARAM2 CPUFUNC(op_1158_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6990,9 +6546,7 @@ void REGPARAM2 CPUFUNC(op_1160_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7007,9 +6561,7 @@ void REGPARAM2 CPUFUNC(op_1168_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7026,9 +6578,7 @@ void REGPARAM2 CPUFUNC(op_1170_21)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7042,9 +6592,7 @@ void REGPARAM2 CPUFUNC(op_1178_21)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7058,9 +6606,7 @@ void REGPARAM2 CPUFUNC(op_1179_21)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7075,9 +6621,7 @@ void REGPARAM2 CPUFUNC(op_117a_21)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7095,9 +6639,7 @@ void REGPARAM2 CPUFUNC(op_117b_21)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7110,9 +6652,7 @@ void REGPARAM2 CPUFUNC(op_117c_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7128,9 +6668,7 @@ void REGPARAM2 CPUFUNC(op_1180_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7146,9 +6684,7 @@ void REGPARAM2 CPUFUNC(op_1190_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7165,9 +6701,7 @@ void REGPARAM2 CPUFUNC(op_1198_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7185,9 +6719,7 @@ void REGPARAM2 CPUFUNC(op_11a0_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7203,9 +6735,7 @@ void REGPARAM2 CPUFUNC(op_11a8_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7222,9 +6752,7 @@ void REGPARAM2 CPUFUNC(op_11b0_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7239,9 +6767,7 @@ void REGPARAM2 CPUFUNC(op_11b8_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7256,9 +6782,7 @@ void REGPARAM2 CPUFUNC(op_11b9_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (6);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7274,9 +6798,7 @@ void REGPARAM2 CPUFUNC(op_11ba_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7294,9 +6816,7 @@ void REGPARAM2 CPUFUNC(op_11bb_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7310,9 +6830,7 @@ void REGPARAM2 CPUFUNC(op_11bc_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7324,9 +6842,7 @@ void REGPARAM2 CPUFUNC(op_11c0_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7340,9 +6856,7 @@ void REGPARAM2 CPUFUNC(op_11d0_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7357,9 +6871,7 @@ void REGPARAM2 CPUFUNC(op_11d8_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7375,9 +6887,7 @@ void REGPARAM2 CPUFUNC(op_11e0_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7391,9 +6901,7 @@ void REGPARAM2 CPUFUNC(op_11e8_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7409,9 +6917,7 @@ void REGPARAM2 CPUFUNC(op_11f0_21)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7424,9 +6930,7 @@ void REGPARAM2 CPUFUNC(op_11f8_21)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7439,9 +6943,7 @@ void REGPARAM2 CPUFUNC(op_11f9_21)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7455,9 +6957,7 @@ void REGPARAM2 CPUFUNC(op_11fa_21)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7474,9 +6974,7 @@ void REGPARAM2 CPUFUNC(op_11fb_21)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7488,9 +6986,7 @@ void REGPARAM2 CPUFUNC(op_11fc_21)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7503,9 +6999,7 @@ void REGPARAM2 CPUFUNC(op_13c0_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7519,9 +7013,7 @@ void REGPARAM2 CPUFUNC(op_13d0_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7536,9 +7028,7 @@ void REGPARAM2 CPUFUNC(op_13d8_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7554,9 +7044,7 @@ void REGPARAM2 CPUFUNC(op_13e0_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7570,9 +7058,7 @@ void REGPARAM2 CPUFUNC(op_13e8_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7588,9 +7074,7 @@ void REGPARAM2 CPUFUNC(op_13f0_21)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7603,9 +7087,7 @@ void REGPARAM2 CPUFUNC(op_13f8_21)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7618,9 +7100,7 @@ void REGPARAM2 CPUFUNC(op_13f9_21)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (10);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7634,9 +7114,7 @@ void REGPARAM2 CPUFUNC(op_13fa_21)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7653,9 +7131,7 @@ void REGPARAM2 CPUFUNC(op_13fb_21)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7667,9 +7143,7 @@ void REGPARAM2 CPUFUNC(op_13fc_21)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7682,9 +7156,7 @@ void REGPARAM2 CPUFUNC(op_2000_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7697,9 +7169,7 @@ void REGPARAM2 CPUFUNC(op_2008_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7713,9 +7183,7 @@ void REGPARAM2 CPUFUNC(op_2010_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7730,9 +7198,7 @@ void REGPARAM2 CPUFUNC(op_2018_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7748,9 +7214,7 @@ void REGPARAM2 CPUFUNC(op_2020_21)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - 4;
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7764,9 +7228,7 @@ void REGPARAM2 CPUFUNC(op_2028_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7782,9 +7244,7 @@ void REGPARAM2 CPUFUNC(op_2030_21)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7796,9 +7256,7 @@ void REGPARAM2 CPUFUNC(op_2038_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7811,9 +7269,7 @@ void REGPARAM2 CPUFUNC(op_2039_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7827,9 +7283,7 @@ void REGPARAM2 CPUFUNC(op_203a_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7846,9 +7300,7 @@ void REGPARAM2 CPUFUNC(op_203b_21)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7859,9 +7311,7 @@ void REGPARAM2 CPUFUNC(op_203c_21)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_long_ce020_prefetch (2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8031,9 +7481,7 @@ void REGPARAM2 CPUFUNC(op_2080_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8047,9 +7495,7 @@ void REGPARAM2 CPUFUNC(op_2088_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8064,9 +7510,7 @@ void REGPARAM2 CPUFUNC(op_2090_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8082,9 +7526,7 @@ void REGPARAM2 CPUFUNC(op_2098_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8101,9 +7543,7 @@ void REGPARAM2 CPUFUNC(op_20a0_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8118,9 +7558,7 @@ void REGPARAM2 CPUFUNC(op_20a8_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8137,9 +7575,7 @@ void REGPARAM2 CPUFUNC(op_20b0_21)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8152,9 +7588,7 @@ void REGPARAM2 CPUFUNC(op_20b8_21)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8168,9 +7602,7 @@ void REGPARAM2 CPUFUNC(op_20b9_21)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8185,9 +7617,7 @@ void REGPARAM2 CPUFUNC(op_20ba_21)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8205,9 +7635,7 @@ void REGPARAM2 CPUFUNC(op_20bb_21)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8219,9 +7647,7 @@ void REGPARAM2 CPUFUNC(op_20bc_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8236,9 +7662,7 @@ void REGPARAM2 CPUFUNC(op_20c0_21)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8253,9 +7677,7 @@ void REGPARAM2 CPUFUNC(op_20c8_21)(uae_u32 opcode)
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8271,9 +7693,7 @@ void REGPARAM2 CPUFUNC(op_20d0_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8290,9 +7710,7 @@ void REGPARAM2 CPUFUNC(op_20d8_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8310,9 +7728,7 @@ void REGPARAM2 CPUFUNC(op_20e0_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8328,9 +7744,7 @@ void REGPARAM2 CPUFUNC(op_20e8_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8348,9 +7762,7 @@ void REGPARAM2 CPUFUNC(op_20f0_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8364,9 +7776,7 @@ void REGPARAM2 CPUFUNC(op_20f8_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8381,9 +7791,7 @@ void REGPARAM2 CPUFUNC(op_20f9_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8399,9 +7807,7 @@ void REGPARAM2 CPUFUNC(op_20fa_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8420,9 +7826,7 @@ void REGPARAM2 CPUFUNC(op_20fb_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8435,9 +7839,7 @@ void REGPARAM2 CPUFUNC(op_20fc_21)(uae_u32 opcode)
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8453,9 +7855,7 @@ void REGPARAM2 CPUFUNC(op_2100_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8471,9 +7871,7 @@ void REGPARAM2 CPUFUNC(op_2108_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8490,9 +7888,7 @@ void REGPARAM2 CPUFUNC(op_2110_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8510,9 +7906,7 @@ void REGPARAM2 CPUFUNC(op_2118_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8531,9 +7925,7 @@ void REGPARAM2 CPUFUNC(op_2120_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8550,9 +7942,7 @@ void REGPARAM2 CPUFUNC(op_2128_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8571,9 +7961,7 @@ void REGPARAM2 CPUFUNC(op_2130_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8588,9 +7976,7 @@ void REGPARAM2 CPUFUNC(op_2138_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8606,9 +7992,7 @@ void REGPARAM2 CPUFUNC(op_2139_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8625,9 +8009,7 @@ void REGPARAM2 CPUFUNC(op_213a_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8647,9 +8029,7 @@ void REGPARAM2 CPUFUNC(op_213b_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8663,9 +8043,7 @@ void REGPARAM2 CPUFUNC(op_213c_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8679,9 +8057,7 @@ void REGPARAM2 CPUFUNC(op_2140_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8695,9 +8071,7 @@ void REGPARAM2 CPUFUNC(op_2148_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8712,9 +8086,7 @@ void REGPARAM2 CPUFUNC(op_2150_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8730,9 +8102,7 @@ void REGPARAM2 CPUFUNC(op_2158_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8749,9 +8119,7 @@ void REGPARAM2 CPUFUNC(op_2160_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8766,9 +8134,7 @@ void REGPARAM2 CPUFUNC(op_2168_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8788,9 +8154,7 @@ void REGPARAM2 CPUFUNC(op_2170_21)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8804,9 +8168,7 @@ void REGPARAM2 CPUFUNC(op_2178_21)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8820,9 +8182,7 @@ void REGPARAM2 CPUFUNC(op_2179_21)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8837,9 +8197,7 @@ void REGPARAM2 CPUFUNC(op_217a_21)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8857,9 +8215,7 @@ void REGPARAM2 CPUFUNC(op_217b_21)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8872,9 +8228,7 @@ void REGPARAM2 CPUFUNC(op_217c_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8890,9 +8244,7 @@ void REGPARAM2 CPUFUNC(op_2180_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8907,9 +8259,7 @@ void REGPARAM2 CPUFUNC(op_2188_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8925,9 +8275,7 @@ void REGPARAM2 CPUFUNC(op_2190_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8944,9 +8292,7 @@ void REGPARAM2 CPUFUNC(op_2198_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8964,9 +8310,7 @@ void REGPARAM2 CPUFUNC(op_21a0_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8982,9 +8326,7 @@ void REGPARAM2 CPUFUNC(op_21a8_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9001,9 +8343,7 @@ void REGPARAM2 CPUFUNC(op_21b0_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9018,9 +8358,7 @@ void REGPARAM2 CPUFUNC(op_21b8_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9035,9 +8373,7 @@ void REGPARAM2 CPUFUNC(op_21b9_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (6);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9053,9 +8389,7 @@ void REGPARAM2 CPUFUNC(op_21ba_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9073,9 +8407,7 @@ void REGPARAM2 CPUFUNC(op_21bb_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9089,9 +8421,7 @@ void REGPARAM2 CPUFUNC(op_21bc_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (6);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9103,9 +8433,7 @@ void REGPARAM2 CPUFUNC(op_21c0_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9118,9 +8446,7 @@ void REGPARAM2 CPUFUNC(op_21c8_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9134,9 +8460,7 @@ void REGPARAM2 CPUFUNC(op_21d0_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9151,9 +8475,7 @@ void REGPARAM2 CPUFUNC(op_21d8_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9169,9 +8491,7 @@ void REGPARAM2 CPUFUNC(op_21e0_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9185,9 +8505,7 @@ void REGPARAM2 CPUFUNC(op_21e8_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9203,9 +8521,7 @@ void REGPARAM2 CPUFUNC(op_21f0_21)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9218,9 +8534,7 @@ void REGPARAM2 CPUFUNC(op_21f8_21)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9233,9 +8547,7 @@ void REGPARAM2 CPUFUNC(op_21f9_21)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9249,9 +8561,7 @@ void REGPARAM2 CPUFUNC(op_21fa_21)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9268,9 +8578,7 @@ void REGPARAM2 CPUFUNC(op_21fb_21)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9282,9 +8590,7 @@ void REGPARAM2 CPUFUNC(op_21fc_21)(uae_u32 opcode)
 {
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9297,9 +8603,7 @@ void REGPARAM2 CPUFUNC(op_23c0_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9312,9 +8616,7 @@ void REGPARAM2 CPUFUNC(op_23c8_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9328,9 +8630,7 @@ void REGPARAM2 CPUFUNC(op_23d0_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9345,9 +8645,7 @@ void REGPARAM2 CPUFUNC(op_23d8_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9363,9 +8661,7 @@ void REGPARAM2 CPUFUNC(op_23e0_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9379,9 +8675,7 @@ void REGPARAM2 CPUFUNC(op_23e8_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9397,9 +8691,7 @@ void REGPARAM2 CPUFUNC(op_23f0_21)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9412,9 +8704,7 @@ void REGPARAM2 CPUFUNC(op_23f8_21)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9427,9 +8717,7 @@ void REGPARAM2 CPUFUNC(op_23f9_21)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (10);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9443,9 +8731,7 @@ void REGPARAM2 CPUFUNC(op_23fa_21)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9462,9 +8748,7 @@ void REGPARAM2 CPUFUNC(op_23fb_21)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9476,9 +8760,7 @@ void REGPARAM2 CPUFUNC(op_23fc_21)(uae_u32 opcode)
 {
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uaecptr dsta = get_long_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (10);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9491,9 +8773,7 @@ void REGPARAM2 CPUFUNC(op_3000_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9506,9 +8786,7 @@ void REGPARAM2 CPUFUNC(op_3008_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9522,9 +8800,7 @@ void REGPARAM2 CPUFUNC(op_3010_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9539,9 +8815,7 @@ void REGPARAM2 CPUFUNC(op_3018_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9557,9 +8831,7 @@ void REGPARAM2 CPUFUNC(op_3020_21)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - 2;
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9573,9 +8845,7 @@ void REGPARAM2 CPUFUNC(op_3028_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9591,9 +8861,7 @@ void REGPARAM2 CPUFUNC(op_3030_21)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9605,9 +8873,7 @@ void REGPARAM2 CPUFUNC(op_3038_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9620,9 +8886,7 @@ void REGPARAM2 CPUFUNC(op_3039_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9636,9 +8900,7 @@ void REGPARAM2 CPUFUNC(op_303a_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9655,9 +8917,7 @@ void REGPARAM2 CPUFUNC(op_303b_21)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9668,9 +8928,7 @@ void REGPARAM2 CPUFUNC(op_303c_21)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_word_ce020_prefetch (2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9852,9 +9110,7 @@ void REGPARAM2 CPUFUNC(op_3080_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9868,9 +9124,7 @@ void REGPARAM2 CPUFUNC(op_3088_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9885,9 +9139,7 @@ void REGPARAM2 CPUFUNC(op_3090_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9903,9 +9155,7 @@ void REGPARAM2 CPUFUNC(op_3098_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9922,9 +9172,7 @@ void REGPARAM2 CPUFUNC(op_30a0_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9939,9 +9187,7 @@ void REGPARAM2 CPUFUNC(op_30a8_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9958,9 +9204,7 @@ void REGPARAM2 CPUFUNC(op_30b0_21)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9973,9 +9217,7 @@ void REGPARAM2 CPUFUNC(op_30b8_21)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9989,9 +9231,7 @@ void REGPARAM2 CPUFUNC(op_30b9_21)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10006,9 +9246,7 @@ void REGPARAM2 CPUFUNC(op_30ba_21)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10026,9 +9264,7 @@ void REGPARAM2 CPUFUNC(op_30bb_21)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10040,9 +9276,7 @@ void REGPARAM2 CPUFUNC(op_30bc_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10057,9 +9291,7 @@ void REGPARAM2 CPUFUNC(op_30c0_21)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10074,9 +9306,7 @@ void REGPARAM2 CPUFUNC(op_30c8_21)(uae_u32 opcode)
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10092,9 +9322,7 @@ void REGPARAM2 CPUFUNC(op_30d0_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10111,9 +9339,7 @@ void REGPARAM2 CPUFUNC(op_30d8_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10131,9 +9357,7 @@ void REGPARAM2 CPUFUNC(op_30e0_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10149,9 +9373,7 @@ void REGPARAM2 CPUFUNC(op_30e8_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10169,9 +9391,7 @@ void REGPARAM2 CPUFUNC(op_30f0_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10185,9 +9405,7 @@ void REGPARAM2 CPUFUNC(op_30f8_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10202,9 +9420,7 @@ void REGPARAM2 CPUFUNC(op_30f9_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10220,9 +9436,7 @@ void REGPARAM2 CPUFUNC(op_30fa_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10241,9 +9455,7 @@ void REGPARAM2 CPUFUNC(op_30fb_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10256,9 +9468,7 @@ void REGPARAM2 CPUFUNC(op_30fc_21)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10274,9 +9484,7 @@ void REGPARAM2 CPUFUNC(op_3100_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10292,9 +9500,7 @@ void REGPARAM2 CPUFUNC(op_3108_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10311,9 +9517,7 @@ void REGPARAM2 CPUFUNC(op_3110_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10331,9 +9535,7 @@ void REGPARAM2 CPUFUNC(op_3118_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10352,9 +9554,7 @@ void REGPARAM2 CPUFUNC(op_3120_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10371,9 +9571,7 @@ void REGPARAM2 CPUFUNC(op_3128_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10392,9 +9590,7 @@ void REGPARAM2 CPUFUNC(op_3130_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10409,9 +9605,7 @@ void REGPARAM2 CPUFUNC(op_3138_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10427,9 +9621,7 @@ void REGPARAM2 CPUFUNC(op_3139_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10446,9 +9638,7 @@ void REGPARAM2 CPUFUNC(op_313a_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10468,9 +9658,7 @@ void REGPARAM2 CPUFUNC(op_313b_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10484,9 +9672,7 @@ void REGPARAM2 CPUFUNC(op_313c_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10500,9 +9686,7 @@ void REGPARAM2 CPUFUNC(op_3140_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10516,9 +9700,7 @@ void REGPARAM2 CPUFUNC(op_3148_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10533,9 +9715,7 @@ void REGPARAM2 CPUFUNC(op_3150_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10551,9 +9731,7 @@ void REGPARAM2 CPUFUNC(op_3158_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10570,9 +9748,7 @@ void REGPARAM2 CPUFUNC(op_3160_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10587,9 +9763,7 @@ void REGPARAM2 CPUFUNC(op_3168_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10606,9 +9780,7 @@ void REGPARAM2 CPUFUNC(op_3170_21)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10622,9 +9794,7 @@ void REGPARAM2 CPUFUNC(op_3178_21)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10638,9 +9808,7 @@ void REGPARAM2 CPUFUNC(op_3179_21)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10655,9 +9823,7 @@ void REGPARAM2 CPUFUNC(op_317a_21)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10675,9 +9841,7 @@ void REGPARAM2 CPUFUNC(op_317b_21)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10690,9 +9854,7 @@ void REGPARAM2 CPUFUNC(op_317c_21)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10708,9 +9870,7 @@ void REGPARAM2 CPUFUNC(op_3180_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10725,9 +9885,7 @@ void REGPARAM2 CPUFUNC(op_3188_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10743,9 +9901,7 @@ void REGPARAM2 CPUFUNC(op_3190_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10762,9 +9918,7 @@ void REGPARAM2 CPUFUNC(op_3198_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10782,9 +9936,7 @@ void REGPARAM2 CPUFUNC(op_31a0_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10800,9 +9952,7 @@ void REGPARAM2 CPUFUNC(op_31a8_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10819,9 +9969,7 @@ void REGPARAM2 CPUFUNC(op_31b0_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10836,9 +9984,7 @@ void REGPARAM2 CPUFUNC(op_31b8_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10853,9 +9999,7 @@ void REGPARAM2 CPUFUNC(op_31b9_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (6);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10871,9 +10015,7 @@ void REGPARAM2 CPUFUNC(op_31ba_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10891,9 +10033,7 @@ void REGPARAM2 CPUFUNC(op_31bb_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10907,9 +10047,7 @@ void REGPARAM2 CPUFUNC(op_31bc_21)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10921,9 +10059,7 @@ void REGPARAM2 CPUFUNC(op_31c0_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10936,9 +10072,7 @@ void REGPARAM2 CPUFUNC(op_31c8_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10952,9 +10086,7 @@ void REGPARAM2 CPUFUNC(op_31d0_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10969,9 +10101,7 @@ void REGPARAM2 CPUFUNC(op_31d8_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10987,9 +10117,7 @@ void REGPARAM2 CPUFUNC(op_31e0_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11003,9 +10131,7 @@ void REGPARAM2 CPUFUNC(op_31e8_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11021,9 +10147,7 @@ void REGPARAM2 CPUFUNC(op_31f0_21)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11036,9 +10160,7 @@ void REGPARAM2 CPUFUNC(op_31f8_21)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11051,9 +10173,7 @@ void REGPARAM2 CPUFUNC(op_31f9_21)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11067,9 +10187,7 @@ void REGPARAM2 CPUFUNC(op_31fa_21)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11086,9 +10204,7 @@ void REGPARAM2 CPUFUNC(op_31fb_21)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11100,9 +10216,7 @@ void REGPARAM2 CPUFUNC(op_31fc_21)(uae_u32 opcode)
 {
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11115,9 +10229,7 @@ void REGPARAM2 CPUFUNC(op_33c0_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11130,9 +10242,7 @@ void REGPARAM2 CPUFUNC(op_33c8_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11146,9 +10256,7 @@ void REGPARAM2 CPUFUNC(op_33d0_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11163,9 +10271,7 @@ void REGPARAM2 CPUFUNC(op_33d8_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11181,9 +10287,7 @@ void REGPARAM2 CPUFUNC(op_33e0_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11197,9 +10301,7 @@ void REGPARAM2 CPUFUNC(op_33e8_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11215,9 +10317,7 @@ void REGPARAM2 CPUFUNC(op_33f0_21)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11230,9 +10330,7 @@ void REGPARAM2 CPUFUNC(op_33f8_21)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11245,9 +10343,7 @@ void REGPARAM2 CPUFUNC(op_33f9_21)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (10);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11261,9 +10357,7 @@ void REGPARAM2 CPUFUNC(op_33fa_21)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11280,9 +10374,7 @@ void REGPARAM2 CPUFUNC(op_33fb_21)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11294,9 +10386,7 @@ void REGPARAM2 CPUFUNC(op_33fc_21)(uae_u32 opcode)
 {
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -12564,9 +11654,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4200_21)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+{{	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((0) & 0xff);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12578,9 +11666,7 @@ void REGPARAM2 CPUFUNC(op_4210_21)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12593,9 +11679,7 @@ void REGPARAM2 CPUFUNC(op_4218_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12609,9 +11693,7 @@ void REGPARAM2 CPUFUNC(op_4220_21)(uae_u32 opcode)
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12623,9 +11705,7 @@ void REGPARAM2 CPUFUNC(op_4228_21)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -12639,9 +11719,7 @@ void REGPARAM2 CPUFUNC(op_4230_21)(uae_u32 opcode)
 {{	uaecptr srca;
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -12651,9 +11729,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4238_21)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -12664,9 +11740,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4239_21)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -12677,9 +11751,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4240_21)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+{{	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((0) & 0xffff);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12691,9 +11763,7 @@ void REGPARAM2 CPUFUNC(op_4250_21)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12706,9 +11776,7 @@ void REGPARAM2 CPUFUNC(op_4258_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12722,9 +11790,7 @@ void REGPARAM2 CPUFUNC(op_4260_21)(uae_u32 opcode)
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - 2;
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12736,9 +11802,7 @@ void REGPARAM2 CPUFUNC(op_4268_21)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -12752,9 +11816,7 @@ void REGPARAM2 CPUFUNC(op_4270_21)(uae_u32 opcode)
 {{	uaecptr srca;
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -12764,9 +11826,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4278_21)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -12777,9 +11837,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4279_21)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -12790,9 +11848,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4280_21)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+{{	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12804,9 +11860,7 @@ void REGPARAM2 CPUFUNC(op_4290_21)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12819,9 +11873,7 @@ void REGPARAM2 CPUFUNC(op_4298_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12835,9 +11887,7 @@ void REGPARAM2 CPUFUNC(op_42a0_21)(uae_u32 opcode)
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - 4;
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12849,9 +11899,7 @@ void REGPARAM2 CPUFUNC(op_42a8_21)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -12865,9 +11913,7 @@ void REGPARAM2 CPUFUNC(op_42b0_21)(uae_u32 opcode)
 {{	uaecptr srca;
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -12877,9 +11923,7 @@ return;
 void REGPARAM2 CPUFUNC(op_42b8_21)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -12890,9 +11934,7 @@ return;
 void REGPARAM2 CPUFUNC(op_42b9_21)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -13024,11 +12066,9 @@ void REGPARAM2 CPUFUNC(op_4400_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13045,11 +12085,9 @@ void REGPARAM2 CPUFUNC(op_4410_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13067,11 +12105,9 @@ void REGPARAM2 CPUFUNC(op_4418_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13090,11 +12126,9 @@ void REGPARAM2 CPUFUNC(op_4420_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13111,11 +12145,9 @@ void REGPARAM2 CPUFUNC(op_4428_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13134,11 +12166,9 @@ void REGPARAM2 CPUFUNC(op_4430_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -13153,11 +12183,9 @@ void REGPARAM2 CPUFUNC(op_4438_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13173,11 +12201,9 @@ void REGPARAM2 CPUFUNC(op_4439_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -13193,11 +12219,9 @@ void REGPARAM2 CPUFUNC(op_4440_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13214,11 +12238,9 @@ void REGPARAM2 CPUFUNC(op_4450_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13236,11 +12258,9 @@ void REGPARAM2 CPUFUNC(op_4458_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13259,11 +12279,9 @@ void REGPARAM2 CPUFUNC(op_4460_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13280,11 +12298,9 @@ void REGPARAM2 CPUFUNC(op_4468_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13303,11 +12319,9 @@ void REGPARAM2 CPUFUNC(op_4470_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -13322,11 +12336,9 @@ void REGPARAM2 CPUFUNC(op_4478_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13342,11 +12354,9 @@ void REGPARAM2 CPUFUNC(op_4479_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -13362,11 +12372,9 @@ void REGPARAM2 CPUFUNC(op_4480_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (dst);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13383,11 +12391,9 @@ void REGPARAM2 CPUFUNC(op_4490_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13405,11 +12411,9 @@ void REGPARAM2 CPUFUNC(op_4498_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13428,11 +12432,9 @@ void REGPARAM2 CPUFUNC(op_44a0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13449,11 +12451,9 @@ void REGPARAM2 CPUFUNC(op_44a8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13472,11 +12472,9 @@ void REGPARAM2 CPUFUNC(op_44b0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -13491,11 +12489,9 @@ void REGPARAM2 CPUFUNC(op_44b8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13511,11 +12507,9 @@ void REGPARAM2 CPUFUNC(op_44b9_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -13694,9 +12688,7 @@ void REGPARAM2 CPUFUNC(op_4600_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13710,9 +12702,7 @@ void REGPARAM2 CPUFUNC(op_4610_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13727,9 +12717,7 @@ void REGPARAM2 CPUFUNC(op_4618_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13745,9 +12733,7 @@ void REGPARAM2 CPUFUNC(op_4620_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13761,9 +12747,7 @@ void REGPARAM2 CPUFUNC(op_4628_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13779,9 +12763,7 @@ void REGPARAM2 CPUFUNC(op_4630_21)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -13793,9 +12775,7 @@ void REGPARAM2 CPUFUNC(op_4638_21)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13808,9 +12788,7 @@ void REGPARAM2 CPUFUNC(op_4639_21)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -13823,9 +12801,7 @@ void REGPARAM2 CPUFUNC(op_4640_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13839,9 +12815,7 @@ void REGPARAM2 CPUFUNC(op_4650_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13856,9 +12830,7 @@ void REGPARAM2 CPUFUNC(op_4658_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13874,9 +12846,7 @@ void REGPARAM2 CPUFUNC(op_4660_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13890,9 +12860,7 @@ void REGPARAM2 CPUFUNC(op_4668_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13908,9 +12876,7 @@ void REGPARAM2 CPUFUNC(op_4670_21)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -13922,9 +12888,7 @@ void REGPARAM2 CPUFUNC(op_4678_21)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13937,9 +12901,7 @@ void REGPARAM2 CPUFUNC(op_4679_21)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -13952,9 +12914,7 @@ void REGPARAM2 CPUFUNC(op_4680_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13968,9 +12928,7 @@ void REGPARAM2 CPUFUNC(op_4690_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13985,9 +12943,7 @@ void REGPARAM2 CPUFUNC(op_4698_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -14003,9 +12959,7 @@ void REGPARAM2 CPUFUNC(op_46a0_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -14019,9 +12973,7 @@ void REGPARAM2 CPUFUNC(op_46a8_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -14037,9 +12989,7 @@ void REGPARAM2 CPUFUNC(op_46b0_21)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -14051,9 +13001,7 @@ void REGPARAM2 CPUFUNC(op_46b8_21)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -14066,9 +13014,7 @@ void REGPARAM2 CPUFUNC(op_46b9_21)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -14451,9 +13397,7 @@ void REGPARAM2 CPUFUNC(op_4840_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -14577,9 +13521,7 @@ void REGPARAM2 CPUFUNC(op_4880_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u16 dst = (uae_s16)(uae_s8)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -14683,9 +13625,7 @@ void REGPARAM2 CPUFUNC(op_48c0_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -14790,9 +13730,7 @@ void REGPARAM2 CPUFUNC(op_49c0_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s8)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -14805,9 +13743,7 @@ void REGPARAM2 CPUFUNC(op_4a00_21)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -14819,9 +13755,7 @@ void REGPARAM2 CPUFUNC(op_4a10_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -14834,9 +13768,7 @@ void REGPARAM2 CPUFUNC(op_4a18_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -14850,9 +13782,7 @@ void REGPARAM2 CPUFUNC(op_4a20_21)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -14864,9 +13794,7 @@ void REGPARAM2 CPUFUNC(op_4a28_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -14880,9 +13808,7 @@ void REGPARAM2 CPUFUNC(op_4a30_21)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -14892,9 +13818,7 @@ void REGPARAM2 CPUFUNC(op_4a38_21)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -14905,9 +13829,7 @@ void REGPARAM2 CPUFUNC(op_4a39_21)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -14920,9 +13842,7 @@ void REGPARAM2 CPUFUNC(op_4a3a_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -14939,9 +13859,7 @@ void REGPARAM2 CPUFUNC(op_4a3b_21)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -14951,9 +13869,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4a3c_21)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -14964,9 +13880,7 @@ void REGPARAM2 CPUFUNC(op_4a40_21)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -14978,9 +13892,7 @@ void REGPARAM2 CPUFUNC(op_4a48_21)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -14993,9 +13905,7 @@ void REGPARAM2 CPUFUNC(op_4a50_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15008,9 +13918,7 @@ void REGPARAM2 CPUFUNC(op_4a58_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15024,9 +13932,7 @@ void REGPARAM2 CPUFUNC(op_4a60_21)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - 2;
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15038,9 +13944,7 @@ void REGPARAM2 CPUFUNC(op_4a68_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -15054,9 +13958,7 @@ void REGPARAM2 CPUFUNC(op_4a70_21)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -15066,9 +13968,7 @@ void REGPARAM2 CPUFUNC(op_4a78_21)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -15079,9 +13979,7 @@ void REGPARAM2 CPUFUNC(op_4a79_21)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -15094,9 +13992,7 @@ void REGPARAM2 CPUFUNC(op_4a7a_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -15113,9 +14009,7 @@ void REGPARAM2 CPUFUNC(op_4a7b_21)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -15125,9 +14019,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4a7c_21)(uae_u32 opcode)
 {
 {{	uae_s16 src = get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -15138,9 +14030,7 @@ void REGPARAM2 CPUFUNC(op_4a80_21)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15152,9 +14042,7 @@ void REGPARAM2 CPUFUNC(op_4a88_21)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15167,9 +14055,7 @@ void REGPARAM2 CPUFUNC(op_4a90_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15182,9 +14068,7 @@ void REGPARAM2 CPUFUNC(op_4a98_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15198,9 +14082,7 @@ void REGPARAM2 CPUFUNC(op_4aa0_21)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - 4;
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15212,9 +14094,7 @@ void REGPARAM2 CPUFUNC(op_4aa8_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -15228,9 +14108,7 @@ void REGPARAM2 CPUFUNC(op_4ab0_21)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -15240,9 +14118,7 @@ void REGPARAM2 CPUFUNC(op_4ab8_21)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -15253,9 +14129,7 @@ void REGPARAM2 CPUFUNC(op_4ab9_21)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -15268,9 +14142,7 @@ void REGPARAM2 CPUFUNC(op_4aba_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -15287,9 +14159,7 @@ void REGPARAM2 CPUFUNC(op_4abb_21)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -15299,9 +14169,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4abc_21)(uae_u32 opcode)
 {
 {{	uae_s32 src = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -15312,9 +14180,7 @@ void REGPARAM2 CPUFUNC(op_4ac0_21)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((src) & 0xff);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -15328,9 +14194,7 @@ void REGPARAM2 CPUFUNC(op_4ad0_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -15345,9 +14209,7 @@ void REGPARAM2 CPUFUNC(op_4ad8_21)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -15363,9 +14225,7 @@ void REGPARAM2 CPUFUNC(op_4ae0_21)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -15379,9 +14239,7 @@ void REGPARAM2 CPUFUNC(op_4ae8_21)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -15397,9 +14255,7 @@ void REGPARAM2 CPUFUNC(op_4af0_21)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -15411,9 +14267,7 @@ void REGPARAM2 CPUFUNC(op_4af8_21)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -15426,9 +14280,7 @@ void REGPARAM2 CPUFUNC(op_4af9_21)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -16495,11 +15347,9 @@ void REGPARAM2 CPUFUNC(op_5000_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16518,11 +15368,9 @@ void REGPARAM2 CPUFUNC(op_5010_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16542,11 +15390,9 @@ void REGPARAM2 CPUFUNC(op_5018_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16567,11 +15413,9 @@ void REGPARAM2 CPUFUNC(op_5020_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16590,11 +15434,9 @@ void REGPARAM2 CPUFUNC(op_5028_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -16615,11 +15457,9 @@ void REGPARAM2 CPUFUNC(op_5030_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -16636,11 +15476,9 @@ void REGPARAM2 CPUFUNC(op_5038_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -16658,11 +15496,9 @@ void REGPARAM2 CPUFUNC(op_5039_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -16680,11 +15516,9 @@ void REGPARAM2 CPUFUNC(op_5040_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16717,11 +15551,9 @@ void REGPARAM2 CPUFUNC(op_5050_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16741,11 +15573,9 @@ void REGPARAM2 CPUFUNC(op_5058_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16766,11 +15596,9 @@ void REGPARAM2 CPUFUNC(op_5060_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16789,11 +15617,9 @@ void REGPARAM2 CPUFUNC(op_5068_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -16814,11 +15640,9 @@ void REGPARAM2 CPUFUNC(op_5070_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -16838,11 +15662,9 @@ void REGPARAM2 CPUFUNC(op_5078_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -16860,11 +15682,9 @@ void REGPARAM2 CPUFUNC(op_5079_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -16882,11 +15702,9 @@ void REGPARAM2 CPUFUNC(op_5080_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16919,11 +15737,9 @@ void REGPARAM2 CPUFUNC(op_5090_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16943,11 +15759,9 @@ void REGPARAM2 CPUFUNC(op_5098_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16968,11 +15782,9 @@ void REGPARAM2 CPUFUNC(op_50a0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16991,11 +15803,9 @@ void REGPARAM2 CPUFUNC(op_50a8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -17016,11 +15826,9 @@ void REGPARAM2 CPUFUNC(op_50b0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -17037,11 +15845,9 @@ void REGPARAM2 CPUFUNC(op_50b8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -17059,11 +15865,9 @@ void REGPARAM2 CPUFUNC(op_50b9_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -17243,11 +16047,9 @@ void REGPARAM2 CPUFUNC(op_5100_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17266,11 +16068,9 @@ void REGPARAM2 CPUFUNC(op_5110_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17290,11 +16090,9 @@ void REGPARAM2 CPUFUNC(op_5118_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17315,11 +16113,9 @@ void REGPARAM2 CPUFUNC(op_5120_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17338,11 +16134,9 @@ void REGPARAM2 CPUFUNC(op_5128_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -17363,11 +16157,9 @@ void REGPARAM2 CPUFUNC(op_5130_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -17384,11 +16176,9 @@ void REGPARAM2 CPUFUNC(op_5138_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -17406,11 +16196,9 @@ void REGPARAM2 CPUFUNC(op_5139_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -17428,11 +16216,9 @@ void REGPARAM2 CPUFUNC(op_5140_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17465,11 +16251,9 @@ void REGPARAM2 CPUFUNC(op_5150_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17489,11 +16273,9 @@ void REGPARAM2 CPUFUNC(op_5158_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17514,11 +16296,9 @@ void REGPARAM2 CPUFUNC(op_5160_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17537,11 +16317,9 @@ void REGPARAM2 CPUFUNC(op_5168_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -17562,11 +16340,9 @@ void REGPARAM2 CPUFUNC(op_5170_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -17583,11 +16359,9 @@ void REGPARAM2 CPUFUNC(op_5178_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -17605,11 +16379,9 @@ void REGPARAM2 CPUFUNC(op_5179_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -17627,11 +16399,9 @@ void REGPARAM2 CPUFUNC(op_5180_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17664,11 +16434,9 @@ void REGPARAM2 CPUFUNC(op_5190_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17688,11 +16456,9 @@ void REGPARAM2 CPUFUNC(op_5198_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17713,11 +16479,9 @@ void REGPARAM2 CPUFUNC(op_51a0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17736,11 +16500,9 @@ void REGPARAM2 CPUFUNC(op_51a8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -17761,11 +16523,9 @@ void REGPARAM2 CPUFUNC(op_51b0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -17782,11 +16542,9 @@ void REGPARAM2 CPUFUNC(op_51b8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -17804,11 +16562,9 @@ void REGPARAM2 CPUFUNC(op_51b9_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -21128,9 +19884,7 @@ void REGPARAM2 CPUFUNC(op_7000_21)(uae_u32 opcode)
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_u32 src = srcreg;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -21145,9 +19899,7 @@ void REGPARAM2 CPUFUNC(op_8000_21)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21163,9 +19915,7 @@ void REGPARAM2 CPUFUNC(op_8010_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21182,9 +19932,7 @@ void REGPARAM2 CPUFUNC(op_8018_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21202,9 +19950,7 @@ void REGPARAM2 CPUFUNC(op_8020_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21220,9 +19966,7 @@ void REGPARAM2 CPUFUNC(op_8028_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21240,9 +19984,7 @@ void REGPARAM2 CPUFUNC(op_8030_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -21256,9 +19998,7 @@ void REGPARAM2 CPUFUNC(op_8038_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21273,9 +20013,7 @@ void REGPARAM2 CPUFUNC(op_8039_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -21291,9 +20029,7 @@ void REGPARAM2 CPUFUNC(op_803a_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21312,9 +20048,7 @@ void REGPARAM2 CPUFUNC(op_803b_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -21327,9 +20061,7 @@ void REGPARAM2 CPUFUNC(op_803c_21)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21344,9 +20076,7 @@ void REGPARAM2 CPUFUNC(op_8040_21)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21362,9 +20092,7 @@ void REGPARAM2 CPUFUNC(op_8050_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21381,9 +20109,7 @@ void REGPARAM2 CPUFUNC(op_8058_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21401,9 +20127,7 @@ void REGPARAM2 CPUFUNC(op_8060_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21419,9 +20143,7 @@ void REGPARAM2 CPUFUNC(op_8068_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21439,9 +20161,7 @@ void REGPARAM2 CPUFUNC(op_8070_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -21455,9 +20175,7 @@ void REGPARAM2 CPUFUNC(op_8078_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21472,9 +20190,7 @@ void REGPARAM2 CPUFUNC(op_8079_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -21490,9 +20206,7 @@ void REGPARAM2 CPUFUNC(op_807a_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21511,9 +20225,7 @@ void REGPARAM2 CPUFUNC(op_807b_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -21526,9 +20238,7 @@ void REGPARAM2 CPUFUNC(op_807c_21)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21543,9 +20253,7 @@ void REGPARAM2 CPUFUNC(op_8080_21)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21561,9 +20269,7 @@ void REGPARAM2 CPUFUNC(op_8090_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21580,9 +20286,7 @@ void REGPARAM2 CPUFUNC(op_8098_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21600,9 +20304,7 @@ void REGPARAM2 CPUFUNC(op_80a0_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21618,9 +20320,7 @@ void REGPARAM2 CPUFUNC(op_80a8_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21638,9 +20338,7 @@ void REGPARAM2 CPUFUNC(op_80b0_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -21654,9 +20352,7 @@ void REGPARAM2 CPUFUNC(op_80b8_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21671,9 +20367,7 @@ void REGPARAM2 CPUFUNC(op_80b9_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -21689,9 +20383,7 @@ void REGPARAM2 CPUFUNC(op_80ba_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21710,9 +20402,7 @@ void REGPARAM2 CPUFUNC(op_80bb_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -21725,9 +20415,7 @@ void REGPARAM2 CPUFUNC(op_80bc_21)(uae_u32 opcode)
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -21756,9 +20444,7 @@ void REGPARAM2 CPUFUNC(op_80c0_21)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21791,9 +20477,7 @@ void REGPARAM2 CPUFUNC(op_80d0_21)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21827,9 +20511,7 @@ void REGPARAM2 CPUFUNC(op_80d8_21)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21864,9 +20546,7 @@ void REGPARAM2 CPUFUNC(op_80e0_21)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21899,9 +20579,7 @@ void REGPARAM2 CPUFUNC(op_80e8_21)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21936,9 +20614,7 @@ void REGPARAM2 CPUFUNC(op_80f0_21)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21969,9 +20645,7 @@ void REGPARAM2 CPUFUNC(op_80f8_21)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22003,9 +20677,7 @@ void REGPARAM2 CPUFUNC(op_80f9_21)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22038,9 +20710,7 @@ void REGPARAM2 CPUFUNC(op_80fa_21)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22076,9 +20746,7 @@ void REGPARAM2 CPUFUNC(op_80fb_21)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22108,9 +20776,7 @@ void REGPARAM2 CPUFUNC(op_80fc_21)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22185,9 +20851,7 @@ void REGPARAM2 CPUFUNC(op_8110_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22204,9 +20868,7 @@ void REGPARAM2 CPUFUNC(op_8118_21)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22224,9 +20886,7 @@ void REGPARAM2 CPUFUNC(op_8120_21)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22242,9 +20902,7 @@ void REGPARAM2 CPUFUNC(op_8128_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -22262,9 +20920,7 @@ void REGPARAM2 CPUFUNC(op_8130_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -22278,9 +20934,7 @@ void REGPARAM2 CPUFUNC(op_8138_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -22295,9 +20949,7 @@ void REGPARAM2 CPUFUNC(op_8139_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -22346,9 +20998,7 @@ void REGPARAM2 CPUFUNC(op_8150_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22365,9 +21015,7 @@ void REGPARAM2 CPUFUNC(op_8158_21)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22385,9 +21033,7 @@ void REGPARAM2 CPUFUNC(op_8160_21)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22403,9 +21049,7 @@ void REGPARAM2 CPUFUNC(op_8168_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -22423,9 +21067,7 @@ void REGPARAM2 CPUFUNC(op_8170_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -22439,9 +21081,7 @@ void REGPARAM2 CPUFUNC(op_8178_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -22456,9 +21096,7 @@ void REGPARAM2 CPUFUNC(op_8179_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -22508,9 +21146,7 @@ void REGPARAM2 CPUFUNC(op_8190_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22527,9 +21163,7 @@ void REGPARAM2 CPUFUNC(op_8198_21)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22547,9 +21181,7 @@ void REGPARAM2 CPUFUNC(op_81a0_21)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22565,9 +21197,7 @@ void REGPARAM2 CPUFUNC(op_81a8_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -22585,9 +21215,7 @@ void REGPARAM2 CPUFUNC(op_81b0_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -22601,9 +21229,7 @@ void REGPARAM2 CPUFUNC(op_81b8_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -22618,9 +21244,7 @@ void REGPARAM2 CPUFUNC(op_81b9_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -22650,9 +21274,7 @@ void REGPARAM2 CPUFUNC(op_81c0_21)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22686,9 +21308,7 @@ void REGPARAM2 CPUFUNC(op_81d0_21)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22723,9 +21343,7 @@ void REGPARAM2 CPUFUNC(op_81d8_21)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22761,9 +21379,7 @@ void REGPARAM2 CPUFUNC(op_81e0_21)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22797,9 +21413,7 @@ void REGPARAM2 CPUFUNC(op_81e8_21)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22835,9 +21449,7 @@ void REGPARAM2 CPUFUNC(op_81f0_21)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22869,9 +21481,7 @@ void REGPARAM2 CPUFUNC(op_81f8_21)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22904,9 +21514,7 @@ void REGPARAM2 CPUFUNC(op_81f9_21)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22940,9 +21548,7 @@ void REGPARAM2 CPUFUNC(op_81fa_21)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22979,9 +21585,7 @@ void REGPARAM2 CPUFUNC(op_81fb_21)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -23012,9 +21616,7 @@ void REGPARAM2 CPUFUNC(op_81fc_21)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -23035,11 +21637,9 @@ void REGPARAM2 CPUFUNC(op_9000_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23058,11 +21658,9 @@ void REGPARAM2 CPUFUNC(op_9010_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23082,11 +21680,9 @@ void REGPARAM2 CPUFUNC(op_9018_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23107,11 +21703,9 @@ void REGPARAM2 CPUFUNC(op_9020_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23130,11 +21724,9 @@ void REGPARAM2 CPUFUNC(op_9028_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23155,11 +21747,9 @@ void REGPARAM2 CPUFUNC(op_9030_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -23176,11 +21766,9 @@ void REGPARAM2 CPUFUNC(op_9038_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23198,11 +21786,9 @@ void REGPARAM2 CPUFUNC(op_9039_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -23221,11 +21807,9 @@ void REGPARAM2 CPUFUNC(op_903a_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23247,11 +21831,9 @@ void REGPARAM2 CPUFUNC(op_903b_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -23267,11 +21849,9 @@ void REGPARAM2 CPUFUNC(op_903c_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23289,11 +21869,9 @@ void REGPARAM2 CPUFUNC(op_9040_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23311,11 +21889,9 @@ void REGPARAM2 CPUFUNC(op_9048_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23334,11 +21910,9 @@ void REGPARAM2 CPUFUNC(op_9050_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23358,11 +21932,9 @@ void REGPARAM2 CPUFUNC(op_9058_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23383,11 +21955,9 @@ void REGPARAM2 CPUFUNC(op_9060_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23406,11 +21976,9 @@ void REGPARAM2 CPUFUNC(op_9068_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23431,11 +21999,9 @@ void REGPARAM2 CPUFUNC(op_9070_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -23452,11 +22018,9 @@ void REGPARAM2 CPUFUNC(op_9078_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23474,11 +22038,9 @@ void REGPARAM2 CPUFUNC(op_9079_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -23497,11 +22059,9 @@ void REGPARAM2 CPUFUNC(op_907a_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23523,11 +22083,9 @@ void REGPARAM2 CPUFUNC(op_907b_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -23543,11 +22101,9 @@ void REGPARAM2 CPUFUNC(op_907c_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23565,11 +22121,9 @@ void REGPARAM2 CPUFUNC(op_9080_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23587,11 +22141,9 @@ void REGPARAM2 CPUFUNC(op_9088_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23610,11 +22162,9 @@ void REGPARAM2 CPUFUNC(op_9090_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23634,11 +22184,9 @@ void REGPARAM2 CPUFUNC(op_9098_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23659,11 +22207,9 @@ void REGPARAM2 CPUFUNC(op_90a0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23682,11 +22228,9 @@ void REGPARAM2 CPUFUNC(op_90a8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23707,11 +22251,9 @@ void REGPARAM2 CPUFUNC(op_90b0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -23728,11 +22270,9 @@ void REGPARAM2 CPUFUNC(op_90b8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23750,11 +22290,9 @@ void REGPARAM2 CPUFUNC(op_90b9_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -23773,11 +22311,9 @@ void REGPARAM2 CPUFUNC(op_90ba_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23799,11 +22335,9 @@ void REGPARAM2 CPUFUNC(op_90bb_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -23819,11 +22353,9 @@ void REGPARAM2 CPUFUNC(op_90bc_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -24072,11 +22604,9 @@ void REGPARAM2 CPUFUNC(op_9110_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24096,11 +22626,9 @@ void REGPARAM2 CPUFUNC(op_9118_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24121,11 +22649,9 @@ void REGPARAM2 CPUFUNC(op_9120_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24144,11 +22670,9 @@ void REGPARAM2 CPUFUNC(op_9128_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -24169,11 +22693,9 @@ void REGPARAM2 CPUFUNC(op_9130_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -24190,11 +22712,9 @@ void REGPARAM2 CPUFUNC(op_9138_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -24212,11 +22732,9 @@ void REGPARAM2 CPUFUNC(op_9139_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -24285,11 +22803,9 @@ void REGPARAM2 CPUFUNC(op_9150_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24309,11 +22825,9 @@ void REGPARAM2 CPUFUNC(op_9158_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24334,11 +22848,9 @@ void REGPARAM2 CPUFUNC(op_9160_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24357,11 +22869,9 @@ void REGPARAM2 CPUFUNC(op_9168_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -24382,11 +22892,9 @@ void REGPARAM2 CPUFUNC(op_9170_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -24403,11 +22911,9 @@ void REGPARAM2 CPUFUNC(op_9178_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -24425,11 +22931,9 @@ void REGPARAM2 CPUFUNC(op_9179_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -24498,11 +23002,9 @@ void REGPARAM2 CPUFUNC(op_9190_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24522,11 +23024,9 @@ void REGPARAM2 CPUFUNC(op_9198_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24547,11 +23047,9 @@ void REGPARAM2 CPUFUNC(op_91a0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24570,11 +23068,9 @@ void REGPARAM2 CPUFUNC(op_91a8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -24595,11 +23091,9 @@ void REGPARAM2 CPUFUNC(op_91b0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -24616,11 +23110,9 @@ void REGPARAM2 CPUFUNC(op_91b8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -24638,11 +23130,9 @@ void REGPARAM2 CPUFUNC(op_91b9_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -24840,10 +23330,8 @@ void REGPARAM2 CPUFUNC(op_b000_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -24861,10 +23349,8 @@ void REGPARAM2 CPUFUNC(op_b010_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -24883,10 +23369,8 @@ void REGPARAM2 CPUFUNC(op_b018_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -24906,10 +23390,8 @@ void REGPARAM2 CPUFUNC(op_b020_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -24927,10 +23409,8 @@ void REGPARAM2 CPUFUNC(op_b028_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -24950,10 +23430,8 @@ void REGPARAM2 CPUFUNC(op_b030_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -24969,10 +23447,8 @@ void REGPARAM2 CPUFUNC(op_b038_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -24989,10 +23465,8 @@ void REGPARAM2 CPUFUNC(op_b039_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -25010,10 +23484,8 @@ void REGPARAM2 CPUFUNC(op_b03a_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25034,10 +23506,8 @@ void REGPARAM2 CPUFUNC(op_b03b_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -25052,10 +23522,8 @@ void REGPARAM2 CPUFUNC(op_b03c_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25072,10 +23540,8 @@ void REGPARAM2 CPUFUNC(op_b040_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25092,10 +23558,8 @@ void REGPARAM2 CPUFUNC(op_b048_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25113,10 +23577,8 @@ void REGPARAM2 CPUFUNC(op_b050_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25135,10 +23597,8 @@ void REGPARAM2 CPUFUNC(op_b058_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25158,10 +23618,8 @@ void REGPARAM2 CPUFUNC(op_b060_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25179,10 +23637,8 @@ void REGPARAM2 CPUFUNC(op_b068_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25202,10 +23658,8 @@ void REGPARAM2 CPUFUNC(op_b070_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -25221,10 +23675,8 @@ void REGPARAM2 CPUFUNC(op_b078_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25241,10 +23693,8 @@ void REGPARAM2 CPUFUNC(op_b079_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -25262,10 +23712,8 @@ void REGPARAM2 CPUFUNC(op_b07a_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25286,10 +23734,8 @@ void REGPARAM2 CPUFUNC(op_b07b_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -25304,10 +23750,8 @@ void REGPARAM2 CPUFUNC(op_b07c_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25324,10 +23768,8 @@ void REGPARAM2 CPUFUNC(op_b080_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25344,10 +23786,8 @@ void REGPARAM2 CPUFUNC(op_b088_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25368,10 +23808,8 @@ void REGPARAM2 CPUFUNC(op_b090_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25390,10 +23828,8 @@ void REGPARAM2 CPUFUNC(op_b098_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25413,10 +23849,8 @@ void REGPARAM2 CPUFUNC(op_b0a0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25434,10 +23868,8 @@ void REGPARAM2 CPUFUNC(op_b0a8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25457,10 +23889,8 @@ void REGPARAM2 CPUFUNC(op_b0b0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -25476,10 +23906,8 @@ void REGPARAM2 CPUFUNC(op_b0b8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25496,10 +23924,8 @@ void REGPARAM2 CPUFUNC(op_b0b9_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -25517,10 +23943,8 @@ void REGPARAM2 CPUFUNC(op_b0ba_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25541,10 +23965,8 @@ void REGPARAM2 CPUFUNC(op_b0bb_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -25559,10 +23981,8 @@ void REGPARAM2 CPUFUNC(op_b0bc_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -25579,10 +23999,8 @@ void REGPARAM2 CPUFUNC(op_b0c0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25599,10 +24017,8 @@ void REGPARAM2 CPUFUNC(op_b0c8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25620,10 +24036,8 @@ void REGPARAM2 CPUFUNC(op_b0d0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25642,10 +24056,8 @@ void REGPARAM2 CPUFUNC(op_b0d8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25665,10 +24077,8 @@ void REGPARAM2 CPUFUNC(op_b0e0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25686,10 +24096,8 @@ void REGPARAM2 CPUFUNC(op_b0e8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25709,10 +24117,8 @@ void REGPARAM2 CPUFUNC(op_b0f0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -25728,10 +24134,8 @@ void REGPARAM2 CPUFUNC(op_b0f8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25748,10 +24152,8 @@ void REGPARAM2 CPUFUNC(op_b0f9_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -25769,10 +24171,8 @@ void REGPARAM2 CPUFUNC(op_b0fa_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25793,10 +24193,8 @@ void REGPARAM2 CPUFUNC(op_b0fb_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -25811,10 +24209,8 @@ void REGPARAM2 CPUFUNC(op_b0fc_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25828,9 +24224,7 @@ void REGPARAM2 CPUFUNC(op_b100_21)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -25852,10 +24246,8 @@ void REGPARAM2 CPUFUNC(op_b108_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25870,9 +24262,7 @@ void REGPARAM2 CPUFUNC(op_b110_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -25889,9 +24279,7 @@ void REGPARAM2 CPUFUNC(op_b118_21)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -25909,9 +24297,7 @@ void REGPARAM2 CPUFUNC(op_b120_21)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -25927,9 +24313,7 @@ void REGPARAM2 CPUFUNC(op_b128_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -25947,9 +24331,7 @@ void REGPARAM2 CPUFUNC(op_b130_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -25963,9 +24345,7 @@ void REGPARAM2 CPUFUNC(op_b138_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -25980,9 +24360,7 @@ void REGPARAM2 CPUFUNC(op_b139_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -25997,9 +24375,7 @@ void REGPARAM2 CPUFUNC(op_b140_21)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26021,10 +24397,8 @@ void REGPARAM2 CPUFUNC(op_b148_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -26039,9 +24413,7 @@ void REGPARAM2 CPUFUNC(op_b150_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26058,9 +24430,7 @@ void REGPARAM2 CPUFUNC(op_b158_21)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26078,9 +24448,7 @@ void REGPARAM2 CPUFUNC(op_b160_21)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26096,9 +24464,7 @@ void REGPARAM2 CPUFUNC(op_b168_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26116,9 +24482,7 @@ void REGPARAM2 CPUFUNC(op_b170_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -26132,9 +24496,7 @@ void REGPARAM2 CPUFUNC(op_b178_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26149,9 +24511,7 @@ void REGPARAM2 CPUFUNC(op_b179_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -26166,9 +24526,7 @@ void REGPARAM2 CPUFUNC(op_b180_21)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26190,10 +24548,8 @@ void REGPARAM2 CPUFUNC(op_b188_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -26208,9 +24564,7 @@ void REGPARAM2 CPUFUNC(op_b190_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26227,9 +24581,7 @@ void REGPARAM2 CPUFUNC(op_b198_21)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26247,9 +24599,7 @@ void REGPARAM2 CPUFUNC(op_b1a0_21)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26265,9 +24615,7 @@ void REGPARAM2 CPUFUNC(op_b1a8_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26285,9 +24633,7 @@ void REGPARAM2 CPUFUNC(op_b1b0_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -26301,9 +24647,7 @@ void REGPARAM2 CPUFUNC(op_b1b8_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26318,9 +24662,7 @@ void REGPARAM2 CPUFUNC(op_b1b9_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -26338,10 +24680,8 @@ void REGPARAM2 CPUFUNC(op_b1c0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -26358,10 +24698,8 @@ void REGPARAM2 CPUFUNC(op_b1c8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -26379,10 +24717,8 @@ void REGPARAM2 CPUFUNC(op_b1d0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -26401,10 +24737,8 @@ void REGPARAM2 CPUFUNC(op_b1d8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -26424,10 +24758,8 @@ void REGPARAM2 CPUFUNC(op_b1e0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -26445,10 +24777,8 @@ void REGPARAM2 CPUFUNC(op_b1e8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -26468,10 +24798,8 @@ void REGPARAM2 CPUFUNC(op_b1f0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -26487,10 +24815,8 @@ void REGPARAM2 CPUFUNC(op_b1f8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -26507,10 +24833,8 @@ void REGPARAM2 CPUFUNC(op_b1f9_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -26528,10 +24852,8 @@ void REGPARAM2 CPUFUNC(op_b1fa_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -26552,10 +24874,8 @@ void REGPARAM2 CPUFUNC(op_b1fb_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -26570,10 +24890,8 @@ void REGPARAM2 CPUFUNC(op_b1fc_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -26587,9 +24905,7 @@ void REGPARAM2 CPUFUNC(op_c000_21)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26605,9 +24921,7 @@ void REGPARAM2 CPUFUNC(op_c010_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26624,9 +24938,7 @@ void REGPARAM2 CPUFUNC(op_c018_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26644,9 +24956,7 @@ void REGPARAM2 CPUFUNC(op_c020_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26662,9 +24972,7 @@ void REGPARAM2 CPUFUNC(op_c028_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26682,9 +24990,7 @@ void REGPARAM2 CPUFUNC(op_c030_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -26698,9 +25004,7 @@ void REGPARAM2 CPUFUNC(op_c038_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26715,9 +25019,7 @@ void REGPARAM2 CPUFUNC(op_c039_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -26733,9 +25035,7 @@ void REGPARAM2 CPUFUNC(op_c03a_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26754,9 +25054,7 @@ void REGPARAM2 CPUFUNC(op_c03b_21)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -26769,9 +25067,7 @@ void REGPARAM2 CPUFUNC(op_c03c_21)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26786,9 +25082,7 @@ void REGPARAM2 CPUFUNC(op_c040_21)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26804,9 +25098,7 @@ void REGPARAM2 CPUFUNC(op_c050_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26823,9 +25115,7 @@ void REGPARAM2 CPUFUNC(op_c058_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26843,9 +25133,7 @@ void REGPARAM2 CPUFUNC(op_c060_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26861,9 +25149,7 @@ void REGPARAM2 CPUFUNC(op_c068_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26881,9 +25167,7 @@ void REGPARAM2 CPUFUNC(op_c070_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -26897,9 +25181,7 @@ void REGPARAM2 CPUFUNC(op_c078_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26914,9 +25196,7 @@ void REGPARAM2 CPUFUNC(op_c079_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -26932,9 +25212,7 @@ void REGPARAM2 CPUFUNC(op_c07a_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26953,9 +25231,7 @@ void REGPARAM2 CPUFUNC(op_c07b_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -26968,9 +25244,7 @@ void REGPARAM2 CPUFUNC(op_c07c_21)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26985,9 +25259,7 @@ void REGPARAM2 CPUFUNC(op_c080_21)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27003,9 +25275,7 @@ void REGPARAM2 CPUFUNC(op_c090_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27022,9 +25292,7 @@ void REGPARAM2 CPUFUNC(op_c098_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27042,9 +25310,7 @@ void REGPARAM2 CPUFUNC(op_c0a0_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27060,9 +25326,7 @@ void REGPARAM2 CPUFUNC(op_c0a8_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27080,9 +25344,7 @@ void REGPARAM2 CPUFUNC(op_c0b0_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -27096,9 +25358,7 @@ void REGPARAM2 CPUFUNC(op_c0b8_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27113,9 +25373,7 @@ void REGPARAM2 CPUFUNC(op_c0b9_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -27131,9 +25389,7 @@ void REGPARAM2 CPUFUNC(op_c0ba_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27152,9 +25408,7 @@ void REGPARAM2 CPUFUNC(op_c0bb_21)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -27167,9 +25421,7 @@ void REGPARAM2 CPUFUNC(op_c0bc_21)(uae_u32 opcode)
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -27184,9 +25436,7 @@ void REGPARAM2 CPUFUNC(op_c0c0_21)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (2);
@@ -27202,9 +25452,7 @@ void REGPARAM2 CPUFUNC(op_c0d0_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (2);
@@ -27221,9 +25469,7 @@ void REGPARAM2 CPUFUNC(op_c0d8_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (2);
@@ -27241,9 +25487,7 @@ void REGPARAM2 CPUFUNC(op_c0e0_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (2);
@@ -27259,9 +25503,7 @@ void REGPARAM2 CPUFUNC(op_c0e8_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
@@ -27279,9 +25521,7 @@ void REGPARAM2 CPUFUNC(op_c0f0_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}return;
@@ -27295,9 +25535,7 @@ void REGPARAM2 CPUFUNC(op_c0f8_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
@@ -27312,9 +25550,7 @@ void REGPARAM2 CPUFUNC(op_c0f9_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (6);
@@ -27330,9 +25566,7 @@ void REGPARAM2 CPUFUNC(op_c0fa_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
@@ -27351,9 +25585,7 @@ void REGPARAM2 CPUFUNC(op_c0fb_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}return;
@@ -27366,9 +25598,7 @@ void REGPARAM2 CPUFUNC(op_c0fc_21)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
@@ -27440,9 +25670,7 @@ void REGPARAM2 CPUFUNC(op_c110_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27459,9 +25687,7 @@ void REGPARAM2 CPUFUNC(op_c118_21)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27479,9 +25705,7 @@ void REGPARAM2 CPUFUNC(op_c120_21)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27497,9 +25721,7 @@ void REGPARAM2 CPUFUNC(op_c128_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27517,9 +25739,7 @@ void REGPARAM2 CPUFUNC(op_c130_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -27533,9 +25753,7 @@ void REGPARAM2 CPUFUNC(op_c138_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27550,9 +25768,7 @@ void REGPARAM2 CPUFUNC(op_c139_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -27596,9 +25812,7 @@ void REGPARAM2 CPUFUNC(op_c150_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27615,9 +25829,7 @@ void REGPARAM2 CPUFUNC(op_c158_21)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27635,9 +25847,7 @@ void REGPARAM2 CPUFUNC(op_c160_21)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27653,9 +25863,7 @@ void REGPARAM2 CPUFUNC(op_c168_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27673,9 +25881,7 @@ void REGPARAM2 CPUFUNC(op_c170_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -27689,9 +25895,7 @@ void REGPARAM2 CPUFUNC(op_c178_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27706,9 +25910,7 @@ void REGPARAM2 CPUFUNC(op_c179_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -27738,9 +25940,7 @@ void REGPARAM2 CPUFUNC(op_c190_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27757,9 +25957,7 @@ void REGPARAM2 CPUFUNC(op_c198_21)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27777,9 +25975,7 @@ void REGPARAM2 CPUFUNC(op_c1a0_21)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27795,9 +25991,7 @@ void REGPARAM2 CPUFUNC(op_c1a8_21)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27815,9 +26009,7 @@ void REGPARAM2 CPUFUNC(op_c1b0_21)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -27831,9 +26023,7 @@ void REGPARAM2 CPUFUNC(op_c1b8_21)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27848,9 +26038,7 @@ void REGPARAM2 CPUFUNC(op_c1b9_21)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -27865,9 +26053,7 @@ void REGPARAM2 CPUFUNC(op_c1c0_21)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}	m68k_incpc (2);
@@ -27883,9 +26069,7 @@ void REGPARAM2 CPUFUNC(op_c1d0_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (2);
@@ -27902,9 +26086,7 @@ void REGPARAM2 CPUFUNC(op_c1d8_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (2);
@@ -27922,9 +26104,7 @@ void REGPARAM2 CPUFUNC(op_c1e0_21)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (2);
@@ -27940,9 +26120,7 @@ void REGPARAM2 CPUFUNC(op_c1e8_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (4);
@@ -27960,9 +26138,7 @@ void REGPARAM2 CPUFUNC(op_c1f0_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}return;
@@ -27976,9 +26152,7 @@ void REGPARAM2 CPUFUNC(op_c1f8_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (4);
@@ -27993,9 +26167,7 @@ void REGPARAM2 CPUFUNC(op_c1f9_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (6);
@@ -28011,9 +26183,7 @@ void REGPARAM2 CPUFUNC(op_c1fa_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (4);
@@ -28032,9 +26202,7 @@ void REGPARAM2 CPUFUNC(op_c1fb_21)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}return;
@@ -28047,9 +26215,7 @@ void REGPARAM2 CPUFUNC(op_c1fc_21)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}	m68k_incpc (4);
@@ -28067,11 +26233,9 @@ void REGPARAM2 CPUFUNC(op_d000_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28090,11 +26254,9 @@ void REGPARAM2 CPUFUNC(op_d010_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28114,11 +26276,9 @@ void REGPARAM2 CPUFUNC(op_d018_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28139,11 +26299,9 @@ void REGPARAM2 CPUFUNC(op_d020_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28162,11 +26320,9 @@ void REGPARAM2 CPUFUNC(op_d028_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28187,11 +26343,9 @@ void REGPARAM2 CPUFUNC(op_d030_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -28208,11 +26362,9 @@ void REGPARAM2 CPUFUNC(op_d038_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28230,11 +26382,9 @@ void REGPARAM2 CPUFUNC(op_d039_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -28253,11 +26403,9 @@ void REGPARAM2 CPUFUNC(op_d03a_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28279,11 +26427,9 @@ void REGPARAM2 CPUFUNC(op_d03b_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -28299,11 +26445,9 @@ void REGPARAM2 CPUFUNC(op_d03c_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28321,11 +26465,9 @@ void REGPARAM2 CPUFUNC(op_d040_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28343,11 +26485,9 @@ void REGPARAM2 CPUFUNC(op_d048_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28366,11 +26506,9 @@ void REGPARAM2 CPUFUNC(op_d050_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28390,11 +26528,9 @@ void REGPARAM2 CPUFUNC(op_d058_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28415,11 +26551,9 @@ void REGPARAM2 CPUFUNC(op_d060_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28438,11 +26572,9 @@ void REGPARAM2 CPUFUNC(op_d068_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28463,11 +26595,9 @@ void REGPARAM2 CPUFUNC(op_d070_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -28484,11 +26614,9 @@ void REGPARAM2 CPUFUNC(op_d078_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28506,11 +26634,9 @@ void REGPARAM2 CPUFUNC(op_d079_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -28529,11 +26655,9 @@ void REGPARAM2 CPUFUNC(op_d07a_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28555,11 +26679,9 @@ void REGPARAM2 CPUFUNC(op_d07b_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -28575,11 +26697,9 @@ void REGPARAM2 CPUFUNC(op_d07c_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28597,11 +26717,9 @@ void REGPARAM2 CPUFUNC(op_d080_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28619,11 +26737,9 @@ void REGPARAM2 CPUFUNC(op_d088_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28642,11 +26758,9 @@ void REGPARAM2 CPUFUNC(op_d090_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28666,11 +26780,9 @@ void REGPARAM2 CPUFUNC(op_d098_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28691,11 +26803,9 @@ void REGPARAM2 CPUFUNC(op_d0a0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28714,11 +26824,9 @@ void REGPARAM2 CPUFUNC(op_d0a8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28739,11 +26847,9 @@ void REGPARAM2 CPUFUNC(op_d0b0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -28760,11 +26866,9 @@ void REGPARAM2 CPUFUNC(op_d0b8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28782,11 +26886,9 @@ void REGPARAM2 CPUFUNC(op_d0b9_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -28805,11 +26907,9 @@ void REGPARAM2 CPUFUNC(op_d0ba_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28831,11 +26931,9 @@ void REGPARAM2 CPUFUNC(op_d0bb_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -28851,11 +26949,9 @@ void REGPARAM2 CPUFUNC(op_d0bc_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -29104,11 +27200,9 @@ void REGPARAM2 CPUFUNC(op_d110_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29128,11 +27222,9 @@ void REGPARAM2 CPUFUNC(op_d118_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29153,11 +27245,9 @@ void REGPARAM2 CPUFUNC(op_d120_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29176,11 +27266,9 @@ void REGPARAM2 CPUFUNC(op_d128_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -29201,11 +27289,9 @@ void REGPARAM2 CPUFUNC(op_d130_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -29222,11 +27308,9 @@ void REGPARAM2 CPUFUNC(op_d138_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -29244,11 +27328,9 @@ void REGPARAM2 CPUFUNC(op_d139_21)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -29317,11 +27399,9 @@ void REGPARAM2 CPUFUNC(op_d150_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29341,11 +27421,9 @@ void REGPARAM2 CPUFUNC(op_d158_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29366,11 +27444,9 @@ void REGPARAM2 CPUFUNC(op_d160_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29389,11 +27465,9 @@ void REGPARAM2 CPUFUNC(op_d168_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -29414,11 +27488,9 @@ void REGPARAM2 CPUFUNC(op_d170_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -29435,11 +27507,9 @@ void REGPARAM2 CPUFUNC(op_d178_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -29457,11 +27527,9 @@ void REGPARAM2 CPUFUNC(op_d179_21)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -29530,11 +27598,9 @@ void REGPARAM2 CPUFUNC(op_d190_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29554,11 +27620,9 @@ void REGPARAM2 CPUFUNC(op_d198_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29579,11 +27643,9 @@ void REGPARAM2 CPUFUNC(op_d1a0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29602,11 +27664,9 @@ void REGPARAM2 CPUFUNC(op_d1a8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -29627,11 +27687,9 @@ void REGPARAM2 CPUFUNC(op_d1b0_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -29648,11 +27706,9 @@ void REGPARAM2 CPUFUNC(op_d1b8_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -29670,11 +27726,9 @@ void REGPARAM2 CPUFUNC(op_d1b9_21)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -30603,9 +28657,7 @@ void REGPARAM2 CPUFUNC(op_e0d0_21)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30625,9 +28677,7 @@ void REGPARAM2 CPUFUNC(op_e0d8_21)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30648,9 +28698,7 @@ void REGPARAM2 CPUFUNC(op_e0e0_21)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30669,9 +28717,7 @@ void REGPARAM2 CPUFUNC(op_e0e8_21)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30692,9 +28738,7 @@ void REGPARAM2 CPUFUNC(op_e0f0_21)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30711,9 +28755,7 @@ void REGPARAM2 CPUFUNC(op_e0f8_21)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30731,9 +28773,7 @@ void REGPARAM2 CPUFUNC(op_e0f9_21)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31478,9 +29518,7 @@ void REGPARAM2 CPUFUNC(op_e1d0_21)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -31502,9 +29540,7 @@ void REGPARAM2 CPUFUNC(op_e1d8_21)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -31527,9 +29563,7 @@ void REGPARAM2 CPUFUNC(op_e1e0_21)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -31550,9 +29584,7 @@ void REGPARAM2 CPUFUNC(op_e1e8_21)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -31575,9 +29607,7 @@ void REGPARAM2 CPUFUNC(op_e1f0_21)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -31596,9 +29626,7 @@ void REGPARAM2 CPUFUNC(op_e1f8_21)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -31618,9 +29646,7 @@ void REGPARAM2 CPUFUNC(op_e1f9_21)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -31640,9 +29666,7 @@ void REGPARAM2 CPUFUNC(op_e2d0_21)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31661,9 +29685,7 @@ void REGPARAM2 CPUFUNC(op_e2d8_21)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31683,9 +29705,7 @@ void REGPARAM2 CPUFUNC(op_e2e0_21)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31703,9 +29723,7 @@ void REGPARAM2 CPUFUNC(op_e2e8_21)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31725,9 +29743,7 @@ void REGPARAM2 CPUFUNC(op_e2f0_21)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31743,9 +29759,7 @@ void REGPARAM2 CPUFUNC(op_e2f8_21)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31762,9 +29776,7 @@ void REGPARAM2 CPUFUNC(op_e2f9_21)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31782,9 +29794,7 @@ void REGPARAM2 CPUFUNC(op_e3d0_21)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31803,9 +29813,7 @@ void REGPARAM2 CPUFUNC(op_e3d8_21)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31825,9 +29833,7 @@ void REGPARAM2 CPUFUNC(op_e3e0_21)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31845,9 +29851,7 @@ void REGPARAM2 CPUFUNC(op_e3e8_21)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31867,9 +29871,7 @@ void REGPARAM2 CPUFUNC(op_e3f0_21)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31885,9 +29887,7 @@ void REGPARAM2 CPUFUNC(op_e3f8_21)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31904,9 +29904,7 @@ void REGPARAM2 CPUFUNC(op_e3f9_21)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31925,9 +29923,7 @@ void REGPARAM2 CPUFUNC(op_e4d0_21)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31947,9 +29943,7 @@ void REGPARAM2 CPUFUNC(op_e4d8_21)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31970,9 +29964,7 @@ void REGPARAM2 CPUFUNC(op_e4e0_21)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31991,9 +29983,7 @@ void REGPARAM2 CPUFUNC(op_e4e8_21)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32014,9 +30004,7 @@ void REGPARAM2 CPUFUNC(op_e4f0_21)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32033,9 +30021,7 @@ void REGPARAM2 CPUFUNC(op_e4f8_21)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32053,9 +30039,7 @@ void REGPARAM2 CPUFUNC(op_e4f9_21)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32074,9 +30058,7 @@ void REGPARAM2 CPUFUNC(op_e5d0_21)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32096,9 +30078,7 @@ void REGPARAM2 CPUFUNC(op_e5d8_21)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32119,9 +30099,7 @@ void REGPARAM2 CPUFUNC(op_e5e0_21)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32140,9 +30118,7 @@ void REGPARAM2 CPUFUNC(op_e5e8_21)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32163,9 +30139,7 @@ void REGPARAM2 CPUFUNC(op_e5f0_21)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32182,9 +30156,7 @@ void REGPARAM2 CPUFUNC(op_e5f8_21)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32202,9 +30174,7 @@ void REGPARAM2 CPUFUNC(op_e5f9_21)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32223,9 +30193,7 @@ void REGPARAM2 CPUFUNC(op_e6d0_21)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32244,9 +30212,7 @@ void REGPARAM2 CPUFUNC(op_e6d8_21)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32266,9 +30232,7 @@ void REGPARAM2 CPUFUNC(op_e6e0_21)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32286,9 +30250,7 @@ void REGPARAM2 CPUFUNC(op_e6e8_21)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32308,9 +30270,7 @@ void REGPARAM2 CPUFUNC(op_e6f0_21)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32326,9 +30286,7 @@ void REGPARAM2 CPUFUNC(op_e6f8_21)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32345,9 +30303,7 @@ void REGPARAM2 CPUFUNC(op_e6f9_21)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32365,9 +30321,7 @@ void REGPARAM2 CPUFUNC(op_e7d0_21)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32386,9 +30340,7 @@ void REGPARAM2 CPUFUNC(op_e7d8_21)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32408,9 +30360,7 @@ void REGPARAM2 CPUFUNC(op_e7e0_21)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32428,9 +30378,7 @@ void REGPARAM2 CPUFUNC(op_e7e8_21)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32450,9 +30398,7 @@ void REGPARAM2 CPUFUNC(op_e7f0_21)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32468,9 +30414,7 @@ void REGPARAM2 CPUFUNC(op_e7f8_21)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32487,9 +30431,7 @@ void REGPARAM2 CPUFUNC(op_e7f9_21)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -34,9 +34,7 @@ void REGPARAM2 CPUFUNC(op_0000_22)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -51,9 +49,7 @@ void REGPARAM2 CPUFUNC(op_0010_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -69,9 +65,7 @@ void REGPARAM2 CPUFUNC(op_0018_22)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -88,9 +82,7 @@ void REGPARAM2 CPUFUNC(op_0020_22)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -105,9 +97,7 @@ void REGPARAM2 CPUFUNC(op_0028_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -124,9 +114,7 @@ void REGPARAM2 CPUFUNC(op_0030_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -139,9 +127,7 @@ void REGPARAM2 CPUFUNC(op_0038_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -155,9 +141,7 @@ void REGPARAM2 CPUFUNC(op_0039_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -184,9 +168,7 @@ void REGPARAM2 CPUFUNC(op_0040_22)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -201,9 +183,7 @@ void REGPARAM2 CPUFUNC(op_0050_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -219,9 +199,7 @@ void REGPARAM2 CPUFUNC(op_0058_22)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -238,9 +216,7 @@ void REGPARAM2 CPUFUNC(op_0060_22)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -255,9 +231,7 @@ void REGPARAM2 CPUFUNC(op_0068_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -274,9 +248,7 @@ void REGPARAM2 CPUFUNC(op_0070_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -289,9 +261,7 @@ void REGPARAM2 CPUFUNC(op_0078_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -305,9 +275,7 @@ void REGPARAM2 CPUFUNC(op_0079_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -335,9 +303,7 @@ void REGPARAM2 CPUFUNC(op_0080_22)(uae_u32 opcode)
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -352,9 +318,7 @@ void REGPARAM2 CPUFUNC(op_0090_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -370,9 +334,7 @@ void REGPARAM2 CPUFUNC(op_0098_22)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -389,9 +351,7 @@ void REGPARAM2 CPUFUNC(op_00a0_22)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -406,9 +366,7 @@ void REGPARAM2 CPUFUNC(op_00a8_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -425,9 +383,7 @@ void REGPARAM2 CPUFUNC(op_00b0_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -440,9 +396,7 @@ void REGPARAM2 CPUFUNC(op_00b8_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -456,9 +410,7 @@ void REGPARAM2 CPUFUNC(op_00b9_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (10);
@@ -1369,9 +1321,7 @@ void REGPARAM2 CPUFUNC(op_0200_22)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1386,9 +1336,7 @@ void REGPARAM2 CPUFUNC(op_0210_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1404,9 +1352,7 @@ void REGPARAM2 CPUFUNC(op_0218_22)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1423,9 +1369,7 @@ void REGPARAM2 CPUFUNC(op_0220_22)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1440,9 +1384,7 @@ void REGPARAM2 CPUFUNC(op_0228_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -1459,9 +1401,7 @@ void REGPARAM2 CPUFUNC(op_0230_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -1474,9 +1414,7 @@ void REGPARAM2 CPUFUNC(op_0238_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -1490,9 +1428,7 @@ void REGPARAM2 CPUFUNC(op_0239_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -1519,9 +1455,7 @@ void REGPARAM2 CPUFUNC(op_0240_22)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1536,9 +1470,7 @@ void REGPARAM2 CPUFUNC(op_0250_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1554,9 +1486,7 @@ void REGPARAM2 CPUFUNC(op_0258_22)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1573,9 +1503,7 @@ void REGPARAM2 CPUFUNC(op_0260_22)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1590,9 +1518,7 @@ void REGPARAM2 CPUFUNC(op_0268_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -1609,9 +1535,7 @@ void REGPARAM2 CPUFUNC(op_0270_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -1624,9 +1548,7 @@ void REGPARAM2 CPUFUNC(op_0278_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -1640,9 +1562,7 @@ void REGPARAM2 CPUFUNC(op_0279_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -1670,9 +1590,7 @@ void REGPARAM2 CPUFUNC(op_0280_22)(uae_u32 opcode)
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -1687,9 +1605,7 @@ void REGPARAM2 CPUFUNC(op_0290_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -1705,9 +1621,7 @@ void REGPARAM2 CPUFUNC(op_0298_22)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -1724,9 +1638,7 @@ void REGPARAM2 CPUFUNC(op_02a0_22)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -1741,9 +1653,7 @@ void REGPARAM2 CPUFUNC(op_02a8_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -1760,9 +1670,7 @@ void REGPARAM2 CPUFUNC(op_02b0_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -1775,9 +1683,7 @@ void REGPARAM2 CPUFUNC(op_02b8_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -1791,9 +1697,7 @@ void REGPARAM2 CPUFUNC(op_02b9_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (10);
@@ -1960,11 +1864,9 @@ void REGPARAM2 CPUFUNC(op_0400_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -1982,11 +1884,9 @@ void REGPARAM2 CPUFUNC(op_0410_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2005,11 +1905,9 @@ void REGPARAM2 CPUFUNC(op_0418_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2029,11 +1927,9 @@ void REGPARAM2 CPUFUNC(op_0420_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2051,11 +1947,9 @@ void REGPARAM2 CPUFUNC(op_0428_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2075,11 +1969,9 @@ void REGPARAM2 CPUFUNC(op_0430_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -2095,11 +1987,9 @@ void REGPARAM2 CPUFUNC(op_0438_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2116,11 +2006,9 @@ void REGPARAM2 CPUFUNC(op_0439_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -2137,11 +2025,9 @@ void REGPARAM2 CPUFUNC(op_0440_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2159,11 +2045,9 @@ void REGPARAM2 CPUFUNC(op_0450_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2182,11 +2066,9 @@ void REGPARAM2 CPUFUNC(op_0458_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2206,11 +2088,9 @@ void REGPARAM2 CPUFUNC(op_0460_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2228,11 +2108,9 @@ void REGPARAM2 CPUFUNC(op_0468_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2252,11 +2130,9 @@ void REGPARAM2 CPUFUNC(op_0470_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -2272,11 +2148,9 @@ void REGPARAM2 CPUFUNC(op_0478_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2293,11 +2167,9 @@ void REGPARAM2 CPUFUNC(op_0479_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -2314,11 +2186,9 @@ void REGPARAM2 CPUFUNC(op_0480_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2336,11 +2206,9 @@ void REGPARAM2 CPUFUNC(op_0490_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2359,11 +2227,9 @@ void REGPARAM2 CPUFUNC(op_0498_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2383,11 +2249,9 @@ void REGPARAM2 CPUFUNC(op_04a0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2405,11 +2269,9 @@ void REGPARAM2 CPUFUNC(op_04a8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -2429,11 +2291,9 @@ void REGPARAM2 CPUFUNC(op_04b0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -2449,11 +2309,9 @@ void REGPARAM2 CPUFUNC(op_04b8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -2470,11 +2328,9 @@ void REGPARAM2 CPUFUNC(op_04b9_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (10);
@@ -2634,11 +2490,9 @@ void REGPARAM2 CPUFUNC(op_0600_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2656,11 +2510,9 @@ void REGPARAM2 CPUFUNC(op_0610_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2679,11 +2531,9 @@ void REGPARAM2 CPUFUNC(op_0618_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2703,11 +2553,9 @@ void REGPARAM2 CPUFUNC(op_0620_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2725,11 +2573,9 @@ void REGPARAM2 CPUFUNC(op_0628_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2749,11 +2595,9 @@ void REGPARAM2 CPUFUNC(op_0630_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -2769,11 +2613,9 @@ void REGPARAM2 CPUFUNC(op_0638_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2790,11 +2632,9 @@ void REGPARAM2 CPUFUNC(op_0639_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -2811,11 +2651,9 @@ void REGPARAM2 CPUFUNC(op_0640_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2833,11 +2671,9 @@ void REGPARAM2 CPUFUNC(op_0650_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2856,11 +2692,9 @@ void REGPARAM2 CPUFUNC(op_0658_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2880,11 +2714,9 @@ void REGPARAM2 CPUFUNC(op_0660_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -2902,11 +2734,9 @@ void REGPARAM2 CPUFUNC(op_0668_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2926,11 +2756,9 @@ void REGPARAM2 CPUFUNC(op_0670_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -2946,11 +2774,9 @@ void REGPARAM2 CPUFUNC(op_0678_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -2967,11 +2793,9 @@ void REGPARAM2 CPUFUNC(op_0679_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -2988,11 +2812,9 @@ void REGPARAM2 CPUFUNC(op_0680_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -3010,11 +2832,9 @@ void REGPARAM2 CPUFUNC(op_0690_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -3033,11 +2853,9 @@ void REGPARAM2 CPUFUNC(op_0698_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -3057,11 +2875,9 @@ void REGPARAM2 CPUFUNC(op_06a0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -3079,11 +2895,9 @@ void REGPARAM2 CPUFUNC(op_06a8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -3103,11 +2917,9 @@ void REGPARAM2 CPUFUNC(op_06b0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -3123,11 +2935,9 @@ void REGPARAM2 CPUFUNC(op_06b8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -3144,11 +2954,9 @@ void REGPARAM2 CPUFUNC(op_06b9_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (10);
@@ -3918,9 +3726,7 @@ void REGPARAM2 CPUFUNC(op_0a00_22)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -3935,9 +3741,7 @@ void REGPARAM2 CPUFUNC(op_0a10_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -3953,9 +3757,7 @@ void REGPARAM2 CPUFUNC(op_0a18_22)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -3972,9 +3774,7 @@ void REGPARAM2 CPUFUNC(op_0a20_22)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -3989,9 +3789,7 @@ void REGPARAM2 CPUFUNC(op_0a28_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -4008,9 +3806,7 @@ void REGPARAM2 CPUFUNC(op_0a30_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -4023,9 +3819,7 @@ void REGPARAM2 CPUFUNC(op_0a38_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -4039,9 +3833,7 @@ void REGPARAM2 CPUFUNC(op_0a39_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (4);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -4068,9 +3860,7 @@ void REGPARAM2 CPUFUNC(op_0a40_22)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -4085,9 +3875,7 @@ void REGPARAM2 CPUFUNC(op_0a50_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -4103,9 +3891,7 @@ void REGPARAM2 CPUFUNC(op_0a58_22)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -4122,9 +3908,7 @@ void REGPARAM2 CPUFUNC(op_0a60_22)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -4139,9 +3923,7 @@ void REGPARAM2 CPUFUNC(op_0a68_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -4158,9 +3940,7 @@ void REGPARAM2 CPUFUNC(op_0a70_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -4173,9 +3953,7 @@ void REGPARAM2 CPUFUNC(op_0a78_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -4189,9 +3967,7 @@ void REGPARAM2 CPUFUNC(op_0a79_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (4);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -4219,9 +3995,7 @@ void REGPARAM2 CPUFUNC(op_0a80_22)(uae_u32 opcode)
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -4239,9 +4013,7 @@ void REGPARAM2 CPUFUNC(op_0a90_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -4257,9 +4029,7 @@ void REGPARAM2 CPUFUNC(op_0a98_22)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -4276,9 +4046,7 @@ void REGPARAM2 CPUFUNC(op_0aa0_22)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -4293,9 +4061,7 @@ void REGPARAM2 CPUFUNC(op_0aa8_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -4312,9 +4078,7 @@ void REGPARAM2 CPUFUNC(op_0ab0_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -4327,9 +4091,7 @@ void REGPARAM2 CPUFUNC(op_0ab8_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
@@ -4343,9 +4105,7 @@ void REGPARAM2 CPUFUNC(op_0ab9_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (6);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (10);
@@ -4366,10 +4126,8 @@ void REGPARAM2 CPUFUNC(op_0ad0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4393,10 +4151,8 @@ void REGPARAM2 CPUFUNC(op_0ad8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4421,10 +4177,8 @@ void REGPARAM2 CPUFUNC(op_0ae0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4447,10 +4201,8 @@ void REGPARAM2 CPUFUNC(op_0ae8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4475,10 +4227,8 @@ void REGPARAM2 CPUFUNC(op_0af0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
 }}}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -4499,10 +4249,8 @@ void REGPARAM2 CPUFUNC(op_0af8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4524,10 +4272,8 @@ void REGPARAM2 CPUFUNC(op_0af9_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (8);
 	if (GET_ZFLG ()){	x_put_byte (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4546,10 +4292,8 @@ void REGPARAM2 CPUFUNC(op_0c00_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -4566,10 +4310,8 @@ void REGPARAM2 CPUFUNC(op_0c10_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -4587,10 +4329,8 @@ void REGPARAM2 CPUFUNC(op_0c18_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -4609,10 +4349,8 @@ void REGPARAM2 CPUFUNC(op_0c20_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -4629,10 +4367,8 @@ void REGPARAM2 CPUFUNC(op_0c28_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -4651,10 +4387,8 @@ void REGPARAM2 CPUFUNC(op_0c30_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -4669,10 +4403,8 @@ void REGPARAM2 CPUFUNC(op_0c38_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -4688,10 +4420,8 @@ void REGPARAM2 CPUFUNC(op_0c39_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
 return;
@@ -4710,10 +4440,8 @@ void REGPARAM2 CPUFUNC(op_0c3a_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -4736,10 +4464,8 @@ void REGPARAM2 CPUFUNC(op_0c3b_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -4755,10 +4481,8 @@ void REGPARAM2 CPUFUNC(op_0c40_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -4775,10 +4499,8 @@ void REGPARAM2 CPUFUNC(op_0c50_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -4796,10 +4518,8 @@ void REGPARAM2 CPUFUNC(op_0c58_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -4818,10 +4538,8 @@ void REGPARAM2 CPUFUNC(op_0c60_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -4838,10 +4556,8 @@ void REGPARAM2 CPUFUNC(op_0c68_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -4860,10 +4576,8 @@ void REGPARAM2 CPUFUNC(op_0c70_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -4878,10 +4592,8 @@ void REGPARAM2 CPUFUNC(op_0c78_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -4897,10 +4609,8 @@ void REGPARAM2 CPUFUNC(op_0c79_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
 return;
@@ -4919,10 +4629,8 @@ void REGPARAM2 CPUFUNC(op_0c7a_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -4945,10 +4653,8 @@ void REGPARAM2 CPUFUNC(op_0c7b_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -4964,10 +4670,8 @@ void REGPARAM2 CPUFUNC(op_0c80_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -4984,10 +4688,8 @@ void REGPARAM2 CPUFUNC(op_0c90_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -5005,10 +4707,8 @@ void REGPARAM2 CPUFUNC(op_0c98_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -5027,10 +4727,8 @@ void REGPARAM2 CPUFUNC(op_0ca0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -5047,10 +4745,8 @@ void REGPARAM2 CPUFUNC(op_0ca8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
 return;
@@ -5069,10 +4765,8 @@ void REGPARAM2 CPUFUNC(op_0cb0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -5087,10 +4781,8 @@ void REGPARAM2 CPUFUNC(op_0cb8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
 return;
@@ -5106,10 +4798,8 @@ void REGPARAM2 CPUFUNC(op_0cb9_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (10);
 return;
@@ -5128,10 +4818,8 @@ void REGPARAM2 CPUFUNC(op_0cba_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (8);
 return;
@@ -5154,10 +4842,8 @@ void REGPARAM2 CPUFUNC(op_0cbb_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -5181,10 +4867,8 @@ void REGPARAM2 CPUFUNC(op_0cd0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -5213,10 +4897,8 @@ void REGPARAM2 CPUFUNC(op_0cd8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -5246,10 +4928,8 @@ void REGPARAM2 CPUFUNC(op_0ce0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -5277,10 +4957,8 @@ void REGPARAM2 CPUFUNC(op_0ce8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -5310,10 +4988,8 @@ void REGPARAM2 CPUFUNC(op_0cf0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
 }}}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -5339,10 +5015,8 @@ void REGPARAM2 CPUFUNC(op_0cf8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -5369,10 +5043,8 @@ void REGPARAM2 CPUFUNC(op_0cf9_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (8);
 	if (GET_ZFLG ()){	x_put_word (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -5394,19 +5066,15 @@ void REGPARAM2 CPUFUNC(op_0cfc_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, (extra >> 16) & 7))) < 0;
 	int flgo = ((uae_s16)(dst1)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, (extra >> 16) & 7))) > ((uae_u16)(dst1)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, (extra >> 16) & 7))) > ((uae_u16)(dst1))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()) {
 {uae_u32 newv = ((uae_s16)(dst2)) - ((uae_s16)(m68k_dreg (regs, extra & 7)));
 {	int flgs = ((uae_s16)(m68k_dreg (regs, extra & 7))) < 0;
 	int flgo = ((uae_s16)(dst2)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, extra & 7))) > ((uae_u16)(dst2)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, extra & 7))) > ((uae_u16)(dst2))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()) {
 	x_put_word (rn1, m68k_dreg (regs, (extra >> 22) & 7));
 	x_put_word (rn2, m68k_dreg (regs, (extra >> 6) & 7));
@@ -5985,10 +5653,8 @@ void REGPARAM2 CPUFUNC(op_0ed0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -6017,10 +5683,8 @@ void REGPARAM2 CPUFUNC(op_0ed8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -6050,10 +5714,8 @@ void REGPARAM2 CPUFUNC(op_0ee0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (4);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -6081,10 +5743,8 @@ void REGPARAM2 CPUFUNC(op_0ee8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -6114,10 +5774,8 @@ void REGPARAM2 CPUFUNC(op_0ef0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
 }}}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6143,10 +5801,8 @@ void REGPARAM2 CPUFUNC(op_0ef8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (6);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -6173,10 +5829,8 @@ void REGPARAM2 CPUFUNC(op_0ef9_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpc (8);
 	if (GET_ZFLG ()){	x_put_long (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -6198,19 +5852,15 @@ void REGPARAM2 CPUFUNC(op_0efc_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, (extra >> 16) & 7))) < 0;
 	int flgo = ((uae_s32)(dst1)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, (extra >> 16) & 7))) > ((uae_u32)(dst1)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, (extra >> 16) & 7))) > ((uae_u32)(dst1))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()) {
 {uae_u32 newv = ((uae_s32)(dst2)) - ((uae_s32)(m68k_dreg (regs, extra & 7)));
 {	int flgs = ((uae_s32)(m68k_dreg (regs, extra & 7))) < 0;
 	int flgo = ((uae_s32)(dst2)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, extra & 7))) > ((uae_u32)(dst2)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, extra & 7))) > ((uae_u32)(dst2))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()) {
 	x_put_long (rn1, m68k_dreg (regs, (extra >> 22) & 7));
 	x_put_long (rn2, m68k_dreg (regs, (extra >> 6) & 7));
@@ -6231,9 +5881,7 @@ void REGPARAM2 CPUFUNC(op_1000_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6247,9 +5895,7 @@ void REGPARAM2 CPUFUNC(op_1010_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6264,9 +5910,7 @@ void REGPARAM2 CPUFUNC(op_1018_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6282,9 +5926,7 @@ void REGPARAM2 CPUFUNC(op_1020_22)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6298,9 +5940,7 @@ void REGPARAM2 CPUFUNC(op_1028_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6316,9 +5956,7 @@ void REGPARAM2 CPUFUNC(op_1030_22)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -6330,9 +5968,7 @@ void REGPARAM2 CPUFUNC(op_1038_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6345,9 +5981,7 @@ void REGPARAM2 CPUFUNC(op_1039_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6361,9 +5995,7 @@ void REGPARAM2 CPUFUNC(op_103a_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6380,9 +6012,7 @@ void REGPARAM2 CPUFUNC(op_103b_22)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -6393,9 +6023,7 @@ void REGPARAM2 CPUFUNC(op_103c_22)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6409,9 +6037,7 @@ void REGPARAM2 CPUFUNC(op_1080_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6426,9 +6052,7 @@ void REGPARAM2 CPUFUNC(op_1090_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6444,9 +6068,7 @@ void REGPARAM2 CPUFUNC(op_1098_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6463,9 +6085,7 @@ void REGPARAM2 CPUFUNC(op_10a0_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6480,9 +6100,7 @@ void REGPARAM2 CPUFUNC(op_10a8_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6499,9 +6117,7 @@ void REGPARAM2 CPUFUNC(op_10b0_22)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -6514,9 +6130,7 @@ void REGPARAM2 CPUFUNC(op_10b8_22)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6530,9 +6144,7 @@ void REGPARAM2 CPUFUNC(op_10b9_22)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6547,9 +6159,7 @@ void REGPARAM2 CPUFUNC(op_10ba_22)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6567,9 +6177,7 @@ void REGPARAM2 CPUFUNC(op_10bb_22)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -6581,9 +6189,7 @@ void REGPARAM2 CPUFUNC(op_10bc_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6598,9 +6204,7 @@ void REGPARAM2 CPUFUNC(op_10c0_22)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6616,9 +6220,7 @@ void REGPARAM2 CPUFUNC(op_10d0_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6635,9 +6237,7 @@ void REGPARAM2 CPUFUNC(op_10d8_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6655,9 +6255,7 @@ void REGPARAM2 CPUFUNC(op_10e0_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6673,9 +6271,7 @@ void REGPARAM2 CPUFUNC(op_10e8_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6693,9 +6289,7 @@ void REGPARAM2 CPUFUNC(op_10f0_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -6709,9 +6303,7 @@ void REGPARAM2 CPUFUNC(op_10f8_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6726,9 +6318,7 @@ void REGPARAM2 CPUFUNC(op_10f9_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6744,9 +6334,7 @@ void REGPARAM2 CPUFUNC(op_10fa_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6765,9 +6353,7 @@ void REGPARAM2 CPUFUNC(op_10fb_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -6780,9 +6366,7 @@ void REGPARAM2 CPUFUNC(op_10fc_22)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6798,9 +6382,7 @@ void REGPARAM2 CPUFUNC(op_1100_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6817,9 +6399,7 @@ void REGPARAM2 CPUFUNC(op_1110_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6837,9 +6417,7 @@ void REGPARAM2 CPUFUNC(op_1118_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6858,9 +6436,7 @@ void REGPARAM2 CPUFUNC(op_1120_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6877,9 +6453,7 @@ void REGPARAM2 CPUFUNC(op_1128_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6898,9 +6472,7 @@ void REGPARAM2 CPUFUNC(op_1130_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -6915,9 +6487,7 @@ void REGPARAM2 CPUFUNC(op_1138_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6933,9 +6503,7 @@ void REGPARAM2 CPUFUNC(op_1139_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6952,9 +6520,7 @@ void REGPARAM2 CPUFUNC(op_113a_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -6974,9 +6540,7 @@ void REGPARAM2 CPUFUNC(op_113b_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -6990,9 +6554,7 @@ void REGPARAM2 CPUFUNC(op_113c_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7006,9 +6568,7 @@ void REGPARAM2 CPUFUNC(op_1140_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7023,9 +6583,7 @@ void REGPARAM2 CPUFUNC(op_1150_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7041,9 +6599,7 @@ void REGPARAM2 CPUFUNC(op_1158_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7060,9 +6616,7 @@ void REGPARAM2 CPUFUNC(op_1160_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7077,9 +6631,7 @@ void REGPARAM2 CPUFUNC(op_1168_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7096,9 +6648,7 @@ void REGPARAM2 CPUFUNC(op_1170_22)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7112,9 +6662,7 @@ void REGPARAM2 CPUFUNC(op_1178_22)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7128,9 +6676,7 @@ void REGPARAM2 CPUFUNC(op_1179_22)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7145,9 +6691,7 @@ void REGPARAM2 CPUFUNC(op_117a_22)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7165,9 +6709,7 @@ void REGPARAM2 CPUFUNC(op_117b_22)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7180,9 +6722,7 @@ void REGPARAM2 CPUFUNC(op_117c_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7198,9 +6738,7 @@ void REGPARAM2 CPUFUNC(op_1180_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7216,9 +6754,7 @@ void REGPARAM2 CPUFUNC(op_1190_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7235,9 +6771,7 @@ void REGPARAM2 CPUFUNC(op_1198_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7255,9 +6789,7 @@ void REGPARAM2 CPUFUNC(op_11a0_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7273,9 +6805,7 @@ void REGPARAM2 CPUFUNC(op_11a8_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7292,9 +6822,7 @@ void REGPARAM2 CPUFUNC(op_11b0_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7309,9 +6837,7 @@ void REGPARAM2 CPUFUNC(op_11b8_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7326,9 +6852,7 @@ void REGPARAM2 CPUFUNC(op_11b9_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (6);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7344,9 +6868,7 @@ void REGPARAM2 CPUFUNC(op_11ba_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7364,9 +6886,7 @@ void REGPARAM2 CPUFUNC(op_11bb_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7380,9 +6900,7 @@ void REGPARAM2 CPUFUNC(op_11bc_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7394,9 +6912,7 @@ void REGPARAM2 CPUFUNC(op_11c0_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7410,9 +6926,7 @@ void REGPARAM2 CPUFUNC(op_11d0_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7427,9 +6941,7 @@ void REGPARAM2 CPUFUNC(op_11d8_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7445,9 +6957,7 @@ void REGPARAM2 CPUFUNC(op_11e0_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7461,9 +6971,7 @@ void REGPARAM2 CPUFUNC(op_11e8_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7479,9 +6987,7 @@ void REGPARAM2 CPUFUNC(op_11f0_22)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7494,9 +7000,7 @@ void REGPARAM2 CPUFUNC(op_11f8_22)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7509,9 +7013,7 @@ void REGPARAM2 CPUFUNC(op_11f9_22)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7525,9 +7027,7 @@ void REGPARAM2 CPUFUNC(op_11fa_22)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7544,9 +7044,7 @@ void REGPARAM2 CPUFUNC(op_11fb_22)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7558,9 +7056,7 @@ void REGPARAM2 CPUFUNC(op_11fc_22)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7573,9 +7069,7 @@ void REGPARAM2 CPUFUNC(op_13c0_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7589,9 +7083,7 @@ void REGPARAM2 CPUFUNC(op_13d0_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7606,9 +7098,7 @@ void REGPARAM2 CPUFUNC(op_13d8_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7624,9 +7114,7 @@ void REGPARAM2 CPUFUNC(op_13e0_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7640,9 +7128,7 @@ void REGPARAM2 CPUFUNC(op_13e8_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7658,9 +7144,7 @@ void REGPARAM2 CPUFUNC(op_13f0_22)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7673,9 +7157,7 @@ void REGPARAM2 CPUFUNC(op_13f8_22)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7688,9 +7170,7 @@ void REGPARAM2 CPUFUNC(op_13f9_22)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (10);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7704,9 +7184,7 @@ void REGPARAM2 CPUFUNC(op_13fa_22)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7723,9 +7201,7 @@ void REGPARAM2 CPUFUNC(op_13fb_22)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (4);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7737,9 +7213,7 @@ void REGPARAM2 CPUFUNC(op_13fc_22)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 	m68k_incpc (8);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7752,9 +7226,7 @@ void REGPARAM2 CPUFUNC(op_2000_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7767,9 +7239,7 @@ void REGPARAM2 CPUFUNC(op_2008_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7783,9 +7253,7 @@ void REGPARAM2 CPUFUNC(op_2010_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7800,9 +7268,7 @@ void REGPARAM2 CPUFUNC(op_2018_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7818,9 +7284,7 @@ void REGPARAM2 CPUFUNC(op_2020_22)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - 4;
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7834,9 +7298,7 @@ void REGPARAM2 CPUFUNC(op_2028_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7852,9 +7314,7 @@ void REGPARAM2 CPUFUNC(op_2030_22)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7866,9 +7326,7 @@ void REGPARAM2 CPUFUNC(op_2038_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7881,9 +7339,7 @@ void REGPARAM2 CPUFUNC(op_2039_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7897,9 +7353,7 @@ void REGPARAM2 CPUFUNC(op_203a_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -7916,9 +7370,7 @@ void REGPARAM2 CPUFUNC(op_203b_22)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -7929,9 +7381,7 @@ void REGPARAM2 CPUFUNC(op_203c_22)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_long_ce020_prefetch (2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8101,9 +7551,7 @@ void REGPARAM2 CPUFUNC(op_2080_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8117,9 +7565,7 @@ void REGPARAM2 CPUFUNC(op_2088_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8134,9 +7580,7 @@ void REGPARAM2 CPUFUNC(op_2090_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8152,9 +7596,7 @@ void REGPARAM2 CPUFUNC(op_2098_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8171,9 +7613,7 @@ void REGPARAM2 CPUFUNC(op_20a0_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8188,9 +7628,7 @@ void REGPARAM2 CPUFUNC(op_20a8_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8207,9 +7645,7 @@ void REGPARAM2 CPUFUNC(op_20b0_22)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8222,9 +7658,7 @@ void REGPARAM2 CPUFUNC(op_20b8_22)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8238,9 +7672,7 @@ void REGPARAM2 CPUFUNC(op_20b9_22)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8255,9 +7687,7 @@ void REGPARAM2 CPUFUNC(op_20ba_22)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8275,9 +7705,7 @@ void REGPARAM2 CPUFUNC(op_20bb_22)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8289,9 +7717,7 @@ void REGPARAM2 CPUFUNC(op_20bc_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8306,9 +7732,7 @@ void REGPARAM2 CPUFUNC(op_20c0_22)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8323,9 +7747,7 @@ void REGPARAM2 CPUFUNC(op_20c8_22)(uae_u32 opcode)
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8341,9 +7763,7 @@ void REGPARAM2 CPUFUNC(op_20d0_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8360,9 +7780,7 @@ void REGPARAM2 CPUFUNC(op_20d8_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8380,9 +7798,7 @@ void REGPARAM2 CPUFUNC(op_20e0_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8398,9 +7814,7 @@ void REGPARAM2 CPUFUNC(op_20e8_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8418,9 +7832,7 @@ void REGPARAM2 CPUFUNC(op_20f0_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8434,9 +7846,7 @@ void REGPARAM2 CPUFUNC(op_20f8_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8451,9 +7861,7 @@ void REGPARAM2 CPUFUNC(op_20f9_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8469,9 +7877,7 @@ void REGPARAM2 CPUFUNC(op_20fa_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8490,9 +7896,7 @@ void REGPARAM2 CPUFUNC(op_20fb_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8505,9 +7909,7 @@ void REGPARAM2 CPUFUNC(op_20fc_22)(uae_u32 opcode)
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8523,9 +7925,7 @@ void REGPARAM2 CPUFUNC(op_2100_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8541,9 +7941,7 @@ void REGPARAM2 CPUFUNC(op_2108_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8560,9 +7958,7 @@ void REGPARAM2 CPUFUNC(op_2110_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8580,9 +7976,7 @@ void REGPARAM2 CPUFUNC(op_2118_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8601,9 +7995,7 @@ void REGPARAM2 CPUFUNC(op_2120_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8620,9 +8012,7 @@ void REGPARAM2 CPUFUNC(op_2128_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8641,9 +8031,7 @@ void REGPARAM2 CPUFUNC(op_2130_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8658,9 +8046,7 @@ void REGPARAM2 CPUFUNC(op_2138_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8676,9 +8062,7 @@ void REGPARAM2 CPUFUNC(op_2139_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8695,9 +8079,7 @@ void REGPARAM2 CPUFUNC(op_213a_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8717,9 +8099,7 @@ void REGPARAM2 CPUFUNC(op_213b_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8733,9 +8113,7 @@ void REGPARAM2 CPUFUNC(op_213c_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8749,9 +8127,7 @@ void REGPARAM2 CPUFUNC(op_2140_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8765,9 +8141,7 @@ void REGPARAM2 CPUFUNC(op_2148_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8782,9 +8156,7 @@ void REGPARAM2 CPUFUNC(op_2150_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8800,9 +8172,7 @@ void REGPARAM2 CPUFUNC(op_2158_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8819,9 +8189,7 @@ void REGPARAM2 CPUFUNC(op_2160_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8836,9 +8204,7 @@ void REGPARAM2 CPUFUNC(op_2168_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8858,9 +8224,7 @@ void REGPARAM2 CPUFUNC(op_2170_22)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8874,9 +8238,7 @@ void REGPARAM2 CPUFUNC(op_2178_22)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8890,9 +8252,7 @@ void REGPARAM2 CPUFUNC(op_2179_22)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8907,9 +8267,7 @@ void REGPARAM2 CPUFUNC(op_217a_22)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8927,9 +8285,7 @@ void REGPARAM2 CPUFUNC(op_217b_22)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8942,9 +8298,7 @@ void REGPARAM2 CPUFUNC(op_217c_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -8960,9 +8314,7 @@ void REGPARAM2 CPUFUNC(op_2180_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8977,9 +8329,7 @@ void REGPARAM2 CPUFUNC(op_2188_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -8995,9 +8345,7 @@ void REGPARAM2 CPUFUNC(op_2190_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9014,9 +8362,7 @@ void REGPARAM2 CPUFUNC(op_2198_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9034,9 +8380,7 @@ void REGPARAM2 CPUFUNC(op_21a0_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9052,9 +8396,7 @@ void REGPARAM2 CPUFUNC(op_21a8_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9071,9 +8413,7 @@ void REGPARAM2 CPUFUNC(op_21b0_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9088,9 +8428,7 @@ void REGPARAM2 CPUFUNC(op_21b8_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9105,9 +8443,7 @@ void REGPARAM2 CPUFUNC(op_21b9_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (6);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9123,9 +8459,7 @@ void REGPARAM2 CPUFUNC(op_21ba_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9143,9 +8477,7 @@ void REGPARAM2 CPUFUNC(op_21bb_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9159,9 +8491,7 @@ void REGPARAM2 CPUFUNC(op_21bc_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (6);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9173,9 +8503,7 @@ void REGPARAM2 CPUFUNC(op_21c0_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9188,9 +8516,7 @@ void REGPARAM2 CPUFUNC(op_21c8_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9204,9 +8530,7 @@ void REGPARAM2 CPUFUNC(op_21d0_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9221,9 +8545,7 @@ void REGPARAM2 CPUFUNC(op_21d8_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9239,9 +8561,7 @@ void REGPARAM2 CPUFUNC(op_21e0_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9255,9 +8575,7 @@ void REGPARAM2 CPUFUNC(op_21e8_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9273,9 +8591,7 @@ void REGPARAM2 CPUFUNC(op_21f0_22)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9288,9 +8604,7 @@ void REGPARAM2 CPUFUNC(op_21f8_22)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9303,9 +8617,7 @@ void REGPARAM2 CPUFUNC(op_21f9_22)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9319,9 +8631,7 @@ void REGPARAM2 CPUFUNC(op_21fa_22)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9338,9 +8648,7 @@ void REGPARAM2 CPUFUNC(op_21fb_22)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9352,9 +8660,7 @@ void REGPARAM2 CPUFUNC(op_21fc_22)(uae_u32 opcode)
 {
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9367,9 +8673,7 @@ void REGPARAM2 CPUFUNC(op_23c0_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9382,9 +8686,7 @@ void REGPARAM2 CPUFUNC(op_23c8_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9398,9 +8700,7 @@ void REGPARAM2 CPUFUNC(op_23d0_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9415,9 +8715,7 @@ void REGPARAM2 CPUFUNC(op_23d8_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9433,9 +8731,7 @@ void REGPARAM2 CPUFUNC(op_23e0_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9449,9 +8745,7 @@ void REGPARAM2 CPUFUNC(op_23e8_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9467,9 +8761,7 @@ void REGPARAM2 CPUFUNC(op_23f0_22)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9482,9 +8774,7 @@ void REGPARAM2 CPUFUNC(op_23f8_22)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9497,9 +8787,7 @@ void REGPARAM2 CPUFUNC(op_23f9_22)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (10);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9513,9 +8801,7 @@ void REGPARAM2 CPUFUNC(op_23fa_22)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9532,9 +8818,7 @@ void REGPARAM2 CPUFUNC(op_23fb_22)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (4);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9546,9 +8830,7 @@ void REGPARAM2 CPUFUNC(op_23fc_22)(uae_u32 opcode)
 {
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uaecptr dsta = get_long_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 	m68k_incpc (10);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9561,9 +8843,7 @@ void REGPARAM2 CPUFUNC(op_3000_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9576,9 +8856,7 @@ void REGPARAM2 CPUFUNC(op_3008_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9592,9 +8870,7 @@ void REGPARAM2 CPUFUNC(op_3010_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9609,9 +8885,7 @@ void REGPARAM2 CPUFUNC(op_3018_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9627,9 +8901,7 @@ void REGPARAM2 CPUFUNC(op_3020_22)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - 2;
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9643,9 +8915,7 @@ void REGPARAM2 CPUFUNC(op_3028_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9661,9 +8931,7 @@ void REGPARAM2 CPUFUNC(op_3030_22)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9675,9 +8943,7 @@ void REGPARAM2 CPUFUNC(op_3038_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9690,9 +8956,7 @@ void REGPARAM2 CPUFUNC(op_3039_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9706,9 +8970,7 @@ void REGPARAM2 CPUFUNC(op_303a_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9725,9 +8987,7 @@ void REGPARAM2 CPUFUNC(op_303b_22)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -9738,9 +8998,7 @@ void REGPARAM2 CPUFUNC(op_303c_22)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_word_ce020_prefetch (2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9922,9 +9180,7 @@ void REGPARAM2 CPUFUNC(op_3080_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9938,9 +9194,7 @@ void REGPARAM2 CPUFUNC(op_3088_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9955,9 +9209,7 @@ void REGPARAM2 CPUFUNC(op_3090_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9973,9 +9225,7 @@ void REGPARAM2 CPUFUNC(op_3098_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -9992,9 +9242,7 @@ void REGPARAM2 CPUFUNC(op_30a0_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10009,9 +9257,7 @@ void REGPARAM2 CPUFUNC(op_30a8_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10028,9 +9274,7 @@ void REGPARAM2 CPUFUNC(op_30b0_22)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10043,9 +9287,7 @@ void REGPARAM2 CPUFUNC(op_30b8_22)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10059,9 +9301,7 @@ void REGPARAM2 CPUFUNC(op_30b9_22)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10076,9 +9316,7 @@ void REGPARAM2 CPUFUNC(op_30ba_22)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10096,9 +9334,7 @@ void REGPARAM2 CPUFUNC(op_30bb_22)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10110,9 +9346,7 @@ void REGPARAM2 CPUFUNC(op_30bc_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10127,9 +9361,7 @@ void REGPARAM2 CPUFUNC(op_30c0_22)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10144,9 +9376,7 @@ void REGPARAM2 CPUFUNC(op_30c8_22)(uae_u32 opcode)
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10162,9 +9392,7 @@ void REGPARAM2 CPUFUNC(op_30d0_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10181,9 +9409,7 @@ void REGPARAM2 CPUFUNC(op_30d8_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10201,9 +9427,7 @@ void REGPARAM2 CPUFUNC(op_30e0_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10219,9 +9443,7 @@ void REGPARAM2 CPUFUNC(op_30e8_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10239,9 +9461,7 @@ void REGPARAM2 CPUFUNC(op_30f0_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10255,9 +9475,7 @@ void REGPARAM2 CPUFUNC(op_30f8_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10272,9 +9490,7 @@ void REGPARAM2 CPUFUNC(op_30f9_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10290,9 +9506,7 @@ void REGPARAM2 CPUFUNC(op_30fa_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10311,9 +9525,7 @@ void REGPARAM2 CPUFUNC(op_30fb_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10326,9 +9538,7 @@ void REGPARAM2 CPUFUNC(op_30fc_22)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10344,9 +9554,7 @@ void REGPARAM2 CPUFUNC(op_3100_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10362,9 +9570,7 @@ void REGPARAM2 CPUFUNC(op_3108_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10381,9 +9587,7 @@ void REGPARAM2 CPUFUNC(op_3110_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10401,9 +9605,7 @@ void REGPARAM2 CPUFUNC(op_3118_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10422,9 +9624,7 @@ void REGPARAM2 CPUFUNC(op_3120_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10441,9 +9641,7 @@ void REGPARAM2 CPUFUNC(op_3128_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10462,9 +9660,7 @@ void REGPARAM2 CPUFUNC(op_3130_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10479,9 +9675,7 @@ void REGPARAM2 CPUFUNC(op_3138_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10497,9 +9691,7 @@ void REGPARAM2 CPUFUNC(op_3139_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10516,9 +9708,7 @@ void REGPARAM2 CPUFUNC(op_313a_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10538,9 +9728,7 @@ void REGPARAM2 CPUFUNC(op_313b_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10554,9 +9742,7 @@ void REGPARAM2 CPUFUNC(op_313c_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10570,9 +9756,7 @@ void REGPARAM2 CPUFUNC(op_3140_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10586,9 +9770,7 @@ void REGPARAM2 CPUFUNC(op_3148_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10603,9 +9785,7 @@ void REGPARAM2 CPUFUNC(op_3150_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10621,9 +9801,7 @@ void REGPARAM2 CPUFUNC(op_3158_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10640,9 +9818,7 @@ void REGPARAM2 CPUFUNC(op_3160_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10657,9 +9833,7 @@ void REGPARAM2 CPUFUNC(op_3168_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10676,9 +9850,7 @@ void REGPARAM2 CPUFUNC(op_3170_22)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10692,9 +9864,7 @@ void REGPARAM2 CPUFUNC(op_3178_22)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10708,9 +9878,7 @@ void REGPARAM2 CPUFUNC(op_3179_22)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10725,9 +9893,7 @@ void REGPARAM2 CPUFUNC(op_317a_22)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10745,9 +9911,7 @@ void REGPARAM2 CPUFUNC(op_317b_22)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10760,9 +9924,7 @@ void REGPARAM2 CPUFUNC(op_317c_22)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -10778,9 +9940,7 @@ void REGPARAM2 CPUFUNC(op_3180_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10795,9 +9955,7 @@ void REGPARAM2 CPUFUNC(op_3188_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10813,9 +9971,7 @@ void REGPARAM2 CPUFUNC(op_3190_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10832,9 +9988,7 @@ void REGPARAM2 CPUFUNC(op_3198_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10852,9 +10006,7 @@ void REGPARAM2 CPUFUNC(op_31a0_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (2);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10870,9 +10022,7 @@ void REGPARAM2 CPUFUNC(op_31a8_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10889,9 +10039,7 @@ void REGPARAM2 CPUFUNC(op_31b0_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10906,9 +10054,7 @@ void REGPARAM2 CPUFUNC(op_31b8_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10923,9 +10069,7 @@ void REGPARAM2 CPUFUNC(op_31b9_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (6);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10941,9 +10085,7 @@ void REGPARAM2 CPUFUNC(op_31ba_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10961,9 +10103,7 @@ void REGPARAM2 CPUFUNC(op_31bb_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10977,9 +10117,7 @@ void REGPARAM2 CPUFUNC(op_31bc_22)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpc (4);
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -10991,9 +10129,7 @@ void REGPARAM2 CPUFUNC(op_31c0_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11006,9 +10142,7 @@ void REGPARAM2 CPUFUNC(op_31c8_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11022,9 +10156,7 @@ void REGPARAM2 CPUFUNC(op_31d0_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11039,9 +10171,7 @@ void REGPARAM2 CPUFUNC(op_31d8_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11057,9 +10187,7 @@ void REGPARAM2 CPUFUNC(op_31e0_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11073,9 +10201,7 @@ void REGPARAM2 CPUFUNC(op_31e8_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11091,9 +10217,7 @@ void REGPARAM2 CPUFUNC(op_31f0_22)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11106,9 +10230,7 @@ void REGPARAM2 CPUFUNC(op_31f8_22)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11121,9 +10243,7 @@ void REGPARAM2 CPUFUNC(op_31f9_22)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11137,9 +10257,7 @@ void REGPARAM2 CPUFUNC(op_31fa_22)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11156,9 +10274,7 @@ void REGPARAM2 CPUFUNC(op_31fb_22)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (2);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11170,9 +10286,7 @@ void REGPARAM2 CPUFUNC(op_31fc_22)(uae_u32 opcode)
 {
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11185,9 +10299,7 @@ void REGPARAM2 CPUFUNC(op_33c0_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11200,9 +10312,7 @@ void REGPARAM2 CPUFUNC(op_33c8_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11216,9 +10326,7 @@ void REGPARAM2 CPUFUNC(op_33d0_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11233,9 +10341,7 @@ void REGPARAM2 CPUFUNC(op_33d8_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11251,9 +10357,7 @@ void REGPARAM2 CPUFUNC(op_33e0_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (6);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11267,9 +10371,7 @@ void REGPARAM2 CPUFUNC(op_33e8_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11285,9 +10387,7 @@ void REGPARAM2 CPUFUNC(op_33f0_22)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11300,9 +10400,7 @@ void REGPARAM2 CPUFUNC(op_33f8_22)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11315,9 +10413,7 @@ void REGPARAM2 CPUFUNC(op_33f9_22)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (10);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11331,9 +10427,7 @@ void REGPARAM2 CPUFUNC(op_33fa_22)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11350,9 +10444,7 @@ void REGPARAM2 CPUFUNC(op_33fb_22)(uae_u32 opcode)
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uaecptr dsta = get_long_ce020_prefetch (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (4);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -11364,9 +10456,7 @@ void REGPARAM2 CPUFUNC(op_33fc_22)(uae_u32 opcode)
 {
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uaecptr dsta = get_long_ce020_prefetch (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 	m68k_incpc (8);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -12634,9 +11724,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4200_22)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+{{	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((0) & 0xff);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12648,9 +11736,7 @@ void REGPARAM2 CPUFUNC(op_4210_22)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12663,9 +11749,7 @@ void REGPARAM2 CPUFUNC(op_4218_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12679,9 +11763,7 @@ void REGPARAM2 CPUFUNC(op_4220_22)(uae_u32 opcode)
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12693,9 +11775,7 @@ void REGPARAM2 CPUFUNC(op_4228_22)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -12709,9 +11789,7 @@ void REGPARAM2 CPUFUNC(op_4230_22)(uae_u32 opcode)
 {{	uaecptr srca;
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -12721,9 +11799,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4238_22)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -12734,9 +11810,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4239_22)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -12747,9 +11821,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4240_22)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+{{	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((0) & 0xffff);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12761,9 +11833,7 @@ void REGPARAM2 CPUFUNC(op_4250_22)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12776,9 +11846,7 @@ void REGPARAM2 CPUFUNC(op_4258_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12792,9 +11860,7 @@ void REGPARAM2 CPUFUNC(op_4260_22)(uae_u32 opcode)
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - 2;
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12806,9 +11872,7 @@ void REGPARAM2 CPUFUNC(op_4268_22)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -12822,9 +11886,7 @@ void REGPARAM2 CPUFUNC(op_4270_22)(uae_u32 opcode)
 {{	uaecptr srca;
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -12834,9 +11896,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4278_22)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -12847,9 +11907,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4279_22)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	x_put_word (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -12860,9 +11918,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4280_22)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+{{	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12874,9 +11930,7 @@ void REGPARAM2 CPUFUNC(op_4290_22)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12889,9 +11943,7 @@ void REGPARAM2 CPUFUNC(op_4298_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12905,9 +11957,7 @@ void REGPARAM2 CPUFUNC(op_42a0_22)(uae_u32 opcode)
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - 4;
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -12919,9 +11969,7 @@ void REGPARAM2 CPUFUNC(op_42a8_22)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -12935,9 +11983,7 @@ void REGPARAM2 CPUFUNC(op_42b0_22)(uae_u32 opcode)
 {{	uaecptr srca;
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -12947,9 +11993,7 @@ return;
 void REGPARAM2 CPUFUNC(op_42b8_22)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -12960,9 +12004,7 @@ return;
 void REGPARAM2 CPUFUNC(op_42b9_22)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	x_put_long (srca, 0);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -13094,11 +12136,9 @@ void REGPARAM2 CPUFUNC(op_4400_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13115,11 +12155,9 @@ void REGPARAM2 CPUFUNC(op_4410_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13137,11 +12175,9 @@ void REGPARAM2 CPUFUNC(op_4418_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13160,11 +12196,9 @@ void REGPARAM2 CPUFUNC(op_4420_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13181,11 +12215,9 @@ void REGPARAM2 CPUFUNC(op_4428_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13204,11 +12236,9 @@ void REGPARAM2 CPUFUNC(op_4430_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -13223,11 +12253,9 @@ void REGPARAM2 CPUFUNC(op_4438_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13243,11 +12271,9 @@ void REGPARAM2 CPUFUNC(op_4439_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -13263,11 +12289,9 @@ void REGPARAM2 CPUFUNC(op_4440_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13284,11 +12308,9 @@ void REGPARAM2 CPUFUNC(op_4450_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13306,11 +12328,9 @@ void REGPARAM2 CPUFUNC(op_4458_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13329,11 +12349,9 @@ void REGPARAM2 CPUFUNC(op_4460_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13350,11 +12368,9 @@ void REGPARAM2 CPUFUNC(op_4468_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13373,11 +12389,9 @@ void REGPARAM2 CPUFUNC(op_4470_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -13392,11 +12406,9 @@ void REGPARAM2 CPUFUNC(op_4478_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13412,11 +12424,9 @@ void REGPARAM2 CPUFUNC(op_4479_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -13432,11 +12442,9 @@ void REGPARAM2 CPUFUNC(op_4480_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (dst);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13453,11 +12461,9 @@ void REGPARAM2 CPUFUNC(op_4490_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13475,11 +12481,9 @@ void REGPARAM2 CPUFUNC(op_4498_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13498,11 +12502,9 @@ void REGPARAM2 CPUFUNC(op_44a0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13519,11 +12521,9 @@ void REGPARAM2 CPUFUNC(op_44a8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13542,11 +12542,9 @@ void REGPARAM2 CPUFUNC(op_44b0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -13561,11 +12559,9 @@ void REGPARAM2 CPUFUNC(op_44b8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13581,11 +12577,9 @@ void REGPARAM2 CPUFUNC(op_44b9_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (srca, dst);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -13764,9 +12758,7 @@ void REGPARAM2 CPUFUNC(op_4600_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13780,9 +12772,7 @@ void REGPARAM2 CPUFUNC(op_4610_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13797,9 +12787,7 @@ void REGPARAM2 CPUFUNC(op_4618_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13815,9 +12803,7 @@ void REGPARAM2 CPUFUNC(op_4620_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13831,9 +12817,7 @@ void REGPARAM2 CPUFUNC(op_4628_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13849,9 +12833,7 @@ void REGPARAM2 CPUFUNC(op_4630_22)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -13863,9 +12845,7 @@ void REGPARAM2 CPUFUNC(op_4638_22)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13878,9 +12858,7 @@ void REGPARAM2 CPUFUNC(op_4639_22)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	x_put_byte (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -13893,9 +12871,7 @@ void REGPARAM2 CPUFUNC(op_4640_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13909,9 +12885,7 @@ void REGPARAM2 CPUFUNC(op_4650_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13926,9 +12900,7 @@ void REGPARAM2 CPUFUNC(op_4658_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13944,9 +12916,7 @@ void REGPARAM2 CPUFUNC(op_4660_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -13960,9 +12930,7 @@ void REGPARAM2 CPUFUNC(op_4668_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -13978,9 +12946,7 @@ void REGPARAM2 CPUFUNC(op_4670_22)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -13992,9 +12958,7 @@ void REGPARAM2 CPUFUNC(op_4678_22)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -14007,9 +12971,7 @@ void REGPARAM2 CPUFUNC(op_4679_22)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	x_put_word (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -14022,9 +12984,7 @@ void REGPARAM2 CPUFUNC(op_4680_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -14038,9 +12998,7 @@ void REGPARAM2 CPUFUNC(op_4690_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -14055,9 +13013,7 @@ void REGPARAM2 CPUFUNC(op_4698_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -14073,9 +13029,7 @@ void REGPARAM2 CPUFUNC(op_46a0_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -14089,9 +13043,7 @@ void REGPARAM2 CPUFUNC(op_46a8_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -14107,9 +13059,7 @@ void REGPARAM2 CPUFUNC(op_46b0_22)(uae_u32 opcode)
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -14121,9 +13071,7 @@ void REGPARAM2 CPUFUNC(op_46b8_22)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -14136,9 +13084,7 @@ void REGPARAM2 CPUFUNC(op_46b9_22)(uae_u32 opcode)
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	x_put_long (srca, dst);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -14513,9 +13459,7 @@ void REGPARAM2 CPUFUNC(op_4840_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -14639,9 +13583,7 @@ void REGPARAM2 CPUFUNC(op_4880_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u16 dst = (uae_s16)(uae_s8)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -14745,9 +13687,7 @@ void REGPARAM2 CPUFUNC(op_48c0_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -14852,9 +13792,7 @@ void REGPARAM2 CPUFUNC(op_49c0_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s8)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -14867,9 +13805,7 @@ void REGPARAM2 CPUFUNC(op_4a00_22)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -14881,9 +13817,7 @@ void REGPARAM2 CPUFUNC(op_4a10_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -14896,9 +13830,7 @@ void REGPARAM2 CPUFUNC(op_4a18_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -14912,9 +13844,7 @@ void REGPARAM2 CPUFUNC(op_4a20_22)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -14926,9 +13856,7 @@ void REGPARAM2 CPUFUNC(op_4a28_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -14942,9 +13870,7 @@ void REGPARAM2 CPUFUNC(op_4a30_22)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -14954,9 +13880,7 @@ void REGPARAM2 CPUFUNC(op_4a38_22)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -14967,9 +13891,7 @@ void REGPARAM2 CPUFUNC(op_4a39_22)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -14982,9 +13904,7 @@ void REGPARAM2 CPUFUNC(op_4a3a_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -15001,9 +13921,7 @@ void REGPARAM2 CPUFUNC(op_4a3b_22)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -15013,9 +13931,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4a3c_22)(uae_u32 opcode)
 {
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -15026,9 +13942,7 @@ void REGPARAM2 CPUFUNC(op_4a40_22)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15040,9 +13954,7 @@ void REGPARAM2 CPUFUNC(op_4a48_22)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15055,9 +13967,7 @@ void REGPARAM2 CPUFUNC(op_4a50_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15070,9 +13980,7 @@ void REGPARAM2 CPUFUNC(op_4a58_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15086,9 +13994,7 @@ void REGPARAM2 CPUFUNC(op_4a60_22)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - 2;
 {	uae_s16 src = x_get_word (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15100,9 +14006,7 @@ void REGPARAM2 CPUFUNC(op_4a68_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -15116,9 +14020,7 @@ void REGPARAM2 CPUFUNC(op_4a70_22)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -15128,9 +14030,7 @@ void REGPARAM2 CPUFUNC(op_4a78_22)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -15141,9 +14041,7 @@ void REGPARAM2 CPUFUNC(op_4a79_22)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -15156,9 +14054,7 @@ void REGPARAM2 CPUFUNC(op_4a7a_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -15175,9 +14071,7 @@ void REGPARAM2 CPUFUNC(op_4a7b_22)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s16 src = x_get_word (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -15187,9 +14081,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4a7c_22)(uae_u32 opcode)
 {
 {{	uae_s16 src = get_word_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -15200,9 +14092,7 @@ void REGPARAM2 CPUFUNC(op_4a80_22)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15214,9 +14104,7 @@ void REGPARAM2 CPUFUNC(op_4a88_22)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15229,9 +14117,7 @@ void REGPARAM2 CPUFUNC(op_4a90_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15244,9 +14130,7 @@ void REGPARAM2 CPUFUNC(op_4a98_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15260,9 +14144,7 @@ void REGPARAM2 CPUFUNC(op_4aa0_22)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - 4;
 {	uae_s32 src = x_get_long (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -15274,9 +14156,7 @@ void REGPARAM2 CPUFUNC(op_4aa8_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -15290,9 +14170,7 @@ void REGPARAM2 CPUFUNC(op_4ab0_22)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -15302,9 +14180,7 @@ void REGPARAM2 CPUFUNC(op_4ab8_22)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -15315,9 +14191,7 @@ void REGPARAM2 CPUFUNC(op_4ab9_22)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -15330,9 +14204,7 @@ void REGPARAM2 CPUFUNC(op_4aba_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -15349,9 +14221,7 @@ void REGPARAM2 CPUFUNC(op_4abb_22)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_ce020 (tmppc, next_iword_020ce ());
 {	uae_s32 src = x_get_long (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -15361,9 +14231,7 @@ return;
 void REGPARAM2 CPUFUNC(op_4abc_22)(uae_u32 opcode)
 {
 {{	uae_s32 src = get_long_ce020_prefetch (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -15374,9 +14242,7 @@ void REGPARAM2 CPUFUNC(op_4ac0_22)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((src) & 0xff);
 }}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -15390,9 +14256,7 @@ void REGPARAM2 CPUFUNC(op_4ad0_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -15407,9 +14271,7 @@ void REGPARAM2 CPUFUNC(op_4ad8_22)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -15425,9 +14287,7 @@ void REGPARAM2 CPUFUNC(op_4ae0_22)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = x_get_byte (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -15441,9 +14301,7 @@ void REGPARAM2 CPUFUNC(op_4ae8_22)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -15459,9 +14317,7 @@ void REGPARAM2 CPUFUNC(op_4af0_22)(uae_u32 opcode)
 	m68k_incpc (2);
 {	srca = x_get_disp_ea_ce020 (m68k_areg (regs, srcreg), next_iword_020ce ());
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -15473,9 +14329,7 @@ void REGPARAM2 CPUFUNC(op_4af8_22)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -15488,9 +14342,7 @@ void REGPARAM2 CPUFUNC(op_4af9_22)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_long_ce020_prefetch (2);
 {	uae_s8 src = x_get_byte (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	x_put_byte (srca, src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -16557,11 +15409,9 @@ void REGPARAM2 CPUFUNC(op_5000_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16580,11 +15430,9 @@ void REGPARAM2 CPUFUNC(op_5010_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16604,11 +15452,9 @@ void REGPARAM2 CPUFUNC(op_5018_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16629,11 +15475,9 @@ void REGPARAM2 CPUFUNC(op_5020_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16652,11 +15496,9 @@ void REGPARAM2 CPUFUNC(op_5028_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -16677,11 +15519,9 @@ void REGPARAM2 CPUFUNC(op_5030_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -16698,11 +15538,9 @@ void REGPARAM2 CPUFUNC(op_5038_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -16720,11 +15558,9 @@ void REGPARAM2 CPUFUNC(op_5039_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -16742,11 +15578,9 @@ void REGPARAM2 CPUFUNC(op_5040_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16779,11 +15613,9 @@ void REGPARAM2 CPUFUNC(op_5050_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16803,11 +15635,9 @@ void REGPARAM2 CPUFUNC(op_5058_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16828,11 +15658,9 @@ void REGPARAM2 CPUFUNC(op_5060_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16851,11 +15679,9 @@ void REGPARAM2 CPUFUNC(op_5068_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -16876,11 +15702,9 @@ void REGPARAM2 CPUFUNC(op_5070_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -16900,11 +15724,9 @@ void REGPARAM2 CPUFUNC(op_5078_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -16922,11 +15744,9 @@ void REGPARAM2 CPUFUNC(op_5079_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -16944,11 +15764,9 @@ void REGPARAM2 CPUFUNC(op_5080_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -16981,11 +15799,9 @@ void REGPARAM2 CPUFUNC(op_5090_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17005,11 +15821,9 @@ void REGPARAM2 CPUFUNC(op_5098_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17030,11 +15844,9 @@ void REGPARAM2 CPUFUNC(op_50a0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17053,11 +15865,9 @@ void REGPARAM2 CPUFUNC(op_50a8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -17078,11 +15888,9 @@ void REGPARAM2 CPUFUNC(op_50b0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -17099,11 +15907,9 @@ void REGPARAM2 CPUFUNC(op_50b8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -17121,11 +15927,9 @@ void REGPARAM2 CPUFUNC(op_50b9_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -17305,11 +16109,9 @@ void REGPARAM2 CPUFUNC(op_5100_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17328,11 +16130,9 @@ void REGPARAM2 CPUFUNC(op_5110_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17352,11 +16152,9 @@ void REGPARAM2 CPUFUNC(op_5118_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17377,11 +16175,9 @@ void REGPARAM2 CPUFUNC(op_5120_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17400,11 +16196,9 @@ void REGPARAM2 CPUFUNC(op_5128_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -17425,11 +16219,9 @@ void REGPARAM2 CPUFUNC(op_5130_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -17446,11 +16238,9 @@ void REGPARAM2 CPUFUNC(op_5138_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -17468,11 +16258,9 @@ void REGPARAM2 CPUFUNC(op_5139_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -17490,11 +16278,9 @@ void REGPARAM2 CPUFUNC(op_5140_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17527,11 +16313,9 @@ void REGPARAM2 CPUFUNC(op_5150_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17551,11 +16335,9 @@ void REGPARAM2 CPUFUNC(op_5158_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17576,11 +16358,9 @@ void REGPARAM2 CPUFUNC(op_5160_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17599,11 +16379,9 @@ void REGPARAM2 CPUFUNC(op_5168_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -17624,11 +16402,9 @@ void REGPARAM2 CPUFUNC(op_5170_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -17645,11 +16421,9 @@ void REGPARAM2 CPUFUNC(op_5178_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -17667,11 +16441,9 @@ void REGPARAM2 CPUFUNC(op_5179_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -17689,11 +16461,9 @@ void REGPARAM2 CPUFUNC(op_5180_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17726,11 +16496,9 @@ void REGPARAM2 CPUFUNC(op_5190_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17750,11 +16518,9 @@ void REGPARAM2 CPUFUNC(op_5198_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17775,11 +16541,9 @@ void REGPARAM2 CPUFUNC(op_51a0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -17798,11 +16562,9 @@ void REGPARAM2 CPUFUNC(op_51a8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -17823,11 +16585,9 @@ void REGPARAM2 CPUFUNC(op_51b0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -17844,11 +16604,9 @@ void REGPARAM2 CPUFUNC(op_51b8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -17866,11 +16624,9 @@ void REGPARAM2 CPUFUNC(op_51b9_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -21190,9 +19946,7 @@ void REGPARAM2 CPUFUNC(op_7000_22)(uae_u32 opcode)
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_u32 src = srcreg;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpc (2);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -21207,9 +19961,7 @@ void REGPARAM2 CPUFUNC(op_8000_22)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21225,9 +19977,7 @@ void REGPARAM2 CPUFUNC(op_8010_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21244,9 +19994,7 @@ void REGPARAM2 CPUFUNC(op_8018_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21264,9 +20012,7 @@ void REGPARAM2 CPUFUNC(op_8020_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21282,9 +20028,7 @@ void REGPARAM2 CPUFUNC(op_8028_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21302,9 +20046,7 @@ void REGPARAM2 CPUFUNC(op_8030_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -21318,9 +20060,7 @@ void REGPARAM2 CPUFUNC(op_8038_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21335,9 +20075,7 @@ void REGPARAM2 CPUFUNC(op_8039_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -21353,9 +20091,7 @@ void REGPARAM2 CPUFUNC(op_803a_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21374,9 +20110,7 @@ void REGPARAM2 CPUFUNC(op_803b_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -21389,9 +20123,7 @@ void REGPARAM2 CPUFUNC(op_803c_22)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21406,9 +20138,7 @@ void REGPARAM2 CPUFUNC(op_8040_22)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21424,9 +20154,7 @@ void REGPARAM2 CPUFUNC(op_8050_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21443,9 +20171,7 @@ void REGPARAM2 CPUFUNC(op_8058_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21463,9 +20189,7 @@ void REGPARAM2 CPUFUNC(op_8060_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21481,9 +20205,7 @@ void REGPARAM2 CPUFUNC(op_8068_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21501,9 +20223,7 @@ void REGPARAM2 CPUFUNC(op_8070_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -21517,9 +20237,7 @@ void REGPARAM2 CPUFUNC(op_8078_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21534,9 +20252,7 @@ void REGPARAM2 CPUFUNC(op_8079_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -21552,9 +20268,7 @@ void REGPARAM2 CPUFUNC(op_807a_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21573,9 +20287,7 @@ void REGPARAM2 CPUFUNC(op_807b_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -21588,9 +20300,7 @@ void REGPARAM2 CPUFUNC(op_807c_22)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21605,9 +20315,7 @@ void REGPARAM2 CPUFUNC(op_8080_22)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21623,9 +20331,7 @@ void REGPARAM2 CPUFUNC(op_8090_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21642,9 +20348,7 @@ void REGPARAM2 CPUFUNC(op_8098_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21662,9 +20366,7 @@ void REGPARAM2 CPUFUNC(op_80a0_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -21680,9 +20382,7 @@ void REGPARAM2 CPUFUNC(op_80a8_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21700,9 +20400,7 @@ void REGPARAM2 CPUFUNC(op_80b0_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -21716,9 +20414,7 @@ void REGPARAM2 CPUFUNC(op_80b8_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21733,9 +20429,7 @@ void REGPARAM2 CPUFUNC(op_80b9_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -21751,9 +20445,7 @@ void REGPARAM2 CPUFUNC(op_80ba_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -21772,9 +20464,7 @@ void REGPARAM2 CPUFUNC(op_80bb_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -21787,9 +20477,7 @@ void REGPARAM2 CPUFUNC(op_80bc_22)(uae_u32 opcode)
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -21818,9 +20506,7 @@ void REGPARAM2 CPUFUNC(op_80c0_22)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21853,9 +20539,7 @@ void REGPARAM2 CPUFUNC(op_80d0_22)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21889,9 +20573,7 @@ void REGPARAM2 CPUFUNC(op_80d8_22)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21926,9 +20608,7 @@ void REGPARAM2 CPUFUNC(op_80e0_22)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21961,9 +20641,7 @@ void REGPARAM2 CPUFUNC(op_80e8_22)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21998,9 +20676,7 @@ void REGPARAM2 CPUFUNC(op_80f0_22)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22031,9 +20707,7 @@ void REGPARAM2 CPUFUNC(op_80f8_22)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22065,9 +20739,7 @@ void REGPARAM2 CPUFUNC(op_80f9_22)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22100,9 +20772,7 @@ void REGPARAM2 CPUFUNC(op_80fa_22)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22138,9 +20808,7 @@ void REGPARAM2 CPUFUNC(op_80fb_22)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22170,9 +20838,7 @@ void REGPARAM2 CPUFUNC(op_80fc_22)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22243,9 +20909,7 @@ void REGPARAM2 CPUFUNC(op_8110_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22262,9 +20926,7 @@ void REGPARAM2 CPUFUNC(op_8118_22)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22282,9 +20944,7 @@ void REGPARAM2 CPUFUNC(op_8120_22)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22300,9 +20960,7 @@ void REGPARAM2 CPUFUNC(op_8128_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -22320,9 +20978,7 @@ void REGPARAM2 CPUFUNC(op_8130_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -22336,9 +20992,7 @@ void REGPARAM2 CPUFUNC(op_8138_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -22353,9 +21007,7 @@ void REGPARAM2 CPUFUNC(op_8139_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -22404,9 +21056,7 @@ void REGPARAM2 CPUFUNC(op_8150_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22423,9 +21073,7 @@ void REGPARAM2 CPUFUNC(op_8158_22)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22443,9 +21091,7 @@ void REGPARAM2 CPUFUNC(op_8160_22)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22461,9 +21107,7 @@ void REGPARAM2 CPUFUNC(op_8168_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -22481,9 +21125,7 @@ void REGPARAM2 CPUFUNC(op_8170_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -22497,9 +21139,7 @@ void REGPARAM2 CPUFUNC(op_8178_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -22514,9 +21154,7 @@ void REGPARAM2 CPUFUNC(op_8179_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -22566,9 +21204,7 @@ void REGPARAM2 CPUFUNC(op_8190_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22585,9 +21221,7 @@ void REGPARAM2 CPUFUNC(op_8198_22)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22605,9 +21239,7 @@ void REGPARAM2 CPUFUNC(op_81a0_22)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -22623,9 +21255,7 @@ void REGPARAM2 CPUFUNC(op_81a8_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -22643,9 +21273,7 @@ void REGPARAM2 CPUFUNC(op_81b0_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -22659,9 +21287,7 @@ void REGPARAM2 CPUFUNC(op_81b8_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -22676,9 +21302,7 @@ void REGPARAM2 CPUFUNC(op_81b9_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -22708,9 +21332,7 @@ void REGPARAM2 CPUFUNC(op_81c0_22)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22744,9 +21366,7 @@ void REGPARAM2 CPUFUNC(op_81d0_22)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22781,9 +21401,7 @@ void REGPARAM2 CPUFUNC(op_81d8_22)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22819,9 +21437,7 @@ void REGPARAM2 CPUFUNC(op_81e0_22)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22855,9 +21471,7 @@ void REGPARAM2 CPUFUNC(op_81e8_22)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22893,9 +21507,7 @@ void REGPARAM2 CPUFUNC(op_81f0_22)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22927,9 +21539,7 @@ void REGPARAM2 CPUFUNC(op_81f8_22)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22962,9 +21572,7 @@ void REGPARAM2 CPUFUNC(op_81f9_22)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22998,9 +21606,7 @@ void REGPARAM2 CPUFUNC(op_81fa_22)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -23037,9 +21643,7 @@ void REGPARAM2 CPUFUNC(op_81fb_22)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -23070,9 +21674,7 @@ void REGPARAM2 CPUFUNC(op_81fc_22)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -23093,11 +21695,9 @@ void REGPARAM2 CPUFUNC(op_9000_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23116,11 +21716,9 @@ void REGPARAM2 CPUFUNC(op_9010_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23140,11 +21738,9 @@ void REGPARAM2 CPUFUNC(op_9018_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23165,11 +21761,9 @@ void REGPARAM2 CPUFUNC(op_9020_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23188,11 +21782,9 @@ void REGPARAM2 CPUFUNC(op_9028_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23213,11 +21805,9 @@ void REGPARAM2 CPUFUNC(op_9030_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -23234,11 +21824,9 @@ void REGPARAM2 CPUFUNC(op_9038_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23256,11 +21844,9 @@ void REGPARAM2 CPUFUNC(op_9039_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -23279,11 +21865,9 @@ void REGPARAM2 CPUFUNC(op_903a_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23305,11 +21889,9 @@ void REGPARAM2 CPUFUNC(op_903b_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -23325,11 +21907,9 @@ void REGPARAM2 CPUFUNC(op_903c_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23347,11 +21927,9 @@ void REGPARAM2 CPUFUNC(op_9040_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23369,11 +21947,9 @@ void REGPARAM2 CPUFUNC(op_9048_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23392,11 +21968,9 @@ void REGPARAM2 CPUFUNC(op_9050_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23416,11 +21990,9 @@ void REGPARAM2 CPUFUNC(op_9058_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23441,11 +22013,9 @@ void REGPARAM2 CPUFUNC(op_9060_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23464,11 +22034,9 @@ void REGPARAM2 CPUFUNC(op_9068_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23489,11 +22057,9 @@ void REGPARAM2 CPUFUNC(op_9070_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -23510,11 +22076,9 @@ void REGPARAM2 CPUFUNC(op_9078_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23532,11 +22096,9 @@ void REGPARAM2 CPUFUNC(op_9079_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -23555,11 +22117,9 @@ void REGPARAM2 CPUFUNC(op_907a_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23581,11 +22141,9 @@ void REGPARAM2 CPUFUNC(op_907b_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -23601,11 +22159,9 @@ void REGPARAM2 CPUFUNC(op_907c_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23623,11 +22179,9 @@ void REGPARAM2 CPUFUNC(op_9080_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23645,11 +22199,9 @@ void REGPARAM2 CPUFUNC(op_9088_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23668,11 +22220,9 @@ void REGPARAM2 CPUFUNC(op_9090_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23692,11 +22242,9 @@ void REGPARAM2 CPUFUNC(op_9098_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23717,11 +22265,9 @@ void REGPARAM2 CPUFUNC(op_90a0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -23740,11 +22286,9 @@ void REGPARAM2 CPUFUNC(op_90a8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23765,11 +22309,9 @@ void REGPARAM2 CPUFUNC(op_90b0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -23786,11 +22328,9 @@ void REGPARAM2 CPUFUNC(op_90b8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23808,11 +22348,9 @@ void REGPARAM2 CPUFUNC(op_90b9_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -23831,11 +22369,9 @@ void REGPARAM2 CPUFUNC(op_90ba_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -23857,11 +22393,9 @@ void REGPARAM2 CPUFUNC(op_90bb_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -23877,11 +22411,9 @@ void REGPARAM2 CPUFUNC(op_90bc_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -24130,11 +22662,9 @@ void REGPARAM2 CPUFUNC(op_9110_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24154,11 +22684,9 @@ void REGPARAM2 CPUFUNC(op_9118_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24179,11 +22707,9 @@ void REGPARAM2 CPUFUNC(op_9120_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24202,11 +22728,9 @@ void REGPARAM2 CPUFUNC(op_9128_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -24227,11 +22751,9 @@ void REGPARAM2 CPUFUNC(op_9130_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -24248,11 +22770,9 @@ void REGPARAM2 CPUFUNC(op_9138_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -24270,11 +22790,9 @@ void REGPARAM2 CPUFUNC(op_9139_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -24343,11 +22861,9 @@ void REGPARAM2 CPUFUNC(op_9150_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24367,11 +22883,9 @@ void REGPARAM2 CPUFUNC(op_9158_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24392,11 +22906,9 @@ void REGPARAM2 CPUFUNC(op_9160_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24415,11 +22927,9 @@ void REGPARAM2 CPUFUNC(op_9168_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -24440,11 +22950,9 @@ void REGPARAM2 CPUFUNC(op_9170_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -24461,11 +22969,9 @@ void REGPARAM2 CPUFUNC(op_9178_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -24483,11 +22989,9 @@ void REGPARAM2 CPUFUNC(op_9179_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -24556,11 +23060,9 @@ void REGPARAM2 CPUFUNC(op_9190_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24580,11 +23082,9 @@ void REGPARAM2 CPUFUNC(op_9198_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24605,11 +23105,9 @@ void REGPARAM2 CPUFUNC(op_91a0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -24628,11 +23126,9 @@ void REGPARAM2 CPUFUNC(op_91a8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -24653,11 +23149,9 @@ void REGPARAM2 CPUFUNC(op_91b0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -24674,11 +23168,9 @@ void REGPARAM2 CPUFUNC(op_91b8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -24696,11 +23188,9 @@ void REGPARAM2 CPUFUNC(op_91b9_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -24898,10 +23388,8 @@ void REGPARAM2 CPUFUNC(op_b000_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -24919,10 +23407,8 @@ void REGPARAM2 CPUFUNC(op_b010_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -24941,10 +23427,8 @@ void REGPARAM2 CPUFUNC(op_b018_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -24964,10 +23448,8 @@ void REGPARAM2 CPUFUNC(op_b020_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -24985,10 +23467,8 @@ void REGPARAM2 CPUFUNC(op_b028_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25008,10 +23488,8 @@ void REGPARAM2 CPUFUNC(op_b030_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -25027,10 +23505,8 @@ void REGPARAM2 CPUFUNC(op_b038_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25047,10 +23523,8 @@ void REGPARAM2 CPUFUNC(op_b039_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -25068,10 +23542,8 @@ void REGPARAM2 CPUFUNC(op_b03a_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25092,10 +23564,8 @@ void REGPARAM2 CPUFUNC(op_b03b_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -25110,10 +23580,8 @@ void REGPARAM2 CPUFUNC(op_b03c_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25130,10 +23598,8 @@ void REGPARAM2 CPUFUNC(op_b040_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25150,10 +23616,8 @@ void REGPARAM2 CPUFUNC(op_b048_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25171,10 +23635,8 @@ void REGPARAM2 CPUFUNC(op_b050_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25193,10 +23655,8 @@ void REGPARAM2 CPUFUNC(op_b058_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25216,10 +23676,8 @@ void REGPARAM2 CPUFUNC(op_b060_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25237,10 +23695,8 @@ void REGPARAM2 CPUFUNC(op_b068_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25260,10 +23716,8 @@ void REGPARAM2 CPUFUNC(op_b070_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -25279,10 +23733,8 @@ void REGPARAM2 CPUFUNC(op_b078_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25299,10 +23751,8 @@ void REGPARAM2 CPUFUNC(op_b079_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -25320,10 +23770,8 @@ void REGPARAM2 CPUFUNC(op_b07a_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25344,10 +23792,8 @@ void REGPARAM2 CPUFUNC(op_b07b_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -25362,10 +23808,8 @@ void REGPARAM2 CPUFUNC(op_b07c_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25382,10 +23826,8 @@ void REGPARAM2 CPUFUNC(op_b080_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25402,10 +23844,8 @@ void REGPARAM2 CPUFUNC(op_b088_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25426,10 +23866,8 @@ void REGPARAM2 CPUFUNC(op_b090_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25448,10 +23886,8 @@ void REGPARAM2 CPUFUNC(op_b098_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25471,10 +23907,8 @@ void REGPARAM2 CPUFUNC(op_b0a0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25492,10 +23926,8 @@ void REGPARAM2 CPUFUNC(op_b0a8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25515,10 +23947,8 @@ void REGPARAM2 CPUFUNC(op_b0b0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -25534,10 +23964,8 @@ void REGPARAM2 CPUFUNC(op_b0b8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25554,10 +23982,8 @@ void REGPARAM2 CPUFUNC(op_b0b9_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -25575,10 +24001,8 @@ void REGPARAM2 CPUFUNC(op_b0ba_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25599,10 +24023,8 @@ void REGPARAM2 CPUFUNC(op_b0bb_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -25617,10 +24039,8 @@ void REGPARAM2 CPUFUNC(op_b0bc_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -25637,10 +24057,8 @@ void REGPARAM2 CPUFUNC(op_b0c0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25657,10 +24075,8 @@ void REGPARAM2 CPUFUNC(op_b0c8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25678,10 +24094,8 @@ void REGPARAM2 CPUFUNC(op_b0d0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25700,10 +24114,8 @@ void REGPARAM2 CPUFUNC(op_b0d8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25723,10 +24135,8 @@ void REGPARAM2 CPUFUNC(op_b0e0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25744,10 +24154,8 @@ void REGPARAM2 CPUFUNC(op_b0e8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25767,10 +24175,8 @@ void REGPARAM2 CPUFUNC(op_b0f0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -25786,10 +24192,8 @@ void REGPARAM2 CPUFUNC(op_b0f8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25806,10 +24210,8 @@ void REGPARAM2 CPUFUNC(op_b0f9_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -25827,10 +24229,8 @@ void REGPARAM2 CPUFUNC(op_b0fa_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25851,10 +24251,8 @@ void REGPARAM2 CPUFUNC(op_b0fb_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -25869,10 +24267,8 @@ void REGPARAM2 CPUFUNC(op_b0fc_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -25886,9 +24282,7 @@ void REGPARAM2 CPUFUNC(op_b100_22)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -25910,10 +24304,8 @@ void REGPARAM2 CPUFUNC(op_b108_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -25928,9 +24320,7 @@ void REGPARAM2 CPUFUNC(op_b110_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -25947,9 +24337,7 @@ void REGPARAM2 CPUFUNC(op_b118_22)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -25967,9 +24355,7 @@ void REGPARAM2 CPUFUNC(op_b120_22)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -25985,9 +24371,7 @@ void REGPARAM2 CPUFUNC(op_b128_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26005,9 +24389,7 @@ void REGPARAM2 CPUFUNC(op_b130_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -26021,9 +24403,7 @@ void REGPARAM2 CPUFUNC(op_b138_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26038,9 +24418,7 @@ void REGPARAM2 CPUFUNC(op_b139_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -26055,9 +24433,7 @@ void REGPARAM2 CPUFUNC(op_b140_22)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26079,10 +24455,8 @@ void REGPARAM2 CPUFUNC(op_b148_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -26097,9 +24471,7 @@ void REGPARAM2 CPUFUNC(op_b150_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26116,9 +24488,7 @@ void REGPARAM2 CPUFUNC(op_b158_22)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26136,9 +24506,7 @@ void REGPARAM2 CPUFUNC(op_b160_22)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26154,9 +24522,7 @@ void REGPARAM2 CPUFUNC(op_b168_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26174,9 +24540,7 @@ void REGPARAM2 CPUFUNC(op_b170_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -26190,9 +24554,7 @@ void REGPARAM2 CPUFUNC(op_b178_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26207,9 +24569,7 @@ void REGPARAM2 CPUFUNC(op_b179_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -26224,9 +24584,7 @@ void REGPARAM2 CPUFUNC(op_b180_22)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26248,10 +24606,8 @@ void REGPARAM2 CPUFUNC(op_b188_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -26266,9 +24622,7 @@ void REGPARAM2 CPUFUNC(op_b190_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26285,9 +24639,7 @@ void REGPARAM2 CPUFUNC(op_b198_22)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26305,9 +24657,7 @@ void REGPARAM2 CPUFUNC(op_b1a0_22)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26323,9 +24673,7 @@ void REGPARAM2 CPUFUNC(op_b1a8_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26343,9 +24691,7 @@ void REGPARAM2 CPUFUNC(op_b1b0_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -26359,9 +24705,7 @@ void REGPARAM2 CPUFUNC(op_b1b8_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26376,9 +24720,7 @@ void REGPARAM2 CPUFUNC(op_b1b9_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -26396,10 +24738,8 @@ void REGPARAM2 CPUFUNC(op_b1c0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -26416,10 +24756,8 @@ void REGPARAM2 CPUFUNC(op_b1c8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -26437,10 +24775,8 @@ void REGPARAM2 CPUFUNC(op_b1d0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -26459,10 +24795,8 @@ void REGPARAM2 CPUFUNC(op_b1d8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -26482,10 +24816,8 @@ void REGPARAM2 CPUFUNC(op_b1e0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
 return;
@@ -26503,10 +24835,8 @@ void REGPARAM2 CPUFUNC(op_b1e8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -26526,10 +24856,8 @@ void REGPARAM2 CPUFUNC(op_b1f0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -26545,10 +24873,8 @@ void REGPARAM2 CPUFUNC(op_b1f8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -26565,10 +24891,8 @@ void REGPARAM2 CPUFUNC(op_b1f9_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -26586,10 +24910,8 @@ void REGPARAM2 CPUFUNC(op_b1fa_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
 return;
@@ -26610,10 +24932,8 @@ void REGPARAM2 CPUFUNC(op_b1fb_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
 }
@@ -26628,10 +24948,8 @@ void REGPARAM2 CPUFUNC(op_b1fc_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
 return;
@@ -26645,9 +24963,7 @@ void REGPARAM2 CPUFUNC(op_c000_22)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26663,9 +24979,7 @@ void REGPARAM2 CPUFUNC(op_c010_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26682,9 +24996,7 @@ void REGPARAM2 CPUFUNC(op_c018_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26702,9 +25014,7 @@ void REGPARAM2 CPUFUNC(op_c020_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26720,9 +25030,7 @@ void REGPARAM2 CPUFUNC(op_c028_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26740,9 +25048,7 @@ void REGPARAM2 CPUFUNC(op_c030_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -26756,9 +25062,7 @@ void REGPARAM2 CPUFUNC(op_c038_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26773,9 +25077,7 @@ void REGPARAM2 CPUFUNC(op_c039_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -26791,9 +25093,7 @@ void REGPARAM2 CPUFUNC(op_c03a_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26812,9 +25112,7 @@ void REGPARAM2 CPUFUNC(op_c03b_22)(uae_u32 opcode)
 {	uae_s8 src = x_get_byte (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -26827,9 +25125,7 @@ void REGPARAM2 CPUFUNC(op_c03c_22)(uae_u32 opcode)
 {{	uae_s8 src = (uae_u8)get_word_ce020_prefetch (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26844,9 +25140,7 @@ void REGPARAM2 CPUFUNC(op_c040_22)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26862,9 +25156,7 @@ void REGPARAM2 CPUFUNC(op_c050_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26881,9 +25173,7 @@ void REGPARAM2 CPUFUNC(op_c058_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26901,9 +25191,7 @@ void REGPARAM2 CPUFUNC(op_c060_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -26919,9 +25207,7 @@ void REGPARAM2 CPUFUNC(op_c068_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26939,9 +25225,7 @@ void REGPARAM2 CPUFUNC(op_c070_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -26955,9 +25239,7 @@ void REGPARAM2 CPUFUNC(op_c078_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -26972,9 +25254,7 @@ void REGPARAM2 CPUFUNC(op_c079_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -26990,9 +25270,7 @@ void REGPARAM2 CPUFUNC(op_c07a_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27011,9 +25289,7 @@ void REGPARAM2 CPUFUNC(op_c07b_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -27026,9 +25302,7 @@ void REGPARAM2 CPUFUNC(op_c07c_22)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27043,9 +25317,7 @@ void REGPARAM2 CPUFUNC(op_c080_22)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27061,9 +25333,7 @@ void REGPARAM2 CPUFUNC(op_c090_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27080,9 +25350,7 @@ void REGPARAM2 CPUFUNC(op_c098_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27100,9 +25368,7 @@ void REGPARAM2 CPUFUNC(op_c0a0_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27118,9 +25384,7 @@ void REGPARAM2 CPUFUNC(op_c0a8_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27138,9 +25402,7 @@ void REGPARAM2 CPUFUNC(op_c0b0_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -27154,9 +25416,7 @@ void REGPARAM2 CPUFUNC(op_c0b8_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27171,9 +25431,7 @@ void REGPARAM2 CPUFUNC(op_c0b9_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -27189,9 +25447,7 @@ void REGPARAM2 CPUFUNC(op_c0ba_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27210,9 +25466,7 @@ void REGPARAM2 CPUFUNC(op_c0bb_22)(uae_u32 opcode)
 {	uae_s32 src = x_get_long (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -27225,9 +25479,7 @@ void REGPARAM2 CPUFUNC(op_c0bc_22)(uae_u32 opcode)
 {{	uae_s32 src = get_long_ce020_prefetch (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -27242,9 +25494,7 @@ void REGPARAM2 CPUFUNC(op_c0c0_22)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (2);
@@ -27260,9 +25510,7 @@ void REGPARAM2 CPUFUNC(op_c0d0_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (2);
@@ -27279,9 +25527,7 @@ void REGPARAM2 CPUFUNC(op_c0d8_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (2);
@@ -27299,9 +25545,7 @@ void REGPARAM2 CPUFUNC(op_c0e0_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (2);
@@ -27317,9 +25561,7 @@ void REGPARAM2 CPUFUNC(op_c0e8_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
@@ -27337,9 +25579,7 @@ void REGPARAM2 CPUFUNC(op_c0f0_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}return;
@@ -27353,9 +25593,7 @@ void REGPARAM2 CPUFUNC(op_c0f8_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
@@ -27370,9 +25608,7 @@ void REGPARAM2 CPUFUNC(op_c0f9_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (6);
@@ -27388,9 +25624,7 @@ void REGPARAM2 CPUFUNC(op_c0fa_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
@@ -27409,9 +25643,7 @@ void REGPARAM2 CPUFUNC(op_c0fb_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}return;
@@ -27424,9 +25656,7 @@ void REGPARAM2 CPUFUNC(op_c0fc_22)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpc (4);
@@ -27494,9 +25724,7 @@ void REGPARAM2 CPUFUNC(op_c110_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27513,9 +25741,7 @@ void REGPARAM2 CPUFUNC(op_c118_22)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27533,9 +25759,7 @@ void REGPARAM2 CPUFUNC(op_c120_22)(uae_u32 opcode)
 {	uae_s8 dst = x_get_byte (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27551,9 +25775,7 @@ void REGPARAM2 CPUFUNC(op_c128_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27571,9 +25793,7 @@ void REGPARAM2 CPUFUNC(op_c130_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -27587,9 +25807,7 @@ void REGPARAM2 CPUFUNC(op_c138_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27604,9 +25822,7 @@ void REGPARAM2 CPUFUNC(op_c139_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s8 dst = x_get_byte (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	x_put_byte (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -27650,9 +25866,7 @@ void REGPARAM2 CPUFUNC(op_c150_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27669,9 +25883,7 @@ void REGPARAM2 CPUFUNC(op_c158_22)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27689,9 +25901,7 @@ void REGPARAM2 CPUFUNC(op_c160_22)(uae_u32 opcode)
 {	uae_s16 dst = x_get_word (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27707,9 +25917,7 @@ void REGPARAM2 CPUFUNC(op_c168_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27727,9 +25935,7 @@ void REGPARAM2 CPUFUNC(op_c170_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -27743,9 +25949,7 @@ void REGPARAM2 CPUFUNC(op_c178_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27760,9 +25964,7 @@ void REGPARAM2 CPUFUNC(op_c179_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s16 dst = x_get_word (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	x_put_word (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -27792,9 +25994,7 @@ void REGPARAM2 CPUFUNC(op_c190_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27811,9 +26011,7 @@ void REGPARAM2 CPUFUNC(op_c198_22)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27831,9 +26029,7 @@ void REGPARAM2 CPUFUNC(op_c1a0_22)(uae_u32 opcode)
 {	uae_s32 dst = x_get_long (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -27849,9 +26045,7 @@ void REGPARAM2 CPUFUNC(op_c1a8_22)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27869,9 +26063,7 @@ void REGPARAM2 CPUFUNC(op_c1b0_22)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_ce020 (m68k_areg (regs, dstreg), next_iword_020ce ());
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -27885,9 +26077,7 @@ void REGPARAM2 CPUFUNC(op_c1b8_22)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_word_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -27902,9 +26092,7 @@ void REGPARAM2 CPUFUNC(op_c1b9_22)(uae_u32 opcode)
 {	uaecptr dsta = get_long_ce020_prefetch (2);
 {	uae_s32 dst = x_get_long (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	x_put_long (dsta, src);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -27919,9 +26107,7 @@ void REGPARAM2 CPUFUNC(op_c1c0_22)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}	m68k_incpc (2);
@@ -27937,9 +26123,7 @@ void REGPARAM2 CPUFUNC(op_c1d0_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (2);
@@ -27956,9 +26140,7 @@ void REGPARAM2 CPUFUNC(op_c1d8_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (2);
@@ -27976,9 +26158,7 @@ void REGPARAM2 CPUFUNC(op_c1e0_22)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (2);
@@ -27994,9 +26174,7 @@ void REGPARAM2 CPUFUNC(op_c1e8_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (4);
@@ -28014,9 +26192,7 @@ void REGPARAM2 CPUFUNC(op_c1f0_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}return;
@@ -28030,9 +26206,7 @@ void REGPARAM2 CPUFUNC(op_c1f8_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (4);
@@ -28047,9 +26221,7 @@ void REGPARAM2 CPUFUNC(op_c1f9_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (6);
@@ -28065,9 +26237,7 @@ void REGPARAM2 CPUFUNC(op_c1fa_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpc (4);
@@ -28086,9 +26256,7 @@ void REGPARAM2 CPUFUNC(op_c1fb_22)(uae_u32 opcode)
 {	uae_s16 src = x_get_word (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}return;
@@ -28101,9 +26269,7 @@ void REGPARAM2 CPUFUNC(op_c1fc_22)(uae_u32 opcode)
 {{	uae_s16 src = get_word_ce020_prefetch (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	regs.ce020memcycles += 20 * cpucycleunit;
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}	m68k_incpc (4);
@@ -28121,11 +26287,9 @@ void REGPARAM2 CPUFUNC(op_d000_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28144,11 +26308,9 @@ void REGPARAM2 CPUFUNC(op_d010_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28168,11 +26330,9 @@ void REGPARAM2 CPUFUNC(op_d018_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28193,11 +26353,9 @@ void REGPARAM2 CPUFUNC(op_d020_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28216,11 +26374,9 @@ void REGPARAM2 CPUFUNC(op_d028_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28241,11 +26397,9 @@ void REGPARAM2 CPUFUNC(op_d030_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -28262,11 +26416,9 @@ void REGPARAM2 CPUFUNC(op_d038_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28284,11 +26436,9 @@ void REGPARAM2 CPUFUNC(op_d039_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -28307,11 +26457,9 @@ void REGPARAM2 CPUFUNC(op_d03a_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28333,11 +26481,9 @@ void REGPARAM2 CPUFUNC(op_d03b_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -28353,11 +26499,9 @@ void REGPARAM2 CPUFUNC(op_d03c_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28375,11 +26519,9 @@ void REGPARAM2 CPUFUNC(op_d040_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28397,11 +26539,9 @@ void REGPARAM2 CPUFUNC(op_d048_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28420,11 +26560,9 @@ void REGPARAM2 CPUFUNC(op_d050_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28444,11 +26582,9 @@ void REGPARAM2 CPUFUNC(op_d058_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28469,11 +26605,9 @@ void REGPARAM2 CPUFUNC(op_d060_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28492,11 +26626,9 @@ void REGPARAM2 CPUFUNC(op_d068_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28517,11 +26649,9 @@ void REGPARAM2 CPUFUNC(op_d070_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -28538,11 +26668,9 @@ void REGPARAM2 CPUFUNC(op_d078_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28560,11 +26688,9 @@ void REGPARAM2 CPUFUNC(op_d079_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -28583,11 +26709,9 @@ void REGPARAM2 CPUFUNC(op_d07a_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28609,11 +26733,9 @@ void REGPARAM2 CPUFUNC(op_d07b_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -28629,11 +26751,9 @@ void REGPARAM2 CPUFUNC(op_d07c_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28651,11 +26771,9 @@ void REGPARAM2 CPUFUNC(op_d080_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28673,11 +26791,9 @@ void REGPARAM2 CPUFUNC(op_d088_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28696,11 +26812,9 @@ void REGPARAM2 CPUFUNC(op_d090_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28720,11 +26834,9 @@ void REGPARAM2 CPUFUNC(op_d098_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28745,11 +26857,9 @@ void REGPARAM2 CPUFUNC(op_d0a0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -28768,11 +26878,9 @@ void REGPARAM2 CPUFUNC(op_d0a8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28793,11 +26901,9 @@ void REGPARAM2 CPUFUNC(op_d0b0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -28814,11 +26920,9 @@ void REGPARAM2 CPUFUNC(op_d0b8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28836,11 +26940,9 @@ void REGPARAM2 CPUFUNC(op_d0b9_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -28859,11 +26961,9 @@ void REGPARAM2 CPUFUNC(op_d0ba_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -28885,11 +26985,9 @@ void REGPARAM2 CPUFUNC(op_d0bb_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -28905,11 +27003,9 @@ void REGPARAM2 CPUFUNC(op_d0bc_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -29158,11 +27254,9 @@ void REGPARAM2 CPUFUNC(op_d110_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29182,11 +27276,9 @@ void REGPARAM2 CPUFUNC(op_d118_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29207,11 +27299,9 @@ void REGPARAM2 CPUFUNC(op_d120_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29230,11 +27320,9 @@ void REGPARAM2 CPUFUNC(op_d128_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -29255,11 +27343,9 @@ void REGPARAM2 CPUFUNC(op_d130_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -29276,11 +27362,9 @@ void REGPARAM2 CPUFUNC(op_d138_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -29298,11 +27382,9 @@ void REGPARAM2 CPUFUNC(op_d139_22)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_byte (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -29371,11 +27453,9 @@ void REGPARAM2 CPUFUNC(op_d150_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29395,11 +27475,9 @@ void REGPARAM2 CPUFUNC(op_d158_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29420,11 +27498,9 @@ void REGPARAM2 CPUFUNC(op_d160_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29443,11 +27519,9 @@ void REGPARAM2 CPUFUNC(op_d168_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -29468,11 +27542,9 @@ void REGPARAM2 CPUFUNC(op_d170_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -29489,11 +27561,9 @@ void REGPARAM2 CPUFUNC(op_d178_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -29511,11 +27581,9 @@ void REGPARAM2 CPUFUNC(op_d179_22)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_word (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -29584,11 +27652,9 @@ void REGPARAM2 CPUFUNC(op_d190_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29608,11 +27674,9 @@ void REGPARAM2 CPUFUNC(op_d198_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29633,11 +27697,9 @@ void REGPARAM2 CPUFUNC(op_d1a0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (2);
@@ -29656,11 +27718,9 @@ void REGPARAM2 CPUFUNC(op_d1a8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -29681,11 +27741,9 @@ void REGPARAM2 CPUFUNC(op_d1b0_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 return;
@@ -29702,11 +27760,9 @@ void REGPARAM2 CPUFUNC(op_d1b8_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (4);
@@ -29724,11 +27780,9 @@ void REGPARAM2 CPUFUNC(op_d1b9_22)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	x_put_long (dsta, newv);
 }}}}}}}	regs.ce020memcycles += 2 * cpucycleunit;
 	m68k_incpc (6);
@@ -30657,9 +28711,7 @@ void REGPARAM2 CPUFUNC(op_e0d0_22)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30679,9 +28731,7 @@ void REGPARAM2 CPUFUNC(op_e0d8_22)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30702,9 +28752,7 @@ void REGPARAM2 CPUFUNC(op_e0e0_22)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30723,9 +28771,7 @@ void REGPARAM2 CPUFUNC(op_e0e8_22)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30746,9 +28792,7 @@ void REGPARAM2 CPUFUNC(op_e0f0_22)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30765,9 +28809,7 @@ void REGPARAM2 CPUFUNC(op_e0f8_22)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -30785,9 +28827,7 @@ void REGPARAM2 CPUFUNC(op_e0f9_22)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31532,9 +29572,7 @@ void REGPARAM2 CPUFUNC(op_e1d0_22)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -31556,9 +29594,7 @@ void REGPARAM2 CPUFUNC(op_e1d8_22)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -31581,9 +29617,7 @@ void REGPARAM2 CPUFUNC(op_e1e0_22)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -31604,9 +29638,7 @@ void REGPARAM2 CPUFUNC(op_e1e8_22)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -31629,9 +29661,7 @@ void REGPARAM2 CPUFUNC(op_e1f0_22)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -31650,9 +29680,7 @@ void REGPARAM2 CPUFUNC(op_e1f8_22)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -31672,9 +29700,7 @@ void REGPARAM2 CPUFUNC(op_e1f9_22)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -31694,9 +29720,7 @@ void REGPARAM2 CPUFUNC(op_e2d0_22)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31715,9 +29739,7 @@ void REGPARAM2 CPUFUNC(op_e2d8_22)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31737,9 +29759,7 @@ void REGPARAM2 CPUFUNC(op_e2e0_22)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31757,9 +29777,7 @@ void REGPARAM2 CPUFUNC(op_e2e8_22)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31779,9 +29797,7 @@ void REGPARAM2 CPUFUNC(op_e2f0_22)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31797,9 +29813,7 @@ void REGPARAM2 CPUFUNC(op_e2f8_22)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31816,9 +29830,7 @@ void REGPARAM2 CPUFUNC(op_e2f9_22)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31836,9 +29848,7 @@ void REGPARAM2 CPUFUNC(op_e3d0_22)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31857,9 +29867,7 @@ void REGPARAM2 CPUFUNC(op_e3d8_22)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31879,9 +29887,7 @@ void REGPARAM2 CPUFUNC(op_e3e0_22)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31899,9 +29905,7 @@ void REGPARAM2 CPUFUNC(op_e3e8_22)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31921,9 +29925,7 @@ void REGPARAM2 CPUFUNC(op_e3f0_22)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31939,9 +29941,7 @@ void REGPARAM2 CPUFUNC(op_e3f8_22)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31958,9 +29958,7 @@ void REGPARAM2 CPUFUNC(op_e3f9_22)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -31979,9 +29977,7 @@ void REGPARAM2 CPUFUNC(op_e4d0_22)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32001,9 +29997,7 @@ void REGPARAM2 CPUFUNC(op_e4d8_22)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32024,9 +30018,7 @@ void REGPARAM2 CPUFUNC(op_e4e0_22)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32045,9 +30037,7 @@ void REGPARAM2 CPUFUNC(op_e4e8_22)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32068,9 +30058,7 @@ void REGPARAM2 CPUFUNC(op_e4f0_22)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32087,9 +30075,7 @@ void REGPARAM2 CPUFUNC(op_e4f8_22)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32107,9 +30093,7 @@ void REGPARAM2 CPUFUNC(op_e4f9_22)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32128,9 +30112,7 @@ void REGPARAM2 CPUFUNC(op_e5d0_22)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32150,9 +30132,7 @@ void REGPARAM2 CPUFUNC(op_e5d8_22)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32173,9 +30153,7 @@ void REGPARAM2 CPUFUNC(op_e5e0_22)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32194,9 +30172,7 @@ void REGPARAM2 CPUFUNC(op_e5e8_22)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32217,9 +30193,7 @@ void REGPARAM2 CPUFUNC(op_e5f0_22)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32236,9 +30210,7 @@ void REGPARAM2 CPUFUNC(op_e5f8_22)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32256,9 +30228,7 @@ void REGPARAM2 CPUFUNC(op_e5f9_22)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	x_put_word (dataa, val);
@@ -32277,9 +30247,7 @@ void REGPARAM2 CPUFUNC(op_e6d0_22)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32298,9 +30266,7 @@ void REGPARAM2 CPUFUNC(op_e6d8_22)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32320,9 +30286,7 @@ void REGPARAM2 CPUFUNC(op_e6e0_22)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32340,9 +30304,7 @@ void REGPARAM2 CPUFUNC(op_e6e8_22)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32362,9 +30324,7 @@ void REGPARAM2 CPUFUNC(op_e6f0_22)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32380,9 +30340,7 @@ void REGPARAM2 CPUFUNC(op_e6f8_22)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32399,9 +30357,7 @@ void REGPARAM2 CPUFUNC(op_e6f9_22)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32419,9 +30375,7 @@ void REGPARAM2 CPUFUNC(op_e7d0_22)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32440,9 +30394,7 @@ void REGPARAM2 CPUFUNC(op_e7d8_22)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32462,9 +30414,7 @@ void REGPARAM2 CPUFUNC(op_e7e0_22)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32482,9 +30432,7 @@ void REGPARAM2 CPUFUNC(op_e7e8_22)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32504,9 +30452,7 @@ void REGPARAM2 CPUFUNC(op_e7f0_22)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32522,9 +30468,7 @@ void REGPARAM2 CPUFUNC(op_e7f8_22)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -32541,9 +30485,7 @@ void REGPARAM2 CPUFUNC(op_e7f9_22)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	x_put_word (dataa, val);
 }}}}	regs.ce020memcycles += 2 * cpucycleunit;
@@ -34,9 +34,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0000_31)(uae_u32 opcode)
 {{	uae_s8 src = get_ibyte_mmu (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -50,9 +48,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0010_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -68,9 +64,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0018_31)(uae_u32 opcode)
 {	uae_s8 dst = get_byte_mmu (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -87,9 +81,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0020_31)(uae_u32 opcode)
 {	uae_s8 dst = get_byte_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -104,9 +96,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0028_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -123,9 +113,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0030_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -138,9 +126,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0038_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -154,9 +140,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0039_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (4);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -182,9 +166,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0040_31)(uae_u32 opcode)
 {{	uae_s16 src = get_iword_mmu (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	m68k_incpci (4);
 return 8 * CYCLE_UNIT / 2;
@@ -198,9 +180,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0050_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -216,9 +196,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0058_31)(uae_u32 opcode)
 {	uae_s16 dst = get_word_mmu (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -235,9 +213,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0060_31)(uae_u32 opcode)
 {	uae_s16 dst = get_word_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -252,9 +228,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0068_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -271,9 +245,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0070_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s16 dst = get_word_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -286,9 +258,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0078_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -302,9 +272,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0079_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (4);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -331,9 +299,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0080_31)(uae_u32 opcode)
 {{	uae_s32 src = get_ilong_mmu (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	m68k_incpci (6);
 return 12 * CYCLE_UNIT / 2;
@@ -347,9 +313,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0090_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -365,9 +329,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0098_31)(uae_u32 opcode)
 {	uae_s32 dst = get_long_mmu (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -384,9 +346,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_00a0_31)(uae_u32 opcode)
 {	uae_s32 dst = get_long_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -401,9 +361,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_00a8_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (6);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -420,9 +378,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_00b0_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s32 dst = get_long_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 32 * CYCLE_UNIT / 2;
@@ -435,9 +391,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_00b8_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (6);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -451,9 +405,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_00b9_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (6);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (10);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -1339,9 +1291,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0200_31)(uae_u32 opcode)
 {{	uae_s8 src = get_ibyte_mmu (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -1355,9 +1305,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0210_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -1373,9 +1321,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0218_31)(uae_u32 opcode)
 {	uae_s8 dst = get_byte_mmu (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -1392,9 +1338,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0220_31)(uae_u32 opcode)
 {	uae_s8 dst = get_byte_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -1409,9 +1353,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0228_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -1428,9 +1370,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0230_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -1443,9 +1383,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0238_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -1459,9 +1397,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0239_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (4);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -1487,9 +1423,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0240_31)(uae_u32 opcode)
 {{	uae_s16 src = get_iword_mmu (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	m68k_incpci (4);
 return 8 * CYCLE_UNIT / 2;
@@ -1503,9 +1437,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0250_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -1521,9 +1453,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0258_31)(uae_u32 opcode)
 {	uae_s16 dst = get_word_mmu (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -1540,9 +1470,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0260_31)(uae_u32 opcode)
 {	uae_s16 dst = get_word_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -1557,9 +1485,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0268_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -1576,9 +1502,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0270_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s16 dst = get_word_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -1591,9 +1515,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0278_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -1607,9 +1529,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0279_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (4);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -1636,9 +1556,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0280_31)(uae_u32 opcode)
 {{	uae_s32 src = get_ilong_mmu (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	m68k_incpci (6);
 return 12 * CYCLE_UNIT / 2;
@@ -1652,9 +1570,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0290_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -1670,9 +1586,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0298_31)(uae_u32 opcode)
 {	uae_s32 dst = get_long_mmu (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -1689,9 +1603,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_02a0_31)(uae_u32 opcode)
 {	uae_s32 dst = get_long_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -1706,9 +1618,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_02a8_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (6);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -1725,9 +1635,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_02b0_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s32 dst = get_long_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 32 * CYCLE_UNIT / 2;
@@ -1740,9 +1648,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_02b8_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (6);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -1756,9 +1662,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_02b9_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (6);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (10);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -1918,11 +1822,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0400_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -1939,11 +1841,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0410_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -1962,11 +1862,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0418_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -1986,11 +1884,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0420_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -2008,11 +1904,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0428_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -2032,11 +1926,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0430_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
 }}}}}}}}return 24 * CYCLE_UNIT / 2;
@@ -2052,11 +1944,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0438_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -2073,11 +1963,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0439_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -2094,11 +1982,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0440_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpci (4);
 return 8 * CYCLE_UNIT / 2;
@@ -2115,11 +2001,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0450_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -2138,11 +2022,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0458_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -2162,11 +2044,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0460_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -2184,11 +2064,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0468_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -2208,11 +2086,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0470_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
 }}}}}}}}return 20 * CYCLE_UNIT / 2;
@@ -2228,11 +2104,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0478_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -2249,11 +2123,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0479_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -2270,11 +2142,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0480_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpci (6);
 return 12 * CYCLE_UNIT / 2;
@@ -2291,11 +2161,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0490_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -2314,11 +2182,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0498_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -2338,11 +2204,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_04a0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -2360,11 +2224,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_04a8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -2384,11 +2246,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_04b0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
 }}}}}}}}return 32 * CYCLE_UNIT / 2;
@@ -2404,11 +2264,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_04b8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -2425,11 +2283,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_04b9_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (10);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -2582,11 +2438,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0600_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -2603,11 +2457,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0610_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -2626,11 +2478,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0618_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -2650,11 +2500,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0620_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -2672,11 +2520,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0628_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -2696,11 +2542,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0630_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
 }}}}}}}}return 24 * CYCLE_UNIT / 2;
@@ -2716,11 +2560,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0638_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -2737,11 +2579,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0639_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -2758,11 +2598,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0640_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpci (4);
 return 8 * CYCLE_UNIT / 2;
@@ -2779,11 +2617,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0650_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -2802,11 +2638,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0658_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -2826,11 +2660,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0660_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -2848,11 +2680,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0668_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -2872,11 +2702,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0670_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
 }}}}}}}}return 20 * CYCLE_UNIT / 2;
@@ -2892,11 +2720,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0678_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -2913,11 +2739,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0679_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -2934,11 +2758,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0680_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpci (6);
 return 12 * CYCLE_UNIT / 2;
@@ -2955,11 +2777,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0690_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -2978,11 +2798,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_0698_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -3002,11 +2820,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_06a0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -3024,11 +2840,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_06a8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -3048,11 +2862,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_06b0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
 }}}}}}}}return 32 * CYCLE_UNIT / 2;
@@ -3068,11 +2880,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_06b8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -3089,11 +2899,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_06b9_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (10);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -3840,9 +3648,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a00_31)(uae_u32 opcode)
 {{	uae_s8 src = get_ibyte_mmu (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -3856,9 +3662,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a10_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -3874,9 +3678,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a18_31)(uae_u32 opcode)
 {	uae_s8 dst = get_byte_mmu (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -3893,9 +3695,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a20_31)(uae_u32 opcode)
 {	uae_s8 dst = get_byte_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -3910,9 +3710,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a28_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -3929,9 +3727,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a30_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -3944,9 +3740,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a38_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -3960,9 +3754,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a39_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (4);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -3988,9 +3780,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a40_31)(uae_u32 opcode)
 {{	uae_s16 src = get_iword_mmu (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	m68k_incpci (4);
 return 8 * CYCLE_UNIT / 2;
@@ -4004,9 +3794,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a50_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -4022,9 +3810,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a58_31)(uae_u32 opcode)
 {	uae_s16 dst = get_word_mmu (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -4041,9 +3827,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a60_31)(uae_u32 opcode)
 {	uae_s16 dst = get_word_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -4058,9 +3842,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a68_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -4077,9 +3859,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a70_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s16 dst = get_word_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -4092,9 +3872,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a78_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -4108,9 +3886,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a79_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (4);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -4137,9 +3913,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a80_31)(uae_u32 opcode)
 {{	uae_s32 src = get_ilong_mmu (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	m68k_incpci (6);
 return 12 * CYCLE_UNIT / 2;
@@ -4156,9 +3930,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a90_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -4174,9 +3946,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0a98_31)(uae_u32 opcode)
 {	uae_s32 dst = get_long_mmu (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -4193,9 +3963,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0aa0_31)(uae_u32 opcode)
 {	uae_s32 dst = get_long_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -4210,9 +3978,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0aa8_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (6);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -4229,9 +3995,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ab0_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s32 dst = get_long_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 32 * CYCLE_UNIT / 2;
@@ -4244,9 +4008,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ab8_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (6);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -4260,9 +4022,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ab9_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (6);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (10);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -4283,10 +4043,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ad0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (4);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -4310,10 +4068,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ad8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (4);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -4338,10 +4094,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ae0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (4);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -4364,10 +4118,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ae8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (6);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -4392,10 +4144,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0af0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xff) | (dst & 0xff);
@@ -4416,10 +4166,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0af8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (6);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -4441,10 +4189,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0af9_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(m68k_dreg (regs, rc))) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (8);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -4463,10 +4209,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c00_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -4482,10 +4226,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c10_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -4502,10 +4244,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c18_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -4523,10 +4263,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c20_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 18 * CYCLE_UNIT / 2;
 }
@@ -4542,10 +4280,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c28_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (6);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -4563,10 +4299,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c30_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 20 * CYCLE_UNIT / 2;
 }
 
@@ -4580,10 +4314,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c38_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (6);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -4598,10 +4330,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c39_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (8);
 return 24 * CYCLE_UNIT / 2;
 }
@@ -4619,10 +4349,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c3a_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (6);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -4644,10 +4372,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c3b_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 20 * CYCLE_UNIT / 2;
 }
 
@@ -4662,10 +4388,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c40_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (4);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -4681,10 +4405,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c50_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -4701,10 +4423,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c58_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -4722,10 +4442,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c60_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 14 * CYCLE_UNIT / 2;
 }
@@ -4741,10 +4459,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c68_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (6);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -4762,10 +4478,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c70_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
 
@@ -4779,10 +4493,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c78_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (6);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -4797,10 +4509,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c79_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (8);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -4818,10 +4528,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c7a_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (6);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -4843,10 +4551,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c7b_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
 
@@ -4861,10 +4567,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c80_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (6);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -4880,10 +4584,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c90_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (6);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -4900,10 +4602,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0c98_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (6);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -4921,10 +4621,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ca0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (6);
 return 22 * CYCLE_UNIT / 2;
 }
@@ -4940,10 +4638,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ca8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (8);
 return 24 * CYCLE_UNIT / 2;
 }
@@ -4961,10 +4657,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cb0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 24 * CYCLE_UNIT / 2;
 }
 
@@ -4978,10 +4672,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cb8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (8);
 return 24 * CYCLE_UNIT / 2;
 }
@@ -4996,10 +4688,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cb9_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (10);
 return 28 * CYCLE_UNIT / 2;
 }
@@ -5017,10 +4707,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cba_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (8);
 return 24 * CYCLE_UNIT / 2;
 }
@@ -5042,10 +4730,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cbb_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 24 * CYCLE_UNIT / 2;
 }
 
@@ -5064,10 +4750,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cd0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (4);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -5091,10 +4775,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cd8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (4);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -5119,10 +4801,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ce0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (4);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -5145,10 +4825,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ce8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (6);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -5173,10 +4851,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cf0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = (m68k_dreg(regs, rc) & ~0xffff) | (dst & 0xffff);
@@ -5197,10 +4873,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cf8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (6);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -5222,10 +4896,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cf9_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, rc))) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (8);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -5246,19 +4918,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0cfc_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(m68k_dreg (regs, (extra >> 16) & 7))) < 0;
 	int flgo = ((uae_s16)(dst1)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, (extra >> 16) & 7))) > ((uae_u16)(dst1)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, (extra >> 16) & 7))) > ((uae_u16)(dst1))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()) {
 {uae_u32 newv = ((uae_s16)(dst2)) - ((uae_s16)(m68k_dreg (regs, extra & 7)));
 {	int flgs = ((uae_s16)(m68k_dreg (regs, extra & 7))) < 0;
 	int flgo = ((uae_s16)(dst2)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(m68k_dreg (regs, extra & 7))) > ((uae_u16)(dst2)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(m68k_dreg (regs, extra & 7))) > ((uae_u16)(dst2))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()) {
 	put_word_mmu (rn1, m68k_dreg (regs, (extra >> 22) & 7));
 	put_word_mmu (rn2, m68k_dreg (regs, (extra >> 6) & 7));
@@ -5850,10 +5518,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ed0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (4);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -5877,10 +5543,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ed8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (4);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -5905,10 +5569,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ee0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (4);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -5931,10 +5593,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ee8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (6);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -5959,10 +5619,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ef0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, (m68k_dreg (regs, ru)));
 }else{	m68k_dreg(regs, rc) = dst;
@@ -5983,10 +5641,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ef8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (6);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -6008,10 +5664,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_0ef9_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, rc))) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	m68k_incpci (8);
 	if (GET_ZFLG ()){	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, (m68k_dreg (regs, ru)));
@@ -6032,19 +5686,15 @@ uae_u32 REGPARAM2 CPUFUNC(op_0efc_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(m68k_dreg (regs, (extra >> 16) & 7))) < 0;
 	int flgo = ((uae_s32)(dst1)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, (extra >> 16) & 7))) > ((uae_u32)(dst1)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, (extra >> 16) & 7))) > ((uae_u32)(dst1))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()) {
 {uae_u32 newv = ((uae_s32)(dst2)) - ((uae_s32)(m68k_dreg (regs, extra & 7)));
 {	int flgs = ((uae_s32)(m68k_dreg (regs, extra & 7))) < 0;
 	int flgo = ((uae_s32)(dst2)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(m68k_dreg (regs, extra & 7))) > ((uae_u32)(dst2)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(m68k_dreg (regs, extra & 7))) > ((uae_u32)(dst2))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	if (GET_ZFLG ()) {
 	put_long_mmu (rn1, m68k_dreg (regs, (extra >> 22) & 7));
 	put_long_mmu (rn2, m68k_dreg (regs, (extra >> 6) & 7));
@@ -6064,9 +5714,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1000_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpci (2);
 }}}return 4 * CYCLE_UNIT / 2;
@@ -6079,9 +5727,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1010_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = get_byte_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpci (2);
 }}}}return 8 * CYCLE_UNIT / 2;
@@ -6098,9 +5744,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1018_31)(uae_u32 opcode)
 	mmufixup[0].value = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpci (2);
 }}}}return 8 * CYCLE_UNIT / 2;
@@ -6118,9 +5762,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1020_31)(uae_u32 opcode)
 	mmufixup[0].value = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) = srca;
 {	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpci (2);
 }}}}return 10 * CYCLE_UNIT / 2;
@@ -6133,9 +5775,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1028_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpci (4);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -6150,9 +5790,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1030_31)(uae_u32 opcode)
 	m68k_incpci (2);
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s8 src = get_byte_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -6163,9 +5801,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1038_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpci (4);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -6177,9 +5813,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1039_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpci (6);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -6192,9 +5826,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_103a_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpci (4);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -6210,9 +5842,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_103b_31)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s8 src = get_byte_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -6222,9 +5852,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_103c_31)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte_mmu (2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+{	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 	m68k_incpci (4);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -6237,9 +5865,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1080_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6254,9 +5880,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1090_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6275,9 +5899,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1098_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6297,9 +5919,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10a0_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6314,9 +5934,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10a8_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6333,9 +5951,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10b0_31)(uae_u32 opcode)
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -6348,9 +5964,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10b8_31)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6364,9 +5978,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10b9_31)(uae_u32 opcode)
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6381,9 +5993,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10ba_31)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6401,9 +6011,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10bb_31)(uae_u32 opcode)
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -6415,9 +6023,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10bc_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte_mmu (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6432,9 +6038,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10c0_31)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6450,9 +6054,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10d0_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6472,9 +6074,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10d8_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6495,9 +6095,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10e0_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6513,9 +6111,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10e8_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6533,9 +6129,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10f0_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -6549,9 +6143,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10f8_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6566,9 +6158,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10f9_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6584,9 +6174,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10fa_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6605,9 +6193,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10fb_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -6620,9 +6206,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_10fc_31)(uae_u32 opcode)
 {{	uae_s8 src = get_ibyte_mmu (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6638,9 +6222,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1100_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6657,9 +6239,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1110_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6680,9 +6260,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1118_31)(uae_u32 opcode)
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6704,9 +6282,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1120_31)(uae_u32 opcode)
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6723,9 +6299,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1128_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6744,9 +6318,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1130_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -6761,9 +6333,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1138_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6779,9 +6349,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1139_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6798,9 +6366,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_113a_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6820,9 +6386,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_113b_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -6836,9 +6400,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_113c_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6852,9 +6414,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1140_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6869,9 +6429,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1150_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6890,9 +6448,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1158_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6912,9 +6468,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1160_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6929,9 +6483,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1168_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6948,9 +6500,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1170_31)(uae_u32 opcode)
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6964,9 +6514,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1178_31)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6980,9 +6528,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1179_31)(uae_u32 opcode)
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -6997,9 +6543,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_117a_31)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7017,9 +6561,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_117b_31)(uae_u32 opcode)
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7032,9 +6574,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_117c_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte_mmu (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7050,9 +6590,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1180_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (2);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -7068,9 +6606,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1190_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (2);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -7090,9 +6626,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_1198_31)(uae_u32 opcode)
 	m68k_incpci (2);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -7113,9 +6647,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11a0_31)(uae_u32 opcode)
 	m68k_incpci (2);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 18 * CYCLE_UNIT / 2;
@@ -7131,9 +6663,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11a8_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (4);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -7150,9 +6680,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11b0_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}}return 20 * CYCLE_UNIT / 2;
@@ -7167,9 +6695,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11b8_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (4);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -7184,9 +6710,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11b9_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (6);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -7202,9 +6726,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11ba_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (4);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -7222,9 +6744,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11bb_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}}return 20 * CYCLE_UNIT / 2;
@@ -7238,9 +6758,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11bc_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (4);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -7252,9 +6770,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11c0_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7268,9 +6784,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11d0_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7288,9 +6802,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11d8_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7309,9 +6821,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11e0_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7325,9 +6835,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11e8_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7343,9 +6851,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11f0_31)(uae_u32 opcode)
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7358,9 +6864,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11f8_31)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7373,9 +6877,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11f9_31)(uae_u32 opcode)
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7389,9 +6891,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11fa_31)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7408,9 +6908,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11fb_31)(uae_u32 opcode)
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7422,9 +6920,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_11fc_31)(uae_u32 opcode)
 {
 {{	uae_s8 src = get_ibyte_mmu (2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7437,9 +6933,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13c0_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_ilong_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7453,9 +6947,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13d0_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7473,9 +6965,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13d8_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = get_ilong_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7494,9 +6984,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13e0_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_ilong_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7510,9 +6998,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13e8_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7528,9 +7014,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13f0_31)(uae_u32 opcode)
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7543,9 +7027,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13f8_31)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7558,9 +7040,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13f9_31)(uae_u32 opcode)
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (10);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7574,9 +7054,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13fa_31)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7593,9 +7071,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13fb_31)(uae_u32 opcode)
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s8 src = get_byte_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7607,9 +7083,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_13fc_31)(uae_u32 opcode)
 {
 {{	uae_s8 src = get_ibyte_mmu (2);
 {	uaecptr dsta = get_ilong_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -7622,9 +7096,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2000_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpci (2);
 }}}return 4 * CYCLE_UNIT / 2;
@@ -7636,9 +7108,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2008_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpci (2);
 }}}return 4 * CYCLE_UNIT / 2;
@@ -7651,9 +7121,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2010_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = get_long_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpci (2);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -7670,9 +7138,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2018_31)(uae_u32 opcode)
 	mmufixup[0].value = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) += 4;
 {	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpci (2);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -7690,9 +7156,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2020_31)(uae_u32 opcode)
 	mmufixup[0].value = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) = srca;
 {	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpci (2);
 }}}}return 14 * CYCLE_UNIT / 2;
@@ -7705,9 +7169,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2028_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpci (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -7722,9 +7184,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2030_31)(uae_u32 opcode)
 	m68k_incpci (2);
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s32 src = get_long_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -7735,9 +7195,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2038_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpci (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -7749,9 +7207,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2039_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpci (6);
 }}}}return 20 * CYCLE_UNIT / 2;
@@ -7764,9 +7220,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_203a_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpci (4);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -7782,9 +7236,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_203b_31)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s32 src = get_long_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -7794,9 +7246,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_203c_31)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong_mmu (2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpci (6);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -7959,9 +7409,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2080_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -7975,9 +7423,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2088_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -7992,9 +7438,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2090_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8013,9 +7457,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2098_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8035,9 +7477,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20a0_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8052,9 +7492,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20a8_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8071,9 +7509,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20b0_31)(uae_u32 opcode)
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -8086,9 +7522,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20b8_31)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8102,9 +7536,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20b9_31)(uae_u32 opcode)
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8119,9 +7551,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20ba_31)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8139,9 +7569,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20bb_31)(uae_u32 opcode)
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -8153,9 +7581,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20bc_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong_mmu (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8170,9 +7596,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20c0_31)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8187,9 +7611,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20c8_31)(uae_u32 opcode)
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8205,9 +7627,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20d0_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8227,9 +7647,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20d8_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8250,9 +7668,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20e0_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8268,9 +7684,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20e8_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8288,9 +7702,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20f0_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -8304,9 +7716,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20f8_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8321,9 +7731,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20f9_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8339,9 +7747,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20fa_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8360,9 +7766,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20fb_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -8375,9 +7779,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_20fc_31)(uae_u32 opcode)
 {{	uae_s32 src = get_ilong_mmu (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8393,9 +7795,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2100_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8411,9 +7811,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2108_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8430,9 +7828,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2110_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8453,9 +7849,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2118_31)(uae_u32 opcode)
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8477,9 +7871,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2120_31)(uae_u32 opcode)
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8496,9 +7888,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2128_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8517,9 +7907,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2130_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -8534,9 +7922,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2138_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8552,9 +7938,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2139_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8571,9 +7955,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_213a_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8593,9 +7975,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_213b_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -8609,9 +7989,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_213c_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8625,9 +8003,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2140_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8641,9 +8017,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2148_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8658,9 +8032,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2150_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8679,9 +8051,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2158_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8701,9 +8071,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2160_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8718,9 +8086,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2168_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8740,9 +8106,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2170_31)(uae_u32 opcode)
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8756,9 +8120,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2178_31)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8772,9 +8134,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2179_31)(uae_u32 opcode)
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8789,9 +8149,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_217a_31)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8809,9 +8167,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_217b_31)(uae_u32 opcode)
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8824,9 +8180,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_217c_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong_mmu (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -8842,9 +8196,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2180_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (2);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -8859,9 +8211,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2188_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (2);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -8877,9 +8227,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2190_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (2);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -8899,9 +8247,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_2198_31)(uae_u32 opcode)
 	m68k_incpci (2);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -8922,9 +8268,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21a0_31)(uae_u32 opcode)
 	m68k_incpci (2);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 26 * CYCLE_UNIT / 2;
@@ -8940,9 +8284,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21a8_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (4);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 28 * CYCLE_UNIT / 2;
@@ -8959,9 +8301,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21b0_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}}return 28 * CYCLE_UNIT / 2;
@@ -8976,9 +8316,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21b8_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (4);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 28 * CYCLE_UNIT / 2;
@@ -8993,9 +8331,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21b9_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (6);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 32 * CYCLE_UNIT / 2;
@@ -9011,9 +8347,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21ba_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (4);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 28 * CYCLE_UNIT / 2;
@@ -9031,9 +8365,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21bb_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}}return 28 * CYCLE_UNIT / 2;
@@ -9047,9 +8379,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21bc_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (6);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}return 24 * CYCLE_UNIT / 2;
@@ -9061,9 +8391,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21c0_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9076,9 +8404,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21c8_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9092,9 +8418,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21d0_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9112,9 +8436,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21d8_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9133,9 +8455,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21e0_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9149,9 +8469,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21e8_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9167,9 +8485,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21f0_31)(uae_u32 opcode)
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9182,9 +8498,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21f8_31)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9197,9 +8511,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21f9_31)(uae_u32 opcode)
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9213,9 +8525,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21fa_31)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9232,9 +8542,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21fb_31)(uae_u32 opcode)
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9246,9 +8554,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_21fc_31)(uae_u32 opcode)
 {
 {{	uae_s32 src = get_ilong_mmu (2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9261,9 +8567,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23c0_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_ilong_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9276,9 +8580,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23c8_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = get_ilong_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9292,9 +8594,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23d0_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9312,9 +8612,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23d8_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uaecptr dsta = get_ilong_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9333,9 +8631,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23e0_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_ilong_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9349,9 +8645,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23e8_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9367,9 +8661,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23f0_31)(uae_u32 opcode)
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9382,9 +8674,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23f8_31)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9397,9 +8687,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23f9_31)(uae_u32 opcode)
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (10);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9413,9 +8701,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23fa_31)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9432,9 +8718,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23fb_31)(uae_u32 opcode)
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s32 src = get_long_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9446,9 +8730,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_23fc_31)(uae_u32 opcode)
 {
 {{	uae_s32 src = get_ilong_mmu (2);
 {	uaecptr dsta = get_ilong_mmu (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (10);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -9461,9 +8743,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3000_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpci (2);
 }}}return 4 * CYCLE_UNIT / 2;
@@ -9475,9 +8755,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3008_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg (regs, srcreg);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpci (2);
 }}}return 4 * CYCLE_UNIT / 2;
@@ -9490,9 +8768,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3010_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = get_word_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpci (2);
 }}}}return 8 * CYCLE_UNIT / 2;
@@ -9509,9 +8785,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3018_31)(uae_u32 opcode)
 	mmufixup[0].value = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) += 2;
 {	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpci (2);
 }}}}return 8 * CYCLE_UNIT / 2;
@@ -9529,9 +8803,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3020_31)(uae_u32 opcode)
 	mmufixup[0].value = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) = srca;
 {	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpci (2);
 }}}}return 10 * CYCLE_UNIT / 2;
@@ -9544,9 +8816,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3028_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpci (4);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -9561,9 +8831,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3030_31)(uae_u32 opcode)
 	m68k_incpci (2);
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s16 src = get_word_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -9574,9 +8842,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3038_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpci (4);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -9588,9 +8854,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3039_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpci (6);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -9603,9 +8867,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_303a_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpci (4);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -9621,9 +8883,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_303b_31)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s16 src = get_word_mmu (srca);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -9633,9 +8893,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_303c_31)(uae_u32 opcode)
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword_mmu (2);
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+{	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 	m68k_incpci (4);
 }}}return 8 * CYCLE_UNIT / 2;
@@ -9810,9 +9068,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3080_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -9826,9 +9082,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3088_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -9843,9 +9097,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3090_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -9864,9 +9116,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3098_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -9886,9 +9136,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30a0_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -9903,9 +9151,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30a8_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -9922,9 +9168,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30b0_31)(uae_u32 opcode)
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -9937,9 +9181,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30b8_31)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -9953,9 +9195,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30b9_31)(uae_u32 opcode)
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -9970,9 +9210,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30ba_31)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -9990,9 +9228,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30bb_31)(uae_u32 opcode)
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -10004,9 +9240,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30bc_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword_mmu (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10021,9 +9255,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30c0_31)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10038,9 +9270,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30c8_31)(uae_u32 opcode)
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10056,9 +9286,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30d0_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10078,9 +9306,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30d8_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10101,9 +9327,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30e0_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10119,9 +9343,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30e8_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10139,9 +9361,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30f0_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -10155,9 +9375,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30f8_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10172,9 +9390,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30f9_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10190,9 +9406,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30fa_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10211,9 +9425,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30fb_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -10226,9 +9438,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_30fc_31)(uae_u32 opcode)
 {{	uae_s16 src = get_iword_mmu (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 	m68k_areg (regs, dstreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10244,9 +9454,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3100_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10262,9 +9470,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3108_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10281,9 +9487,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3110_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10304,9 +9508,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3118_31)(uae_u32 opcode)
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10328,9 +9530,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3120_31)(uae_u32 opcode)
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10347,9 +9547,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3128_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10368,9 +9566,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3130_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -10385,9 +9581,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3138_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10403,9 +9597,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3139_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10422,9 +9614,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_313a_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10444,9 +9634,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_313b_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -10460,9 +9648,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_313c_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	dsta = m68k_areg (regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10476,9 +9662,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3140_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10492,9 +9676,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3148_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10509,9 +9691,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3150_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10530,9 +9710,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3158_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10552,9 +9730,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3160_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10569,9 +9745,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3168_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10588,9 +9762,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3170_31)(uae_u32 opcode)
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10604,9 +9776,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3178_31)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10620,9 +9790,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3179_31)(uae_u32 opcode)
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10637,9 +9805,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_317a_31)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10657,9 +9823,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_317b_31)(uae_u32 opcode)
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10672,9 +9836,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_317c_31)(uae_u32 opcode)
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword_mmu (2);
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10690,9 +9852,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3180_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (2);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -10707,9 +9867,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3188_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (2);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}return 12 * CYCLE_UNIT / 2;
@@ -10725,9 +9883,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3190_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (2);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -10747,9 +9903,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_3198_31)(uae_u32 opcode)
 	m68k_incpci (2);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -10770,9 +9924,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31a0_31)(uae_u32 opcode)
 	m68k_incpci (2);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 18 * CYCLE_UNIT / 2;
@@ -10788,9 +9940,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31a8_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (4);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -10807,9 +9957,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31b0_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}}return 20 * CYCLE_UNIT / 2;
@@ -10824,9 +9972,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31b8_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (4);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -10841,9 +9987,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31b9_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (6);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -10859,9 +10003,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31ba_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (4);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 20 * CYCLE_UNIT / 2;
@@ -10879,9 +10021,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31bb_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta;
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}}return 20 * CYCLE_UNIT / 2;
@@ -10895,9 +10035,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31bc_31)(uae_u32 opcode)
 {	uaecptr dsta;
 	m68k_incpci (4);
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}return 16 * CYCLE_UNIT / 2;
@@ -10909,9 +10047,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31c0_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10924,9 +10060,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31c8_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10940,9 +10074,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31d0_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10960,9 +10092,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31d8_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10981,9 +10111,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31e0_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -10997,9 +10125,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31e8_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11015,9 +10141,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31f0_31)(uae_u32 opcode)
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11030,9 +10154,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31f8_31)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11045,9 +10167,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31f9_31)(uae_u32 opcode)
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11061,9 +10181,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31fa_31)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11080,9 +10198,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31fb_31)(uae_u32 opcode)
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11094,9 +10210,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_31fc_31)(uae_u32 opcode)
 {
 {{	uae_s16 src = get_iword_mmu (2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11109,9 +10223,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33c0_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uaecptr dsta = get_ilong_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11124,9 +10236,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33c8_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg (regs, srcreg);
 {	uaecptr dsta = get_ilong_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11140,9 +10250,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33d0_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11160,9 +10268,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33d8_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uaecptr dsta = get_ilong_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11181,9 +10287,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33e0_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_ilong_mmu (2);
 	mmufixup[0].reg = -1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11197,9 +10301,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33e8_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11215,9 +10317,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33f0_31)(uae_u32 opcode)
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11230,9 +10330,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33f8_31)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11245,9 +10343,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33f9_31)(uae_u32 opcode)
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (6);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (10);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11261,9 +10357,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33fa_31)(uae_u32 opcode)
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11280,9 +10374,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33fb_31)(uae_u32 opcode)
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s16 src = get_word_mmu (srca);
 {	uaecptr dsta = get_ilong_mmu (0);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -11294,9 +10386,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_33fc_31)(uae_u32 opcode)
 {
 {{	uae_s16 src = get_iword_mmu (2);
 {	uaecptr dsta = get_ilong_mmu (4);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (8);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -12531,9 +11621,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_41fb_31)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_4200_31)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+{{	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((0) & 0xff);
 }}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -12544,9 +11632,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4210_31)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, 0);
@@ -12559,9 +11645,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4218_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, 0);
@@ -12575,9 +11659,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4220_31)(uae_u32 opcode)
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, 0);
@@ -12589,9 +11671,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4228_31)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, 0);
@@ -12605,9 +11685,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4230_31)(uae_u32 opcode)
 {{	uaecptr srca;
 	m68k_incpci (2);
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, 0);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -12617,9 +11695,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4230_31)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_4238_31)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, 0);
@@ -12630,9 +11706,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4238_31)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_4239_31)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_ilong_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(0)) == 0);
-	SET_NFLG   (((uae_s8)(0)) < 0);
+	SET_CZNV (((((uae_s8)(0)) == 0) << FLAGBIT_Z) | ((((uae_s8)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, 0);
@@ -12643,9 +11717,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4239_31)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_4240_31)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+{{	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((0) & 0xffff);
 }}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -12656,9 +11728,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4250_31)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, 0);
@@ -12671,9 +11741,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4258_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, 0);
@@ -12687,9 +11755,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4260_31)(uae_u32 opcode)
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - 2;
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, 0);
@@ -12701,9 +11767,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4268_31)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, 0);
@@ -12717,9 +11781,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4270_31)(uae_u32 opcode)
 {{	uaecptr srca;
 	m68k_incpci (2);
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, 0);
 }}}return 12 * CYCLE_UNIT / 2;
@@ -12729,9 +11791,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4270_31)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_4278_31)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, 0);
@@ -12742,9 +11802,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4278_31)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_4279_31)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_ilong_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(0)) == 0);
-	SET_NFLG   (((uae_s16)(0)) < 0);
+	SET_CZNV (((((uae_s16)(0)) == 0) << FLAGBIT_Z) | ((((uae_s16)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, 0);
@@ -12755,9 +11813,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4279_31)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_4280_31)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+{{	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (0);
 }}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -12768,9 +11824,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4290_31)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, 0);
@@ -12783,9 +11837,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4298_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 	m68k_areg (regs, srcreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, 0);
@@ -12799,9 +11851,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_42a0_31)(uae_u32 opcode)
 {{	uaecptr srca;
 	srca = m68k_areg (regs, srcreg) - 4;
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, 0);
@@ -12813,9 +11863,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_42a8_31)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, 0);
@@ -12829,9 +11877,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_42b0_31)(uae_u32 opcode)
 {{	uaecptr srca;
 	m68k_incpci (2);
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, 0);
 }}}return 16 * CYCLE_UNIT / 2;
@@ -12841,9 +11887,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_42b0_31)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_42b8_31)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, 0);
@@ -12854,9 +11898,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_42b8_31)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_42b9_31)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_ilong_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(0)) == 0);
-	SET_NFLG   (((uae_s32)(0)) < 0);
+	SET_CZNV (((((uae_s32)(0)) == 0) << FLAGBIT_Z) | ((((uae_s32)(0)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, 0);
@@ -12987,11 +12029,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4400_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -13007,11 +12047,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4410_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, dst);
@@ -13029,11 +12067,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4418_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, dst);
@@ -13052,11 +12088,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4420_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, dst);
@@ -13073,11 +12107,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4428_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, dst);
@@ -13096,11 +12128,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4430_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, dst);
 }}}}}}}return 16 * CYCLE_UNIT / 2;
@@ -13115,11 +12145,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4438_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, dst);
@@ -13135,11 +12163,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4439_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, dst);
@@ -13155,11 +12181,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4440_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -13175,11 +12199,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4450_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, dst);
@@ -13197,11 +12219,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4458_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, dst);
@@ -13220,11 +12240,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4460_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, dst);
@@ -13241,11 +12259,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4468_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, dst);
@@ -13264,11 +12280,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4470_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, dst);
 }}}}}}}return 16 * CYCLE_UNIT / 2;
@@ -13283,11 +12297,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4478_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, dst);
@@ -13303,11 +12315,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4479_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, dst);
@@ -13323,11 +12333,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4480_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, srcreg) = (dst);
 }}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -13343,11 +12351,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4490_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, dst);
@@ -13365,11 +12371,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_4498_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, dst);
@@ -13388,11 +12392,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_44a0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, dst);
@@ -13409,11 +12411,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_44a8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, dst);
@@ -13432,11 +12432,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_44b0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, dst);
 }}}}}}}return 24 * CYCLE_UNIT / 2;
@@ -13451,11 +12449,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_44b8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, dst);
@@ -13471,11 +12467,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_44b9_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(0))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, dst);
@@ -13643,9 +12637,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4600_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -13658,9 +12650,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4610_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, dst);
@@ -13675,9 +12665,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4618_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, dst);
@@ -13693,9 +12681,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4620_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, dst);
@@ -13709,9 +12695,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4628_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, dst);
@@ -13727,9 +12711,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4630_31)(uae_u32 opcode)
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, dst);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -13741,9 +12723,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4638_31)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, dst);
@@ -13756,9 +12736,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4639_31)(uae_u32 opcode)
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(dst)) == 0);
-	SET_NFLG   (((uae_s8)(dst)) < 0);
+	SET_CZNV (((((uae_s8)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s8)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, dst);
@@ -13771,9 +12749,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4640_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -13786,9 +12762,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4650_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, dst);
@@ -13803,9 +12777,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4658_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 	m68k_areg (regs, srcreg) += 2;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, dst);
@@ -13821,9 +12793,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4660_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, dst);
@@ -13837,9 +12807,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4668_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, dst);
@@ -13855,9 +12823,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4670_31)(uae_u32 opcode)
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, dst);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -13869,9 +12835,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4678_31)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, dst);
@@ -13884,9 +12848,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4679_31)(uae_u32 opcode)
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (srca, dst);
@@ -13899,9 +12861,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4680_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -13914,9 +12874,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4690_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, dst);
@@ -13931,9 +12889,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4698_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 	m68k_areg (regs, srcreg) += 4;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, dst);
@@ -13949,9 +12905,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46a0_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 	m68k_areg (regs, srcreg) = srca;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, dst);
@@ -13965,9 +12919,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46a8_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, dst);
@@ -13983,9 +12935,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46b0_31)(uae_u32 opcode)
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, dst);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -13997,9 +12947,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46b8_31)(uae_u32 opcode)
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, dst);
@@ -14012,9 +12960,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_46b9_31)(uae_u32 opcode)
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (srca, dst);
@@ -14377,9 +13323,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4840_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -14501,9 +13445,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4880_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u16 dst = (uae_s16)(uae_s8)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(dst)) == 0);
-	SET_NFLG   (((uae_s16)(dst)) < 0);
+	SET_CZNV (((((uae_s16)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s16)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -14598,9 +13540,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_48c0_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -14696,9 +13636,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_49c0_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s8)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(dst)) == 0);
-	SET_NFLG   (((uae_s32)(dst)) < 0);
+	SET_CZNV (((((uae_s32)(dst)) == 0) << FLAGBIT_Z) | ((((uae_s32)(dst)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, srcreg) = (dst);
 }}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -14710,9 +13648,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a00_31)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -14723,9 +13659,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a10_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = get_byte_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -14737,9 +13671,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a18_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = get_byte_mmu (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -14752,9 +13684,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a20_31)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = get_byte_mmu (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (2);
 return 10 * CYCLE_UNIT / 2;
 }
@@ -14765,9 +13695,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a28_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14780,9 +13708,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a30_31)(uae_u32 opcode)
 	m68k_incpci (2);
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s8 src = get_byte_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -14791,9 +13717,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a38_31)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14803,9 +13727,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a39_31)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (6);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -14817,9 +13739,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a3a_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14835,9 +13755,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a3b_31)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s8 src = get_byte_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -14846,9 +13764,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a3b_31)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_4a3c_31)(uae_u32 opcode)
 {
 {{	uae_s8 src = get_ibyte_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14858,9 +13774,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a40_31)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -14871,9 +13785,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a48_31)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -14885,9 +13797,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a50_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = get_word_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -14899,9 +13809,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a58_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s16 src = get_word_mmu (srca);
 	m68k_areg (regs, srcreg) += 2;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -14914,9 +13822,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a60_31)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - 2;
 {	uae_s16 src = get_word_mmu (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (2);
 return 10 * CYCLE_UNIT / 2;
 }
@@ -14927,9 +13833,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a68_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14942,9 +13846,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a70_31)(uae_u32 opcode)
 	m68k_incpci (2);
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s16 src = get_word_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -14953,9 +13855,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a78_31)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14965,9 +13865,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a79_31)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (6);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -14979,9 +13877,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a7a_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 src = get_word_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -14997,9 +13893,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a7b_31)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s16 src = get_word_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -15008,9 +13902,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a7b_31)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_4a7c_31)(uae_u32 opcode)
 {
 {{	uae_s16 src = get_iword_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpci (4);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -15020,9 +13912,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a80_31)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -15033,9 +13923,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a88_31)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -15047,9 +13935,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a90_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = get_long_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (2);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -15061,9 +13947,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4a98_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s32 src = get_long_mmu (srca);
 	m68k_areg (regs, srcreg) += 4;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (2);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -15076,9 +13960,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4aa0_31)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - 4;
 {	uae_s32 src = get_long_mmu (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (2);
 return 14 * CYCLE_UNIT / 2;
 }
@@ -15089,9 +13971,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4aa8_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -15104,9 +13984,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ab0_31)(uae_u32 opcode)
 	m68k_incpci (2);
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s32 src = get_long_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}return 16 * CYCLE_UNIT / 2;
 }
 
@@ -15115,9 +13993,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ab8_31)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -15127,9 +14003,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ab9_31)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (6);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -15141,9 +14015,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4aba_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 src = get_long_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -15159,9 +14031,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4abb_31)(uae_u32 opcode)
 {	tmppc = m68k_getpc ();
 	srca = x_get_disp_ea_020 (tmppc, next_iword_mmu ());
 {	uae_s32 src = get_long_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}}}return 16 * CYCLE_UNIT / 2;
 }
 
@@ -15170,9 +14040,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4abb_31)(uae_u32 opcode)
 uae_u32 REGPARAM2 CPUFUNC(op_4abc_31)(uae_u32 opcode)
 {
 {{	uae_s32 src = get_ilong_mmu (2);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 }}	m68k_incpci (6);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -15182,9 +14050,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ac0_31)(uae_u32 opcode)
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	m68k_dreg (regs, srcreg) = (m68k_dreg (regs, srcreg) & ~0xff) | ((src) & 0xff);
 }}	m68k_incpci (2);
@@ -15197,9 +14063,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ad0_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = get_byte_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
@@ -15214,9 +14078,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ad8_31)(uae_u32 opcode)
 {{	uaecptr srca = m68k_areg (regs, srcreg);
 {	uae_s8 src = get_byte_mmu (srca);
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
@@ -15232,9 +14094,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ae0_31)(uae_u32 opcode)
 	srca = m68k_areg (regs, srcreg) - areg_byteinc[srcreg];
 {	uae_s8 src = get_byte_mmu (srca);
 	m68k_areg (regs, srcreg) = srca;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
@@ -15248,9 +14108,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4ae8_31)(uae_u32 opcode)
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg (regs, srcreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
@@ -15266,9 +14124,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4af0_31)(uae_u32 opcode)
 	m68k_incpci (2);
 {	srca = x_get_disp_ea_020 (m68k_areg (regs, srcreg), next_iword_mmu ());
 {	uae_s8 src = get_byte_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (srca, src);
@@ -15280,9 +14136,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4af8_31)(uae_u32 opcode)
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
@@ -15295,9 +14149,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_4af9_31)(uae_u32 opcode)
 {
 {{	uaecptr srca = get_ilong_mmu (2);
 {	uae_s8 src = get_byte_mmu (srca);
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	src |= 0x80;
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
@@ -16296,11 +15148,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5000_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -16318,11 +15168,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5010_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -16342,11 +15190,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5018_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -16367,11 +15213,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5020_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -16390,11 +15234,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5028_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -16415,11 +15257,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5030_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
@@ -16436,11 +15276,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5038_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -16458,11 +15296,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5039_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -16480,11 +15316,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5040_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -16515,11 +15349,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5050_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -16539,11 +15371,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5058_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -16564,11 +15394,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5060_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -16587,11 +15415,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5068_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -16612,11 +15438,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5070_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
@@ -16636,11 +15460,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5078_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -16658,11 +15480,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5079_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -16680,11 +15500,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5080_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -16715,11 +15533,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5090_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -16739,11 +15555,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5098_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -16764,11 +15578,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_50a0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -16787,11 +15599,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_50a8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -16812,11 +15622,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_50b0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
 }}}}}}}}return 24 * CYCLE_UNIT / 2;
@@ -16833,11 +15641,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_50b8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -16855,11 +15661,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_50b9_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -17032,11 +15836,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5100_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -17054,11 +15856,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5110_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -17078,11 +15878,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5118_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -17103,11 +15901,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5120_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -17126,11 +15922,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5128_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -17151,11 +15945,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5130_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
@@ -17172,11 +15964,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5138_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -17194,11 +15984,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5139_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -17216,11 +16004,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5140_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -17251,11 +16037,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5150_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -17275,11 +16059,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5158_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -17300,11 +16082,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5160_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -17323,11 +16103,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5168_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -17348,11 +16126,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5170_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
@@ -17369,11 +16145,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5178_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -17391,11 +16165,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5179_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -17413,11 +16185,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5180_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -17448,11 +16218,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5190_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -17472,11 +16240,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_5198_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -17497,11 +16263,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_51a0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -17520,11 +16284,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_51a8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -17545,11 +16307,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_51b0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
 }}}}}}}}return 24 * CYCLE_UNIT / 2;
@@ -17566,11 +16326,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_51b8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -17588,11 +16346,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_51b9_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -20759,9 +19515,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_7000_31)(uae_u32 opcode)
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_u32 src = srcreg;
-{	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+{	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 	m68k_incpci (2);
 }}}return 4 * CYCLE_UNIT / 2;
@@ -20775,9 +19529,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8000_31)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -20792,9 +19544,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8010_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
@@ -20810,9 +19560,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8018_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
@@ -20829,9 +19577,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8020_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpci (2);
 return 10 * CYCLE_UNIT / 2;
@@ -20846,9 +19592,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8028_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -20865,9 +19609,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8030_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -20880,9 +19622,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8038_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -20896,9 +19636,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8039_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpci (6);
 return 16 * CYCLE_UNIT / 2;
@@ -20913,9 +19651,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_803a_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -20933,9 +19669,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_803b_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -20947,9 +19681,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_803c_31)(uae_u32 opcode)
 {{	uae_s8 src = get_ibyte_mmu (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -20963,9 +19695,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8040_31)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -20980,9 +19710,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8050_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
@@ -20998,9 +19726,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8058_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
@@ -21017,9 +19743,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8060_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpci (2);
 return 10 * CYCLE_UNIT / 2;
@@ -21034,9 +19758,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8068_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -21053,9 +19775,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8070_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -21068,9 +19788,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8078_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -21084,9 +19802,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8079_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpci (6);
 return 16 * CYCLE_UNIT / 2;
@@ -21101,9 +19817,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_807a_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -21121,9 +19835,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_807b_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -21135,9 +19847,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_807c_31)(uae_u32 opcode)
 {{	uae_s16 src = get_iword_mmu (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	m68k_incpci (4);
 return 8 * CYCLE_UNIT / 2;
@@ -21151,9 +19861,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8080_31)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -21168,9 +19876,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8090_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpci (2);
 return 12 * CYCLE_UNIT / 2;
@@ -21186,9 +19892,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8098_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpci (2);
 return 12 * CYCLE_UNIT / 2;
@@ -21205,9 +19909,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80a0_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpci (2);
 return 14 * CYCLE_UNIT / 2;
@@ -21222,9 +19924,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80a8_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
@@ -21241,9 +19941,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80b0_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -21256,9 +19954,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80b8_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
@@ -21272,9 +19968,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80b9_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpci (6);
 return 20 * CYCLE_UNIT / 2;
@@ -21289,9 +19983,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80ba_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
@@ -21309,9 +20001,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80bb_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -21323,9 +20013,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80bc_31)(uae_u32 opcode)
 {{	uae_s32 src = get_ilong_mmu (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	m68k_incpci (6);
 return 12 * CYCLE_UNIT / 2;
@@ -21352,9 +20040,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80c0_31)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21386,9 +20072,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80d0_31)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21421,9 +20105,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80d8_31)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21457,9 +20139,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80e0_31)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21491,9 +20171,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80e8_31)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21527,9 +20205,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80f0_31)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21559,9 +20235,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80f8_31)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21592,9 +20266,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80f9_31)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21626,9 +20298,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80fa_31)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21663,9 +20333,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80fb_31)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21694,9 +20362,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_80fc_31)(uae_u32 opcode)
 			SET_VFLG (1);
 			SET_NFLG (1);
 		} else {
-			CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+			SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -21769,9 +20435,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8110_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -21788,9 +20452,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8118_31)(uae_u32 opcode)
 {	uae_s8 dst = get_byte_mmu (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -21808,9 +20470,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8120_31)(uae_u32 opcode)
 {	uae_s8 dst = get_byte_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -21826,9 +20486,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8128_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -21846,9 +20504,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8130_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -21862,9 +20518,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8138_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -21879,9 +20533,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8139_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (2);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -21929,9 +20581,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8150_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -21948,9 +20598,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8158_31)(uae_u32 opcode)
 {	uae_s16 dst = get_word_mmu (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -21968,9 +20616,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8160_31)(uae_u32 opcode)
 {	uae_s16 dst = get_word_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -21986,9 +20632,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8168_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -22006,9 +20650,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8170_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s16 dst = get_word_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -22022,9 +20664,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8178_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -22039,9 +20679,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8179_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (2);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -22089,9 +20727,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8190_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -22108,9 +20744,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_8198_31)(uae_u32 opcode)
 {	uae_s32 dst = get_long_mmu (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -22128,9 +20762,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81a0_31)(uae_u32 opcode)
 {	uae_s32 dst = get_long_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -22146,9 +20778,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81a8_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -22166,9 +20796,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81b0_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s32 dst = get_long_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -22182,9 +20810,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81b8_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -22199,9 +20825,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81b9_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (2);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src |= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -22230,9 +20854,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81c0_31)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22265,9 +20887,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81d0_31)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22301,9 +20921,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81d8_31)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22338,9 +20956,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81e0_31)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22373,9 +20989,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81e8_31)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22410,9 +21024,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81f0_31)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22443,9 +21055,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81f8_31)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22477,9 +21087,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81f9_31)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22512,9 +21120,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81fa_31)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22550,9 +21156,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81fb_31)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22582,9 +21186,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_81fc_31)(uae_u32 opcode)
 			SET_NFLG (1);
 		} else {
 			if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(newv)) == 0);
-	SET_NFLG   (((uae_s16)(newv)) < 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s16)(newv)) < 0) << FLAGBIT_N));
 			newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 			m68k_dreg (regs, dstreg) = (newv);
 		}
@@ -22605,11 +21207,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9000_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -22627,11 +21227,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9010_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
@@ -22650,11 +21248,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9018_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
@@ -22674,11 +21270,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9020_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpci (2);
 return 10 * CYCLE_UNIT / 2;
@@ -22696,11 +21290,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9028_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -22720,11 +21312,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9030_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -22740,11 +21330,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9038_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -22761,11 +21349,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9039_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpci (6);
 return 16 * CYCLE_UNIT / 2;
@@ -22783,11 +21369,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_903a_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -22808,11 +21392,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_903b_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -22827,11 +21409,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_903c_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -22848,11 +21428,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9040_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -22869,11 +21447,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9048_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -22891,11 +21467,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9050_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
@@ -22914,11 +21488,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9058_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
@@ -22938,11 +21510,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9060_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpci (2);
 return 10 * CYCLE_UNIT / 2;
@@ -22960,11 +21530,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9068_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -22984,11 +21552,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9070_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -23004,11 +21570,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9078_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -23025,11 +21589,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9079_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpci (6);
 return 16 * CYCLE_UNIT / 2;
@@ -23047,11 +21609,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_907a_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -23072,11 +21632,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_907b_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -23091,11 +21649,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_907c_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpci (4);
 return 8 * CYCLE_UNIT / 2;
@@ -23112,11 +21668,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9080_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -23133,11 +21687,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9088_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -23155,11 +21707,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9090_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpci (2);
 return 12 * CYCLE_UNIT / 2;
@@ -23178,11 +21728,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9098_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpci (2);
 return 12 * CYCLE_UNIT / 2;
@@ -23202,11 +21750,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90a0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpci (2);
 return 14 * CYCLE_UNIT / 2;
@@ -23224,11 +21770,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90a8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
@@ -23248,11 +21792,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90b0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -23268,11 +21810,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90b8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
@@ -23289,11 +21829,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90b9_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpci (6);
 return 20 * CYCLE_UNIT / 2;
@@ -23311,11 +21849,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90ba_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
@@ -23336,11 +21872,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90bb_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -23355,11 +21889,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_90bc_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpci (6);
 return 12 * CYCLE_UNIT / 2;
@@ -23597,11 +22129,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9110_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -23621,11 +22151,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9118_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -23646,11 +22174,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9120_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -23669,11 +22195,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9128_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -23694,11 +22218,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9130_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
@@ -23715,11 +22237,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9138_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -23737,11 +22257,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9139_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -23812,11 +22330,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9150_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -23836,11 +22352,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9158_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -23861,11 +22375,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9160_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -23884,11 +22396,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9168_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -23909,11 +22419,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9170_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
@@ -23930,11 +22438,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9178_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -23952,11 +22458,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9179_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -24027,11 +22531,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9190_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -24051,11 +22553,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_9198_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -24076,11 +22576,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_91a0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -24099,11 +22597,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_91a8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -24124,11 +22620,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_91b0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
 }}}}}}}}return 24 * CYCLE_UNIT / 2;
@@ -24145,11 +22639,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_91b8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -24167,11 +22659,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_91b9_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -24357,10 +22847,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b000_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -24377,10 +22865,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b010_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -24398,10 +22884,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b018_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -24420,10 +22904,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b020_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (2);
 return 10 * CYCLE_UNIT / 2;
 }
@@ -24440,10 +22922,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b028_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24462,10 +22942,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b030_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -24480,10 +22958,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b038_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24499,10 +22975,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b039_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (6);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -24519,10 +22993,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b03a_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24542,10 +23014,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b03b_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -24559,10 +23029,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b03c_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24578,10 +23046,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b040_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -24597,10 +23063,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b048_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -24617,10 +23081,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b050_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -24638,10 +23100,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b058_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -24660,10 +23120,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b060_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (2);
 return 10 * CYCLE_UNIT / 2;
 }
@@ -24680,10 +23138,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b068_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24702,10 +23158,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b070_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -24720,10 +23174,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b078_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24739,10 +23191,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b079_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (6);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -24759,10 +23209,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b07a_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24782,10 +23230,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b07b_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -24799,10 +23245,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b07c_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (4);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -24818,10 +23262,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b080_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -24837,10 +23279,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b088_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -24860,10 +23300,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b090_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (2);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24881,10 +23319,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b098_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (2);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -24903,10 +23339,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0a0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (2);
 return 14 * CYCLE_UNIT / 2;
 }
@@ -24923,10 +23357,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0a8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -24945,10 +23377,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0b0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
 
@@ -24963,10 +23393,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0b8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -24982,10 +23410,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0b9_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (6);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -25002,10 +23428,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0ba_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -25025,10 +23449,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0bb_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
 
@@ -25042,10 +23464,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0bc_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (6);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -25061,10 +23481,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0c0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -25080,10 +23498,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0c8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -25100,10 +23516,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0d0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -25121,10 +23535,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0d8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -25143,10 +23555,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0e0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (2);
 return 10 * CYCLE_UNIT / 2;
 }
@@ -25163,10 +23573,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0e8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -25185,10 +23593,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0f0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -25203,10 +23609,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0f8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -25222,10 +23626,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0f9_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (6);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -25242,10 +23644,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0fa_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -25265,10 +23665,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0fb_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
 
@@ -25282,10 +23680,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b0fc_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (4);
 return 8 * CYCLE_UNIT / 2;
 }
@@ -25298,9 +23694,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b100_31)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -25324,10 +23718,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b108_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u8)(src)) > ((uae_u8)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpci (2);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -25341,9 +23733,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b110_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -25360,9 +23750,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b118_31)(uae_u32 opcode)
 {	uae_s8 dst = get_byte_mmu (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -25380,9 +23768,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b120_31)(uae_u32 opcode)
 {	uae_s8 dst = get_byte_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -25398,9 +23784,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b128_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -25418,9 +23802,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b130_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -25434,9 +23816,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b138_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -25451,9 +23831,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b139_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (2);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -25468,9 +23846,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b140_31)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -25494,10 +23870,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b148_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u16)(src)) > ((uae_u16)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpci (2);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -25511,9 +23885,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b150_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -25530,9 +23902,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b158_31)(uae_u32 opcode)
 {	uae_s16 dst = get_word_mmu (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -25550,9 +23920,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b160_31)(uae_u32 opcode)
 {	uae_s16 dst = get_word_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -25568,9 +23936,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b168_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -25588,9 +23954,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b170_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s16 dst = get_word_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -25604,9 +23968,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b178_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -25621,9 +23983,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b179_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (2);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -25638,9 +23998,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b180_31)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -25664,10 +24022,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b188_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}	m68k_incpci (2);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -25681,9 +24037,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b190_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -25700,9 +24054,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b198_31)(uae_u32 opcode)
 {	uae_s32 dst = get_long_mmu (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -25720,9 +24072,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1a0_31)(uae_u32 opcode)
 {	uae_s32 dst = get_long_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -25738,9 +24088,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1a8_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -25758,9 +24106,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1b0_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s32 dst = get_long_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -25774,9 +24120,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1b8_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -25791,9 +24135,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1b9_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (2);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src ^= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -25811,10 +24153,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1c0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -25830,10 +24170,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1c8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
 }
@@ -25850,10 +24188,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1d0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (2);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -25871,10 +24207,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1d8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (2);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -25893,10 +24227,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1e0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (2);
 return 14 * CYCLE_UNIT / 2;
 }
@@ -25913,10 +24245,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1e8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -25935,10 +24265,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1f0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
 
@@ -25953,10 +24281,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1f8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -25972,10 +24298,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1f9_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (6);
 return 20 * CYCLE_UNIT / 2;
 }
@@ -25992,10 +24316,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1fa_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
 }
@@ -26015,10 +24337,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1fb_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
 
@@ -26032,10 +24352,8 @@ uae_u32 REGPARAM2 CPUFUNC(op_b1fc_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)
+		| ((((uae_u32)(src)) > ((uae_u32)(dst))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 }}}}}}	m68k_incpci (6);
 return 12 * CYCLE_UNIT / 2;
 }
@@ -26048,9 +24366,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c000_31)(uae_u32 opcode)
 {{	uae_s8 src = m68k_dreg (regs, srcreg);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -26065,9 +24381,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c010_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
@@ -26083,9 +24397,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c018_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
@@ -26102,9 +24414,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c020_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpci (2);
 return 10 * CYCLE_UNIT / 2;
@@ -26119,9 +24429,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c028_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -26138,9 +24446,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c030_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -26153,9 +24459,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c038_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -26169,9 +24473,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c039_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpci (6);
 return 16 * CYCLE_UNIT / 2;
@@ -26186,9 +24488,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c03a_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -26206,9 +24506,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c03b_31)(uae_u32 opcode)
 {	uae_s8 src = get_byte_mmu (srca);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -26220,9 +24518,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c03c_31)(uae_u32 opcode)
 {{	uae_s8 src = get_ibyte_mmu (2);
 {	uae_s8 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -26236,9 +24532,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c040_31)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -26253,9 +24547,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c050_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
@@ -26271,9 +24563,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c058_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
@@ -26290,9 +24580,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c060_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpci (2);
 return 10 * CYCLE_UNIT / 2;
@@ -26307,9 +24595,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c068_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -26326,9 +24612,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c070_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -26341,9 +24625,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c078_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -26357,9 +24639,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c079_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpci (6);
 return 16 * CYCLE_UNIT / 2;
@@ -26374,9 +24654,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c07a_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -26394,9 +24672,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c07b_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -26408,9 +24684,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c07c_31)(uae_u32 opcode)
 {{	uae_s16 src = get_iword_mmu (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}	m68k_incpci (4);
 return 8 * CYCLE_UNIT / 2;
@@ -26424,9 +24698,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c080_31)(uae_u32 opcode)
 {{	uae_s32 src = m68k_dreg (regs, srcreg);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -26441,9 +24713,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c090_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpci (2);
 return 12 * CYCLE_UNIT / 2;
@@ -26459,9 +24729,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c098_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpci (2);
 return 12 * CYCLE_UNIT / 2;
@@ -26478,9 +24746,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0a0_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpci (2);
 return 14 * CYCLE_UNIT / 2;
@@ -26495,9 +24761,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0a8_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
@@ -26514,9 +24778,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0b0_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -26529,9 +24791,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0b8_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
@@ -26545,9 +24805,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0b9_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpci (6);
 return 20 * CYCLE_UNIT / 2;
@@ -26562,9 +24820,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0ba_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
@@ -26582,9 +24838,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0bb_31)(uae_u32 opcode)
 {	uae_s32 src = get_long_mmu (srca);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -26596,9 +24850,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0bc_31)(uae_u32 opcode)
 {{	uae_s32 src = get_ilong_mmu (2);
 {	uae_s32 dst = m68k_dreg (regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (src);
 }}}	m68k_incpci (6);
 return 12 * CYCLE_UNIT / 2;
@@ -26612,9 +24864,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0c0_31)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpci (2);
 }}}}return 58 * CYCLE_UNIT / 2;
@@ -26629,9 +24879,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0d0_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpci (2);
 }}}}}return 62 * CYCLE_UNIT / 2;
@@ -26647,9 +24895,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0d8_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpci (2);
 }}}}}return 62 * CYCLE_UNIT / 2;
@@ -26666,9 +24912,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0e0_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpci (2);
 }}}}}return 64 * CYCLE_UNIT / 2;
@@ -26683,9 +24927,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0e8_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpci (4);
 }}}}}return 66 * CYCLE_UNIT / 2;
@@ -26702,9 +24944,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0f0_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}return 66 * CYCLE_UNIT / 2;
 }
@@ -26717,9 +24957,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0f8_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpci (4);
 }}}}}return 66 * CYCLE_UNIT / 2;
@@ -26733,9 +24971,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0f9_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpci (6);
 }}}}}return 70 * CYCLE_UNIT / 2;
@@ -26750,9 +24986,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0fa_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpci (4);
 }}}}}return 66 * CYCLE_UNIT / 2;
@@ -26770,9 +25004,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0fb_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}return 66 * CYCLE_UNIT / 2;
 }
@@ -26784,9 +25016,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c0fc_31)(uae_u32 opcode)
 {{	uae_s16 src = get_iword_mmu (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 	m68k_incpci (4);
 }}}}return 62 * CYCLE_UNIT / 2;
@@ -26855,9 +25085,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c110_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -26874,9 +25102,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c118_31)(uae_u32 opcode)
 {	uae_s8 dst = get_byte_mmu (dsta);
 	m68k_areg (regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -26894,9 +25120,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c120_31)(uae_u32 opcode)
 {	uae_s8 dst = get_byte_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -26912,9 +25136,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c128_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -26932,9 +25154,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c130_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -26948,9 +25168,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c138_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -26965,9 +25183,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c139_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (2);
 {	uae_s8 dst = get_byte_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s8)(src)) == 0);
-	SET_NFLG   (((uae_s8)(src)) < 0);
+	SET_CZNV (((((uae_s8)(src)) == 0) << FLAGBIT_Z) | ((((uae_s8)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, src);
@@ -27009,9 +25225,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c150_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -27028,9 +25242,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c158_31)(uae_u32 opcode)
 {	uae_s16 dst = get_word_mmu (dsta);
 	m68k_areg (regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -27048,9 +25260,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c160_31)(uae_u32 opcode)
 {	uae_s16 dst = get_word_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -27066,9 +25276,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c168_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -27086,9 +25294,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c170_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s16 dst = get_word_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
 }}}}}return 16 * CYCLE_UNIT / 2;
@@ -27102,9 +25308,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c178_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -27119,9 +25323,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c179_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (2);
 {	uae_s16 dst = get_word_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(src)) == 0);
-	SET_NFLG   (((uae_s16)(src)) < 0);
+	SET_CZNV (((((uae_s16)(src)) == 0) << FLAGBIT_Z) | ((((uae_s16)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, src);
@@ -27150,9 +25352,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c190_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -27169,9 +25369,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c198_31)(uae_u32 opcode)
 {	uae_s32 dst = get_long_mmu (dsta);
 	m68k_areg (regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -27189,9 +25387,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1a0_31)(uae_u32 opcode)
 {	uae_s32 dst = get_long_mmu (dsta);
 	m68k_areg (regs, dstreg) = dsta;
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -27207,9 +25403,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1a8_31)(uae_u32 opcode)
 {	uaecptr dsta = m68k_areg (regs, dstreg) + (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -27227,9 +25421,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1b0_31)(uae_u32 opcode)
 {	dsta = x_get_disp_ea_020 (m68k_areg (regs, dstreg), next_iword_mmu ());
 {	uae_s32 dst = get_long_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
 }}}}}return 24 * CYCLE_UNIT / 2;
@@ -27243,9 +25435,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1b8_31)(uae_u32 opcode)
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_mmu (2);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -27260,9 +25450,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1b9_31)(uae_u32 opcode)
 {	uaecptr dsta = get_ilong_mmu (2);
 {	uae_s32 dst = get_long_mmu (dsta);
 	src &= dst;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(src)) == 0);
-	SET_NFLG   (((uae_s32)(src)) < 0);
+	SET_CZNV (((((uae_s32)(src)) == 0) << FLAGBIT_Z) | ((((uae_s32)(src)) < 0) << FLAGBIT_N));
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, src);
@@ -27277,9 +25465,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1c0_31)(uae_u32 opcode)
 {{	uae_s16 src = m68k_dreg (regs, srcreg);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}	m68k_incpci (2);
 return 58 * CYCLE_UNIT / 2;
@@ -27294,9 +25480,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1d0_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpci (2);
 return 62 * CYCLE_UNIT / 2;
@@ -27312,9 +25496,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1d8_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpci (2);
 return 62 * CYCLE_UNIT / 2;
@@ -27331,9 +25513,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1e0_31)(uae_u32 opcode)
 	m68k_areg (regs, srcreg) = srca;
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpci (2);
 return 64 * CYCLE_UNIT / 2;
@@ -27348,9 +25528,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1e8_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpci (4);
 return 66 * CYCLE_UNIT / 2;
@@ -27367,9 +25545,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1f0_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}return 66 * CYCLE_UNIT / 2;
 }
@@ -27382,9 +25558,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1f8_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpci (4);
 return 66 * CYCLE_UNIT / 2;
@@ -27398,9 +25572,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1f9_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpci (6);
 return 70 * CYCLE_UNIT / 2;
@@ -27415,9 +25587,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1fa_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}	m68k_incpci (4);
 return 66 * CYCLE_UNIT / 2;
@@ -27435,9 +25605,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1fb_31)(uae_u32 opcode)
 {	uae_s16 src = get_word_mmu (srca);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}return 66 * CYCLE_UNIT / 2;
 }
@@ -27449,9 +25617,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_c1fc_31)(uae_u32 opcode)
 {{	uae_s16 src = get_iword_mmu (2);
 {	uae_s16 dst = m68k_dreg (regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s32)(newv)) == 0);
-	SET_NFLG   (((uae_s32)(newv)) < 0);
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | ((((uae_s32)(newv)) < 0) << FLAGBIT_N));
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}	m68k_incpci (4);
 return 62 * CYCLE_UNIT / 2;
@@ -27468,11 +25634,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d000_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -27490,11 +25654,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d010_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
@@ -27513,11 +25675,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d018_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
@@ -27537,11 +25697,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d020_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpci (2);
 return 10 * CYCLE_UNIT / 2;
@@ -27559,11 +25717,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d028_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -27583,11 +25739,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d030_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -27603,11 +25757,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d038_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -27624,11 +25776,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d039_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpci (6);
 return 16 * CYCLE_UNIT / 2;
@@ -27646,11 +25796,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d03a_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -27671,11 +25819,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d03b_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -27690,11 +25836,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d03c_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -27711,11 +25855,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d040_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -27732,11 +25874,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d048_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -27754,11 +25894,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d050_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
@@ -27777,11 +25915,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d058_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpci (2);
 return 8 * CYCLE_UNIT / 2;
@@ -27801,11 +25937,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d060_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpci (2);
 return 10 * CYCLE_UNIT / 2;
@@ -27823,11 +25957,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d068_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -27847,11 +25979,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d070_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -27867,11 +25997,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d078_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -27888,11 +26016,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d079_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpci (6);
 return 16 * CYCLE_UNIT / 2;
@@ -27910,11 +26036,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d07a_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}	m68k_incpci (4);
 return 12 * CYCLE_UNIT / 2;
@@ -27935,11 +26059,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d07b_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}return 12 * CYCLE_UNIT / 2;
 }
@@ -27954,11 +26076,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d07c_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (m68k_dreg (regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}	m68k_incpci (4);
 return 8 * CYCLE_UNIT / 2;
@@ -27975,11 +26095,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d080_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -27996,11 +26114,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d088_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpci (2);
 return 4 * CYCLE_UNIT / 2;
@@ -28018,11 +26134,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d090_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpci (2);
 return 12 * CYCLE_UNIT / 2;
@@ -28041,11 +26155,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d098_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpci (2);
 return 12 * CYCLE_UNIT / 2;
@@ -28065,11 +26177,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0a0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpci (2);
 return 14 * CYCLE_UNIT / 2;
@@ -28087,11 +26197,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0a8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
@@ -28111,11 +26219,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0b0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -28131,11 +26237,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0b8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
@@ -28152,11 +26256,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0b9_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpci (6);
 return 20 * CYCLE_UNIT / 2;
@@ -28174,11 +26276,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0ba_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}	m68k_incpci (4);
 return 16 * CYCLE_UNIT / 2;
@@ -28199,11 +26299,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0bb_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
 }
@@ -28218,11 +26316,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d0bc_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_dreg (regs, dstreg) = (newv);
 }}}}}}	m68k_incpci (6);
 return 12 * CYCLE_UNIT / 2;
@@ -28460,11 +26556,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d110_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -28484,11 +26578,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d118_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -28509,11 +26601,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d120_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -28532,11 +26622,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d128_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -28557,11 +26645,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d130_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
@@ -28578,11 +26664,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d138_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -28600,11 +26684,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d139_31)(uae_u32 opcode)
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CZNV (((((uae_s8)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u8)(~dst)) < ((uae_u8)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_byte_mmu (dsta, newv);
@@ -28675,11 +26757,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d150_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -28699,11 +26779,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d158_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -28724,11 +26802,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d160_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -28747,11 +26823,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d168_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -28772,11 +26846,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d170_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
 }}}}}}}}return 16 * CYCLE_UNIT / 2;
@@ -28793,11 +26865,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d178_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -28815,11 +26885,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d179_31)(uae_u32 opcode)
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CZNV (((((uae_s16)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u16)(~dst)) < ((uae_u16)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dsta, newv);
@@ -28890,11 +26958,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d190_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -28914,11 +26980,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d198_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -28939,11 +27003,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1a0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -28962,11 +27024,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1a8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -28987,11 +27047,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1b0_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
 }}}}}}}}return 24 * CYCLE_UNIT / 2;
@@ -29008,11 +27066,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1b8_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -29030,11 +27086,9 @@ uae_u32 REGPARAM2 CPUFUNC(op_d1b9_31)(uae_u32 opcode)
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	SET_CZNV (((((uae_s32)(newv)) == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)
+		| ((((uae_u32)(~dst)) < ((uae_u32)(src))) << FLAGBIT_C) | (flgn << FLAGBIT_N));
 	COPY_CARRY ();
-	SET_NFLG (flgn != 0);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
 	put_long_mmu (dsta, newv);
@@ -29927,9 +27981,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0d0_31)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	m68k_incpci (2);
@@ -29949,9 +28001,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0d8_31)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	m68k_incpci (2);
@@ -29972,9 +28022,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0e0_31)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	m68k_incpci (2);
@@ -29993,9 +28041,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0e8_31)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	m68k_incpci (4);
@@ -30016,9 +28062,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0f0_31)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	regs.instruction_pc = m68k_getpci ();
@@ -30035,9 +28079,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0f8_31)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	m68k_incpci (4);
@@ -30055,9 +28097,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e0f9_31)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (cflg);
 	COPY_CARRY ();
 	m68k_incpci (6);
@@ -30778,9 +28818,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1d0_31)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -30802,9 +28840,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1d8_31)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -30827,9 +28863,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1e0_31)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -30850,9 +28884,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1e8_31)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -30875,9 +28907,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1f0_31)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -30896,9 +28926,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1f8_31)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -30918,9 +28946,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e1f9_31)(uae_u32 opcode)
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY ();
@@ -30940,9 +28966,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2d0_31)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	m68k_incpci (2);
@@ -30961,9 +28985,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2d8_31)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	m68k_incpci (2);
@@ -30983,9 +29005,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2e0_31)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	m68k_incpci (2);
@@ -31003,9 +29023,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2e8_31)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	m68k_incpci (4);
@@ -31025,9 +29043,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2f0_31)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	regs.instruction_pc = m68k_getpci ();
@@ -31043,9 +29059,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2f8_31)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	m68k_incpci (4);
@@ -31062,9 +29076,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e2f9_31)(uae_u32 opcode)
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	m68k_incpci (6);
@@ -31082,9 +29094,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3d0_31)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	m68k_incpci (2);
@@ -31103,9 +29113,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3d8_31)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	m68k_incpci (2);
@@ -31125,9 +29133,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3e0_31)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	m68k_incpci (2);
@@ -31145,9 +29151,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3e8_31)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	m68k_incpci (4);
@@ -31167,9 +29171,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3f0_31)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	regs.instruction_pc = m68k_getpci ();
@@ -31185,9 +29187,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3f8_31)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	m68k_incpci (4);
@@ -31204,9 +29204,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e3f9_31)(uae_u32 opcode)
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	m68k_incpci (6);
@@ -31225,9 +29223,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4d0_31)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	m68k_incpci (2);
@@ -31247,9 +29243,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4d8_31)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	m68k_incpci (2);
@@ -31270,9 +29264,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4e0_31)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	m68k_incpci (2);
@@ -31291,9 +29283,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4e8_31)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	m68k_incpci (4);
@@ -31314,9 +29304,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4f0_31)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	regs.instruction_pc = m68k_getpci ();
@@ -31333,9 +29321,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4f8_31)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	m68k_incpci (4);
@@ -31353,9 +29339,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e4f9_31)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG ()) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	COPY_CARRY ();
 	m68k_incpci (6);
@@ -31374,9 +29358,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5d0_31)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	m68k_incpci (2);
@@ -31396,9 +29378,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5d8_31)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	m68k_incpci (2);
@@ -31419,9 +29399,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5e0_31)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	m68k_incpci (2);
@@ -31440,9 +29418,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5e8_31)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	m68k_incpci (4);
@@ -31463,9 +29439,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5f0_31)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	regs.instruction_pc = m68k_getpci ();
@@ -31482,9 +29456,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5f8_31)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	m68k_incpci (4);
@@ -31502,9 +29474,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e5f9_31)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG ()) val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	COPY_CARRY ();
 	m68k_incpci (6);
@@ -31523,9 +29493,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6d0_31)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
@@ -31544,9 +29512,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6d8_31)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
@@ -31566,9 +29532,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6e0_31)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
@@ -31586,9 +29550,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6e8_31)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
@@ -31608,9 +29570,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6f0_31)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dataa, val);
@@ -31626,9 +29586,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6f8_31)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
@@ -31645,9 +29603,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e6f9_31)(uae_u32 opcode)
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
@@ -31665,9 +29621,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7d0_31)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
@@ -31686,9 +29640,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7d8_31)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
@@ -31708,9 +29660,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7e0_31)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	m68k_incpci (2);
 	regs.instruction_pc = m68k_getpci ();
@@ -31728,9 +29678,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7e8_31)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
@@ -31750,9 +29698,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7f0_31)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	regs.instruction_pc = m68k_getpci ();
 	put_word_mmu (dataa, val);
@@ -31768,9 +29714,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7f8_31)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	m68k_incpci (4);
 	regs.instruction_pc = m68k_getpci ();
@@ -31787,9 +29731,7 @@ uae_u32 REGPARAM2 CPUFUNC(op_e7f9_31)(uae_u32 opcode)
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV ();
-	SET_ZFLG   (((uae_s16)(val)) == 0);
-	SET_NFLG   (((uae_s16)(val)) < 0);
+	SET_CZNV (((((uae_s16)(val)) == 0) << FLAGBIT_Z) | ((((uae_s16)(val)) < 0) << FLAGBIT_N));
 	SET_CFLG (carry >> 15);
 	m68k_incpci (6);
 	regs.instruction_pc = m68k_getpci ();
@@ -4,6 +4,163 @@
  * This file was generated by genlinetoscr. Don't edit.
  */
 
+#ifdef LINETOSCR_AVX2
+static int NOINLINE LINETOSCR_TARGET_AVX2 linetoscr_32_avx2 (uae_u32 *buf, int spix, int dpix, int dpix_end,
+    const int *lookup, const int *lookup_no, int lookup_ofs, uae_u8 xor_val)
+{
+    const __m256i xor_vec = _mm256_set1_epi32 (xor_val);
+    const __m256i ofs_vec = _mm256_set1_epi32 (lookup_ofs);
+    const __m256i byte_mask = _mm256_set1_epi32 (0xff);
+
+    while (dpix < dpix_end) {
+        const uae_u8 *src = &pixdata.apixels[spix];
+        __m256i idx, out;
+
+        idx = _mm256_cvtepu8_epi32 (_mm_loadl_epi64 ((const __m128i *)src));
+        spix += 8;
+        if (lookup) {
+            __m256i ofs = _mm256_setzero_si256 ();
+            if (lookup_no) {
+                __m256i no = _mm256_i32gather_epi32 (lookup_no, idx, 4);
+                ofs = _mm256_andnot_si256 (_mm256_cmpeq_epi32 (no, _mm256_setzero_si256 ()), ofs_vec);
+            }
+            idx = _mm256_i32gather_epi32 (lookup, idx, 4);
+            idx = _mm256_and_si256 (_mm256_add_epi32 (idx, ofs), byte_mask);
+        }
+        idx = _mm256_xor_si256 (idx, xor_vec);
+        out = _mm256_i32gather_epi32 ((const int *)colors_for_drawing.acolors, idx, 4);
+        _mm256_storeu_si256 ((__m256i *)&buf[dpix], out);
+        dpix += 8;
+    }
+    return spix;
+}
+
+static int NOINLINE LINETOSCR_TARGET_AVX2 linetoscr_32_stretch1_avx2 (uae_u32 *buf, int spix, int dpix, int dpix_end,
+    const int *lookup, const int *lookup_no, int lookup_ofs, uae_u8 xor_val)
+{
+    const __m256i xor_vec = _mm256_set1_epi32 (xor_val);
+    const __m256i ofs_vec = _mm256_set1_epi32 (lookup_ofs);
+    const __m256i byte_mask = _mm256_set1_epi32 (0xff);
+
+    while (dpix < dpix_end) {
+        const uae_u8 *src = &pixdata.apixels[spix];
+        __m256i idx, out;
+
+        idx = _mm256_cvtepu8_epi32 (_mm_loadl_epi64 ((const __m128i *)src));
+        spix += 8;
+        if (lookup) {
+            __m256i ofs = _mm256_setzero_si256 ();
+            if (lookup_no) {
+                __m256i no = _mm256_i32gather_epi32 (lookup_no, idx, 4);
+                ofs = _mm256_andnot_si256 (_mm256_cmpeq_epi32 (no, _mm256_setzero_si256 ()), ofs_vec);
+            }
+            idx = _mm256_i32gather_epi32 (lookup, idx, 4);
+            idx = _mm256_and_si256 (_mm256_add_epi32 (idx, ofs), byte_mask);
+        }
+        idx = _mm256_xor_si256 (idx, xor_vec);
+        out = _mm256_i32gather_epi32 ((const int *)colors_for_drawing.acolors, idx, 4);
+        _mm256_storeu_si256 ((__m256i *)&buf[dpix + 0], _mm256_permutevar8x32_epi32 (out, _mm256_setr_epi32 (0, 0, 1, 1, 2, 2, 3, 3)));
+        _mm256_storeu_si256 ((__m256i *)&buf[dpix + 8], _mm256_permutevar8x32_epi32 (out, _mm256_setr_epi32 (4, 4, 5, 5, 6, 6, 7, 7)));
+        dpix += 16;
+    }
+    return spix;
+}
+
+static int NOINLINE LINETOSCR_TARGET_AVX2 linetoscr_32_stretch2_avx2 (uae_u32 *buf, int spix, int dpix, int dpix_end,
+    const int *lookup, const int *lookup_no, int lookup_ofs, uae_u8 xor_val)
+{
+    const __m256i xor_vec = _mm256_set1_epi32 (xor_val);
+    const __m256i ofs_vec = _mm256_set1_epi32 (lookup_ofs);
+    const __m256i byte_mask = _mm256_set1_epi32 (0xff);
+
+    while (dpix < dpix_end) {
+        const uae_u8 *src = &pixdata.apixels[spix];
+        __m256i idx, out;
+
+        idx = _mm256_cvtepu8_epi32 (_mm_loadl_epi64 ((const __m128i *)src));
+        spix += 8;
+        if (lookup) {
+            __m256i ofs = _mm256_setzero_si256 ();
+            if (lookup_no) {
+                __m256i no = _mm256_i32gather_epi32 (lookup_no, idx, 4);
+                ofs = _mm256_andnot_si256 (_mm256_cmpeq_epi32 (no, _mm256_setzero_si256 ()), ofs_vec);
+            }
+            idx = _mm256_i32gather_epi32 (lookup, idx, 4);
+            idx = _mm256_and_si256 (_mm256_add_epi32 (idx, ofs), byte_mask);
+        }
+        idx = _mm256_xor_si256 (idx, xor_vec);
+        out = _mm256_i32gather_epi32 ((const int *)colors_for_drawing.acolors, idx, 4);
+        _mm256_storeu_si256 ((__m256i *)&buf[dpix + 0], _mm256_permutevar8x32_epi32 (out, _mm256_setr_epi32 (0, 0, 0, 0, 1, 1, 1, 1)));
+        _mm256_storeu_si256 ((__m256i *)&buf[dpix + 8], _mm256_permutevar8x32_epi32 (out, _mm256_setr_epi32 (2, 2, 2, 2, 3, 3, 3, 3)));
+        _mm256_storeu_si256 ((__m256i *)&buf[dpix + 16], _mm256_permutevar8x32_epi32 (out, _mm256_setr_epi32 (4, 4, 4, 4, 5, 5, 5, 5)));
+        _mm256_storeu_si256 ((__m256i *)&buf[dpix + 24], _mm256_permutevar8x32_epi32 (out, _mm256_setr_epi32 (6, 6, 6, 6, 7, 7, 7, 7)));
+        dpix += 32;
+    }
+    return spix;
+}
+
+static int NOINLINE LINETOSCR_TARGET_AVX2 linetoscr_32_shrink1_avx2 (uae_u32 *buf, int spix, int dpix, int dpix_end,
+    const int *lookup, const int *lookup_no, int lookup_ofs, uae_u8 xor_val)
+{
+    const __m256i xor_vec = _mm256_set1_epi32 (xor_val);
+    const __m256i ofs_vec = _mm256_set1_epi32 (lookup_ofs);
+    const __m256i byte_mask = _mm256_set1_epi32 (0xff);
+
+    while (dpix < dpix_end) {
+        const uae_u8 *src = &pixdata.apixels[spix];
+        __m256i idx, out;
+
+        idx = _mm256_and_si256 (_mm256_cvtepu16_epi32 (_mm_loadu_si128 ((const __m128i *)src)), byte_mask);
+        spix += 16;
+        if (lookup) {
+            __m256i ofs = _mm256_setzero_si256 ();
+            if (lookup_no) {
+                __m256i no = _mm256_i32gather_epi32 (lookup_no, idx, 4);
+                ofs = _mm256_andnot_si256 (_mm256_cmpeq_epi32 (no, _mm256_setzero_si256 ()), ofs_vec);
+            }
+            idx = _mm256_i32gather_epi32 (lookup, idx, 4);
+            idx = _mm256_and_si256 (_mm256_add_epi32 (idx, ofs), byte_mask);
+        }
+        idx = _mm256_xor_si256 (idx, xor_vec);
+        out = _mm256_i32gather_epi32 ((const int *)colors_for_drawing.acolors, idx, 4);
+        _mm256_storeu_si256 ((__m256i *)&buf[dpix], out);
+        dpix += 8;
+    }
+    return spix;
+}
+
+static int NOINLINE LINETOSCR_TARGET_AVX2 linetoscr_32_shrink2_avx2 (uae_u32 *buf, int spix, int dpix, int dpix_end,
+    const int *lookup, const int *lookup_no, int lookup_ofs, uae_u8 xor_val)
+{
+    const __m256i xor_vec = _mm256_set1_epi32 (xor_val);
+    const __m256i ofs_vec = _mm256_set1_epi32 (lookup_ofs);
+    const __m256i byte_mask = _mm256_set1_epi32 (0xff);
+
+    while (dpix < dpix_end) {
+        const uae_u8 *src = &pixdata.apixels[spix];
+        __m256i idx, out;
+
+        idx = _mm256_and_si256 (_mm256_loadu_si256 ((const __m256i *)src), byte_mask);
+        spix += 32;
+        if (lookup) {
+            __m256i ofs = _mm256_setzero_si256 ();
+            if (lookup_no) {
+                __m256i no = _mm256_i32gather_epi32 (lookup_no, idx, 4);
+                ofs = _mm256_andnot_si256 (_mm256_cmpeq_epi32 (no, _mm256_setzero_si256 ()), ofs_vec);
+            }
+            idx = _mm256_i32gather_epi32 (lookup, idx, 4);
+            idx = _mm256_and_si256 (_mm256_add_epi32 (idx, ofs), byte_mask);
+        }
+        idx = _mm256_xor_si256 (idx, xor_vec);
+        out = _mm256_i32gather_epi32 ((const int *)colors_for_drawing.acolors, idx, 4);
+        _mm256_storeu_si256 ((__m256i *)&buf[dpix], out);
+        dpix += 8;
+    }
+    return spix;
+}
+
+#endif
+
 static int NOINLINE linetoscr_16 (int spix, int dpix, int dpix_end)
 {
     uae_u16 *buf = (uae_u16 *) xlinebuffer;
@@ -5098,6 +5255,13 @@ static int NOINLINE linetoscr_32 (int spix, int dpix, int dpix_end)
         }
     } else if (bpldualpf) {
         int *lookup = bpldualpfpri ? dblpf_ind2 : dblpf_ind1;
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 8) {
+            int n = (dpix_end - dpix) & ~7;
+            spix = linetoscr_32_avx2 (buf, spix, dpix, dpix + n, lookup, NULL, 0, 0);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -5125,6 +5289,13 @@ static int NOINLINE linetoscr_32 (int spix, int dpix, int dpix_end)
             buf[dpix++] = out_val;
         }
     } else {
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 8) {
+            int n = (dpix_end - dpix) & ~7;
+            spix = linetoscr_32_avx2 (buf, spix, dpix, dpix + n, NULL, NULL, 0, 0);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -5159,6 +5330,13 @@ static int NOINLINE linetoscr_32_stretch1 (int spix, int dpix, int dpix_end)
         }
     } else if (bpldualpf) {
         int *lookup = bpldualpfpri ? dblpf_ind2 : dblpf_ind1;
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 16) {
+            int n = (dpix_end - dpix) & ~15;
+            spix = linetoscr_32_stretch1_avx2 (buf, spix, dpix, dpix + n, lookup, NULL, 0, 0);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -5188,6 +5366,13 @@ static int NOINLINE linetoscr_32_stretch1 (int spix, int dpix, int dpix_end)
             buf[dpix++] = out_val;
         }
     } else {
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 16) {
+            int n = (dpix_end - dpix) & ~15;
+            spix = linetoscr_32_stretch1_avx2 (buf, spix, dpix, dpix + n, NULL, NULL, 0, 0);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -5225,6 +5410,13 @@ static int NOINLINE linetoscr_32_stretch2 (int spix, int dpix, int dpix_end)
         }
     } else if (bpldualpf) {
         int *lookup = bpldualpfpri ? dblpf_ind2 : dblpf_ind1;
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 32) {
+            int n = (dpix_end - dpix) & ~31;
+            spix = linetoscr_32_stretch2_avx2 (buf, spix, dpix, dpix + n, lookup, NULL, 0, 0);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -5258,6 +5450,13 @@ static int NOINLINE linetoscr_32_stretch2 (int spix, int dpix, int dpix_end)
             buf[dpix++] = out_val;
         }
     } else {
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 32) {
+            int n = (dpix_end - dpix) & ~31;
+            spix = linetoscr_32_stretch2_avx2 (buf, spix, dpix, dpix + n, NULL, NULL, 0, 0);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -5294,6 +5493,13 @@ static int NOINLINE linetoscr_32_shrink1 (int spix, int dpix, int dpix_end)
         }
     } else if (bpldualpf) {
         int *lookup = bpldualpfpri ? dblpf_ind2 : dblpf_ind1;
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 8) {
+            int n = (dpix_end - dpix) & ~7;
+            spix = linetoscr_32_shrink1_avx2 (buf, spix, dpix, dpix + n, lookup, NULL, 0, 0);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -5321,6 +5527,13 @@ static int NOINLINE linetoscr_32_shrink1 (int spix, int dpix, int dpix_end)
             buf[dpix++] = out_val;
         }
     } else {
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 8) {
+            int n = (dpix_end - dpix) & ~7;
+            spix = linetoscr_32_shrink1_avx2 (buf, spix, dpix, dpix + n, NULL, NULL, 0, 0);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -5448,6 +5661,13 @@ static int NOINLINE linetoscr_32_shrink2 (int spix, int dpix, int dpix_end)
         }
     } else if (bpldualpf) {
         int *lookup = bpldualpfpri ? dblpf_ind2 : dblpf_ind1;
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 8) {
+            int n = (dpix_end - dpix) & ~7;
+            spix = linetoscr_32_shrink2_avx2 (buf, spix, dpix, dpix + n, lookup, NULL, 0, 0);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -5475,6 +5695,13 @@ static int NOINLINE linetoscr_32_shrink2 (int spix, int dpix, int dpix_end)
             buf[dpix++] = out_val;
         }
     } else {
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 8) {
+            int n = (dpix_end - dpix) & ~7;
+            spix = linetoscr_32_shrink2_avx2 (buf, spix, dpix, dpix + n, NULL, NULL, 0, 0);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -6473,6 +6700,13 @@ static int NOINLINE linetoscr_32_aga (int spix, int dpix, int dpix_end)
     } else if (bpldualpf) {
         int *lookup    = bpldualpfpri ? dblpf_ind2_aga : dblpf_ind1_aga;
         int *lookup_no = bpldualpfpri ? dblpf_2nd2     : dblpf_2nd1;
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 8) {
+            int n = (dpix_end - dpix) & ~7;
+            spix = linetoscr_32_avx2 (buf, spix, dpix, dpix + n, lookup, lookup_no, dblpfofs[bpldualpf2of], xor_val);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -6507,6 +6741,13 @@ static int NOINLINE linetoscr_32_aga (int spix, int dpix, int dpix_end)
             buf[dpix++] = out_val;
         }
     } else {
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 8) {
+            int n = (dpix_end - dpix) & ~7;
+            spix = linetoscr_32_avx2 (buf, spix, dpix, dpix + n, NULL, NULL, 0, xor_val);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -6546,6 +6787,13 @@ static int NOINLINE linetoscr_32_stretch1_aga (int spix, int dpix, int dpix_end)
     } else if (bpldualpf) {
         int *lookup    = bpldualpfpri ? dblpf_ind2_aga : dblpf_ind1_aga;
         int *lookup_no = bpldualpfpri ? dblpf_2nd2     : dblpf_2nd1;
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 16) {
+            int n = (dpix_end - dpix) & ~15;
+            spix = linetoscr_32_stretch1_avx2 (buf, spix, dpix, dpix + n, lookup, lookup_no, dblpfofs[bpldualpf2of], xor_val);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -6582,6 +6830,13 @@ static int NOINLINE linetoscr_32_stretch1_aga (int spix, int dpix, int dpix_end)
             buf[dpix++] = out_val;
         }
     } else {
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 16) {
+            int n = (dpix_end - dpix) & ~15;
+            spix = linetoscr_32_stretch1_avx2 (buf, spix, dpix, dpix + n, NULL, NULL, 0, xor_val);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -6624,6 +6879,13 @@ static int NOINLINE linetoscr_32_stretch2_aga (int spix, int dpix, int dpix_end)
     } else if (bpldualpf) {
         int *lookup    = bpldualpfpri ? dblpf_ind2_aga : dblpf_ind1_aga;
         int *lookup_no = bpldualpfpri ? dblpf_2nd2     : dblpf_2nd1;
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 32) {
+            int n = (dpix_end - dpix) & ~31;
+            spix = linetoscr_32_stretch2_avx2 (buf, spix, dpix, dpix + n, lookup, lookup_no, dblpfofs[bpldualpf2of], xor_val);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -6664,6 +6926,13 @@ static int NOINLINE linetoscr_32_stretch2_aga (int spix, int dpix, int dpix_end)
             buf[dpix++] = out_val;
         }
     } else {
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 32) {
+            int n = (dpix_end - dpix) & ~31;
+            spix = linetoscr_32_stretch2_avx2 (buf, spix, dpix, dpix + n, NULL, NULL, 0, xor_val);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -6705,6 +6974,13 @@ static int NOINLINE linetoscr_32_shrink1_aga (int spix, int dpix, int dpix_end)
     } else if (bpldualpf) {
         int *lookup    = bpldualpfpri ? dblpf_ind2_aga : dblpf_ind1_aga;
         int *lookup_no = bpldualpfpri ? dblpf_2nd2     : dblpf_2nd1;
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 8) {
+            int n = (dpix_end - dpix) & ~7;
+            spix = linetoscr_32_shrink1_avx2 (buf, spix, dpix, dpix + n, lookup, lookup_no, dblpfofs[bpldualpf2of], xor_val);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -6739,6 +7015,13 @@ static int NOINLINE linetoscr_32_shrink1_aga (int spix, int dpix, int dpix_end)
             buf[dpix++] = out_val;
         }
     } else {
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 8) {
+            int n = (dpix_end - dpix) & ~7;
+            spix = linetoscr_32_shrink1_avx2 (buf, spix, dpix, dpix + n, NULL, NULL, 0, xor_val);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -6891,6 +7174,13 @@ static int NOINLINE linetoscr_32_shrink2_aga (int spix, int dpix, int dpix_end)
     } else if (bpldualpf) {
         int *lookup    = bpldualpfpri ? dblpf_ind2_aga : dblpf_ind1_aga;
         int *lookup_no = bpldualpfpri ? dblpf_2nd2     : dblpf_2nd1;
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 8) {
+            int n = (dpix_end - dpix) & ~7;
+            spix = linetoscr_32_shrink2_avx2 (buf, spix, dpix, dpix + n, lookup, lookup_no, dblpfofs[bpldualpf2of], xor_val);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -6925,6 +7215,13 @@ static int NOINLINE linetoscr_32_shrink2_aga (int spix, int dpix, int dpix_end)
             buf[dpix++] = out_val;
         }
     } else {
+#ifdef LINETOSCR_AVX2
+        if (have_avx2 && dpix_end - dpix >= 8) {
+            int n = (dpix_end - dpix) & ~7;
+            spix = linetoscr_32_shrink2_avx2 (buf, spix, dpix, dpix + n, NULL, NULL, 0, xor_val);
+            dpix += n;
+        }
+#endif
         while (dpix < dpix_end) {
             uae_u32 spix_val;
             uae_u32 dpix_val;
@@ -57,6 +57,18 @@ static int g_texture_filter = GL_LINEAR;
 static int g_frame_texture_black_left = 100000;
 static int g_frame_texture_black_top = 100000;
 
+// what the frame texture holds, so the next frame only needs to upload the
+// lines the emulator drew (buffer->line[y] == 0); the other lines were
+// copied from the previous frame by fs_emu_video_buffer_update_lines
+static int g_frame_texture_seq = -1;
+static fs_emu_rect g_frame_texture_rect;
+static int g_frame_texture_stride = 0;
+static int g_frame_texture_filter = 0;
+
+// unchanged lines shorter than this between two changed ones are uploaded
+// anyway, saving a glTexSubImage2D call
+#define DIRTY_LINES_MIN_GAP 8
+
 // crop coordinates of emulator video frame
 static fs_emu_rect g_crop = {};
 
@@ -135,6 +147,7 @@ static void context_notification_handler(int notification, void *data) {
             glDeleteTextures(1, &g_frame_texture);
             CHECK_GL_ERROR();
             g_frame_texture = 0;
+            g_frame_texture_seq = -1;
         }
     }
     else if (notification == FS_GL_CONTEXT_CREATE) {
@@ -245,6 +258,7 @@ static void create_texture_if_needed(int width, int height) {
     // blanks the border if necessary
     g_frame_texture_black_left = 100000;
     g_frame_texture_black_top = 100000;
+    g_frame_texture_seq = -1;
 }
 
 static void fix_border(fs_emu_video_buffer *buffer, int *upload_x,
@@ -618,18 +632,64 @@ static int update_texture() {
     create_texture_if_needed(width, height);
     fs_gl_bind_texture(g_frame_texture);
 
-    uint8_t *gl_buffer_start = frame + ((upload_y * width) + upload_x) * bpp;
+    // the texture holds the previous frame with the same layout, so
+    // lines which were not drawn this frame are already there
+    int partial = buffer->seq == g_frame_texture_seq + 1 &&
+            upload_x == g_frame_texture_rect.x &&
+            upload_y == g_frame_texture_rect.y &&
+            upload_w == g_frame_texture_rect.w &&
+            upload_h == g_frame_texture_rect.h &&
+            width * bpp == g_frame_texture_stride &&
+            filter == g_frame_texture_filter;
+
+#ifndef USE_GLES
+    fs_gl_unpack_row_length(width);
+#endif
+    int y = 0;
+    while (y < upload_h) {
+        int first = y, last;
+        if (partial) {
+            while (first < upload_h && upload_y + first < FS_EMU_MAX_LINES &&
+                    buffer->line[upload_y + first]) {
+                first++;
+            }
+            if (first == upload_h) {
+                break;
+            }
+            last = first;
+            for (y = first + 1; y < upload_h && y - last <= DIRTY_LINES_MIN_GAP;
+                    y++) {
+                if (upload_y + y >= FS_EMU_MAX_LINES ||
+                        !buffer->line[upload_y + y]) {
+                    last = y;
+                }
+            }
+        }
+        else {
+            last = upload_h - 1;
+        }
+        y = last + 1;
 
+        uint8_t *gl_buffer_start = frame + (((upload_y + first) * width) +
+                upload_x) * bpp;
 #ifdef USE_GLES
-    /* we don't have unpack padding in GLES. uploading full width lines instead */
-    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, upload_h,
-            gl_buffer_format, gl_buffer_type, gl_buffer_start);
+        /* we don't have unpack padding in GLES. uploading full width lines instead */
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, first, width, last - first + 1,
+                gl_buffer_format, gl_buffer_type, gl_buffer_start);
 #else
-    fs_gl_unpack_row_length(width);
-    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, upload_w, upload_h,
-            gl_buffer_format, gl_buffer_type, gl_buffer_start);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, first, upload_w, last - first + 1,
+                gl_buffer_format, gl_buffer_type, gl_buffer_start);
 #endif
-    CHECK_GL_ERROR();
+        CHECK_GL_ERROR();
+    }
+
+    g_frame_texture_seq = buffer->seq;
+    g_frame_texture_rect.x = upload_x;
+    g_frame_texture_rect.y = upload_y;
+    g_frame_texture_rect.w = upload_w;
+    g_frame_texture_rect.h = upload_h;
+    g_frame_texture_stride = width * bpp;
+    g_frame_texture_filter = filter;
 
     int update_black_border = 1;
     if (update_black_border) {
@@ -0,0 +1,76 @@
+/*
+ * Compara o débito de pesquisas num map por (id, addr) com a hash inteira
+ * (memIDhash) e com a hash SHA-512 usada anteriormente.
+ *
+ * Uso: hash-benchmark [chaves] [pesquisas]
+ */
+#include <iostream>
+#include <chrono>
+#include <openssl/sha.h>
+#include <stdio.h>
+#include "MemoryStorage.h"
+#include "MemoryID.h"
+
+using namespace std;
+
+/**
+ * Hash original: SHA-512 sobre a representação decimal da chave
+ */
+class sha512MemIDhash {
+public:
+	size_t operator()(const memoryID& v) const
+	{
+		unsigned char digest[SHA512_DIGEST_LENGTH];
+		stringstream ss;
+		ss << v.id;
+		ss << v.addr;
+		string text = ss.str();
+		char mdString[SHA512_DIGEST_LENGTH*2+1];
+
+		SHA512((unsigned char*) text.c_str(), text.length(), (unsigned char*)&digest);
+
+		for(int i = 0; i < SHA512_DIGEST_LENGTH; i++)
+			sprintf(&mdString[i*2], "%02x", (unsigned int)digest[i]);
+
+		return strtoul(mdString, NULL, 0);
+	}
+};
+
+template <typename Hash>
+static void run(const char *name, int keys, int lookups)
+{
+	typedef unordered_map<memoryID,uae_u32,Hash,memIDeqKey> map_type;
+	map_type map;
+	memoryID key;
+	uae_u32 sum = 0;
+
+	for (int i = 0; i < keys; i++) {
+		key.id = i & 3;
+		key.addr = (i >> 2) * 4;
+		map[key] = i;
+	}
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (int i = 0; i < lookups; i++) {
+		int k = (int)((i * 2654435761u) % keys);
+		key.id = k & 3;
+		key.addr = (k >> 2) * 4;
+		sum += map.find(key)->second;
+	}
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+	cout << name << ": " << lookups / elapsed.count() / 1e6 << " Mlookups/s"
+		<< " (buckets " << map.bucket_count() << ", checksum " << sum << ")" << endl;
+}
+
+int main(int argc, char* argv[])
+{
+	int keys = argc > 1 ? atoi(argv[1]) : 1 << 12;
+	int lookups = argc > 2 ? atoi(argv[2]) : 1 << 20;
+
+	cout << keys << " keys, " << lookups << " lookups" << endl;
+	run<memIDhash>("memIDhash (mix64)", keys, lookups);
+	run<sha512MemIDhash>("SHA-512", keys, lookups / 256);
+
+	return 0;
+}
@@ -0,0 +1,574 @@
+/*
+ * Reproduz um trace de acessos (gravado pelo cliente com
+ * FSUAE_MEMSERVER_TRACE=ficheiro) contra os backends em processo e contra
+ * o servidor, por socket e por memória partilhada, com vários tamanhos de
+ * lote. Mostra ops/s, latência p50/p99 de cada lote e o aumento da
+ * memória residente de quem guarda os dados.
+ *
+ * Uso: memory-benchmark [-S servidor] [-t transportes] [-b lotes] trace
+ *      memory-benchmark -g trace [acessos]
+ *
+ * -t é uma lista de inproc,socket,shm e -b de tamanhos de lote
+ * (por omissão todos e 1,16,512). -g gera um trace sintético.
+ * O servidor é lançado pelo benchmark, por isso não pode haver outro a
+ * correr no mesmo SOCKET_PATH.
+ */
+#include <string.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <strings.h>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "MemoryTrace.h"
+#include "shm_ring.h"
+#include "MemoryID.h"
+
+using namespace std;
+
+typedef struct {
+	uint64_t ops;
+	double seconds;
+	uint64_t p50;
+	uint64_t p99;
+	long rss;
+} benchResult;
+
+static uint64_t monotonicNs()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * VmRSS of a process in KiB, -1 if unknown
+ */
+static long residentKiB(pid_t pid)
+{
+	char path[64], line[256];
+	long rss = -1;
+	FILE *file;
+
+	snprintf(path, sizeof(path), "/proc/%d/status", (int) pid);
+	if ((file = fopen(path, "r")) == NULL)
+		return -1;
+	while (fgets(line, sizeof(line), file)) {
+		if (strncmp(line, "VmRSS:", 6) == 0) {
+			rss = atol(line + 6);
+			break;
+		}
+	}
+	fclose(file);
+	return rss;
+}
+
+static bool readAll(int fd, void *buf, size_t size)
+{
+	char *p = (char *) buf;
+
+	while (size > 0) {
+		ssize_t checker = read(fd, p, size);
+		if (checker <= 0)
+			return false;
+		p += checker;
+		size -= checker;
+	}
+	return true;
+}
+
+static bool writeAll(int fd, const void *buf, size_t size)
+{
+	const char *p = (const char *) buf;
+
+	while (size > 0) {
+		ssize_t checker = write(fd, p, size);
+		if (checker < 0)
+			return false;
+		p += checker;
+		size -= checker;
+	}
+	return true;
+}
+
+/*
+ * Run the trace in batches of batchSize accesses, timing each batch
+ */
+template <typename F>
+static void timeBatches(const vector<memTraceRecord> &trace, size_t batchSize, benchResult *result, F runBatch)
+{
+	vector<uint64_t> latencies;
+	uint64_t start = monotonicNs();
+
+	for (size_t i = 0; i < trace.size(); i += batchSize) {
+		size_t n = min(batchSize, trace.size() - i);
+		uint64_t t = monotonicNs();
+
+		if (!runBatch(&trace[i], n)) {
+			cerr << "memory-benchmark: connection to server lost" << endl;
+			exit(1);
+		}
+		latencies.push_back(monotonicNs() - t);
+	}
+
+	result->seconds = (monotonicNs() - start) / 1e9;
+	result->ops = trace.size();
+	sort(latencies.begin(), latencies.end());
+	result->p50 = latencies.empty() ? 0 : latencies[latencies.size() / 2];
+	result->p99 = latencies.empty() ? 0 : latencies[latencies.size() * 99 / 100];
+}
+
+/*
+ * In-process backends
+ */
+typedef unordered_map<memoryID,uae_u32,memIDhash,memIDeqKey> map_storage_type;
+
+// keeps the replayed reads from being optimized away
+static volatile uae_u32 sink;
+
+static void replayMap(const vector<memTraceRecord> &trace, size_t batchSize, benchResult *result)
+{
+	map_storage_type &storage = *(new map_storage_type());
+	uae_u32 sum = 0;
+	memoryID key;
+
+	key.id = getpid();
+	timeBatches(trace, batchSize, result, [&](const memTraceRecord *r, size_t n) {
+		for (size_t i = 0; i < n; i++) {
+			key.addr = r[i].addr;
+			if (r[i].op == MEMSERVER_WRITE) {
+				storage[key] = r[i].value;
+			} else {
+				map_storage_type::const_iterator iter = storage.find(key);
+				if (iter != storage.end())
+					sum += iter->second;
+			}
+		}
+		return true;
+	});
+	sink = sum;
+}
+
+static void replayPages(const vector<memTraceRecord> &trace, size_t batchSize, benchResult *result)
+{
+	MemoryStorage &storage = *(new MemoryStorage());
+	uae_u32 sum = 0;
+	int id = getpid();
+
+	timeBatches(trace, batchSize, result, [&](const memTraceRecord *r, size_t n) {
+		for (size_t i = 0; i < n; i++) {
+			if (r[i].op == MEMSERVER_WRITE)
+				storage.putMemoryData(r[i].addr, id, r[i].value);
+			else
+				sum += storage.getMemoryData(r[i].addr, id);
+		}
+		return true;
+	});
+	storage.scanDirtyPages((size_t) -1);
+	sink = sum;
+}
+
+/*
+ * Run an in-process backend in a child, so that its resident memory can
+ * be measured on its own
+ */
+static bool runInProcess(void (*replay)(const vector<memTraceRecord> &, size_t, benchResult *),
+		const vector<memTraceRecord> &trace, size_t batchSize, benchResult *result)
+{
+	int pipeFd[2];
+	pid_t pid;
+	int status;
+
+	if (pipe(pipeFd) < 0)
+		return false;
+
+	if ((pid = fork()) == 0) {
+		long rss;
+
+		close(pipeFd[0]);
+		rss = residentKiB(getpid());
+		replay(trace, batchSize, result);
+		result->rss = residentKiB(getpid()) - rss;
+		writeAll(pipeFd[1], result, sizeof(*result));
+		_exit(0);
+	}
+
+	close(pipeFd[1]);
+	bool ok = pid > 0 && readAll(pipeFd[0], result, sizeof(*result));
+	close(pipeFd[0]);
+	if (pid > 0)
+		waitpid(pid, &status, 0);
+	return ok;
+}
+
+/*
+ * Server transports
+ */
+static int connectServer()
+{
+	struct sockaddr_un svrAdd;
+	int fd = socket(PF_UNIX, SOCK_STREAM, 0);
+
+	if (fd < 0)
+		return -1;
+
+	bzero((char *) &svrAdd, sizeof(svrAdd));
+	svrAdd.sun_family = PF_UNIX;
+	strcpy(svrAdd.sun_path, SOCKET_PATH);
+
+	if (connect(fd, (struct sockaddr *) &svrAdd, sizeof(svrAdd)) < 0) {
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+static pid_t startServer(const char *serverPath, int *fd)
+{
+	pid_t pid = fork();
+
+	if (pid == 0) {
+		int null = open("/dev/null", O_WRONLY);
+
+		dup2(null, STDOUT_FILENO);
+		dup2(null, STDERR_FILENO);
+		execl(serverPath, serverPath, (char *) NULL);
+		_exit(127);
+	}
+	if (pid < 0)
+		return -1;
+
+	// esperar que o servidor aceite ligações (até 5 s)
+	for (int i = 0; i < 500; i++) {
+		if ((*fd = connectServer()) >= 0)
+			return pid;
+		usleep(10000);
+	}
+	kill(pid, SIGKILL);
+	waitpid(pid, NULL, 0);
+	return -1;
+}
+
+static void stopServer(pid_t pid)
+{
+	kill(pid, SIGINT);
+	waitpid(pid, NULL, 0);
+}
+
+static void fillPDU(memPDU *pdu, const memTraceRecord &r, int id)
+{
+	pdu->op = r.op == MEMSERVER_WRITE ? MEMSERVER_WRITE : MEMSERVER_READ;
+	pdu->id = id;
+	pdu->addr = r.addr;
+	pdu->data = r.value;
+}
+
+static bool replaySocket(int fd, const vector<memTraceRecord> &trace, size_t batchSize, benchResult *result)
+{
+	memPDU pdu[MEMSERVER_BATCH_SIZE];
+	uae_u32 values[MEMSERVER_BATCH_SIZE];
+	memBatchHeader header;
+	uae_u32 seq = 0;
+	int id = getpid();
+
+	timeBatches(trace, batchSize, result, [&](const memTraceRecord *r, size_t n) {
+		uae_u32 reads = 0;
+
+		for (size_t i = 0; i < n; i++) {
+			fillPDU(&pdu[i], r[i], id);
+			if (pdu[i].op == MEMSERVER_READ)
+				reads++;
+		}
+		header.seq = seq++;
+		header.count = n;
+		header.flags = MEMSERVER_BATCH_SYNC;
+
+		return writeAll(fd, &header, sizeof(header)) && writeAll(fd, pdu, n * sizeof(memPDU)) &&
+			readAll(fd, &header, sizeof(header)) && header.count == reads &&
+			readAll(fd, values, reads * sizeof(uae_u32));
+	});
+	return true;
+}
+
+/*
+ * Same handshake as the client: the memfd goes to the server in SCM_RIGHTS
+ */
+static shmRegion *startShm(int fd)
+{
+	memBatchHeader header = { 0, 0, MEMSERVER_BATCH_SHM };
+	struct msghdr msg;
+	struct iovec iov;
+	struct cmsghdr *cmsg;
+	char control[CMSG_SPACE(sizeof(int))];
+	shmRegion *region;
+
+	int shmFd = memfd_create("memory-benchmark", 0);
+	if (shmFd < 0 || ftruncate(shmFd, sizeof(shmRegion)) < 0)
+		return NULL;
+
+	region = (shmRegion *) mmap(NULL, sizeof(shmRegion), PROT_READ | PROT_WRITE, MAP_SHARED, shmFd, 0);
+	if (region == MAP_FAILED) {
+		close(shmFd);
+		return NULL;
+	}
+	region->magic = SHM_RING_MAGIC;
+	region->requests.init();
+	region->responses.init();
+
+	bzero(&msg, sizeof(msg));
+	bzero(control, sizeof(control));
+	iov.iov_base = &header;
+	iov.iov_len = sizeof(header);
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control;
+	msg.msg_controllen = sizeof(control);
+	cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+	memcpy(CMSG_DATA(cmsg), &shmFd, sizeof(int));
+
+	bool ok = sendmsg(fd, &msg, 0) == sizeof(header) && readAll(fd, &header, sizeof(header)) &&
+		(header.flags & MEMSERVER_BATCH_SHM);
+	close(shmFd);
+	if (!ok) {
+		munmap(region, sizeof(shmRegion));
+		return NULL;
+	}
+	return region;
+}
+
+/*
+ * Queue one access, waiting for the reply if there is one; false if the
+ * server went away
+ */
+static bool shmAccess(shmRegion *shm, int fd, const memPDU &pdu)
+{
+	struct timespec timeout = { 0, 100 * 1000 * 1000 };
+	uae_u32 value;
+
+	while (!shm->requests.push(pdu, &timeout)) {
+		if (connectionClosed(fd))
+			return false;
+	}
+	if (pdu.op != MEMSERVER_READ_REPLY)
+		return true;
+	while (!shm->responses.pop(value, &timeout)) {
+		if (connectionClosed(fd))
+			return false;
+	}
+	return true;
+}
+
+/*
+ * Each batch ends with a read whose reply marks the batch as served
+ */
+static bool replayShm(int fd, const vector<memTraceRecord> &trace, size_t batchSize, benchResult *result)
+{
+	shmRegion *shm = startShm(fd);
+	int id = getpid();
+	memPDU pdu;
+
+	if (!shm)
+		return false;
+
+	timeBatches(trace, batchSize, result, [&](const memTraceRecord *r, size_t n) {
+		for (size_t i = 0; i < n; i++) {
+			fillPDU(&pdu, r[i], id);
+			if (r[i].op == MEMTRACE_READ_SYNC)
+				pdu.op = MEMSERVER_READ_REPLY;
+			if (!shmAccess(shm, fd, pdu))
+				return false;
+		}
+		pdu.op = MEMSERVER_READ_REPLY;
+		return shmAccess(shm, fd, pdu);
+	});
+
+	munmap(shm, sizeof(shmRegion));
+	return true;
+}
+
+static bool runServer(const char *serverPath, bool useShm, const vector<memTraceRecord> &trace,
+		size_t batchSize, benchResult *result)
+{
+	int fd;
+	pid_t pid = startServer(serverPath, &fd);
+	bool ok;
+
+	if (pid < 0) {
+		cerr << "memory-benchmark: cannot start " << serverPath << endl;
+		return false;
+	}
+
+	long rss = residentKiB(pid);
+	ok = useShm ? replayShm(fd, trace, batchSize, result) : replaySocket(fd, trace, batchSize, result);
+	result->rss = residentKiB(pid) - rss;
+
+	close(fd);
+	stopServer(pid);
+	return ok;
+}
+
+/*
+ * Synthetic trace: mostly word accesses walking through 512 KiB of chip
+ * RAM plus a hot 64 KiB region, 60% reads
+ */
+static int generateTrace(const char *path, long accesses)
+{
+	memTraceWriter writer;
+	uae_u32 seed = 12345, walk = 0;
+
+	if (!writer.open(path)) {
+		cerr << "memory-benchmark: cannot write " << path << endl;
+		return 1;
+	}
+
+	for (long i = 0; i < accesses; i++) {
+		seed = seed * 1103515245 + 12345;
+		uae_u32 r = seed >> 8;
+		uaecptr addr;
+		int size = (r & 7) == 0 ? 4 : (r & 7) == 1 ? 1 : 2;
+
+		if (r % 10 < 7) {
+			walk = (walk + 2) & 0x7ffff;
+			addr = walk;
+		} else {
+			addr = 0xc00000 + ((r >> 4) & 0xfffe);
+		}
+
+		if (r % 5 < 2)
+			writer.record(MEMSERVER_WRITE, size, addr, r);
+		else if (r % 97 == 0)
+			writer.record(MEMTRACE_READ_SYNC, 4, addr, 0);
+		else
+			writer.record(MEMSERVER_READ, size, addr, 0);
+	}
+	return 0;
+}
+
+static void printResult(const char *backend, const char *transport, size_t batchSize, const benchResult &result)
+{
+	cout << left << setw(8) << backend << setw(10) << transport << right << setw(6) << batchSize
+		<< setw(14) << (uint64_t)(result.ops / result.seconds)
+		<< setw(12) << fixed << setprecision(2) << result.p50 / 1000.0
+		<< setw(12) << result.p99 / 1000.0
+		<< setw(12) << result.rss << endl;
+}
+
+static void printTraceSummary(const vector<memTraceRecord> &trace)
+{
+	uint64_t ops[4] = { 0, 0, 0, 0 }, sizes[5] = { 0, 0, 0, 0, 0 };
+	vector<uae_u32> pages;
+
+	for (size_t i = 0; i < trace.size(); i++) {
+		ops[trace[i].op & 3]++;
+		sizes[trace[i].size <= 4 ? trace[i].size : 0]++;
+		pages.push_back(trace[i].addr >> STORAGE_PAGE_BITS);
+	}
+	sort(pages.begin(), pages.end());
+	pages.erase(unique(pages.begin(), pages.end()), pages.end());
+
+	cout << trace.size() << " accesses: " << ops[MEMSERVER_WRITE] << " writes, "
+		<< ops[MEMSERVER_READ] << " reads, " << ops[MEMTRACE_READ_SYNC] << " sync reads; "
+		<< sizes[1] << " byte, " << sizes[2] << " word, " << sizes[4] << " long; "
+		<< pages.size() << " storage pages" << endl << endl;
+}
+
+static vector<size_t> parseList(const char *list)
+{
+	vector<size_t> values;
+	string s(list);
+	size_t start = 0, end;
+
+	do {
+		end = s.find(',', start);
+		values.push_back(strtoul(s.substr(start, end - start).c_str(), NULL, 0));
+		start = end + 1;
+	} while (end != string::npos);
+	return values;
+}
+
+int main(int argc, char* argv[])
+{
+	const char *serverPath = "./server";
+	string transports = "inproc,socket,shm";
+	vector<size_t> batchSizes;
+	vector<memTraceRecord> trace;
+	benchResult result;
+	int opt;
+
+	batchSizes.push_back(1);
+	batchSizes.push_back(16);
+	batchSizes.push_back(MEMSERVER_BATCH_SIZE);
+
+	while ((opt = getopt(argc, argv, "S:t:b:g:")) != -1) {
+		switch (opt) {
+		case 'S':
+			serverPath = optarg;
+			break;
+		case 't':
+			transports = optarg;
+			break;
+		case 'b':
+			batchSizes = parseList(optarg);
+			break;
+		case 'g':
+			return generateTrace(optarg, optind < argc ? atol(argv[optind]) : 1 << 20);
+		default:
+			cerr << "Usage: memory-benchmark [-S server] [-t inproc,socket,shm] [-b batch sizes] trace" << endl;
+			cerr << "       memory-benchmark -g trace [accesses]" << endl;
+			return 1;
+		}
+	}
+	if (optind >= argc || !readMemTrace(argv[optind], trace) || trace.empty()) {
+		cerr << "memory-benchmark: no trace to replay" << endl;
+		return 1;
+	}
+
+	bool useServer = transports.find("socket") != string::npos || transports.find("shm") != string::npos;
+	int running = useServer ? connectServer() : -1;
+	if (running >= 0) {
+		close(running);
+		cerr << "memory-benchmark: a server is already listening on " << SOCKET_PATH << endl;
+		return 1;
+	}
+
+	printTraceSummary(trace);
+	cout << left << setw(8) << "backend" << setw(10) << "transport" << right << setw(6) << "batch"
+		<< setw(14) << "ops/s" << setw(12) << "p50 (us)" << setw(12) << "p99 (us)"
+		<< setw(12) << "RSS (KiB)" << endl;
+
+	for (size_t b = 0; b < batchSizes.size(); b++) {
+		size_t batchSize = batchSizes[b];
+
+		if (batchSize == 0 || batchSize > MEMSERVER_BATCH_SIZE) {
+			cerr << "memory-benchmark: batch size must be 1.." << MEMSERVER_BATCH_SIZE << endl;
+			return 1;
+		}
+
+		if (transports.find("inproc") != string::npos) {
+			if (runInProcess(replayMap, trace, batchSize, &result))
+				printResult("map", "inproc", batchSize, result);
+			if (runInProcess(replayPages, trace, batchSize, &result))
+				printResult("pages", "inproc", batchSize, result);
+		}
+		if (transports.find("socket") != string::npos && runServer(serverPath, false, trace, batchSize, &result))
+			printResult("server", "socket", batchSize, result);
+		if (transports.find("shm") != string::npos && runServer(serverPath, true, trace, batchSize, &result))
+			printResult("server", "shm", batchSize, result);
+	}
+
+	return 0;
+}
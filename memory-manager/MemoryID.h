@@ -0,0 +1,51 @@
+#ifndef __MEMORY_ID_H__
+#define __MEMORY_ID_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include "PageTable.h"
+
+/*
+ * Chave (id, addr) do antigo map de endereços, que o MemoryStorage já não
+ * usa: fica só para os benchmarks que comparam as tabelas de páginas com
+ * um map por endereço e a hash inteira com a SHA-512.
+ */
+typedef struct {
+	uaecptr addr;
+	int id;
+} memoryID;
+
+class memIDeqKey {
+public:
+	bool operator() ( memoryID id1, memoryID id2) const
+	{
+		return id1.addr == id2.addr && id1.id == id2.id;
+	}
+};
+
+/**
+ * Mistura de 64 bits (finalizador do splitmix64): barata e com boa
+ * dispersão em todos os bits, ao contrário do valor original da chave
+ */
+inline uint64_t mix64(uint64_t x)
+{
+	x ^= x >> 30;
+	x *= 0xbf58476d1ce4e5b9ULL;
+	x ^= x >> 27;
+	x *= 0x94d049bb133111ebULL;
+	x ^= x >> 31;
+	return x;
+}
+
+/**
+ * Hash function for (id, addr) keys
+ */
+class memIDhash {
+public:
+	size_t operator()(const memoryID& v) const
+	{
+		return mix64(((uint64_t)(uae_u32)v.id << 32) | v.addr);
+	}
+};
+
+#endif
@@ -0,0 +1,169 @@
+#ifndef __MEMORY_STATS_H__
+#define __MEMORY_STATS_H__
+
+#include <string.h>
+#include <stdint.h>
+#include <iostream>
+#include <vector>
+
+typedef unsigned int uae_u32;
+typedef uae_u32 uaecptr;
+
+/*
+ * Estatísticas de memória fixa por cliente: contadores de acessos,
+ * páginas mais acedidas (count-min sketch + top-K) e histograma das
+ * latências de cada lote, em potências de 2 de nanosegundos.
+ */
+#define STATS_SKETCH_ROWS 4
+#define STATS_SKETCH_COLS 1024
+#define STATS_HOT_PAGES 16
+#define STATS_LATENCY_BUCKETS 32
+// granularidade das páginas contadas (4 KiB de endereços)
+#define STATS_PAGE_BITS 12
+
+typedef struct {
+	uaecptr addr;
+	uae_u32 count;
+} memHotPage;
+
+/*
+ * Registos devolvidos pelo pedido MEMSERVER_BATCH_STATS
+ */
+typedef struct {
+	uint64_t mappedPages;
+	uint64_t physicalPages;
+	uint64_t entries;
+	uae_u32 clients;
+	uae_u32 pad;
+} memServerStats;
+
+typedef struct {
+	int id;
+	uae_u32 hotPages;
+	uint64_t reads;
+	uint64_t writes;
+	uint64_t latency[STATS_LATENCY_BUCKETS];
+	memHotPage hot[STATS_HOT_PAGES];
+} memClientStats;
+
+class accessStats {
+private:
+	uint64_t reads;
+	uint64_t writes;
+	uint64_t latency[STATS_LATENCY_BUCKETS];
+	uae_u32 sketch[STATS_SKETCH_ROWS][STATS_SKETCH_COLS];
+	memHotPage hot[STATS_HOT_PAGES];
+	uae_u32 hotPages;
+
+	static uae_u32 column(uae_u32 page, int row) {
+		uint64_t x = ((uint64_t)(row + 1) << 32) | page;
+
+		x ^= x >> 33;
+		x *= 0xff51afd7ed558ccdULL;
+		x ^= x >> 33;
+		return (uae_u32) x & (STATS_SKETCH_COLS - 1);
+	}
+
+	/**
+	 * Count-min update, returns the new estimate for the page
+	 */
+	uae_u32 count(uae_u32 page) {
+		uae_u32 estimate = ~0u;
+
+		for (int row = 0; row < STATS_SKETCH_ROWS; row++) {
+			uae_u32 &c = sketch[row][column(page, row)];
+
+			if (c != ~0u)
+				c++;
+			if (c < estimate)
+				estimate = c;
+		}
+		return estimate;
+	}
+
+	void updateHot(uaecptr addr, uae_u32 estimate) {
+		uae_u32 smallest = 0;
+
+		for (uae_u32 i = 0; i < hotPages; i++) {
+			if (hot[i].addr == addr) {
+				hot[i].count = estimate;
+				return;
+			}
+			if (hot[i].count < hot[smallest].count)
+				smallest = i;
+		}
+		if (hotPages < STATS_HOT_PAGES) {
+			hot[hotPages].addr = addr;
+			hot[hotPages++].count = estimate;
+		} else if (estimate > hot[smallest].count) {
+			hot[smallest].addr = addr;
+			hot[smallest].count = estimate;
+		}
+	}
+
+public:
+	accessStats() {
+		memset(this, 0, sizeof(*this));
+	}
+
+	void access(uaecptr addr, bool write) {
+		uae_u32 page = addr >> STATS_PAGE_BITS;
+
+		if (write)
+			writes++;
+		else
+			reads++;
+		updateHot(page << STATS_PAGE_BITS, count(page));
+	}
+
+	void batchLatency(uint64_t ns) {
+		int bucket = ns ? 63 - __builtin_clzll(ns) : 0;
+
+		if (bucket >= STATS_LATENCY_BUCKETS)
+			bucket = STATS_LATENCY_BUCKETS - 1;
+		latency[bucket]++;
+	}
+
+	uint64_t accesses() const {
+		return reads + writes;
+	}
+
+	void fill(memClientStats *out, int id) const {
+		out->id = id;
+		out->hotPages = hotPages;
+		out->reads = reads;
+		out->writes = writes;
+		memcpy(out->latency, latency, sizeof(latency));
+		memcpy(out->hot, hot, sizeof(hot));
+	}
+};
+
+/**
+ * Human readable report, used by the server log and server-stats
+ */
+inline void printServerStats(std::ostream &out, const memServerStats &server, const std::vector<memClientStats> &clients)
+{
+	out << "clients: " << server.clients << std::endl;
+	out << "stored addresses: " << server.entries << std::endl;
+	out << "mapped pages: " << server.mappedPages << ", physical pages: " << server.physicalPages;
+	if (server.physicalPages)
+		out << ", dedup ratio: " << (double) server.mappedPages / server.physicalPages;
+	out << std::endl;
+
+	for (size_t i = 0; i < clients.size(); i++) {
+		const memClientStats &c = clients[i];
+
+		out << std::endl << "client " << c.id << ": " << c.reads << " reads, " << c.writes << " writes" << std::endl;
+		out << "  batch latency (ns):";
+		for (int b = 0; b < STATS_LATENCY_BUCKETS; b++) {
+			if (c.latency[b])
+				out << " <" << (1ULL << (b + 1)) << ":" << c.latency[b];
+		}
+		out << std::endl << "  hot pages:";
+		for (uae_u32 h = 0; h < c.hotPages; h++)
+			out << " " << std::hex << c.hot[h].addr << std::dec << ":" << c.hot[h].count;
+		out << std::endl;
+	}
+}
+
+#endif
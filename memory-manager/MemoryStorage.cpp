@@ -1,45 +1,241 @@
 #include "MemoryStorage.h"
 
 
-memoryID MemoryStorage::createIDpdu(uaecptr addr, int id) {
-	memoryID pdu;
-	pdu.addr = addr;
-	pdu.id = id;
+/*
+ * Cada thread guarda o último cliente que acedeu; as entradas do map
+ * nunca são removidas enquanto a MemoryStorage existe. A cache é indexada
+ * pelo número da instância e não pelo endereço, que pode ser reutilizado
+ * por uma MemoryStorage nova depois de a anterior ser destruída.
+ */
+static std::atomic<uint64_t> storageInstances(0);
+static thread_local uint64_t lastInstance = 0;
+static thread_local int lastID;
+static thread_local clientStorage *lastClient;
 
-	return pdu;
+MemoryStorage::MemoryStorage() : instance(++storageInstances) {
+	pthread_mutex_init(&clientsLock, NULL);
+	pthread_mutex_init(&storageLock, NULL);
+	pthread_mutex_init(&snapshotLock, NULL);
+}
+
+clientStorage *MemoryStorage::client(int id, bool create) {
+	if (lastInstance == instance && lastID == id)
+		return lastClient;
+
+	pthread_mutex_lock(&clientsLock);
+	database_type::iterator iter = memoryStorage.find(id);
+	if (iter == memoryStorage.end()) {
+		if (!create) {
+			pthread_mutex_unlock(&clientsLock);
+			return NULL;
+		}
+		iter = memoryStorage.emplace(id, new clientStorage(arena)).first;
+	}
+	pthread_mutex_unlock(&clientsLock);
+
+	lastInstance = instance;
+	lastID = id;
+	lastClient = iter->second;
+	return lastClient;
 }
 
-#ifdef __MEMORY_DEDUPLICATION__
 uae_u32 MemoryStorage::getMemoryData(uaecptr addr, int id) {
-	memoryID key = createIDpdu(addr, id);
+	clientStorage *c = client(id, false);
+	uae_u32 data = 0;
+
+	if (!c)
+		return 0;
+
+	pthread_mutex_lock(&c->lock);
+	storagePage *page = c->table.lookup(addr);
+	if (page)
+		data = page->data[addr & STORAGE_PAGE_MASK];
+	c->stats.access(addr, false);
+	pthread_mutex_unlock(&c->lock);
 
-	return *dedupMemoryStorage[key];
+	return data;
 }
 
-void MemoryStorage::putMemoryData(uaecptr addr, int id, uae_u32 data) {
+#ifdef __MEMORY_DEDUPLICATION__
+void MemoryStorage::unindexPage(storagePage *page) {
+	pair<deduplicated_data_type::iterator, deduplicated_data_type::iterator> range = dedupDataStorage.equal_range(page->hash);
+
+	for (deduplicated_data_type::iterator iter = range.first; iter != range.second; iter++) {
+		if (iter->second == page) {
+			dedupDataStorage.erase(iter);
+			break;
+		}
+	}
+	page->indexed = 0;
+}
+
+/*
+ * Página de addr pronta a ser alterada: copiada se for partilhada
+ * (copy-on-write), retirada do índice e marcada para nova análise.
+ * Chamada com o lock do cliente; uma página dirty é sempre privada e
+ * não indexada, por isso só as restantes (ou as que estão guardadas na
+ * snapshot) precisam do storageLock.
+ */
+storagePage *MemoryStorage::writablePage(clientStorage *c, uaecptr addr) {
+	storagePage **slot = c->table.lookupSlot(addr);
+
+	if (slot && *slot && (*slot)->dirty && !(*slot)->snapshot)
+		return *slot;
+
+	bool created = !slot || !*slot;
+
+	pthread_mutex_lock(&storageLock);
+	storagePage *&ref = c->table.lookupOrCreate(addr);
+	storagePage *page = ref;
+
+	if (created) {
+		mappedPages++;
+		page->refs = 1;
+	}
+
+	if (page->refs > 1) {
+		storagePage *copy = arena.alloc();
+
+		memcpy(copy, page, STORAGE_PAGE_CONTENT);
+		copy->refs = 1;
+		page->refs--;
+		ref = page = copy;
+	} else if (page->indexed) {
+		unindexPage(page);
+	}
+
+	if (!page->dirty) {
+		page->dirty = 1;
+		dirtyPages.push_back(make_pair(c, addr & ~STORAGE_PAGE_MASK));
+	}
+	page->snapshot = 0;
+	pthread_mutex_unlock(&storageLock);
+
+	return page;
+}
+
+/*
+ * Chamada com o lock do cliente e o storageLock
+ */
+void MemoryStorage::scanPage(clientStorage *c, uaecptr base) {
+	storagePage **slot = c->table.lookupSlot(base);
+	storagePage *page = *slot;
+
+	if (!page->dirty)
+		return;
+	page->dirty = 0;
+	page->hash = storagePageHash(page);
+
+	pair<deduplicated_data_type::iterator, deduplicated_data_type::iterator> range = dedupDataStorage.equal_range(page->hash);
+	for (deduplicated_data_type::iterator iter = range.first; iter != range.second; iter++) {
+		storagePage *shared = iter->second;
+
+		if (memcmp(shared, page, STORAGE_PAGE_CONTENT) == 0) {
+			shared->refs++;
+			*slot = shared;
+			arena.release(page);
+			return;
+		}
+	}
+
+	page->indexed = 1;
+	dedupDataStorage.emplace(page->hash, page);
+}
+
+size_t MemoryStorage::scanDirtyPages(size_t maxPages) {
+	dirty_pages_type batch;
+	size_t pending;
 
-	memoryID key = *(new memoryID(createIDpdu(addr, id)));
+	pthread_mutex_lock(&storageLock);
+	while (!dirtyPages.empty() && batch.size() < maxPages) {
+		batch.push_back(dirtyPages.front());
+		dirtyPages.pop_front();
+	}
+	pending = dirtyPages.size();
+	pthread_mutex_unlock(&storageLock);
 
-	dedupMemoryStorage[key] = &dedupDataStorage.emplace(data, data).first->second;
+	for (dirty_pages_type::iterator iter = batch.begin(); iter != batch.end(); iter++) {
+		pthread_mutex_lock(&iter->first->lock);
+		pthread_mutex_lock(&storageLock);
+		scanPage(iter->first, iter->second);
+		pthread_mutex_unlock(&storageLock);
+		pthread_mutex_unlock(&iter->first->lock);
+	}
 
-	memoryStats.emplace(data, key);
+	return pending;
 }
 #else
-uae_u32 MemoryStorage::getMemoryData(uaecptr addr, int id) {
-	memoryID key = createIDpdu(addr, id);
+storagePage *MemoryStorage::writablePage(clientStorage *c, uaecptr addr) {
+	storagePage **slot = c->table.lookupSlot(addr);
+
+	if (slot && *slot && !(*slot)->snapshot)
+		return *slot;
 
-	return memoryStorage[key];
+	pthread_mutex_lock(&storageLock);
+	if (!slot || !*slot)
+		mappedPages++;
+	storagePage *page = c->table.lookupOrCreate(addr);
+	page->snapshot = 0;
+	pthread_mutex_unlock(&storageLock);
+
+	return page;
+}
+
+size_t MemoryStorage::scanDirtyPages(size_t maxPages) {
+	return 0;
 }
+#endif
 
 void MemoryStorage::putMemoryData(uaecptr addr, int id, uae_u32 data) {
+	clientStorage *c = client(id, true);
+	uae_u32 slot = addr & STORAGE_PAGE_MASK;
 
-	memoryID key = *(new memoryID(createIDpdu(addr, id)));
+	pthread_mutex_lock(&c->lock);
+	storagePage *page = writablePage(c, addr);
 
-	memoryStorage[key] = data;
-	memoryStats.emplace(data, key);
+	if (!storagePagePresent(page, addr)) {
+		page->present[slot >> 5] |= 1u << (slot & 31);
+		c->entries++;
+	}
+	page->data[slot] = data;
+
+	c->stats.access(addr, true);
+	pthread_mutex_unlock(&c->lock);
 }
-#endif
 
+void MemoryStorage::recordLatency(int id, uint64_t ns) {
+	clientStorage *c = client(id, false);
+
+	if (!c)
+		return;
+
+	pthread_mutex_lock(&c->lock);
+	c->stats.batchLatency(ns);
+	pthread_mutex_unlock(&c->lock);
+}
+
+void MemoryStorage::getStats(memServerStats *server, vector<memClientStats> &clients) {
+	memClientStats stats;
+
+	memset(server, 0, sizeof(*server));
+	clients.clear();
+
+	pthread_mutex_lock(&clientsLock);
+	for (database_type_iterator iter = memoryStorage.begin(); iter != memoryStorage.end(); iter++) {
+		pthread_mutex_lock(&iter->second->lock);
+		iter->second->stats.fill(&stats, iter->first);
+		server->entries += iter->second->entries;
+		pthread_mutex_unlock(&iter->second->lock);
+		clients.push_back(stats);
+	}
+	pthread_mutex_unlock(&clientsLock);
+
+	pthread_mutex_lock(&storageLock);
+	server->mappedPages = mappedPages;
+	server->physicalPages = arena.pages();
+	pthread_mutex_unlock(&storageLock);
+	server->clients = clients.size();
+}
 
 #if 0
 #include <iostream>
@@ -82,47 +278,33 @@ int main (int argc, char* argv[])
 	 * Apresentação de resultados
 	 */
 #ifdef __MEMORY_DEDUPLICATION__
+	memoryStorage.scanDirtyPages((size_t) -1);
 	int memSize = memoryStorage.dedupMemoryStorageSize();
 	int dataSize = memoryStorage.dedupDataStorageSize();
 #else
 	int memSize = memoryStorage.memoryStorageSize();
 #endif
-	int allRequests = memoryStorage.memoryStatsSize();
+	int allRequests = memoryStorage.memoryAccesses();
 	assert(allRequests!=0);
 	float access_ratio = ((float)memSize)/((float)allRequests);
 
 	ofstream logFile;
 	logFile.open("log.txt");
-#ifdef __MEMORY_DEDUPLICATION__
-	logFile << "dedupMemoryStorage: unordered_map<memoryID,uae_u32*,memIDhash,memIDeqKey> deduplicated_database_type" << endl;
-	for (deduplicated_database_iterator iter = memoryStorage.dedupMemoryStorageBeginIterator(); iter != memoryStorage.dedupMemoryStorageEndIterator(); iter++) {
-		logFile << "Key: [" << iter->first.id << "," << iter->first.addr << "]\t\tData: ";
-		logFile << *(iter->second);
-		logFile << endl;
-	}
-#else
-	logFile << "memoryStorage: unordered_map<memoryID,uae_u32,memIDhash,memIDeqKey> database_type" << endl;
-	for (database_type_iterator iter = memoryStorage.memoryStorageBeginIterator(); iter != memoryStorage.memoryStorageEndIterator(); iter++) {
-		logFile << "Key: [" << iter->first.id << "," << iter->first.addr << "]\t\tData: " << iter->second << endl;
-	}
-#endif
-	logFile << endl;
-	logFile << endl;
-	logFile << "memoryStats: unordered_multimap<uae_u32,memoryID> stats_type" << endl;
-	for (stats_type_iterator iter = memoryStorage.memoryStatsBeginIterator(); iter != memoryStorage.memoryStatsEndIterator(); iter++) {
-		logFile << "Key: "<< iter->first << "\t\tData: [" << iter->second.id << "," << iter->second.addr << "]" << endl;
-	}
+	logFile << "memoryStorage: unordered_map<int,PageTable*> database_type" << endl;
+	memoryStorage.forEachMemoryData([&](int id, uaecptr addr, uae_u32 data) {
+		logFile << "Key: [" << id << "," << addr << "]\t\tData: " << data << endl;
+	});
 
 #ifdef __MEMORY_DEDUPLICATION__
 	assert(memSize!=0);
 	float optimization_ratio = ((float)dataSize)/((float)memSize);
 	cout << "dedupMemoryStorage.size() is " << memSize << endl;
 	cout << "dedupDataStorage.size() is " << dataSize << endl;
-	cout << "dedupMemoryStats.size() is " << allRequests << endl;
+	cout << "accesses: " << allRequests << endl;
 	cout << "Optimization acquired in run was: " << optimization_ratio << endl;
 #else
 	cout << "memoryStorage.size() is " << memSize << endl;
-	cout << "memoryStats.size() is " << allRequests << endl;
+	cout << "accesses: " << allRequests << endl;
 #endif
 	cout << "Memory access ration was: " << access_ratio << endl;
 
@@ -3,151 +3,131 @@
 
 #include <unordered_map>
 #include <unordered_set>
-#include <openssl/sha.h>
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <pthread.h>
 #include <sstream>
 #include <string>
 #include <stdlib.h>
+#include <stdint.h>
+#include "PageTable.h"
+#include "MemoryStats.h"
 
 // Descomentar para correr o algoritmo com deduplicação
 #define __MEMORY_DEDUPLICATION__
 
-typedef unsigned int uae_u32;
-typedef uae_u32 uaecptr;
-
 using namespace std;
 
-typedef struct {
-	uaecptr addr;
-	int id;
-} memoryID;
-
-class memIDeqKey {
-public:
-	bool operator() ( memoryID id1, memoryID id2) const
-	{
-		return id1.addr == id2.addr && id1.id == id2.id;
-	}
-};
-
-inline string to_string_2args(const int& t1, const int& t2)
-{
-    stringstream ss;
-    ss << t1;
-    ss << t2;
-    return ss.str();
-}
-
-class memIDhash {
-public:
-	size_t operator()(const memoryID& v) const
-	{
-	   unsigned char digest[SHA512_DIGEST_LENGTH];
-	   string text = to_string_2args(v.id, v.addr);
-	   char mdString[SHA512_DIGEST_LENGTH*2+1];
-
-	   SHA512((unsigned char*) text.c_str(), text.length(), (unsigned char*)&digest);
-
-	   for(int i = 0; i < SHA512_DIGEST_LENGTH; i++)
-			sprintf(&mdString[i*2], "%02x", (unsigned int)digest[i]);
-
-	   return strtoul(mdString, NULL, 0);
-	}
-};
-
 /**
- * Hash function for uae_32
+ * Estado de um cliente: tabela de páginas com lock próprio, para que
+ * clientes diferentes nunca disputem o mesmo lock
  */
-class uae_u32_hash {
+class clientStorage {
 public:
-	size_t operator () (const uae_u32 &v) const
-	{
-		unsigned char digest[SHA512_DIGEST_LENGTH];
-		string text = to_string(v);
-		char mdString[SHA512_DIGEST_LENGTH*2+1];
+	PageTable table;
+	pthread_mutex_t lock;
+	size_t entries;
+	accessStats stats;
 
-		SHA512((unsigned char*) text.c_str(), text.length(), (unsigned char*)&digest);
-
-		for(int i = 0; i < SHA512_DIGEST_LENGTH; i++)
-			sprintf(&mdString[i*2], "%02x", (unsigned int)digest[i]);
-
-		return strtoul(mdString, NULL, 0);
+	clientStorage(PageArena &arena) : table(arena), entries(0) {
+		pthread_mutex_init(&lock, NULL);
+	}
+	~clientStorage() {
+		pthread_mutex_destroy(&lock);
 	}
 };
 
-// versão normal da base de dados
-typedef unordered_map<memoryID,uae_u32,memIDhash,memIDeqKey> database_type;
-// versão optimizada com deduplicação da base de dados
-typedef unordered_map<uae_u32,uae_u32,uae_u32_hash> deduplicated_data_type;
-typedef unordered_map<memoryID,uae_u32*,memIDhash,memIDeqKey> deduplicated_database_type;
-// para guardar todos os acessos (id, addr) efectuados a dados
-typedef unordered_multimap<uae_u32,memoryID> stats_type;
+// versão normal da base de dados: uma tabela de páginas por cliente
+typedef unordered_map<int,clientStorage*> database_type;
+// versão optimizada com deduplicação: índice hash do conteúdo -> página partilhada
+typedef unordered_multimap<uint64_t,storagePage*> deduplicated_data_type;
+// páginas alteradas desde a última análise (cliente, endereço base)
+typedef deque<pair<clientStorage*,uaecptr> > dirty_pages_type;
 // iteradores para os map anteriores
 typedef database_type::const_iterator database_type_iterator;
-typedef deduplicated_database_type::const_iterator deduplicated_database_iterator;
-typedef deduplicated_data_type::const_iterator deduplicated_data_iterator;
-typedef stats_type::const_iterator stats_type_iterator;
 
+/**
+ * Thread-safe. Accesses only take the lock of their client; the arena,
+ * the dedup index and the dirty page queue are under storageLock, which
+ * is always taken after a client lock.
+ */
 class MemoryStorage {
 private:
+	PageArena arena;
 	database_type &memoryStorage = *(new database_type());
+	pthread_mutex_t clientsLock;
+	pthread_mutex_t storageLock;
+	pthread_mutex_t snapshotLock;
 	deduplicated_data_type &dedupDataStorage = *(new deduplicated_data_type());
-	deduplicated_database_type &dedupMemoryStorage = *(new deduplicated_database_type());
-	stats_type &memoryStats = *(new stats_type());
-
-	memoryID createIDpdu(uaecptr addr, int id);
+	dirty_pages_type &dirtyPages = *(new dirty_pages_type());
+	size_t mappedPages = 0;
+	// páginas já escritas no ficheiro de snapshot actual
+	uae_u32 snapshotPages = 0;
+	// número único da instância, chave da cache de clientes por thread
+	const uint64_t instance;
+
+	clientStorage *client(int id, bool create);
+	storagePage *writablePage(clientStorage *c, uaecptr addr);
+	void unindexPage(storagePage *page);
+	void scanPage(clientStorage *c, uaecptr base);
+	void clientList(vector<pair<int,clientStorage*> > &clients);
 
 public:
-	MemoryStorage() {};
+	MemoryStorage();
 
 	~MemoryStorage() {
+		for (database_type_iterator iter = memoryStorage.begin(); iter != memoryStorage.end(); iter++)
+			delete iter->second;
 		delete &memoryStorage;
 		delete &dedupDataStorage;
-		delete &dedupMemoryStorage;
-		delete &memoryStats;
+		delete &dirtyPages;
+		pthread_mutex_destroy(&clientsLock);
+		pthread_mutex_destroy(&storageLock);
+		pthread_mutex_destroy(&snapshotLock);
 	};
 
 	/**
 	 * Data structures size
 	 */
 	size_t memoryStorageSize() {
-		return memoryStorage.size();
+		size_t size = 0;
+		for (database_type_iterator iter = memoryStorage.begin(); iter != memoryStorage.end(); iter++)
+			size += iter->second->entries;
+		return size;
 	}
+	size_t memoryStoragePages() {
+		return arena.pages();
+	}
+	// páginas físicas distintas
 	size_t dedupDataStorageSize() {
-		return dedupDataStorage.size();
+		return arena.pages();
 	}
+	// páginas mapeadas em todas as tabelas de clientes
 	size_t dedupMemoryStorageSize() {
-		return dedupMemoryStorage.size();
+		return mappedPages;
 	}
-	size_t memoryStatsSize() {
-		return memoryStats.size();
+	uint64_t memoryAccesses() {
+		uint64_t accesses = 0;
+		for (database_type_iterator iter = memoryStorage.begin(); iter != memoryStorage.end(); iter++)
+			accesses += iter->second->stats.accesses();
+		return accesses;
 	}
 
 	/**
-	 * Obter iteradores
+	 * Call f(id, addr, data) for every stored address
 	 */
-	database_type_iterator memoryStorageBeginIterator() {
-		return memoryStorage.begin();
-	}
-	database_type_iterator memoryStorageEndIterator() {
-		return memoryStorage.end();
-	}
-	deduplicated_database_iterator dedupMemoryStorageBeginIterator() {
-		return dedupMemoryStorage.begin();
-	}
-	deduplicated_database_iterator dedupMemoryStorageEndIterator() {
-		return dedupMemoryStorage.end();
-	}
-	deduplicated_data_iterator dedupDataStorageBeginIterator() {
-		return dedupDataStorage.begin();
-	}
-	deduplicated_data_iterator dedupDataStorageEndIterator() {
-		return dedupDataStorage.end();
-	}
-	stats_type_iterator memoryStatsBeginIterator() {
-		return memoryStats.begin();
-	}
-	stats_type_iterator memoryStatsEndIterator() {
-		return memoryStats.end();
+	template <typename F>
+	void forEachMemoryData(F f) {
+		for (database_type_iterator iter = memoryStorage.begin(); iter != memoryStorage.end(); iter++) {
+			int id = iter->first;
+			iter->second->table.forEachPage([&](uaecptr base, const storagePage *page) {
+				for (uae_u32 slot = 0; slot < STORAGE_PAGE_SLOTS; slot++) {
+					if (storagePagePresent(page, base | slot))
+						f(id, base | slot, page->data[slot]);
+				}
+			});
+		}
 	}
 
 	/**
@@ -160,6 +140,35 @@ public:
 	 */
 	void putMemoryData(uaecptr addr, int id, uae_u32 data);
 
+	/**
+	 * Analisar até maxPages páginas alteradas, partilhando as que tenham
+	 * conteúdo idêntico a uma página já indexada. Devolve o número de
+	 * páginas que ficam por analisar.
+	 */
+	size_t scanDirtyPages(size_t maxPages);
+
+	/**
+	 * Registar o tempo de serviço de um lote do cliente
+	 */
+	void recordLatency(int id, uint64_t ns);
+
+	/**
+	 * Cópia das estatísticas actuais, globais e de cada cliente
+	 */
+	void getStats(memServerStats *server, vector<memClientStats> &clients);
+
+	/**
+	 * Guardar o conteúdo num ficheiro de snapshot. No modo incremental só
+	 * são acrescentadas as páginas alteradas desde a snapshot anterior;
+	 * caso contrário o ficheiro é reescrito (compactado).
+	 */
+	bool saveSnapshot(const char *path, bool incremental);
+
+	/**
+	 * Carregar uma snapshot; chamada antes de aceitar ligações
+	 */
+	bool loadSnapshot(const char *path);
+
 };
 
 
@@ -0,0 +1,134 @@
+#ifndef __MEMORY_TRACE_H__
+#define __MEMORY_TRACE_H__
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+#include "unix_socket.h"
+
+/*
+ * Traces de acessos do emulador (FSUAE_MEMSERVER_TRACE=ficheiro no
+ * cliente), reproduzidos pelo memory-benchmark.
+ *
+ * Cada registo começa com um byte: operação nos bits 0-1, log2 do tamanho
+ * nos bits 2-3 e, no bit 4, se o valor segue. Depois vem a diferença para
+ * o endereço anterior (zigzag varint) e, se existir, o valor (varint).
+ * Acessos sequenciais ficam assim com 2 a 6 bytes em vez de 12.
+ */
+#define MEMTRACE_MAGIC 0x4d454d54
+#define MEMTRACE_VERSION 1
+// leitura síncrona (readServer), cujo valor é conhecido
+#define MEMTRACE_READ_SYNC 3
+#define MEMTRACE_HAS_VALUE 0x10
+
+typedef struct {
+	uae_u32 magic;
+	uae_u32 version;
+} memTraceHeader;
+
+typedef struct {
+	unsigned char op;
+	unsigned char size;
+	uaecptr addr;
+	uae_u32 value;
+} memTraceRecord;
+
+class memTraceWriter {
+private:
+	FILE *file;
+	uaecptr lastAddr;
+
+	void varint(uint64_t v) {
+		while (v >= 0x80) {
+			putc((int)(v & 0x7f) | 0x80, file);
+			v >>= 7;
+		}
+		putc((int) v, file);
+	}
+
+public:
+	memTraceWriter() : file(NULL), lastAddr(0) {}
+	~memTraceWriter() {
+		close();
+	}
+
+	bool open(const char *path) {
+		memTraceHeader header = { MEMTRACE_MAGIC, MEMTRACE_VERSION };
+
+		file = fopen(path, "wb");
+		return file && fwrite(&header, sizeof(header), 1, file) == 1;
+	}
+
+	void close() {
+		if (file)
+			fclose(file);
+		file = NULL;
+	}
+
+	void record(int op, int size, uaecptr addr, uae_u32 value) {
+		int32_t delta = (int32_t)(addr - lastAddr);
+		bool hasValue = op != MEMSERVER_READ;
+		int sizeLog = size == 4 ? 2 : size == 2 ? 1 : 0;
+
+		putc(op | (sizeLog << 2) | (hasValue ? MEMTRACE_HAS_VALUE : 0), file);
+		varint(((uae_u32) delta << 1) ^ (uae_u32)(delta >> 31));
+		if (hasValue)
+			varint(value);
+		lastAddr = addr;
+	}
+};
+
+/**
+ * Decode a whole trace file, false if it is not a trace
+ */
+inline bool readMemTrace(const char *path, std::vector<memTraceRecord> &records)
+{
+	memTraceHeader header;
+	memTraceRecord r;
+	uaecptr addr = 0;
+	FILE *file;
+	int c;
+
+	records.clear();
+	if ((file = fopen(path, "rb")) == NULL)
+		return false;
+	if (fread(&header, sizeof(header), 1, file) != 1 ||
+			header.magic != MEMTRACE_MAGIC || header.version != MEMTRACE_VERSION) {
+		fclose(file);
+		return false;
+	}
+
+	while ((c = getc(file)) != EOF) {
+		uint64_t v[2] = { 0, 0 };
+		int fields = (c & MEMTRACE_HAS_VALUE) ? 2 : 1;
+
+		for (int f = 0; f < fields; f++) {
+			int b, shift = 0;
+
+			do {
+				if ((b = getc(file)) == EOF)
+					break;
+				v[f] |= (uint64_t)(b & 0x7f) << shift;
+				shift += 7;
+			} while (b & 0x80);
+			// registo incompleto no fim (emulador terminado a meio)
+			if (b == EOF) {
+				fclose(file);
+				return true;
+			}
+		}
+
+		uae_u32 zigzag = (uae_u32) v[0];
+		addr += (uae_u32)((zigzag >> 1) ^ -(zigzag & 1));
+		r.op = c & 3;
+		r.size = 1 << ((c >> 2) & 3);
+		r.addr = addr;
+		r.value = (uae_u32) v[1];
+		records.push_back(r);
+	}
+
+	fclose(file);
+	return true;
+}
+
+#endif
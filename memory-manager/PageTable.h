@@ -0,0 +1,195 @@
+#ifndef __PAGE_TABLE_H__
+#define __PAGE_TABLE_H__
+
+#include <vector>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+typedef unsigned int uae_u32;
+typedef uae_u32 uaecptr;
+
+/*
+ * Armazenamento paginado: cada página guarda um uae_u32 por endereço
+ * (1024 endereços = 4 KiB de dados) e um bitmap dos endereços já escritos.
+ * As páginas são indexadas por uma tabela radix de dois níveis
+ * (11 + 11 bits) e alocadas a pedido a partir de uma arena.
+ */
+#define STORAGE_PAGE_BITS 10
+#define STORAGE_PAGE_SLOTS (1 << STORAGE_PAGE_BITS)
+#define STORAGE_PAGE_MASK (STORAGE_PAGE_SLOTS - 1)
+#define STORAGE_LEAF_BITS 11
+#define STORAGE_LEAF_SIZE (1 << STORAGE_LEAF_BITS)
+#define STORAGE_DIR_BITS (32 - STORAGE_PAGE_BITS - STORAGE_LEAF_BITS)
+#define STORAGE_DIR_SIZE (1 << STORAGE_DIR_BITS)
+// páginas reservadas de cada vez pela arena (1 MiB)
+#define STORAGE_ARENA_PAGES 256
+
+typedef struct {
+	uae_u32 data[STORAGE_PAGE_SLOTS];
+	uae_u32 present[STORAGE_PAGE_SLOTS / 32];
+	// deduplicação: hash do conteúdo, número de tabelas que partilham
+	// a página, alterada desde a última análise, presente no índice
+	uint64_t hash;
+	uae_u32 refs;
+	// índice + 1 da página no ficheiro de snapshot, 0 se alterada desde
+	// a última snapshot
+	uae_u32 snapshot;
+	unsigned char dirty;
+	unsigned char indexed;
+} storagePage;
+
+// bytes de uma página que contam para a comparação de conteúdo
+#define STORAGE_PAGE_CONTENT (sizeof(((storagePage *)0)->data) + sizeof(((storagePage *)0)->present))
+
+/**
+ * Allocates zeroed pages in large chunks. Released pages are kept on a
+ * free list for reuse; memory is only returned together with the arena.
+ */
+template <typename T>
+class PageArenaT {
+private:
+	std::vector<T *> chunks;
+	std::vector<T *> freePages;
+	size_t used;
+
+public:
+	PageArenaT() : used(STORAGE_ARENA_PAGES) {}
+
+	~PageArenaT() {
+		for (size_t i = 0; i < chunks.size(); i++)
+			free(chunks[i]);
+	}
+
+	T *alloc() {
+		T *page;
+
+		if (!freePages.empty()) {
+			page = freePages.back();
+			freePages.pop_back();
+			memset(page, 0, sizeof(T));
+		} else {
+			if (used == STORAGE_ARENA_PAGES) {
+				chunks.push_back((T *) calloc(STORAGE_ARENA_PAGES, sizeof(T)));
+				used = 0;
+			}
+			page = &chunks.back()[used++];
+		}
+		return page;
+	}
+
+	void release(T *page) {
+		freePages.push_back(page);
+	}
+
+	size_t pages() const {
+		size_t allocated = chunks.empty() ? 0 : (chunks.size() - 1) * STORAGE_ARENA_PAGES + used;
+
+		return allocated - freePages.size();
+	}
+};
+
+/**
+ * Address space of a single client
+ */
+template <typename T>
+class PageTableT {
+private:
+	T **dir[STORAGE_DIR_SIZE];
+	PageArenaT<T> &arena;
+
+	PageTableT(const PageTableT &);
+	PageTableT &operator=(const PageTableT &);
+
+public:
+	PageTableT(PageArenaT<T> &arena) : arena(arena) {
+		memset(dir, 0, sizeof(dir));
+	}
+
+	~PageTableT() {
+		for (int i = 0; i < STORAGE_DIR_SIZE; i++)
+			delete[] dir[i];
+	}
+
+	T *lookup(uaecptr addr) const {
+		T **leaf = dir[addr >> (STORAGE_PAGE_BITS + STORAGE_LEAF_BITS)];
+
+		if (!leaf)
+			return NULL;
+		return leaf[(addr >> STORAGE_PAGE_BITS) & (STORAGE_LEAF_SIZE - 1)];
+	}
+
+	/**
+	 * Table entry for addr, NULL if its leaf was never allocated
+	 */
+	T **lookupSlot(uaecptr addr) const {
+		T **leaf = dir[addr >> (STORAGE_PAGE_BITS + STORAGE_LEAF_BITS)];
+
+		if (!leaf)
+			return NULL;
+		return &leaf[(addr >> STORAGE_PAGE_BITS) & (STORAGE_LEAF_SIZE - 1)];
+	}
+
+	/**
+	 * Table entry for addr, allocating its leaf but not the page
+	 */
+	T *&slot(uaecptr addr) {
+		T **&leaf = dir[addr >> (STORAGE_PAGE_BITS + STORAGE_LEAF_BITS)];
+
+		if (!leaf)
+			leaf = new T *[STORAGE_LEAF_SIZE]();
+
+		return leaf[(addr >> STORAGE_PAGE_BITS) & (STORAGE_LEAF_SIZE - 1)];
+	}
+
+	T *&lookupOrCreate(uaecptr addr) {
+		T *&page = slot(addr);
+
+		if (!page)
+			page = arena.alloc();
+		return page;
+	}
+
+	/**
+	 * Call f(base address, page) for every allocated page, in address order
+	 */
+	template <typename F>
+	void forEachPage(F f) const {
+		for (uae_u32 i = 0; i < STORAGE_DIR_SIZE; i++) {
+			if (!dir[i])
+				continue;
+			for (uae_u32 j = 0; j < STORAGE_LEAF_SIZE; j++) {
+				if (dir[i][j])
+					f((i << (STORAGE_PAGE_BITS + STORAGE_LEAF_BITS)) | (j << STORAGE_PAGE_BITS), dir[i][j]);
+			}
+		}
+	}
+};
+
+typedef PageArenaT<storagePage> PageArena;
+typedef PageTableT<storagePage> PageTable;
+
+/**
+ * Hash não criptográfica do conteúdo de uma página (64 bits por iteração)
+ */
+inline uint64_t storagePageHash(const storagePage *page)
+{
+	const uint64_t *p = (const uint64_t *) page;
+	uint64_t h = 0x9e3779b97f4a7c15ULL;
+
+	for (size_t i = 0; i < STORAGE_PAGE_CONTENT / sizeof(uint64_t); i++) {
+		h ^= p[i] * 0xff51afd7ed558ccdULL;
+		h = ((h << 31) | (h >> 33)) * 0xc4ceb9fe1a85ec53ULL;
+	}
+	h ^= h >> 33;
+	return h;
+}
+
+inline bool storagePagePresent(const storagePage *page, uaecptr addr)
+{
+	uae_u32 slot = addr & STORAGE_PAGE_MASK;
+
+	return (page->present[slot >> 5] >> (slot & 31)) & 1;
+}
+
+#endif
@@ -0,0 +1,87 @@
+/*
+ * Consulta as estatísticas de um servidor em execução.
+ *
+ * Uso: server-stats [intervalo em segundos]
+ * Sem intervalo mostra as estatísticas uma vez.
+ */
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <strings.h>
+#include <stdlib.h>
+#include <iostream>
+#include <vector>
+#include "unix_socket.h"
+
+using namespace std;
+
+static bool readAll(int fd, void *buf, size_t size)
+{
+	char *p = (char *) buf;
+
+	while (size > 0) {
+		ssize_t checker = read(fd, p, size);
+		if (checker <= 0)
+			return false;
+		p += checker;
+		size -= checker;
+	}
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	int interval = argc > 1 ? atoi(argv[1]) : 0;
+	struct sockaddr_un svrAdd;
+	memBatchHeader header;
+	memServerStats serverStats;
+	vector<memClientStats> clientStats;
+
+	int fd = socket(PF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0)
+	{
+		cerr << "Cannot open socket" << endl;
+		return 1;
+	}
+
+	bzero((char *) &svrAdd, sizeof(svrAdd));
+	svrAdd.sun_family = PF_UNIX;
+	strcpy(svrAdd.sun_path, SOCKET_PATH);
+
+	if (connect(fd, (struct sockaddr *) &svrAdd, sizeof(svrAdd)) < 0)
+	{
+		cerr << "Cannot connect to " << SOCKET_PATH << endl;
+		return 1;
+	}
+
+	for (uae_u32 seq = 0; ; seq++) {
+		header.seq = seq;
+		header.count = 0;
+		header.flags = MEMSERVER_BATCH_STATS;
+
+		if (write(fd, &header, sizeof(header)) != sizeof(header) ||
+				!readAll(fd, &header, sizeof(header)) ||
+				!readAll(fd, &serverStats, sizeof(serverStats)))
+		{
+			cerr << "Connection to server lost" << endl;
+			return 1;
+		}
+
+		clientStats.resize(header.count);
+		if (!readAll(fd, clientStats.data(), header.count * sizeof(memClientStats)))
+		{
+			cerr << "Connection to server lost" << endl;
+			return 1;
+		}
+
+		printServerStats(cout, serverStats, clientStats);
+		if (interval <= 0)
+			break;
+		cout << endl;
+		sleep(interval);
+	}
+
+	close(fd);
+	return 0;
+}
@@ -0,0 +1,231 @@
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <iostream>
+#include "MemoryStorage.h"
+#include "Snapshot.h"
+
+void MemoryStorage::clientList(vector<pair<int,clientStorage*> > &clients) {
+	clients.clear();
+
+	pthread_mutex_lock(&clientsLock);
+	for (database_type_iterator iter = memoryStorage.begin(); iter != memoryStorage.end(); iter++)
+		clients.push_back(*iter);
+	pthread_mutex_unlock(&clientsLock);
+}
+
+static bool writeSnapshotData(FILE *file, const void *buf, size_t size) {
+	return size == 0 || fwrite(buf, size, 1, file) == 1;
+}
+
+/*
+ * As páginas de cada cliente são copiadas com o lock do cliente e o
+ * storageLock, e o ficheiro só é escrito depois de os largar. Uma página
+ * alterada depois de copiada fica com snapshot a 0 e entra na próxima.
+ */
+bool MemoryStorage::saveSnapshot(const char *path, bool incremental) {
+	vector<pair<int,clientStorage*> > clients;
+	vector<char> pages;
+	vector<snapshotMapping> mappings;
+	snapshotSegment segment;
+	string tmpPath;
+	FILE *file;
+	bool ok;
+
+	pthread_mutex_lock(&snapshotLock);
+	clientList(clients);
+
+	// sem snapshot anterior válida não há a que acrescentar
+	if (incremental && snapshotPages == 0)
+		incremental = false;
+
+	if (!incremental) {
+		for (size_t i = 0; i < clients.size(); i++) {
+			clientStorage *c = clients[i].second;
+
+			pthread_mutex_lock(&c->lock);
+			pthread_mutex_lock(&storageLock);
+			c->table.forEachPage([&](uaecptr, storagePage *page) {
+				page->snapshot = 0;
+			});
+			pthread_mutex_unlock(&storageLock);
+			pthread_mutex_unlock(&c->lock);
+		}
+		snapshotPages = 0;
+	}
+
+	segment.magic = SNAPSHOT_SEGMENT_MAGIC;
+	segment.pad = 0;
+	segment.firstPage = snapshotPages;
+
+	for (size_t i = 0; i < clients.size(); i++) {
+		int id = clients[i].first;
+		clientStorage *c = clients[i].second;
+
+		pthread_mutex_lock(&c->lock);
+		pthread_mutex_lock(&storageLock);
+		c->table.forEachPage([&](uaecptr base, storagePage *page) {
+			snapshotMapping m;
+
+			if (!page->snapshot) {
+				page->snapshot = ++snapshotPages;
+				pages.insert(pages.end(), (const char *) page, (const char *) page + STORAGE_PAGE_CONTENT);
+			}
+			m.id = id;
+			m.base = base;
+			m.page = page->snapshot - 1;
+			mappings.push_back(m);
+		});
+		pthread_mutex_unlock(&storageLock);
+		pthread_mutex_unlock(&c->lock);
+	}
+
+	segment.pages = pages.size() / STORAGE_PAGE_CONTENT;
+	segment.mappings = mappings.size();
+
+	if (incremental) {
+		file = fopen(path, "r+b");
+		ok = file && fseek(file, 0, SEEK_END) == 0;
+	} else {
+		snapshotHeader header = { SNAPSHOT_MAGIC, SNAPSHOT_VERSION, STORAGE_PAGE_CONTENT, 0 };
+
+		tmpPath = string(path) + ".tmp";
+		file = fopen(tmpPath.c_str(), "wb");
+		ok = file && writeSnapshotData(file, &header, sizeof(header));
+	}
+
+	ok = ok && writeSnapshotData(file, &segment, sizeof(segment))
+		&& writeSnapshotData(file, pages.data(), pages.size())
+		&& writeSnapshotData(file, mappings.data(), mappings.size() * sizeof(snapshotMapping))
+		&& fflush(file) == 0 && fsync(fileno(file)) == 0;
+	if (file && fclose(file) != 0)
+		ok = false;
+	if (ok && !incremental && rename(tmpPath.c_str(), path) < 0)
+		ok = false;
+
+	if (!ok) {
+		cerr << "server: cannot write snapshot " << path << "!" << endl;
+		if (!incremental)
+			unlink(tmpPath.c_str());
+		// as páginas numeradas podem não estar no ficheiro: a próxima é completa
+		snapshotPages = 0;
+	}
+
+	pthread_mutex_unlock(&snapshotLock);
+	return ok;
+}
+
+bool MemoryStorage::loadSnapshot(const char *path) {
+	const char *data, *p, *end;
+	const snapshotHeader *header;
+	const snapshotMapping *mappings = NULL;
+	uae_u32 mappingCount = 0;
+	vector<const char *> pageData;
+	vector<storagePage *> pages;
+	struct stat st;
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return false;
+	if (fstat(fd, &st) < 0 || st.st_size < (off_t) sizeof(snapshotHeader)) {
+		close(fd);
+		cerr << "server: invalid snapshot " << path << endl;
+		return false;
+	}
+
+	data = (const char *) mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		cerr << "server: cannot map snapshot " << path << endl;
+		return false;
+	}
+
+	header = (const snapshotHeader *) data;
+	if (header->magic != SNAPSHOT_MAGIC || header->version != SNAPSHOT_VERSION ||
+			header->pageSize != STORAGE_PAGE_CONTENT) {
+		munmap((void *) data, st.st_size);
+		cerr << "server: invalid snapshot " << path << endl;
+		return false;
+	}
+
+	/*
+	 * Percorrer os segmentos completos; páginas e mapeamentos acumulam-se
+	 */
+	end = data + st.st_size;
+	for (p = data + sizeof(snapshotHeader); (size_t)(end - p) >= sizeof(snapshotSegment); ) {
+		const snapshotSegment *segment = (const snapshotSegment *) p;
+		size_t size = sizeof(snapshotSegment) + (size_t) segment->pages * STORAGE_PAGE_CONTENT
+			+ (size_t) segment->mappings * sizeof(snapshotMapping);
+
+		if (segment->magic != SNAPSHOT_SEGMENT_MAGIC || segment->firstPage != pageData.size() ||
+				size > (size_t)(end - p))
+			break;
+
+		p += sizeof(snapshotSegment);
+		for (uae_u32 i = 0; i < segment->pages; i++, p += STORAGE_PAGE_CONTENT)
+			pageData.push_back(p);
+		mappings = (const snapshotMapping *) p;
+		mappingCount = segment->mappings;
+		p += (size_t) segment->mappings * sizeof(snapshotMapping);
+	}
+	bool torn = p != end;
+	off_t complete = p - data;
+	if (torn)
+		cerr << "server: ignoring incomplete snapshot data in " << path << endl;
+
+	/*
+	 * Reconstruir as tabelas a partir dos mapeamentos do último segmento;
+	 * chamada antes de aceitar ligações, por isso sem locks
+	 */
+	pages.resize(pageData.size(), NULL);
+	for (uae_u32 i = 0; i < mappingCount; i++) {
+		const snapshotMapping &m = mappings[i];
+
+		if (m.page >= pages.size())
+			continue;
+
+		storagePage *&page = pages[m.page];
+		if (!page) {
+			page = arena.alloc();
+			memcpy(page, pageData[m.page], STORAGE_PAGE_CONTENT);
+			page->snapshot = m.page + 1;
+		}
+
+		clientStorage *c = client(m.id, true);
+		storagePage *&slot = c->table.slot(m.base);
+		if (slot)
+			continue;
+		slot = page;
+		page->refs++;
+		mappedPages++;
+		for (uae_u32 w = 0; w < STORAGE_PAGE_SLOTS / 32; w++)
+			c->entries += __builtin_popcount(page->present[w]);
+	}
+
+#ifdef __MEMORY_DEDUPLICATION__
+	for (size_t i = 0; i < pages.size(); i++) {
+		if (!pages[i])
+			continue;
+		pages[i]->hash = storagePageHash(pages[i]);
+		pages[i]->indexed = 1;
+		dedupDataStorage.emplace(pages[i]->hash, pages[i]);
+	}
+#endif
+
+	snapshotPages = pageData.size();
+	munmap((void *) data, st.st_size);
+
+	/*
+	 * Um segmento truncado (servidor terminado a meio de uma escrita) é
+	 * cortado do ficheiro: senão a próxima snapshot incremental ficaria
+	 * depois dele e nunca seria lida. Se não der, a próxima é completa.
+	 */
+	if (torn && truncate(path, complete) < 0) {
+		cerr << "server: cannot truncate snapshot " << path << endl;
+		snapshotPages = 0;
+	}
+	return true;
+}
@@ -0,0 +1,50 @@
+#ifndef __SNAPSHOT_H__
+#define __SNAPSHOT_H__
+
+#include <stdint.h>
+#include "PageTable.h"
+
+/*
+ * Formato das snapshots do servidor:
+ *
+ *   snapshotHeader
+ *   segmento 0: snapshotSegment, páginas[pages], snapshotMapping[mappings]
+ *   segmento 1: ...
+ *
+ * Cada página física é escrita uma única vez (dados + bitmap de presença,
+ * STORAGE_PAGE_CONTENT bytes), mesmo que esteja partilhada por vários
+ * clientes. As páginas são numeradas seguidamente ao longo de todos os
+ * segmentos; uma snapshot incremental acrescenta um segmento só com as
+ * páginas alteradas e a tabela completa de mapeamentos, que referencia
+ * também páginas de segmentos anteriores. Ao carregar conta a tabela do
+ * último segmento completo; um segmento truncado é ignorado e cortado
+ * do ficheiro, para que as snapshots seguintes fiquem depois do último
+ * segmento bom.
+ */
+#define SNAPSHOT_MAGIC 0x4d454d53
+#define SNAPSHOT_SEGMENT_MAGIC 0x4d454753
+#define SNAPSHOT_VERSION 1
+
+typedef struct {
+	uae_u32 magic;
+	uae_u32 version;
+	uae_u32 pageSize;
+	uae_u32 pad;
+} snapshotHeader;
+
+typedef struct {
+	uae_u32 magic;
+	uae_u32 pages;
+	uae_u32 mappings;
+	uae_u32 pad;
+	// número da primeira página deste segmento
+	uint64_t firstPage;
+} snapshotSegment;
+
+typedef struct {
+	int id;
+	uaecptr base;
+	uae_u32 page;
+} snapshotMapping;
+
+#endif
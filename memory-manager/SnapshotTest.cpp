@@ -0,0 +1,100 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <iostream>
+#include "MemoryStorage.h"
+
+/*
+ * Teste das snapshots: um segmento incremental truncado (servidor terminado
+ * a meio da escrita) não pode esconder as snapshots guardadas depois dele.
+ *
+ * make snapshot-test && ./snapshot-test [ficheiro]
+ */
+
+static int failures = 0;
+
+static void expect(MemoryStorage &storage, const char *step, uaecptr addr, int id, uae_u32 value)
+{
+	uae_u32 data = storage.getMemoryData(addr, id);
+
+	if (data != value) {
+		cerr << step << ": addr " << addr << " = " << data << ", expected " << value << endl;
+		failures++;
+	}
+}
+
+static off_t fileSize(const char *path)
+{
+	struct stat st;
+
+	return stat(path, &st) < 0 ? -1 : st.st_size;
+}
+
+int main(int argc, char* argv[])
+{
+	const char *path = argc > 1 ? argv[1] : "/tmp/memory-snapshot-test";
+	off_t fullSize;
+
+	unlink(path);
+
+	// snapshot completa, depois um segmento incremental cortado a meio
+	{
+		MemoryStorage storage;
+
+		storage.putMemoryData(5, 1, 12);
+		storage.putMemoryData(3000, 1, 3007);
+		storage.putMemoryData(5, 2, 99);
+		if (!storage.saveSnapshot(path, false)) {
+			cerr << "cannot save " << path << endl;
+			return 1;
+		}
+		fullSize = fileSize(path);
+
+		storage.putMemoryData(3000, 1, 4000);
+		storage.putMemoryData(1 << 20, 1, 77);
+		storage.saveSnapshot(path, true);
+		if (truncate(path, fullSize + (fileSize(path) - fullSize) / 2) < 0) {
+			cerr << "cannot truncate " << path << endl;
+			return 1;
+		}
+	}
+
+	// o segmento truncado é ignorado e a snapshot seguinte acrescentada
+	{
+		MemoryStorage storage;
+
+		if (!storage.loadSnapshot(path)) {
+			cerr << "cannot load " << path << endl;
+			return 1;
+		}
+		expect(storage, "torn load", 5, 1, 12);
+		expect(storage, "torn load", 3000, 1, 3007);
+		expect(storage, "torn load", 1 << 20, 1, 0);
+		expect(storage, "torn load", 5, 2, 99);
+		if (fileSize(path) != fullSize) {
+			cerr << "torn segment left in " << path << endl;
+			failures++;
+		}
+
+		storage.putMemoryData(8000, 1, 8);
+		storage.saveSnapshot(path, true);
+	}
+
+	{
+		MemoryStorage storage;
+
+		if (!storage.loadSnapshot(path)) {
+			cerr << "cannot load " << path << endl;
+			return 1;
+		}
+		expect(storage, "reload", 5, 1, 12);
+		expect(storage, "reload", 3000, 1, 3007);
+		expect(storage, "reload", 8000, 1, 8);
+		expect(storage, "reload", 5, 2, 99);
+	}
+
+	unlink(path);
+	cout << "snapshot test " << (failures ? "FAILED" : "passed") << endl;
+	return failures ? 1 : 0;
+}
@@ -18,13 +18,36 @@
 #include <vector>
 #include <cstdlib>
 #include <stdint.h>
+#include <pthread.h>
 #include "client.h"
+#include "MemoryTrace.h"
+#ifdef __MEMSERVER_SHM__
+#include <sys/mman.h>
+#include "shm_ring.h"
+#endif
 
 using namespace std;
 
-static int listenFd, len, id = rand() % RAND_MAX;
+/*
+ * Client id, FSUAE_MEMSERVER_ID keeps it fixed across runs so that a
+ * server restored from a snapshot finds the same address space
+ */
+static int clientId() {
+	const char *value = getenv("FSUAE_MEMSERVER_ID");
+
+	return value ? atoi(value) : getpid();
+}
+
+static int listenFd, len, id = clientId();
 static struct sockaddr_un svrAdd;
 static bool connection_state = false;
+static pthread_mutex_t connection_mutex = PTHREAD_MUTEX_INITIALIZER;
+static uae_u32 batch_seq;
+#ifdef __MEMSERVER_SHM__
+static shmRegion *shm = NULL;
+
+static void startShmTransport();
+#endif
 
 /*
  *  System Unix Socket
@@ -52,96 +75,488 @@ void startConnection() {
 		return;
 	}
 
+	connection_state = true;
+
+#ifdef __MEMSERVER_SHM__
+	startShmTransport();
+#endif
 }
 
-void writeServer(uaecptr addr, uae_u32 data) {
-	int checker, op;
-	/*
-	 * Verify if connection to server is already started
-	 */
+static void checkConnection() {
+	if (connection_state)
+		return;
+
+	pthread_mutex_lock(&connection_mutex);
 	if(!connection_state)
 		startConnection();
+	pthread_mutex_unlock(&connection_mutex);
+}
 
-	/*
-	 * Send stuff to memory server
-	 */
-	//memPDU memoryBank;
-	//memoryBank.id = id;
-	op = MEMSERVER_WRITE;
+/*
+ * Write/read exactly size bytes, retrying on short transfers
+ */
+static void writeAll(const void *buf, size_t size, const char *what) {
+	const char *p = (const char *) buf;
 
-	checker = write(listenFd, &op, sizeof(int));
-	if (checker < 0)
+	while (size > 0) {
+		ssize_t checker = write(listenFd, p, size);
+		if (checker < 0)
+		{
+			cerr << "client: write error in " << what << "!" << endl;
+			exit(checker);
+		}
+		p += checker;
+		size -= checker;
+	}
+}
+
+static void readAll(void *buf, size_t size, const char *what) {
+	char *p = (char *) buf;
+
+	while (size > 0) {
+		ssize_t checker = read(listenFd, p, size);
+		if (checker <= 0)
+		{
+			cerr << "client: read error in " << what << "!" << endl;
+			exit(checker);
+		}
+		p += checker;
+		size -= checker;
+	}
+}
+
+/*
+ * Per-thread queue of pending accesses, sent to the server as one batch
+ */
+class memBatch {
+public:
+	memPDU pdu[MEMSERVER_BATCH_SIZE];
+	int count;
+	int reads;
+
+	memBatch() : count(0), reads(0) {}
+	~memBatch();
+
+	uae_u32 send(bool sync);
+
+	void push(int op, uaecptr addr, uae_u32 data);
+};
+
+static thread_local memBatch batch;
+
+/*
+ * Trace opcional dos acessos (FSUAE_MEMSERVER_TRACE=ficheiro), reproduzido
+ * pelo memory-benchmark
+ */
+static pthread_once_t trace_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t trace_mutex = PTHREAD_MUTEX_INITIALIZER;
+static memTraceWriter *trace = NULL;
+
+static void closeTrace() {
+	pthread_mutex_lock(&trace_mutex);
+	delete trace;
+	trace = NULL;
+	pthread_mutex_unlock(&trace_mutex);
+}
+
+static void openTrace() {
+	const char *path = getenv("FSUAE_MEMSERVER_TRACE");
+
+	if (!path)
+		return;
+
+	trace = new memTraceWriter();
+	if (!trace->open(path))
 	{
-		cerr << "client writeServer: write error in op!" << endl;
-		exit(checker);
+		cerr << "Client: Cannot open trace " << path << endl;
+		delete trace;
+		trace = NULL;
+		return;
 	}
-	checker = write(listenFd, &id, sizeof(int));
-	if (checker < 0)
+	atexit(closeTrace);
+}
+
+static inline void traceAccess(int op, int size, uaecptr addr, uae_u32 value) {
+	pthread_once(&trace_once, openTrace);
+	if (!trace)
+		return;
+
+	pthread_mutex_lock(&trace_mutex);
+	if (trace)
+		trace->record(op, size, addr, value);
+	pthread_mutex_unlock(&trace_mutex);
+}
+
+#ifdef __MEMSERVER_SHM__
+/*
+ * Create the shared ring region and pass it to the server over the socket.
+ * If anything fails the connection keeps using the socket batches.
+ */
+static void startShmTransport() {
+	memBatchHeader header, reply;
+	struct msghdr msg;
+	struct iovec iov;
+	struct cmsghdr *cmsg;
+	char control[CMSG_SPACE(sizeof(int))];
+	shmRegion *region;
+
+	int fd = memfd_create("fsuae-memserver", 0);
+	if (fd < 0 || ftruncate(fd, sizeof(shmRegion)) < 0)
 	{
-		cerr << "client writeServer: write error in id!" << endl;
-		exit(checker);
+		cerr << "Client: Cannot create shared memory, using socket" << endl;
+		if (fd >= 0)
+			close(fd);
+		return;
 	}
-	checker = write(listenFd, &addr, sizeof(int));
-	if (checker < 0)
+
+	region = (shmRegion *) mmap(NULL, sizeof(shmRegion), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (region == MAP_FAILED)
 	{
-		cerr << "client writeServer: write error in addr!" << endl;
-		exit(checker);
+		cerr << "Client: Cannot map shared memory, using socket" << endl;
+		close(fd);
+		return;
 	}
-	checker = write(listenFd, &data, sizeof(int));
-	if (checker < 0)
+	region->magic = SHM_RING_MAGIC;
+	region->requests.init();
+	region->responses.init();
+
+	header.seq = batch_seq++;
+	header.count = 0;
+	header.flags = MEMSERVER_BATCH_SHM;
+
+	bzero(&msg, sizeof(msg));
+	bzero(control, sizeof(control));
+	iov.iov_base = &header;
+	iov.iov_len = sizeof(header);
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control;
+	msg.msg_controllen = sizeof(control);
+	cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+	memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+
+	if (sendmsg(listenFd, &msg, 0) != sizeof(header))
 	{
-		cerr << "client writeServer: write error in data!" << endl;
-		exit(checker);
+		cerr << "client: write error in shm request!" << endl;
+		exit(-1);
 	}
+	close(fd);
 
+	readAll(&reply, sizeof(reply), "shm reply");
+	if (reply.seq != header.seq || !(reply.flags & MEMSERVER_BATCH_SHM))
+	{
+		cerr << "Client: Server refused shared memory, using socket" << endl;
+		munmap(region, sizeof(shmRegion));
+		return;
+	}
+
+	shm = region;
 }
 
-uae_u32 readServer(uaecptr addr){
-	int checker, op;
-	uae_u32 data;
+/*
+ * Waits on the rings time out now and then to check that the server is
+ * still there; if it is gone fail like the socket path does
+ */
+static const struct timespec shmTimeout = { 0, 100 * 1000 * 1000 };
+
+static void checkShmServer(const char *what) {
+	if (connectionClosed(listenFd))
+	{
+		cerr << "client: server closed the connection in " << what << "!" << endl;
+		exit(-1);
+	}
+}
+
+static void shmPush(const memPDU &p) {
+	while (!shm->requests.push(p, &shmTimeout))
+		checkShmServer("shm request");
+}
+#endif
+
+void memBatch::push(int op, uaecptr addr, uae_u32 data) {
+	checkConnection();
+
+#ifdef __MEMSERVER_SHM__
+	if (shm) {
+		memPDU p = { op, id, addr, data };
+
+		// the emulator has several producer threads, the ring takes only one
+		pthread_mutex_lock(&connection_mutex);
+		shmPush(p);
+		pthread_mutex_unlock(&connection_mutex);
+		return;
+	}
+#endif
+
+	if (count == MEMSERVER_BATCH_SIZE)
+		send(false);
+
+	memPDU &p = pdu[count++];
+	p.op = op;
+	p.id = id;
+	p.addr = addr;
+	p.data = data;
+	if (op == MEMSERVER_READ)
+		reads++;
+}
+
+/*
+ * Send all queued accesses. If sync is set, wait for the server to answer
+ * and return the value of the last read in the batch.
+ */
+uae_u32 memBatch::send(bool sync) {
+	memBatchHeader header;
+	uae_u32 data = 0;
+
+	if (count == 0 && !sync)
+		return 0;
+
+	pthread_mutex_lock(&connection_mutex);
+
 	/*
 	 * Verify if connection to server is already started
 	 */
 	if(!connection_state)
 		startConnection();
 
-	/*
-	 * Receive stuff from memory server
-	 */
-	//memPDU memoryBank;
-	//memoryBank.id = id;
-	op = MEMSERVER_READ;
-	data = 0;
+	header.seq = batch_seq++;
+	header.count = count;
+	header.flags = sync ? MEMSERVER_BATCH_SYNC : 0;
 
-	checker = write(listenFd, &op, sizeof(int));
-	if (checker < 0)
-	{
-		cerr << "client readServer: write error in op!" << endl;
-		exit(checker);
+	writeAll(&header, sizeof(header), "batch header");
+	writeAll(pdu, count * sizeof(memPDU), "batch");
+
+	if (sync) {
+		memBatchHeader reply;
+		uae_u32 values[MEMSERVER_BATCH_SIZE];
+
+		readAll(&reply, sizeof(reply), "reply header");
+		if (reply.seq != header.seq || reply.count != (uae_u32) reads)
+		{
+			cerr << "client: out of order reply " << reply.seq << ", expected " << header.seq << endl;
+			exit(-1);
+		}
+		readAll(values, reads * sizeof(uae_u32), "reply data");
+		if (reads > 0)
+			data = values[reads - 1];
 	}
-	checker = write(listenFd, &id, sizeof(int));
-	if (checker < 0)
-	{
-		cerr << "client readServer: write error in id!" << endl;
-		exit(checker);
+
+	pthread_mutex_unlock(&connection_mutex);
+
+	count = 0;
+	reads = 0;
+
+	return data;
+}
+
+memBatch::~memBatch() {
+	send(false);
+}
+
+/*
+ * Synchronous read straight from the server
+ */
+static uae_u32 readServerDirect(uaecptr addr) {
+#ifdef __MEMSERVER_SHM__
+	checkConnection();
+	if (shm) {
+		memPDU p = { MEMSERVER_READ_REPLY, id, addr, 0 };
+		uae_u32 data;
+
+		pthread_mutex_lock(&connection_mutex);
+		shmPush(p);
+		while (!shm->responses.pop(data, &shmTimeout))
+			checkShmServer("shm reply");
+		pthread_mutex_unlock(&connection_mutex);
+		return data;
 	}
-	checker = write(listenFd, &addr, sizeof(int));
-	if (checker < 0)
-	{
-		cerr << "client readServer: write error in addr!" << endl;
-		exit(checker);
+#endif
+	batch.push(MEMSERVER_READ, addr, 0);
+	return batch.send(true);
+}
+
+#ifdef __MEMSERVER_CACHE__
+/*
+ * Cache write-back: uma página por 1024 endereços, com os valores
+ * conhecidos e os endereços alterados desde a última sincronização
+ */
+typedef struct {
+	uae_u32 data[STORAGE_PAGE_SLOTS];
+	uae_u32 present[STORAGE_PAGE_SLOTS / 32];
+	uae_u32 modified[STORAGE_PAGE_SLOTS / 32];
+	unsigned char dirty;
+} cachePage;
+
+static pthread_mutex_t cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+static PageArenaT<cachePage> cacheArena;
+static PageTableT<cachePage> cacheTable(cacheArena);
+static vector<uaecptr> cacheDirtyPages;
+static int syncFrames = MEMSERVER_SYNC_FRAMES, frameCount;
+static unsigned long syncCycles = MEMSERVER_SYNC_CYCLES, lastSyncCycles;
+
+/*
+ * Sync intervals can be overridden from the environment
+ */
+static void readSyncConfig() {
+	static bool done = false;
+	const char *value;
+
+	if (done)
+		return;
+	done = true;
+
+	if ((value = getenv("FSUAE_MEMSERVER_SYNC_FRAMES")) != NULL)
+		syncFrames = atoi(value);
+	if ((value = getenv("FSUAE_MEMSERVER_SYNC_CYCLES")) != NULL)
+		syncCycles = strtoul(value, NULL, 0);
+	atexit(syncServer);
+}
+
+void writeServer(uaecptr addr, uae_u32 data, int size) {
+	uae_u32 slot = addr & STORAGE_PAGE_MASK;
+
+	traceAccess(MEMSERVER_WRITE, size, addr, data);
+	readSyncConfig();
+	pthread_mutex_lock(&cache_mutex);
+	cachePage *page = cacheTable.lookupOrCreate(addr);
+
+	page->data[slot] = data;
+	page->present[slot >> 5] |= 1u << (slot & 31);
+	page->modified[slot >> 5] |= 1u << (slot & 31);
+	if (!page->dirty) {
+		page->dirty = 1;
+		cacheDirtyPages.push_back(addr & ~STORAGE_PAGE_MASK);
 	}
+	pthread_mutex_unlock(&cache_mutex);
+}
 
-	checker = read(listenFd, (int*)&data, sizeof(int));
-	if (checker < 0)
-	{
-		cerr << "client readServer: read error in data!" << endl;
-		exit(checker);
+/*
+ * The value is not needed and reads are served by the cache, so there is
+ * nothing to send
+ */
+void readServerAsync(uaecptr addr, int size) {
+	traceAccess(MEMSERVER_READ, size, addr, 0);
+}
+
+uae_u32 readServer(uaecptr addr) {
+	uae_u32 slot = addr & STORAGE_PAGE_MASK;
+	uae_u32 data;
+
+	pthread_mutex_lock(&cache_mutex);
+	cachePage *page = cacheTable.lookup(addr);
+	if (page && ((page->present[slot >> 5] >> (slot & 31)) & 1)) {
+		data = page->data[slot];
+		pthread_mutex_unlock(&cache_mutex);
+		traceAccess(MEMTRACE_READ_SYNC, 4, addr, data);
+		return data;
+	}
+	pthread_mutex_unlock(&cache_mutex);
+
+	data = readServerDirect(addr);
+
+	pthread_mutex_lock(&cache_mutex);
+	page = cacheTable.lookupOrCreate(addr);
+	if (!((page->present[slot >> 5] >> (slot & 31)) & 1)) {
+		page->data[slot] = data;
+		page->present[slot >> 5] |= 1u << (slot & 31);
+	}
+	data = page->data[slot];
+	pthread_mutex_unlock(&cache_mutex);
+
+	traceAccess(MEMTRACE_READ_SYNC, 4, addr, data);
+	return data;
+}
+
+/*
+ * Send the addresses modified since the last sync, one batch for all
+ * dirty pages
+ */
+void syncServer(void) {
+	memBatch sync;
+
+	readSyncConfig();
+
+	pthread_mutex_lock(&cache_mutex);
+	for (size_t i = 0; i < cacheDirtyPages.size(); i++) {
+		uaecptr base = cacheDirtyPages[i];
+		cachePage *page = cacheTable.lookup(base);
+
+		for (uae_u32 w = 0; w < STORAGE_PAGE_SLOTS / 32; w++) {
+			uae_u32 bits = page->modified[w];
+
+			while (bits) {
+				uae_u32 slot = w * 32 + __builtin_ctz(bits);
+
+				sync.push(MEMSERVER_WRITE, base | slot, page->data[slot]);
+				bits &= bits - 1;
+			}
+			page->modified[w] = 0;
+		}
+		page->dirty = 0;
+	}
+	cacheDirtyPages.clear();
+	pthread_mutex_unlock(&cache_mutex);
+
+	sync.send(false);
+}
+
+void frameServer(void) {
+	readSyncConfig();
+	if (syncFrames > 0 && ++frameCount >= syncFrames) {
+		frameCount = 0;
+		syncServer();
+	}
+}
+
+void cyclesServer(unsigned long cycles) {
+	readSyncConfig();
+	if (syncCycles > 0 && cycles - lastSyncCycles >= syncCycles) {
+		lastSyncCycles = cycles;
+		syncServer();
 	}
+}
+#else
+/*
+ * Writes are fire-and-forget, the batch sequence number keeps them ordered
+ */
+void writeServer(uaecptr addr, uae_u32 data, int size) {
+	traceAccess(MEMSERVER_WRITE, size, addr, data);
+	batch.push(MEMSERVER_WRITE, addr, data);
+}
+
+/*
+ * Queue a read whose value the caller does not need
+ */
+void readServerAsync(uaecptr addr, int size) {
+	traceAccess(MEMSERVER_READ, size, addr, 0);
+	batch.push(MEMSERVER_READ, addr, 0);
+}
+
+uae_u32 readServer(uaecptr addr) {
+	uae_u32 data = readServerDirect(addr);
 
+	traceAccess(MEMTRACE_READ_SYNC, 4, addr, data);
 	return data;
 }
 
+void syncServer(void) {
+	batch.send(false);
+}
+
+void frameServer(void) {
+}
+
+void cyclesServer(unsigned long cycles) {
+}
+#endif
+
+void flushServer(void) {
+	batch.send(false);
+}
+
 
 #if 0
 int main (int argc, char* argv[])
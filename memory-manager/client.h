@@ -3,8 +3,26 @@
 
 #include "unix_socket.h"
 
-void writeServer(uaecptr addr, uae_u32 data);
+/*
+ * size (1, 2 or 4 bytes) is only kept in the access trace
+ */
+void writeServer(uaecptr addr, uae_u32 data, int size = 4);
 
 uae_u32 readServer(uaecptr addr);
 
+void readServerAsync(uaecptr addr, int size = 4);
+
+void flushServer(void);
+
+/*
+ * Sync points for the write-back cache: syncServer sends every pending
+ * write now (e.g. before a savestate), frameServer is called once per
+ * frame and cyclesServer with the current cycle count
+ */
+void syncServer(void);
+
+void frameServer(void);
+
+void cyclesServer(unsigned long cycles);
+
 #endif
@@ -23,19 +23,38 @@
 #include <signal.h>
 #include <assert.h>
 #include <stdint.h>
+#include <set>
+#include <atomic>
+#include <vector>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "server.h"
+#include "shm_ring.h"
 
 using namespace std;
 
 void *task1(void *);
+#ifdef __MEMORY_DEDUPLICATION__
+void *dedupTask(void *);
+#endif
+void *snapshotTask(void *);
 
-//mutex mtx;
+// ligações abertas, para as terminar quando o servidor pára
 static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
-static int listenFd, connFd, noThread;
+static pthread_cond_t connectionsDone = PTHREAD_COND_INITIALIZER;
+static set<int> connections;
+static int listenFd, noThread;
 
 static MemoryStorage &memoryStorage = *(new MemoryStorage());
 
-bool run = true;
+// ficheiro de snapshot (-s) e intervalo das snapshots incrementais (-i)
+static const char *snapshotPath = NULL;
+static int snapshotInterval = 0;
+static volatile sig_atomic_t snapshotRequested = 0;
+
+// lido pelas threads das ligações e alterado no signal handler
+std::atomic<bool> run(true);
 
 void sighandler(int sig)
 {
@@ -45,18 +64,84 @@ void sighandler(int sig)
     close(listenFd);
 }
 
+/*
+ * SIGUSR1 pede uma snapshot incremental à snapshotTask
+ */
+void snapshotSighandler(int)
+{
+    snapshotRequested = 1;
+}
+
+static void usage(const char *name)
+{
+    cerr << "Usage: " << name << " [-s snapshot file] [-i incremental snapshot interval (s)]" << endl;
+    exit(1);
+}
+
+/*
+ * Worker threads must not take the termination signals, so that they
+ * always interrupt accept() in the main thread
+ */
+static void startThread(pthread_t *thread, void *(*task)(void *), void *arg)
+{
+    sigset_t mask, old;
+
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGABRT);
+    sigaddset(&mask, SIGTERM);
+    sigaddset(&mask, SIGINT);
+    pthread_sigmask(SIG_BLOCK, &mask, &old);
+    pthread_create(thread, NULL, task, arg);
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+}
+
 int main(int argc, char* argv[])
 {
     socklen_t len; //store size of the address
-    int noThreadLocal;
+    int connFd;
     struct sockaddr_un svrAdd;
 
     pthread_t threadA;
+#ifdef __MEMORY_DEDUPLICATION__
+    pthread_t dedupThread;
+#endif
+    pthread_t snapshotThread;
+    struct sigaction snapshotAction;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s:i:")) != -1)
+    {
+        switch (opt) {
+        case 's':
+            snapshotPath = optarg;
+            break;
+        case 'i':
+            snapshotInterval = atoi(optarg);
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    if (snapshotInterval > 0 && !snapshotPath)
+        usage(argv[0]);
 
     signal(SIGABRT, &sighandler);
     signal(SIGTERM, &sighandler);
     signal(SIGINT, &sighandler);
 
+    // SA_RESTART para não interromper o accept() nem as leituras
+    bzero(&snapshotAction, sizeof(snapshotAction));
+    snapshotAction.sa_handler = &snapshotSighandler;
+    snapshotAction.sa_flags = SA_RESTART;
+    sigaction(SIGUSR1, &snapshotAction, NULL);
+
+    if (snapshotPath && access(snapshotPath, F_OK) == 0)
+    {
+        if (!memoryStorage.loadSnapshot(snapshotPath))
+            return 1;
+        cout << "Restored " << memoryStorage.dedupMemoryStorageSize() << " pages from " << snapshotPath << endl;
+    }
+
     //create socket
     listenFd = socket(PF_UNIX, SOCK_STREAM, 0);
 
@@ -89,7 +174,13 @@ int main(int argc, char* argv[])
 
     listen(listenFd, QUEUE_CLIENTS);
 
-    for(run=true, noThreadLocal=0, noThread = 0; run; noThreadLocal++)
+#ifdef __MEMORY_DEDUPLICATION__
+    startThread(&dedupThread, dedupTask, NULL);
+#endif
+    if (snapshotPath)
+        startThread(&snapshotThread, snapshotTask, NULL);
+
+    for(run=true, noThread = 0; run; )
     {
         cout << "Listening" << endl;
         struct sockaddr_un clntAdd;
@@ -108,133 +199,363 @@ int main(int argc, char* argv[])
 			cout << "Connection successful" << endl;
 		}
 
-        pthread_create(&threadA, NULL, task1, NULL);
-        pthread_join(threadA, NULL);
+		// uma thread por ligação, que serve o cliente até este desligar
+		pthread_mutex_lock(&mutex);
+		connections.insert(connFd);
+		pthread_mutex_unlock(&mutex);
 
-        // TODO: very inefficient
-        while(noThreadLocal == noThread);
+		startThread(&threadA, task1, (void *)(intptr_t) connFd);
+		pthread_detach(threadA);
     }
 
-#if 0
-    for(int i = 0; i < noThreadLocal; i++)
-    {
-        pthread_join(threadA[i], NULL);
-    }
-#endif
+    /*
+     * Close every connection and wait for their threads to finish
+     */
+    pthread_mutex_lock(&mutex);
+    for (set<int>::iterator iter = connections.begin(); iter != connections.end(); iter++)
+        shutdown(*iter, SHUT_RDWR);
+    while (!connections.empty())
+        pthread_cond_wait(&connectionsDone, &mutex);
+    pthread_mutex_unlock(&mutex);
 
     cout << "Server terminated!" << endl;
 
     /**
 	 * Apresentação de resultados
 	 */
+#ifdef __MEMORY_DEDUPLICATION__
+	pthread_join(dedupThread, NULL);
+	memoryStorage.scanDirtyPages((size_t) -1);
+#endif
+	if (snapshotPath) {
+		pthread_join(snapshotThread, NULL);
+		if (memoryStorage.saveSnapshot(snapshotPath, false))
+			cout << "Snapshot saved to " << snapshotPath << endl;
+	}
 #ifdef __MEMORY_DEDUPLICATION__
 	int memSize = memoryStorage.dedupMemoryStorageSize();
 	int dataSize = memoryStorage.dedupDataStorageSize();
 #else
 	int memSize = memoryStorage.memoryStorageSize();
 #endif
-	int allRequests = memoryStorage.memoryStatsSize();
+	int allRequests = memoryStorage.memoryAccesses();
 	assert(allRequests!=0);
 	float access_ratio = ((float)memSize)/((float)allRequests);
 
 	ofstream logFile;
 	logFile.open(SERVERLOG);
-#ifdef __MEMORY_DEDUPLICATION__
-	logFile << "dedupMemoryStorage: unordered_map<memoryID,uae_u32*,memIDhash,memIDeqKey> deduplicated_database_type" << endl;
-	for (deduplicated_database_iterator iter = memoryStorage.dedupMemoryStorageBeginIterator(); iter != memoryStorage.dedupMemoryStorageEndIterator(); iter++) {
-		logFile << "Key: [" << iter->first.id << "," << iter->first.addr << "]\t\tData: ";
-		logFile << *(iter->second);
-		logFile << endl;
-	}
-#else
-	logFile << "memoryStorage: unordered_map<memoryID,uae_u32,memIDhash,memIDeqKey> database_type" << endl;
-	for (database_type_iterator iter = memoryStorage.memoryStorageBeginIterator(); iter != memoryStorage.memoryStorageEndIterator(); iter++) {
-		logFile << "Key: [" << iter->first.id << "," << iter->first.addr << "]\t\tData: " << iter->second << endl;
-	}
-#endif
+	logFile << "memoryStorage: unordered_map<int,PageTable*> database_type" << endl;
+	memoryStorage.forEachMemoryData([&](int id, uaecptr addr, uae_u32 data) {
+		logFile << "Key: [" << id << "," << addr << "]\t\tData: " << data << endl;
+	});
 	logFile << endl;
 	logFile << endl;
-	logFile << "memoryStats: unordered_multimap<uae_u32,memoryID> stats_type" << endl;
-	for (stats_type_iterator iter = memoryStorage.memoryStatsBeginIterator(); iter != memoryStorage.memoryStatsEndIterator(); iter++) {
-		logFile << "Key: "<< iter->first << "\t\tData: [" << iter->second.id << "," << iter->second.addr << "]" << endl;
-	}
+
+	memServerStats serverStats;
+	vector<memClientStats> clientStats;
+	memoryStorage.getStats(&serverStats, clientStats);
+	printServerStats(logFile, serverStats, clientStats);
 
 #ifdef __MEMORY_DEDUPLICATION__
 	assert(memSize!=0);
 	float optimization_ratio = ((float)dataSize)/((float)memSize);
-	cout << "dedupMemoryStorage.size() is " << memSize << endl;
-	cout << "dedupDataStorage.size() is " << dataSize << endl;
-	cout << "dedupMemoryStats.size() is " << allRequests << endl;
+	cout << "dedupMemoryStorage pages: " << memSize << endl;
+	cout << "dedupDataStorage pages: " << dataSize << endl;
+	cout << "accesses: " << allRequests << endl;
 	cout << "Optimization acquired in run was: " << optimization_ratio << endl;
 #else
 	cout << "memoryStorage.size() is " << memSize << endl;
-	cout << "memoryStats.size() is " << allRequests << endl;
+	cout << "memoryStorage pages: " << memoryStorage.memoryStoragePages() << endl;
+	cout << "accesses: " << allRequests << endl;
 #endif
 	cout << "Memory access ration was: " << access_ratio << endl;
 
 }
 
-void *task1 (void *dummyPt)
+#ifdef __MEMORY_DEDUPLICATION__
+/*
+ * Background rescan of the pages written since the last pass, a few at a
+ * time so connections are not kept waiting on the storage locks
+ */
+void *dedupTask(void *)
 {
-	//mtx.lock();
-	int rc = pthread_mutex_lock(&mutex);
-    int myThread = noThread;
-    int myConnFd = connFd;
-    //noThread++;
-    //mtx.unlock();
-    //pthread_mutex_unlock(&mutex);
-
-    //memPDU memoryBank;
-    int op, id;
-    uaecptr addr;
-    uae_u32 data;
-    int checker;
+	while (run) {
+		size_t pending;
 
-    cout << "Thread No: " << pthread_self() << endl;
-    cout << "MyThread No: " << myThread << endl;
-    cout << "myConnFd No: " << myConnFd << endl;
+		pending = memoryStorage.scanDirtyPages(DEDUP_SCAN_PAGES);
 
-	checker = read(myConnFd, &op, sizeof(int));
-	if (checker < 0)
-	{
-		cerr << "server readServer: read error in op! op =" << op << endl;
-		exit(checker);
+		if (!pending)
+			usleep(DEDUP_SCAN_INTERVAL);
 	}
-	checker = read(myConnFd, &id, sizeof(int));
-	if (checker < 0)
-	{
-		cerr << "server readServer: read error in id!" << endl;
-		exit(checker);
-	}
-	checker = read(myConnFd, &addr, sizeof(uaecptr));
-	if (checker < 0)
-	{
-		cerr << "server readServer: read error in addr!" << endl;
-		exit(checker);
+	return NULL;
+}
+#endif
+
+/*
+ * Periodic incremental snapshots, plus the ones requested with SIGUSR1.
+ * The full (compacted) snapshot is written by main at shutdown.
+ */
+void *snapshotTask(void *)
+{
+	int elapsed = 0;
+
+	while (run) {
+		sleep(1);
+		elapsed++;
+
+		if (snapshotRequested || (snapshotInterval > 0 && elapsed >= snapshotInterval)) {
+			snapshotRequested = 0;
+			elapsed = 0;
+			memoryStorage.saveSnapshot(snapshotPath, true);
+		}
 	}
+	return NULL;
+}
+
+/*
+ * Read/write exactly size bytes. readAll returns false when the client
+ * closed the connection.
+ */
+static bool readAll(int fd, void *buf, size_t size, const char *what)
+{
+	char *p = (char *) buf;
 
-	if(op == MEMSERVER_READ) {
-		data = memoryStorage.getMemoryData(addr, id);
-		checker = write(myConnFd, &data, sizeof(uae_u32));
+	while (size > 0) {
+		ssize_t checker = read(fd, p, size);
+		if (checker == 0)
+			return false;
 		if (checker < 0)
 		{
-			cerr << "server readServer: write error in data!" << endl;
+			cerr << "server: read error in " << what << "!" << endl;
 			exit(checker);
 		}
+		p += checker;
+		size -= checker;
 	}
-	else {
-		checker = read(myConnFd, &data, sizeof(uae_u32));
+	return true;
+}
+
+static void writeAll(int fd, const void *buf, size_t size, const char *what)
+{
+	const char *p = (const char *) buf;
+
+	while (size > 0) {
+		ssize_t checker = write(fd, p, size);
 		if (checker < 0)
 		{
-			cerr << "server readServer: read error in data!" << endl;
+			cerr << "server: write error in " << what << "!" << endl;
 			exit(checker);
 		}
-		memoryStorage.putMemoryData(addr, id, data);
+		p += checker;
+		size -= checker;
 	}
+}
+
+static uint64_t monotonicNs()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * Reply to a MEMSERVER_BATCH_STATS request
+ */
+static void sendStats(int fd, memBatchHeader header)
+{
+	memServerStats serverStats;
+	vector<memClientStats> clientStats;
+
+	memoryStorage.getStats(&serverStats, clientStats);
+	header.count = clientStats.size();
+	writeAll(fd, &header, sizeof(header), "stats header");
+	writeAll(fd, &serverStats, sizeof(serverStats), "server stats");
+	writeAll(fd, clientStats.data(), clientStats.size() * sizeof(memClientStats), "client stats");
+}
+
+/*
+ * Read a batch header, accepting a file descriptor passed along with it
+ * (used when the client asks for the shared memory transport)
+ */
+static bool readHeader(int fd, memBatchHeader *header, int *passedFd)
+{
+	struct msghdr msg;
+	struct iovec iov;
+	struct cmsghdr *cmsg;
+	char control[CMSG_SPACE(sizeof(int))];
+	ssize_t checker;
+
+	*passedFd = -1;
+	bzero(&msg, sizeof(msg));
+	iov.iov_base = header;
+	iov.iov_len = sizeof(*header);
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control;
+	msg.msg_controllen = sizeof(control);
+
+	checker = recvmsg(fd, &msg, 0);
+	if (checker == 0)
+		return false;
+	if (checker < 0)
+	{
+		cerr << "server: read error in batch header!" << endl;
+		exit(checker);
+	}
+
+	for (cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+		if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS)
+			memcpy(passedFd, CMSG_DATA(cmsg), sizeof(int));
+	}
+
+	if ((size_t) checker < sizeof(*header))
+		return readAll(fd, (char *) header + checker, sizeof(*header) - checker, "batch header");
+	return true;
+}
+
+/*
+ * Map the region passed by the client; NULL if it is not usable
+ */
+static shmRegion *mapShmRegion(int shmFd)
+{
+	struct stat st;
+	shmRegion *region;
+
+	if (shmFd < 0 || fstat(shmFd, &st) < 0 || st.st_size < (off_t) sizeof(shmRegion))
+		return NULL;
+
+	region = (shmRegion *) mmap(NULL, sizeof(shmRegion), PROT_READ | PROT_WRITE, MAP_SHARED, shmFd, 0);
+	if (region == MAP_FAILED)
+		return NULL;
+	if (region->magic != SHM_RING_MAGIC) {
+		munmap(region, sizeof(shmRegion));
+		return NULL;
+	}
+	return region;
+}
+
+/*
+ * Serve a connection that switched to the shared memory rings. The socket
+ * is only watched to notice when the client goes away; a busy client does
+ * not keep the server from shutting down, run is checked while draining.
+ */
+static void serveShm(int myConnFd, shmRegion *shm)
+{
+	struct timespec timeout = { 0, 100 * 1000 * 1000 };
+	memPDU pdu;
+
+	while (run) {
+		uint64_t start;
+		int i;
+
+		if (!shm->requests.wait(&timeout)) {
+			if (connectionClosed(myConnFd))
+				break;
+			continue;
+		}
+
+		start = monotonicNs();
+		for (i = 0; i < SHM_RING_SIZE && run && shm->requests.tryPop(pdu); i++) {
+			if (pdu.op == MEMSERVER_WRITE)
+				memoryStorage.putMemoryData(pdu.addr, pdu.id, pdu.data);
+			else if (pdu.op == MEMSERVER_READ_REPLY)
+				shm->responses.push(memoryStorage.getMemoryData(pdu.addr, pdu.id), NULL);
+			else
+				memoryStorage.getMemoryData(pdu.addr, pdu.id);
+		}
+		if (i > 0)
+			memoryStorage.recordLatency(pdu.id, monotonicNs() - start);
+	}
+
+	munmap(shm, sizeof(shmRegion));
+}
+
+void *task1 (void *connPt)
+{
+    int myThread = __sync_fetch_and_add(&noThread, 1);
+    int myConnFd = (int)(intptr_t) connPt;
+    uae_u32 expectedSeq = 0;
+
+    memBatchHeader header;
+    memPDU pdu[MEMSERVER_BATCH_SIZE];
+    uae_u32 values[MEMSERVER_BATCH_SIZE];
+    int shmFd;
+
+    cout << "Thread No: " << pthread_self() << endl;
+    cout << "MyThread No: " << myThread << endl;
+    cout << "myConnFd No: " << myConnFd << endl;
+
+    while (readHeader(myConnFd, &header, &shmFd))
+    {
+		int reads = 0;
+
+		if (header.flags & MEMSERVER_BATCH_SHM) {
+			shmRegion *shm = mapShmRegion(shmFd);
+
+			if (shmFd >= 0)
+				close(shmFd);
+			if (header.seq == expectedSeq)
+				expectedSeq++;
+			if (!shm)
+				header.flags = 0;
+			header.count = 0;
+			writeAll(myConnFd, &header, sizeof(header), "shm reply");
+			if (shm) {
+				cout << "Using shared memory transport" << endl;
+				serveShm(myConnFd, shm);
+				break;
+			}
+			continue;
+		}
+		if (shmFd >= 0)
+			close(shmFd);
+
+		if (header.flags & MEMSERVER_BATCH_STATS) {
+			if (header.seq == expectedSeq)
+				expectedSeq++;
+			sendStats(myConnFd, header);
+			continue;
+		}
+
+		if (header.count > MEMSERVER_BATCH_SIZE)
+		{
+			cerr << "server: batch too large (" << header.count << ")!" << endl;
+			break;
+		}
+		if (header.seq != expectedSeq)
+		{
+			cerr << "server: batch " << header.seq << " out of order, expected " << expectedSeq << endl;
+			break;
+		}
+		expectedSeq++;
+
+		if (!readAll(myConnFd, pdu, header.count * sizeof(memPDU), "batch"))
+			break;
+
+		uint64_t start = monotonicNs();
+		for (uae_u32 i = 0; i < header.count; i++) {
+			if (pdu[i].op == MEMSERVER_READ)
+				values[reads++] = memoryStorage.getMemoryData(pdu[i].addr, pdu[i].id);
+			else
+				memoryStorage.putMemoryData(pdu[i].addr, pdu[i].id, pdu[i].data);
+		}
+		if (header.count > 0)
+			memoryStorage.recordLatency(pdu[0].id, monotonicNs() - start);
+
+		if (header.flags & MEMSERVER_BATCH_SYNC) {
+			header.count = reads;
+			writeAll(myConnFd, &header, sizeof(header), "reply header");
+			writeAll(myConnFd, values, reads * sizeof(uae_u32), "reply data");
+		}
+    }
 
-    noThread++;
-	pthread_mutex_unlock(&mutex);
     cout << "\nClosing thread and conn" << endl;
+    pthread_mutex_lock(&mutex);
     close(myConnFd);
+    connections.erase(myConnFd);
+    pthread_cond_signal(&connectionsDone);
+    pthread_mutex_unlock(&mutex);
 
+    return NULL;
 }
@@ -11,6 +11,11 @@
 
 #define SERVERLOG "/tmp/server-log.txt"
 
+// páginas analisadas pela deduplicação por cada vez que obtém o lock,
+// e pausa (us) quando não há páginas alteradas
+#define DEDUP_SCAN_PAGES 64
+#define DEDUP_SCAN_INTERVAL 100000
+
 int socket_option_z;     /* Status code */
 int so_reuseaddr = TRUE;
 
@@ -0,0 +1,151 @@
+#ifndef __SHM_RING_H__
+#define __SHM_RING_H__
+
+#include <atomic>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include "unix_socket.h"
+
+/*
+ * Transporte por memória partilhada: uma região memfd com dois anéis
+ * single-producer/single-consumer (pedidos e respostas).
+ * O consumidor só dorme num futex quando o anel está vazio.
+ *
+ * Os anéis em si não têm locks, mas só aceitam um produtor: o emulador
+ * acede à memória a partir de várias threads, por isso o cliente serializa
+ * os push (e cada pedido com a sua resposta) com o connection_mutex.
+ */
+#define SHM_RING_SIZE 8192
+// número de leituras ocupadas antes de adormecer no futex
+#define SHM_RING_SPIN 1000
+#define SHM_RING_MAGIC 0x4d454d52
+
+/**
+ * The socket stays open next to the rings only so that each side notices
+ * when the other one goes away
+ */
+inline bool connectionClosed(int fd)
+{
+	char c;
+	ssize_t r = recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+
+	return r == 0 || (r < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR);
+}
+
+inline bool shm_expired(const struct timespec *start, const struct timespec *timeout)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec - start->tv_sec) * 1000000000LL + (now.tv_nsec - start->tv_nsec)
+		>= timeout->tv_sec * 1000000000LL + timeout->tv_nsec;
+}
+
+inline long shm_futex(std::atomic<uae_u32> *addr, int op, uae_u32 val, const struct timespec *timeout)
+{
+	return syscall(SYS_futex, reinterpret_cast<uae_u32 *>(addr), op, val, timeout, NULL, 0);
+}
+
+template <typename T, unsigned int N>
+class shmRing {
+	static_assert((N & (N - 1)) == 0, "ring size must be a power of two");
+
+	// producer and consumer indexes live on separate cache lines
+	alignas(64) std::atomic<uae_u32> head;
+	alignas(64) std::atomic<uae_u32> tail;
+	alignas(64) std::atomic<uae_u32> waiting;
+	alignas(64) T slot[N];
+
+public:
+	void init() {
+		head.store(0);
+		tail.store(0);
+		waiting.store(0);
+	}
+
+	/**
+	 * Producer side: spins (yielding) while the ring is full. Returns false
+	 * if timeout (which may be NULL) expired first.
+	 */
+	bool push(const T &v, const struct timespec *timeout) {
+		uae_u32 h = head.load(std::memory_order_relaxed);
+		struct timespec start;
+
+		if (h - tail.load(std::memory_order_acquire) == N) {
+			clock_gettime(CLOCK_MONOTONIC, &start);
+			while (h - tail.load(std::memory_order_acquire) == N) {
+				if (timeout && shm_expired(&start, timeout))
+					return false;
+				sched_yield();
+			}
+		}
+
+		slot[h & (N - 1)] = v;
+		head.store(h + 1, std::memory_order_seq_cst);
+
+		if (waiting.load(std::memory_order_seq_cst))
+			shm_futex(&head, FUTEX_WAKE, 1, NULL);
+		return true;
+	}
+
+	/**
+	 * Consumer side: take one element if there is one
+	 */
+	bool tryPop(T &v) {
+		uae_u32 t = tail.load(std::memory_order_relaxed);
+
+		if (head.load(std::memory_order_acquire) == t)
+			return false;
+
+		v = slot[t & (N - 1)];
+		tail.store(t + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * Consumer side: wait until the ring is not empty. Returns false if
+	 * timeout (which may be NULL) expired first.
+	 */
+	bool wait(const struct timespec *timeout) {
+		uae_u32 t = tail.load(std::memory_order_relaxed);
+
+		for (int i = 0; i < SHM_RING_SPIN; i++) {
+			if (head.load(std::memory_order_acquire) != t)
+				return true;
+		}
+
+		waiting.store(1, std::memory_order_seq_cst);
+		while (head.load(std::memory_order_seq_cst) == t) {
+			if (shm_futex(&head, FUTEX_WAIT, t, timeout) < 0 && errno == ETIMEDOUT)
+				break;
+		}
+		waiting.store(0, std::memory_order_relaxed);
+
+		return head.load(std::memory_order_acquire) != t;
+	}
+
+	/**
+	 * Consumer side: take one element, waiting for it at most timeout
+	 * (which may be NULL)
+	 */
+	bool pop(T &v, const struct timespec *timeout) {
+		while (!tryPop(v)) {
+			if (!wait(timeout))
+				return false;
+		}
+		return true;
+	}
+};
+
+typedef struct {
+	uae_u32 magic;
+	shmRing<memPDU, SHM_RING_SIZE> requests;
+	shmRing<uae_u32, SHM_RING_SIZE> responses;
+} shmRegion;
+
+#endif
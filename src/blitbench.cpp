@@ -0,0 +1,334 @@
+ /*
+  * UAE - The Un*x Amiga Emulator
+  *
+  * Bulk blitter check and microbenchmark: runs random blits through
+  * blit_bulk (blitbulk.h) and through the word loops of blitter_dofast
+  * and blitter_dofast_desc, compares memory and registers word for word,
+  * then reports words per second for a few common blits.
+  *
+  * make blitter-benchmark && gensrc/blitbench [blits] [iterations]
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sysconfig.h"
+#include "sysdeps.h"
+#include "machdep/maccess.h"
+#include "blitter.h"
+#include "blit.h"
+#include "blitbulk.h"
+
+#define BENCH_CHIPMEM (512 * 1024)
+
+static uae_u8 chipmem_ref[BENCH_CHIPMEM], chipmem_bulk[BENCH_CHIPMEM], chipmem_init[BENCH_CHIPMEM];
+static uae_u8 blit_filltable[256][4][2];
+uae_u32 blit_masktable[BLITTER_MAX_WORDS];
+
+struct bench_blit {
+	struct bltinfo b;
+	uaecptr pt[4];
+	uae_u16 bltcon0, bltcon1;
+	bool desc;
+};
+
+/* same as build_blitfilltable in blitter.cpp */
+static void build_filltable (void)
+{
+	unsigned int d, fillmask;
+	int i;
+
+	for (d = 0; d < 256; d++) {
+		for (i = 0; i < 4; i++) {
+			int fc = i & 1;
+			uae_u8 data = d;
+			for (fillmask = 1; fillmask != 0x100; fillmask <<= 1) {
+				uae_u16 tmp = data;
+				if (fc) {
+					if (i & 2)
+						data |= fillmask;
+					else
+						data ^= fillmask;
+				}
+				if (tmp & fillmask)
+					fc = !fc;
+			}
+			blit_filltable[d][i][0] = data;
+			blit_filltable[d][i][1] = fc;
+		}
+	}
+}
+
+static uae_u32 ref_agnus_wget (uaecptr addr)
+{
+	return do_get_mem_word ((uae_u16 *)(chipmem_ref + (addr & (BENCH_CHIPMEM - 1))));
+}
+
+static void ref_agnus_wput (uaecptr addr, uae_u32 w)
+{
+	do_put_mem_word ((uae_u16 *)(chipmem_ref + (addr & (BENCH_CHIPMEM - 1))), w);
+}
+
+/* called through pointers like chipmem_wget_indirect/chipmem_wput_indirect */
+static uae_u32 (*volatile ref_wget)(uaecptr) = ref_agnus_wget;
+static void (*volatile ref_wput)(uaecptr, uae_u32) = ref_agnus_wput;
+
+/*
+* The word loops of blitter_dofast/blitter_dofast_desc, with the
+* descending differences folded in. Returns the fill carry left by the
+* last row, *lastd is last_custom_value1 if D was written.
+*/
+static int ref_blit (struct bltinfo *b, uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd,
+	uae_u16 bltcon0, uae_u16 bltcon1, bool desc, uae_u32 *lastd)
+{
+	uae_u8 mt = bltcon0 & 0xFF;
+	int blitfill = !!(bltcon1 & 0x18), ifemode = (bltcon1 & 0x18) == 0x08 ? 2 : 0;
+	int dir = desc ? -2 : 2;
+	uae_u32 blitbhold = b->bltbhold;
+	uae_u32 preva = 0, prevb = 0;
+	uaecptr dstp = 0;
+	int dodst = 0, blitfc = 0;
+	int i, j;
+
+	blit_masktable[0] = b->bltafwm;
+	blit_masktable[b->hblitsize - 1] &= b->bltalwm;
+
+	for (j = 0; j < b->vblitsize; j++) {
+		blitfc = !!(bltcon1 & 0x4);
+		for (i = 0; i < b->hblitsize; i++) {
+			uae_u32 bltadat, blitahold;
+			uae_u16 bltbdat;
+			if (pta) {
+				b->bltadat = bltadat = ref_wget (pta);
+				pta += dir;
+			} else
+				bltadat = b->bltadat;
+			bltadat &= blit_masktable[i];
+			if (desc)
+				blitahold = (((uae_u32)bltadat << 16) | preva) >> b->blitdownashift;
+			else
+				blitahold = (((uae_u32)preva << 16) | bltadat) >> b->blitashift;
+			preva = bltadat;
+
+			if (ptb) {
+				b->bltbdat = bltbdat = ref_wget (ptb);
+				ptb += dir;
+				if (desc)
+					blitbhold = (((uae_u32)bltbdat << 16) | prevb) >> b->blitdownbshift;
+				else
+					blitbhold = (((uae_u32)prevb << 16) | bltbdat) >> b->blitbshift;
+				prevb = bltbdat;
+			}
+
+			if (ptc) {
+				b->bltcdat = ref_wget (ptc);
+				if (desc)
+					b->bltbdat = b->bltcdat;
+				ptc += dir;
+			}
+			if (dodst) {
+				ref_wput (dstp, b->bltddat);
+				*lastd = b->bltddat;
+			}
+			b->bltddat = blit_func (blitahold, blitbhold, b->bltcdat, mt) & 0xFFFF;
+			if (blitfill) {
+				uae_u16 d = b->bltddat;
+				int fc1 = blit_filltable[d & 255][ifemode + blitfc][1];
+				b->bltddat = (blit_filltable[d & 255][ifemode + blitfc][0]
+					+ (blit_filltable[d >> 8][ifemode + fc1][0] << 8));
+				blitfc = blit_filltable[d >> 8][ifemode + fc1][1];
+			}
+			if (b->bltddat)
+				b->blitzero = 0;
+			if (ptd) {
+				dodst = 1;
+				dstp = ptd;
+				ptd += dir;
+			}
+		}
+		if (pta)
+			pta += desc ? -b->bltamod : b->bltamod;
+		if (ptb)
+			ptb += desc ? -b->bltbmod : b->bltbmod;
+		if (ptc)
+			ptc += desc ? -b->bltcmod : b->bltcmod;
+		if (ptd)
+			ptd += desc ? -b->bltdmod : b->bltdmod;
+	}
+	if (dodst) {
+		ref_wput (dstp, b->bltddat);
+		*lastd = b->bltddat;
+	}
+	b->bltbhold = blitbhold;
+
+	blit_masktable[0] = 0xFFFF;
+	blit_masktable[b->hblitsize - 1] = 0xFFFF;
+	return blitfc;
+}
+
+static uaecptr channel (const struct bench_blit *t, int ch)
+{
+	return (t->bltcon0 & (0x800 >> ch)) ? t->pt[ch] : 0;
+}
+
+static bool run_bulk (struct bench_blit *t, uae_u8 *mem, int *fc)
+{
+	int ifemode = (t->bltcon1 & 0x18) == 0x08 ? 2 : 0;
+
+	*fc = !!(t->bltcon1 & 0x4);
+	return blit_bulk (mem, BENCH_CHIPMEM, &t->b, channel (t, 0), channel (t, 1), channel (t, 2), channel (t, 3),
+		t->desc, t->bltcon0 & 0xFF, (t->bltcon1 & 0x18) ? blit_filltable : NULL, ifemode, fc);
+}
+
+static uae_u32 rnd (void)
+{
+	return ((uae_u32)rand () << 16) ^ (uae_u32)rand ();
+}
+
+static void random_blit (struct bench_blit *t)
+{
+	struct bltinfo *b = &t->b;
+	int *mods[4] = { &b->bltamod, &b->bltbmod, &b->bltcmod, &b->bltdmod };
+
+	memset (t, 0, sizeof *t);
+	t->desc = rnd () & 1;
+	b->hblitsize = (rnd () & 3) ? 1 + rnd () % 20 : 1 + rnd () % 64;
+	b->vblitsize = 1 + rnd () % 20;
+	for (int k = 0; k < 4; k++) {
+		*mods[k] = ((int)(rnd () % 80) - 30) & ~1;
+		t->pt[k] = (100000 + rnd () % 300000) & ~1;
+	}
+	b->blitashift = rnd () % 16;
+	b->blitbshift = rnd () % 16;
+	b->blitdownashift = 16 - b->blitashift;
+	b->blitdownbshift = 16 - b->blitbshift;
+	b->bltadat = rnd ();
+	b->bltbdat = rnd ();
+	b->bltcdat = rnd ();
+	b->bltddat = rnd ();
+	b->bltbhold = rnd ();
+	b->bltafwm = rnd ();
+	b->bltalwm = rnd ();
+	b->blitzero = 1;
+	t->bltcon0 = rnd () & 0x0fff;
+	t->bltcon1 = rnd () & 0x1e;
+
+	/* in place, overlapping and out of range channels */
+	switch (rnd () % 4) {
+	case 0:
+		t->pt[0] = t->pt[3];
+		b->bltamod = b->bltdmod = abs (b->bltdmod);
+		break;
+	case 1:
+		t->pt[2] = t->pt[3];
+		b->bltcmod = b->bltdmod = abs (b->bltdmod);
+		break;
+	case 2:
+		t->pt[1] = t->pt[3] + (rnd () % 8) * 2;
+		break;
+	}
+	if (rnd () % 50 == 0)
+		t->pt[rnd () % 4] = BENCH_CHIPMEM - 4;
+	if (rnd () % 50 == 0)
+		t->pt[rnd () % 4] |= 1;
+}
+
+static bool check (int blits, int *taken)
+{
+	*taken = 0;
+	for (int n = 0; n < blits; n++) {
+		struct bench_blit t, ref;
+		uae_u32 lastd_ref = 0x1234, lastd_bulk = 0x1234;
+		int fc_ref, fc_bulk;
+
+		random_blit (&t);
+		ref = t;
+		memcpy (chipmem_bulk, chipmem_init, BENCH_CHIPMEM);
+		if (!run_bulk (&t, chipmem_bulk, &fc_bulk))
+			continue;
+		(*taken)++;
+		if (channel (&t, 3))
+			lastd_bulk = t.b.bltddat;
+
+		memcpy (chipmem_ref, chipmem_init, BENCH_CHIPMEM);
+		fc_ref = ref_blit (&ref.b, channel (&ref, 0), channel (&ref, 1), channel (&ref, 2), channel (&ref, 3),
+			ref.bltcon0, ref.bltcon1, ref.desc, &lastd_ref);
+
+		if (memcmp (chipmem_ref, chipmem_bulk, BENCH_CHIPMEM) || memcmp (&ref.b, &t.b, sizeof t.b)
+			|| fc_ref != fc_bulk || lastd_ref != lastd_bulk) {
+			printf ("mismatch in blit %d: %s %dx%d bltcon0 %04x bltcon1 %04x\n", n, t.desc ? "desc" : "asc",
+				t.b.hblitsize, t.b.vblitsize, t.bltcon0, t.bltcon1);
+			return false;
+		}
+	}
+	return true;
+}
+
+static void bench (const char *name, uae_u16 bltcon0, uae_u16 bltcon1, bool desc, int iterations)
+{
+	struct bench_blit t;
+	struct timespec t0, t1;
+	double secs[2];
+	uae_u32 lastd;
+	int fc;
+
+	memset (&t, 0, sizeof t);
+	t.b.hblitsize = 20;
+	t.b.vblitsize = 200;
+	t.b.bltamod = -2;
+	t.b.bltbmod = 0;
+	t.b.bltcmod = t.b.bltdmod = 40;
+	t.b.blitashift = t.b.blitbshift = 5;
+	t.b.blitdownashift = t.b.blitdownbshift = 11;
+	t.b.bltafwm = 0xffff;
+	t.b.bltalwm = 0;
+	t.bltcon0 = bltcon0;
+	t.bltcon1 = bltcon1;
+	t.desc = desc;
+	t.pt[0] = 10000;
+	t.pt[1] = 30000;
+	t.pt[2] = t.pt[3] = desc ? 200000 : 100000;
+
+	for (int m = 0; m < 2; m++) {
+		clock_gettime (CLOCK_MONOTONIC, &t0);
+		for (int i = 0; i < iterations; i++) {
+			struct bench_blit r = t;
+			if (m)
+				run_bulk (&r, chipmem_bulk, &fc);
+			else
+				ref_blit (&r.b, channel (&r, 0), channel (&r, 1), channel (&r, 2), channel (&r, 3),
+					r.bltcon0, r.bltcon1, r.desc, &lastd);
+		}
+		clock_gettime (CLOCK_MONOTONIC, &t1);
+		secs[m] = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+	}
+	printf ("  %-12s %8.1f %8.1f Mwords/s\n", name,
+		(double) iterations * t.b.hblitsize * t.b.vblitsize / secs[0] / 1e6,
+		(double) iterations * t.b.hblitsize * t.b.vblitsize / secs[1] / 1e6);
+}
+
+int main (int argc, char **argv)
+{
+	int blits = argc > 1 ? atoi (argv[1]) : 200000;
+	int iterations = argc > 2 ? atoi (argv[2]) : 10000;
+	int taken;
+	bool ok;
+
+	srand (1);
+	build_filltable ();
+	for (int i = 0; i < BLITTER_MAX_WORDS; i++)
+		blit_masktable[i] = 0xFFFF;
+	for (int i = 0; i < BENCH_CHIPMEM; i++)
+		chipmem_init[i] = rand ();
+
+	ok = check (blits, &taken);
+	printf ("bulk blits %s the word loops (%d of %d blits taken)\n", ok ? "match" : "DO NOT match", taken, blits);
+
+	printf ("20x200 words          word loop     bulk\n");
+	bench ("copy A->D", 0x09f0, 0x0000, false, iterations);
+	bench ("cookie cut", 0x0fca, 0x0000, false, iterations);
+	bench ("fill desc", 0x09f0, 0x000a, true, iterations);
+	return ok ? 0 : 1;
+}
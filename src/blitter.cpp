@@ -13,6 +13,8 @@
 //#define BLITTER_INSTANT
 
 #define SPEEDUP
+/* whole rows at a time when that gives the same result, see blitbulk.h */
+#define BLITTER_BULK
 
 #include "sysconfig.h"
 #include "sysdeps.h"
@@ -28,6 +30,10 @@
 #include "savestate.h"
 #include "debug.h"
 
+#ifdef BLITTER_BULK
+#include "blitbulk.h"
+#endif
+
 /* we must not change ce-mode while blitter is running.. */
 static int blitter_cycle_exact;
 static int blt_statefile_type;
@@ -362,6 +368,28 @@ STATIC_INLINE void chipmem_agnus_wput2 (uaecptr addr, uae_u32 w)
 #endif
 }
 
+#ifdef BLITTER_BULK
+/* plain chip RAM only, and not while the debugger watches DMA */
+static bool blitter_bulk (uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, bool desc)
+{
+	int fc = !!(bltcon1 & 0x4);
+
+	if (currprefs.z3chipmem_size)
+		return false;
+#ifdef DEBUGGER
+	if (debugger_active || debug_dma)
+		return false;
+#endif
+	if (!blit_bulk (chipmemory, chipmem_full_size, &blt_info, pta, ptb, ptc, ptd, desc,
+		bltcon0 & 0xFF, blitfill ? blit_filltable : NULL, blitife ? 2 : 0, &fc))
+		return false;
+	blitfc = fc;
+	if (ptd)
+		last_custom_value1 = blt_info.bltddat;
+	return true;
+}
+#endif
+
 static void blitter_dofast (void)
 {
 	int i,j;
@@ -388,6 +416,11 @@ static void blitter_dofast (void)
 		bltdpt += (blt_info.hblitsize * 2 + blt_info.bltdmod) * blt_info.vblitsize;
 	}
 
+#ifdef BLITTER_BULK
+	if (blitter_bulk (bltadatptr, bltbdatptr, bltcdatptr, bltddatptr, false)) {
+		/* done */
+	} else
+#endif
 #ifdef SPEEDUP
 	if (blitfunc_dofast[mt] && !blitfill) {
 		(*blitfunc_dofast[mt])(bltadatptr, bltbdatptr, bltcdatptr, bltddatptr, &blt_info);
@@ -487,6 +520,11 @@ static void blitter_dofast_desc (void)
 		bltddatptr = bltdpt;
 		bltdpt -= (blt_info.hblitsize * 2 + blt_info.bltdmod) * blt_info.vblitsize;
 	}
+#ifdef BLITTER_BULK
+	if (blitter_bulk (bltadatptr, bltbdatptr, bltcdatptr, bltddatptr, true)) {
+		/* done */
+	} else
+#endif
 #ifdef SPEEDUP
 	if (blitfunc_dofast_desc[mt] && !blitfill) {
 		(*blitfunc_dofast_desc[mt])(bltadatptr, bltbdatptr, bltcdatptr, bltddatptr, &blt_info);
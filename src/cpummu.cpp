@@ -46,9 +46,12 @@ static void REGPARAM3 mmu_flush_atc_all(bool global) REGPARAM;
 mmu_atc_l1_array atc_l1[2];
 mmu_atc_l1_array *current_atc;
 static struct mmu_atc_line atc_l2[2][ATC_L2_SIZE];
+mmu_softtlb_array mmu_softtlb[2];
+mmu_softtlb_array *current_softtlb = &mmu_softtlb[0];
 
 # ifdef ATC_STATS
 static unsigned int mmu_atc_hits[ATC_L2_SIZE];
+unsigned long mmu_softtlb_hits, mmu_softtlb_misses;
 # endif
 
 
@@ -254,6 +257,12 @@ static void mmu_dump_table(const char * label, uaecptr root_ptr)
 void mmu_dump_atc(void)
 {
 	int i, j;
+#ifdef ATC_STATS
+	unsigned long lookups = mmu_softtlb_hits + mmu_softtlb_misses;
+
+	D(bug(_T("softtlb: %lu hits, %lu misses (%lu%%)\n"), mmu_softtlb_hits, mmu_softtlb_misses,
+		lookups ? mmu_softtlb_hits * 100 / lookups : 0));
+#endif
 	for (i = 0; i < 2; i++) {
 		for (j = 0; j < ATC_L2_SIZE; j++) {
 			if (atc_l2[i][j].tag == 0x8000)
@@ -441,6 +450,23 @@ fail:
 	return false;
 }
 
+/*
+ * Remember the host page behind a translation that just passed
+ * mmu_fill_atc_l1, if it is plain RAM.
+ */
+static ALWAYS_INLINE void mmu_fill_softtlb(uaecptr addr, bool super, bool data, bool write, struct mmu_atc_line *cl)
+{
+	uaecptr phys = mmu_get_real_address(addr, cl);
+	uae_u8 *p = avex_direct_banks[bankindex(phys)];
+	struct mmu_softtlb_line *t;
+
+	if (!p)
+		return;
+	t = &mmu_softtlb[super ? 1 : 0][data ? 1 : 0][write ? 1 : 0][(addr >> 12) % MMU_SOFTTLB_SIZE];
+	t->vpage = (addr & ~0xfff) | MMU_SOFTTLB_VALID;
+	t->host = p + (phys & 0xf000);
+}
+
 uaecptr REGPARAM2 mmu_translate(uaecptr addr, bool super, bool data, bool write)
 {
 	struct mmu_atc_line *l;
@@ -602,6 +628,7 @@ uae_u8 REGPARAM2 mmu_get_byte_slow(uaecptr addr, bool super, bool data,
 
 	if (!mmu_fill_atc_l1(addr, super, data, 0, cl))
 		goto redo;
+	mmu_fill_softtlb(addr, super, data, false, cl);
 
 	return phys_get_byte(mmu_get_real_address(addr, cl));
 }
@@ -621,6 +648,7 @@ uae_u16 REGPARAM2 mmu_get_word_slow(uaecptr addr, bool super, bool data,
 
 	if (!mmu_fill_atc_l1(addr, super, data, 0, cl))
 		goto redo;
+	mmu_fill_softtlb(addr, super, data, false, cl);
 
 	return phys_get_word(mmu_get_real_address(addr, cl));
 }
@@ -640,6 +668,7 @@ uae_u32 REGPARAM2 mmu_get_long_slow(uaecptr addr, bool super, bool data,
 
 	if (!mmu_fill_atc_l1(addr, super, data, 0, cl))
 		goto redo;
+	mmu_fill_softtlb(addr, super, data, false, cl);
 
 	return phys_get_long(mmu_get_real_address(addr, cl));
 }
@@ -707,6 +736,7 @@ void REGPARAM2 mmu_put_byte_slow(uaecptr addr, uae_u8 val, bool super, bool data
 
 	if (!mmu_fill_atc_l1(addr, super, data, 1, cl))
 		goto redo;
+	mmu_fill_softtlb(addr, super, data, true, cl);
 
 	phys_put_byte(mmu_get_real_address(addr, cl), val);
 }
@@ -729,6 +759,7 @@ void REGPARAM2 mmu_put_word_slow(uaecptr addr, uae_u16 val, bool super, bool dat
 
 	if (!mmu_fill_atc_l1(addr, super, data, 1, cl))
 		goto redo;
+	mmu_fill_softtlb(addr, super, data, true, cl);
 
 	phys_put_word(mmu_get_real_address(addr, cl), val);
 }
@@ -751,6 +782,7 @@ void REGPARAM2 mmu_put_long_slow(uaecptr addr, uae_u32 val, bool super, bool dat
 
 	if (!mmu_fill_atc_l1(addr, super, data, 1, cl))
 		goto redo;
+	mmu_fill_softtlb(addr, super, data, true, cl);
 
 	phys_put_long(mmu_get_real_address(addr, cl), val);
 }
@@ -964,6 +996,22 @@ void REGPARAM2 mmu_op_real(uae_u32 opcode, uae_u16 extra)
 		op_illg (opcode);
 }
 
+static void mmu_flush_softtlb_page(bool super, uaecptr addr)
+{
+	int i = (addr >> 12) % MMU_SOFTTLB_SIZE;
+	int j, k;
+
+	for (j = 0; j < 2; j++) {
+		for (k = 0; k < 2; k++)
+			mmu_softtlb[super ? 1 : 0][j][k][i].vpage = 0;
+	}
+}
+
+void mmu_flush_softtlb(void)
+{
+	memset(mmu_softtlb, 0, sizeof(mmu_softtlb));
+}
+
 static void REGPARAM2 mmu_flush_atc(uaecptr addr, bool super, bool global)
 {
 	struct mmu_atc_line *l;
@@ -993,6 +1041,11 @@ static void REGPARAM2 mmu_flush_atc(uaecptr addr, bool super, bool global)
 		if (global || !l[i].global)
 			l[i].tag = 0x8000;
 	}
+
+	/* the softtlb has no global bit, drop the page(s) either way */
+	mmu_flush_softtlb_page(super, addr);
+	if (regs.mmu_pagesize_8k)
+		mmu_flush_softtlb_page(super, addr ^ 0x1000);
 }
 
 static void REGPARAM2 mmu_flush_atc_all(bool global)
@@ -1011,6 +1064,8 @@ static void REGPARAM2 mmu_flush_atc_all(bool global)
 		if (global || !l->global)
 			l->tag = 0x8000;
 	}
+
+	mmu_flush_softtlb();
 }
 
 void REGPARAM2 mmu_reset(void)
@@ -1042,6 +1097,7 @@ void REGPARAM2 mmu_set_tc(uae_u16 tc)
 void REGPARAM2 mmu_set_super(bool super)
 {
 	current_atc = &atc_l1[super ? 1 : 0];
+	current_softtlb = &mmu_softtlb[super ? 1 : 0];
 }
 
 #else
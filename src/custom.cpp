@@ -5975,6 +5975,7 @@ static void vsync_handler_post (void)
 		write_log (_T("vblank interrupt not cleared\n"));
 #endif
 	DISK_vsync ();
+	frameServer ();
 
 #ifdef WITH_LUA
 	uae_lua_run_handler("on_uae_vsync");
@@ -6672,6 +6673,12 @@ static void hsync_handler (void)
 		}
 	}
 	hsync_handler_post (vs);
+	if (pc_profile_active)
+		pc_profile_sample (bltstate != BLT_done,
+			cop_state.state != COP_stop && cop_state.state != COP_waitforever && cop_state.state != COP_wait);
+	/* send this scanline's memory accesses to the memory server */
+	flushServer ();
+	cyclesServer (get_cycles ());
 }
 
 void init_eventtab (void)
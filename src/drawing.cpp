@@ -45,6 +45,7 @@ happening, all ports should restrict window widths to be multiples of 16 pixels.
 #include "gui.h"
 #include "picasso96.h"
 #include "drawing.h"
+#include "p2c.h"
 #include "savestate.h"
 #include "statusline.h"
 #include "inputdevice.h"
@@ -159,6 +160,10 @@ union sps_union spixstate;
 
 static uae_u32 ham_linebuf[MAX_PIXELS_PER_LINE * 2];
 static uae_u8 *real_bplpt[8];
+#ifdef P2C_AVX2
+/* set in drawing_init, selects the AVX2 planar to chunky and linetoscr kernels */
+static int have_avx2;
+#endif
 
 static uae_u8 all_ones[MAX_PIXELS_PER_LINE];
 static uae_u8 all_zeros[MAX_PIXELS_PER_LINE];
@@ -985,6 +990,10 @@ STATIC_INLINE uae_u8 render_sprites (int pos, int dualpf, uae_u8 apixel, int aga
 	return 0;
 }
 
+#ifdef P2C_AVX2
+#define LINETOSCR_AVX2
+#define LINETOSCR_TARGET_AVX2 P2C_TARGET_AVX2
+#endif
 #include "linetoscr.cpp"
 
 #define LTPARMS src_pixel, start, stop
@@ -1693,70 +1702,26 @@ static void weird_bitplane_fix (void)
 	}
 }
 
-#define MERGE(a,b,mask,shift) do {\
-	uae_u32 tmp = mask & (a ^ (b >> shift)); \
-	a ^= tmp; \
-	b ^= (tmp << shift); \
-} while (0)
-
-#define GETLONG(P) (*(uae_u32 *)P)
-
-/* We use the compiler's inlining ability to ensure that PLANES is in effect a compile time
-constant.  That will cause some unnecessary code to be optimized away.
-Don't touch this if you don't know what you are doing.  */
+/* Planes is a compile time constant here, see p2c_doline_scalar.  Whole
+vectors go through the widest kernel the CPU has, the rest through the
+scalar code; all of them advance real_bplpt.  */
 STATIC_INLINE void pfield_doline_1 (uae_u32 *pixels, int wordcount, int planes)
 {
-	while (wordcount-- > 0) {
-		uae_u32 b0, b1, b2, b3, b4, b5, b6, b7;
-
-		b0 = 0, b1 = 0, b2 = 0, b3 = 0, b4 = 0, b5 = 0, b6 = 0, b7 = 0;
-		switch (planes) {
-#ifdef AGA
-		case 8: b0 = GETLONG (real_bplpt[7]); real_bplpt[7] += 4;
-		case 7: b1 = GETLONG (real_bplpt[6]); real_bplpt[6] += 4;
+#ifdef P2C_AVX2
+	if (have_avx2 && wordcount >= 8) {
+		p2c_doline_avx2 (real_bplpt, pixels, wordcount, planes);
+		pixels += (wordcount & ~7) * 8;
+		wordcount &= 7;
+	}
 #endif
-		case 6: b2 = GETLONG (real_bplpt[5]); real_bplpt[5] += 4;
-		case 5: b3 = GETLONG (real_bplpt[4]); real_bplpt[4] += 4;
-		case 4: b4 = GETLONG (real_bplpt[3]); real_bplpt[3] += 4;
-		case 3: b5 = GETLONG (real_bplpt[2]); real_bplpt[2] += 4;
-		case 2: b6 = GETLONG (real_bplpt[1]); real_bplpt[1] += 4;
-		case 1: b7 = GETLONG (real_bplpt[0]); real_bplpt[0] += 4;
-		}
-
-		MERGE (b0, b1, 0x55555555, 1);
-		MERGE (b2, b3, 0x55555555, 1);
-		MERGE (b4, b5, 0x55555555, 1);
-		MERGE (b6, b7, 0x55555555, 1);
-
-		MERGE (b0, b2, 0x33333333, 2);
-		MERGE (b1, b3, 0x33333333, 2);
-		MERGE (b4, b6, 0x33333333, 2);
-		MERGE (b5, b7, 0x33333333, 2);
-
-		MERGE (b0, b4, 0x0f0f0f0f, 4);
-		MERGE (b1, b5, 0x0f0f0f0f, 4);
-		MERGE (b2, b6, 0x0f0f0f0f, 4);
-		MERGE (b3, b7, 0x0f0f0f0f, 4);
-
-		MERGE (b0, b1, 0x00ff00ff, 8);
-		MERGE (b2, b3, 0x00ff00ff, 8);
-		MERGE (b4, b5, 0x00ff00ff, 8);
-		MERGE (b6, b7, 0x00ff00ff, 8);
-
-		MERGE (b0, b2, 0x0000ffff, 16);
-		do_put_mem_long (pixels, b0);
-		do_put_mem_long (pixels + 4, b2);
-		MERGE (b1, b3, 0x0000ffff, 16);
-		do_put_mem_long (pixels + 2, b1);
-		do_put_mem_long (pixels + 6, b3);
-		MERGE (b4, b6, 0x0000ffff, 16);
-		do_put_mem_long (pixels + 1, b4);
-		do_put_mem_long (pixels + 5, b6);
-		MERGE (b5, b7, 0x0000ffff, 16);
-		do_put_mem_long (pixels + 3, b5);
-		do_put_mem_long (pixels + 7, b7);
-		pixels += 8;
+#ifdef P2C_SSE2
+	if (wordcount >= 4) {
+		p2c_doline_sse2 (real_bplpt, pixels, wordcount, planes);
+		pixels += (wordcount & ~3) * 8;
+		wordcount &= 3;
 	}
+#endif
+	p2c_doline_scalar (real_bplpt, pixels, wordcount, planes);
 }
 
 /* See above for comments on inlining.  These functions should _not_
@@ -3081,6 +3046,9 @@ void reset_drawing (void)
 void drawing_init (void)
 {
 	gen_pfield_tables ();
+#ifdef P2C_AVX2
+	have_avx2 = p2c_have_avx2 ();
+#endif
 
 	uae_sem_init (&gui_sem, 0, 1);
 #ifdef PICASSO96
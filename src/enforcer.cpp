@@ -617,6 +617,7 @@ int enforcer_enable (int enfmode)
 		chipmem_bank.bput = chipmem_bput2;
 		chipmem_bank.xlateaddr = chipmem_xlate2;
 		chipmem_bank.check = chipmem_check2;
+		fill_direct_banks ();
 
 		enforcer_installed = 1;
 	}
@@ -643,6 +644,7 @@ int enforcer_disable (void)
 		chipmem_bank.bput = saved_chipmem_bput;
 		chipmem_bank.xlateaddr = saved_chipmem_xlate;
 		chipmem_bank.check = saved_chipmem_check;
+		fill_direct_banks ();
 
 		enforcer_installed = 0;
 	}
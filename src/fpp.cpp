@@ -325,7 +325,7 @@ STATIC_INLINE void set_fpsr (uae_u32 x)
 /* E = MAX & F # 0 -> NotANumber */
 /* E = biased by 127 (single) ,1023 (double) ,16383 (extended) */
 
-STATIC_INLINE fptype to_pack (uae_u32 wrd1, uae_u32 wrd2, uae_u32 wrd3)
+static fptype to_pack_str (uae_u32 wrd1, uae_u32 wrd2, uae_u32 wrd3)
 {
 	fptype d;
 	char *cp;
@@ -363,6 +363,66 @@ STATIC_INLINE fptype to_pack (uae_u32 wrd1, uae_u32 wrd2, uae_u32 wrd3)
 	return d;
 }
 
+/* Packed decimal without the string round trip: the 17 mantissa digits
+   fit in 64 bits, so the value is one integer scaled by a power of ten.
+   That is only done when it is exact, the integer (without its trailing
+   zeros) below 2^53 and the power of ten one of 1e0..1e22, so the single
+   multiply or divide rounds once and gives what sscanf gives. Anything
+   else, non-decimal digits included, takes the string path, and so does
+   everything when the FPU evaluates in extended precision (x87), where
+   the double would be rounded twice. */
+static const double to_pack_pow10[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+STATIC_INLINE fptype to_pack (uae_u32 wrd1, uae_u32 wrd2, uae_u32 wrd3)
+{
+	uae_u64 mant;
+	int exp, i;
+	fptype d;
+
+#if !defined(FLT_EVAL_METHOD) || FLT_EVAL_METHOD != 0 || USE_LONG_DOUBLE
+	return to_pack_str (wrd1, wrd2, wrd3);
+#endif
+	if (((wrd1 & 0x0fff000f) | wrd2 | wrd3) & 0x88888888) {
+		/* a nibble above 7 may be a non-decimal digit */
+		if ((wrd1 & 0xf) > 9 || ((wrd1 >> 16) & 0xf) > 9 || ((wrd1 >> 20) & 0xf) > 9 || ((wrd1 >> 24) & 0xf) > 9)
+			return to_pack_str (wrd1, wrd2, wrd3);
+		for (i = 0; i < 32; i += 4) {
+			if (((wrd2 >> i) & 0xf) > 9 || ((wrd3 >> i) & 0xf) > 9)
+				return to_pack_str (wrd1, wrd2, wrd3);
+		}
+	}
+
+	mant = wrd1 & 0xf;
+	exp = 0;
+	for (i = 28; i >= 0; i -= 4)
+		mant = mant * 10 + ((wrd2 >> i) & 0xf);
+	for (i = 28; i >= 0; i -= 4)
+		mant = mant * 10 + ((wrd3 >> i) & 0xf);
+	for (i = 24; i >= 16; i -= 4)
+		exp = exp * 10 + ((wrd1 >> i) & 0xf);
+	if (wrd1 & 0x40000000)
+		exp = -exp;
+	exp -= 16;
+	if (mant == 0)
+		exp = 0;
+	while (mant && mant % 10 == 0) {
+		mant /= 10;
+		exp++;
+	}
+
+	if (mant >= (1ULL << 53) || exp < -22 || exp > 22)
+		return to_pack_str (wrd1, wrd2, wrd3);
+	d = (fptype) mant;
+	if (exp >= 0)
+		d *= to_pack_pow10[exp];
+	else
+		d /= to_pack_pow10[-exp];
+	return (wrd1 & 0x80000000) ? -d : d;
+}
+
 STATIC_INLINE void from_pack (fptype src, uae_u32 * wrd1, uae_u32 * wrd2, uae_u32 * wrd3)
 {
 	int i;
@@ -1075,6 +1135,30 @@ void fpuop_restore (uae_u32 opcode)
 		m68k_areg (regs, opcode & 7) = ad;
 }
 
+/* FMOVECR constant ROM, indexed by offset; offsets not set in
+   fp_cr_valid are left unimplemented */
+static fptype fp_cr[0x40];
+static uae_u64 fp_cr_valid;
+
+static void init_fp_cr (void)
+{
+	static const struct { int offset; fptype value; } rom[] = {
+		{ 0x00, *fp_pi }, { 0x0b, *fp_l10_2 }, { 0x0c, *fp_exp_1 },
+		{ 0x0d, *fp_l2_e }, { 0x0e, *fp_l10_e }, { 0x0f, 0.0 },
+		{ 0x30, *fp_ln_2 }, { 0x31, *fp_ln_10 }, { 0x32, (fptype)fp_1e0 },
+		{ 0x33, (fptype)fp_1e1 }, { 0x34, (fptype)fp_1e2 }, { 0x35, (fptype)fp_1e4 },
+		{ 0x36, (fptype)fp_1e8 }, { 0x37, *fp_1e16 }, { 0x38, *fp_1e32 },
+		{ 0x39, *fp_1e64 }, { 0x3a, *fp_1e128 }, { 0x3b, *fp_1e256 },
+		{ 0x3c, *fp_1e512 }, { 0x3d, *fp_1e1024 }, { 0x3e, *fp_1e2048 },
+		{ 0x3f, *fp_1e4096 },
+	};
+
+	for (unsigned int i = 0; i < sizeof rom / sizeof *rom; i++) {
+		fp_cr[rom[i].offset] = rom[i].value;
+		fp_cr_valid |= (uae_u64)1 << rom[i].offset;
+	}
+}
+
 static void fround (int reg)
 {
 	regs.fp[reg] = (float)regs.fp[reg];
@@ -1355,78 +1439,16 @@ static void fpuop_arithmetic2 (uae_u32 opcode, uae_u16 extra)
 		case 2: /* Extremely common */
 			reg = (extra >> 7) & 7;
 			if ((extra & 0xfc00) == 0x5c00) {
-				switch (extra & 0x7f) {
-		case 0x00:
-			regs.fp[reg] = *fp_pi;
-			break;
-		case 0x0b:
-			regs.fp[reg] = *fp_l10_2;
-			break;
-		case 0x0c:
-			regs.fp[reg] = *fp_exp_1;
-			break;
-		case 0x0d:
-			regs.fp[reg] = *fp_l2_e;
-			break;
-		case 0x0e:
-			regs.fp[reg] = *fp_l10_e;
-			break;
-		case 0x0f:
-			regs.fp[reg] = 0.0;
-			break;
-		case 0x30:
-			regs.fp[reg] = *fp_ln_2;
-			break;
-		case 0x31:
-			regs.fp[reg] = *fp_ln_10;
-			break;
-		case 0x32:
-			regs.fp[reg] = (fptype)fp_1e0;
-			break;
-		case 0x33:
-			regs.fp[reg] = (fptype)fp_1e1;
-			break;
-		case 0x34:
-			regs.fp[reg] = (fptype)fp_1e2;
-			break;
-		case 0x35:
-			regs.fp[reg] = (fptype)fp_1e4;
-			break;
-		case 0x36:
-			regs.fp[reg] = (fptype)fp_1e8;
-			break;
-		case 0x37:
-			regs.fp[reg] = *fp_1e16;
-			break;
-		case 0x38:
-			regs.fp[reg] = *fp_1e32;
-			break;
-		case 0x39:
-			regs.fp[reg] = *fp_1e64;
-			break;
-		case 0x3a:
-			regs.fp[reg] = *fp_1e128;
-			break;
-		case 0x3b:
-			regs.fp[reg] = *fp_1e256;
-			break;
-		case 0x3c:
-			regs.fp[reg] = *fp_1e512;
-			break;
-		case 0x3d:
-			regs.fp[reg] = *fp_1e1024;
-			break;
-		case 0x3e:
-			regs.fp[reg] = *fp_1e2048;
-			break;
-		case 0x3f:
-			regs.fp[reg] = *fp_1e4096;
-			break;
-		default:
-			m68k_setpc (pc);
-			op_illg (opcode);
-			return;
+				int offset = extra & 0x7f;
+
+				if (!fp_cr_valid)
+					init_fp_cr ();
+				if (offset >= 0x40 || !((fp_cr_valid >> offset) & 1)) {
+					m68k_setpc (pc);
+					op_illg (opcode);
+					return;
 				}
+				regs.fp[reg] = fp_cr[offset];
 				MAKE_FPSR (regs.fp[reg]);
 				return;
 			}
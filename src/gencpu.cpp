@@ -1246,11 +1246,11 @@ static void genflags_normal (flagtypes type, wordsizes size, char *value, char *
 		break;
 	}
 
+	/* Instructions that define all of CZNV build the new value and store
+	   it once, instead of four read-modify-write updates of regflags. */
 	switch (type) {
 	case flag_logical:
-		printf ("\tCLEAR_CZNV ();\n");
-		printf ("\tSET_ZFLG   (%s == 0);\n", vstr);
-		printf ("\tSET_NFLG   (%s < 0);\n", vstr);
+		printf ("\tSET_CZNV (((%s == 0) << FLAGBIT_Z) | ((%s < 0) << FLAGBIT_N));\n", vstr, vstr);
 		break;
 	case flag_logical_noclobber:
 		printf ("\tSET_ZFLG (%s == 0);\n", vstr);
@@ -1270,18 +1270,14 @@ static void genflags_normal (flagtypes type, wordsizes size, char *value, char *
 		printf ("\tSET_NFLG (%s < 0);\n", vstr);
 		break;
 	case flag_add:
-		printf ("\tSET_ZFLG (%s == 0);\n", vstr);
-		printf ("\tSET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));\n");
-		printf ("\tSET_CFLG (%s < %s);\n", undstr, usstr);
+		printf ("\tSET_CZNV (((%s == 0) << FLAGBIT_Z) | (((flgs ^ flgn) & (flgo ^ flgn)) << FLAGBIT_V)\n", vstr);
+		printf ("\t\t| ((%s < %s) << FLAGBIT_C) | (flgn << FLAGBIT_N));\n", undstr, usstr);
 		duplicate_carry (0);
-		printf ("\tSET_NFLG (flgn != 0);\n");
 		break;
 	case flag_sub:
-		printf ("\tSET_ZFLG (%s == 0);\n", vstr);
-		printf ("\tSET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));\n");
-		printf ("\tSET_CFLG (%s > %s);\n", usstr, udstr);
+		printf ("\tSET_CZNV (((%s == 0) << FLAGBIT_Z) | (((flgs ^ flgo) & (flgn ^ flgo)) << FLAGBIT_V)\n", vstr);
+		printf ("\t\t| ((%s > %s) << FLAGBIT_C) | (flgn << FLAGBIT_N));\n", usstr, udstr);
 		duplicate_carry (0);
-		printf ("\tSET_NFLG (flgn != 0);\n");
 		break;
 	case flag_addx:
 		printf ("\tSET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));\n"); /* minterm SON: 0x42 */
@@ -1294,10 +1290,8 @@ static void genflags_normal (flagtypes type, wordsizes size, char *value, char *
 		duplicate_carry (0);
 		break;
 	case flag_cmp:
-		printf ("\tSET_ZFLG (%s == 0);\n", vstr);
-		printf ("\tSET_VFLG ((flgs != flgo) && (flgn != flgo));\n");
-		printf ("\tSET_CFLG (%s > %s);\n", usstr, udstr);
-		printf ("\tSET_NFLG (flgn != 0);\n");
+		printf ("\tSET_CZNV (((%s == 0) << FLAGBIT_Z) | (((flgs != flgo) && (flgn != flgo)) << FLAGBIT_V)\n", vstr);
+		printf ("\t\t| ((%s > %s) << FLAGBIT_C) | (flgn << FLAGBIT_N));\n", usstr, udstr);
 		break;
 	}
 }
@@ -1576,12 +1570,13 @@ static void gen_opcode (unsigned long int opcode)
 		prefetch_word = "get_word_prefetch";
 		prefetch_long = "get_long_prefetch";
 		srcwi = "get_wordi";
-		srcl = "get_long";
-		dstl = "put_long";
-		srcw = "get_word";
-		dstw = "put_word";
-		srcb = "get_byte";
-		dstb = "put_byte";
+		// data accesses to chip/fast RAM skip the bank handlers
+		srcl = "get_long_direct";
+		dstl = "put_long_direct";
+		srcw = "get_word_direct";
+		dstw = "put_word_direct";
+		srcb = "get_byte_direct";
+		dstb = "put_byte_direct";
 	} else {
 		// generic
 		prefetch_long = "get_ilong";
@@ -1591,12 +1586,12 @@ static void gen_opcode (unsigned long int opcode)
 		srcli = "get_ilong";
 		srcwi = "get_iword";
 		srcbi = "get_ibyte";
-		srcl = "get_long";
-		dstl = "put_long";
-		srcw = "get_word";
-		dstw = "put_word";
-		srcb = "get_byte";
-		dstb = "put_byte";
+		srcl = "get_long_direct";
+		dstl = "put_long_direct";
+		srcw = "get_word_direct";
+		dstw = "put_word_direct";
+		srcb = "get_byte_direct";
+		dstb = "put_byte_direct";
 	}
 
 	insn_n_cycles020 = 0;
@@ -289,6 +289,96 @@ static void out_sprite (DEPTH_T bpp, HMODE_T hmode, CMODE_T cmode, int aga, int
 }
 
 
+/* Modes with an AVX2 kernel: 32-bit output, no sprites, no filtering and
+ * a plain colour table lookup (single or dual playfield). */
+static int has_avx2_kernel (DEPTH_T bpp, HMODE_T hmode, int spr, CMODE_T cmode)
+{
+	return bpp == DEPTH_32BPP && !spr && hmode != HMODE_HALVE1F && hmode != HMODE_HALVE2F
+		&& (cmode == CMODE_NORMAL || cmode == CMODE_DUALPF);
+}
+
+/* Output pixels per iteration of the vector kernels: the colour lookups
+ * are always done for 8 source pixels, the doubling modes widen them. */
+static int avx2_kernel_step (HMODE_T hmode)
+{
+	return hmode == HMODE_DOUBLE ? 16 : hmode == HMODE_DOUBLE2X ? 32 : 8;
+}
+
+static void out_linetoscr_avx2 (HMODE_T hmode)
+{
+	outlnf ("static int NOINLINE LINETOSCR_TARGET_AVX2 linetoscr_32%s_avx2 (uae_u32 *buf, int spix, int dpix, int dpix_end,",
+		get_hmode_str (hmode));
+	outln  ("    const int *lookup, const int *lookup_no, int lookup_ofs, uae_u8 xor_val)");
+	outln  ("{");
+	outln  ("    const __m256i xor_vec = _mm256_set1_epi32 (xor_val);");
+	outln  ("    const __m256i ofs_vec = _mm256_set1_epi32 (lookup_ofs);");
+	outln  ("    const __m256i byte_mask = _mm256_set1_epi32 (0xff);");
+	outln  ("");
+	outln  ("    while (dpix < dpix_end) {");
+	outln  ("        const uae_u8 *src = &pixdata.apixels[spix];");
+	outln  ("        __m256i idx, out;");
+	outln  ("");
+	if (hmode == HMODE_HALVE1) {
+		outln ("        idx = _mm256_and_si256 (_mm256_cvtepu16_epi32 (_mm_loadu_si128 ((const __m128i *)src)), byte_mask);");
+		outln ("        spix += 16;");
+	} else if (hmode == HMODE_HALVE2) {
+		outln ("        idx = _mm256_and_si256 (_mm256_loadu_si256 ((const __m256i *)src), byte_mask);");
+		outln ("        spix += 32;");
+	} else {
+		outln ("        idx = _mm256_cvtepu8_epi32 (_mm_loadl_epi64 ((const __m128i *)src));");
+		outln ("        spix += 8;");
+	}
+	outln  ("        if (lookup) {");
+	outln  ("            __m256i ofs = _mm256_setzero_si256 ();");
+	outln  ("            if (lookup_no) {");
+	outln  ("                __m256i no = _mm256_i32gather_epi32 (lookup_no, idx, 4);");
+	outln  ("                ofs = _mm256_andnot_si256 (_mm256_cmpeq_epi32 (no, _mm256_setzero_si256 ()), ofs_vec);");
+	outln  ("            }");
+	outln  ("            idx = _mm256_i32gather_epi32 (lookup, idx, 4);");
+	outln  ("            idx = _mm256_and_si256 (_mm256_add_epi32 (idx, ofs), byte_mask);");
+	outln  ("        }");
+	outln  ("        idx = _mm256_xor_si256 (idx, xor_vec);");
+	outln  ("        out = _mm256_i32gather_epi32 ((const int *)colors_for_drawing.acolors, idx, 4);");
+	if (hmode == HMODE_DOUBLE) {
+		outln ("        _mm256_storeu_si256 ((__m256i *)&buf[dpix + 0], _mm256_permutevar8x32_epi32 (out, _mm256_setr_epi32 (0, 0, 1, 1, 2, 2, 3, 3)));");
+		outln ("        _mm256_storeu_si256 ((__m256i *)&buf[dpix + 8], _mm256_permutevar8x32_epi32 (out, _mm256_setr_epi32 (4, 4, 5, 5, 6, 6, 7, 7)));");
+	} else if (hmode == HMODE_DOUBLE2X) {
+		outln ("        _mm256_storeu_si256 ((__m256i *)&buf[dpix + 0], _mm256_permutevar8x32_epi32 (out, _mm256_setr_epi32 (0, 0, 0, 0, 1, 1, 1, 1)));");
+		outln ("        _mm256_storeu_si256 ((__m256i *)&buf[dpix + 8], _mm256_permutevar8x32_epi32 (out, _mm256_setr_epi32 (2, 2, 2, 2, 3, 3, 3, 3)));");
+		outln ("        _mm256_storeu_si256 ((__m256i *)&buf[dpix + 16], _mm256_permutevar8x32_epi32 (out, _mm256_setr_epi32 (4, 4, 4, 4, 5, 5, 5, 5)));");
+		outln ("        _mm256_storeu_si256 ((__m256i *)&buf[dpix + 24], _mm256_permutevar8x32_epi32 (out, _mm256_setr_epi32 (6, 6, 6, 6, 7, 7, 7, 7)));");
+	} else {
+		outln ("        _mm256_storeu_si256 ((__m256i *)&buf[dpix], out);");
+	}
+	outlnf ("        dpix += %d;", avx2_kernel_step (hmode));
+	outln  ("    }");
+	outln  ("    return spix;");
+	outln  ("}");
+	outln  ("");
+}
+
+static void out_linetoscr_call_avx2 (HMODE_T hmode, int aga, CMODE_T cmode)
+{
+	int step = avx2_kernel_step (hmode);
+	int old_indent = set_indent (0);
+
+	outln  ("#ifdef LINETOSCR_AVX2");
+	set_indent (old_indent);
+	outlnf ("if (have_avx2 && dpix_end - dpix >= %d) {", step);
+	outlnf ("    int n = (dpix_end - dpix) & ~%d;", step - 1);
+	outlnf ("    spix = linetoscr_32%s_avx2 (buf, spix, dpix, dpix + n, %s, %s, %s, %s);",
+		get_hmode_str (hmode),
+		cmode == CMODE_DUALPF ? "lookup" : "NULL",
+		aga && cmode == CMODE_DUALPF ? "lookup_no" : "NULL",
+		aga && cmode == CMODE_DUALPF ? "dblpfofs[bpldualpf2of]" : "0",
+		aga ? "xor_val" : "0");
+	outln  ("    dpix += n;");
+	outln  ("}");
+	set_indent (0);
+	outln  ("#endif");
+	set_indent (old_indent);
+}
+
 static void out_linetoscr_mode (DEPTH_T bpp, HMODE_T hmode, int aga, int spr, CMODE_T cmode)
 {
 	int old_indent = set_indent (8);
@@ -302,6 +392,9 @@ static void out_linetoscr_mode (DEPTH_T bpp, HMODE_T hmode, int aga, int spr, CM
 
 	/* TODO: add support for combining pixel writes in 8-bpp modes. */
 
+	if (has_avx2_kernel (bpp, hmode, spr, cmode))
+		out_linetoscr_call_avx2 (hmode, aga, cmode);
+
 	if (bpp == DEPTH_16BPP && hmode != HMODE_DOUBLE && hmode != HMODE_DOUBLE2X && spr == 0) {
 		outln (		"int rem;");
 		outln (		"if (((long)&buf[dpix]) & 2) {");
@@ -485,6 +578,17 @@ int main (int argc, char *argv[])
 	outln (" */");
 	outln ("");
 
+	/* One vector kernel per scaling mode, shared by the ECS and AGA
+	 * variants; the caller picks it at run time and finishes the line
+	 * with the scalar loop. */
+	outln ("#ifdef LINETOSCR_AVX2");
+	for (hmode = HMODE_NORMAL; hmode <= HMODE_MAX; hmode++) {
+		if (has_avx2_kernel (DEPTH_32BPP, hmode, 0, CMODE_NORMAL))
+			out_linetoscr_avx2 (hmode);
+	}
+	outln ("#endif");
+	outln ("");
+
 	for (bpp = DEPTH_16BPP; bpp <= DEPTH_MAX; bpp++) {
 		for (aga = 0; aga <= 1 ; aga++) {
 			if (aga && bpp == DEPTH_8BPP)
@@ -0,0 +1,289 @@
+ /*
+  * UAE - The Un*x Amiga Emulator
+  *
+  * Bulk blits for the immediate blitter
+  *
+  * Each row of A, B and C is read into a host order buffer, shifted,
+  * combined with a branch free minterm mux (any of the 256 minterms),
+  * area filled if needed and then written out. The result, memory and
+  * registers, is the same as the word loops in blitter_dofast and
+  * blitter_dofast_desc; blitbench.cpp checks that.
+  *
+  * The word loops write D one word late, after the next word has been
+  * read, so doing a row at once only gives the same result when no source
+  * reads what D writes. A source that is D itself (same pointer and
+  * modulo, rows not overlapping) is fine: every word is read before it is
+  * written in both cases. blit_bulk returns false, without touching
+  * anything, for those blits and for any channel outside mem.
+  */
+
+#ifndef UAE_BLITBULK_H
+#define UAE_BLITBULK_H
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#define BLIT_BULK_SSE2
+#endif
+
+/* index 0 holds the word carried over from the previous row */
+static uae_u16 blit_bulk_row[4][BLITTER_MAX_WORDS + 1];
+
+STATIC_INLINE bool blit_bulk_range (const struct bltinfo *b, uae_u32 memsize, uaecptr pt, int mod, bool desc, uae_s64 *lo, uae_s64 *hi)
+{
+	int h = b->hblitsize;
+	uae_s64 step = (uae_s64)(h * 2 + mod) * (b->vblitsize - 1);
+	uae_s64 first = pt, last = desc ? first - step : first + step;
+
+	*lo = first < last ? first : last;
+	*hi = first < last ? last : first;
+	if (desc)
+		*lo -= (h - 1) * 2;
+	else
+		*hi += (h - 1) * 2;
+	*hi += 2;
+	return !(pt & 1) && *lo >= 0 && *hi <= memsize;
+}
+
+STATIC_INLINE bool blit_bulk_source_ok (const struct bltinfo *b, uae_u32 memsize, uaecptr pt, int mod, uaecptr ptd, bool desc, uae_s64 dlo, uae_s64 dhi)
+{
+	uae_s64 lo, hi;
+
+	if (!pt)
+		return true;
+	if (!blit_bulk_range (b, memsize, pt, mod, desc, &lo, &hi))
+		return false;
+	if (!ptd || hi <= dlo || lo >= dhi)
+		return true;
+	return pt == ptd && mod == b->bltdmod && mod >= 0;
+}
+
+#ifdef BLIT_BULK_SSE2
+STATIC_INLINE __m128i blit_bulk_bswap16 (__m128i x)
+{
+	return _mm_or_si128 (_mm_slli_epi16 (x, 8), _mm_srli_epi16 (x, 8));
+}
+
+/* word order of 8 words loaded from below a descending pointer */
+STATIC_INLINE __m128i blit_bulk_reverse16 (__m128i x)
+{
+	x = _mm_shuffle_epi32 (x, 0x1b);
+	return _mm_shufflehi_epi16 (_mm_shufflelo_epi16 (x, 0xb1), 0xb1);
+}
+#endif
+
+STATIC_INLINE void blit_bulk_load (uae_u16 *dst, const uae_u8 *mem, uaecptr pt, int h, bool desc)
+{
+	int i = 0;
+
+	if (desc) {
+#ifdef BLIT_BULK_SSE2
+		for (; i + 8 <= h; i += 8) {
+			__m128i x = _mm_loadu_si128 ((__m128i *)(mem + pt - i * 2 - 14));
+			_mm_storeu_si128 ((__m128i *)(dst + i), blit_bulk_bswap16 (blit_bulk_reverse16 (x)));
+		}
+#endif
+		for (; i < h; i++)
+			dst[i] = do_get_mem_word ((uae_u16 *)(mem + pt - i * 2));
+	} else {
+#ifdef BLIT_BULK_SSE2
+		for (; i + 8 <= h; i += 8) {
+			__m128i x = _mm_loadu_si128 ((__m128i *)(mem + pt + i * 2));
+			_mm_storeu_si128 ((__m128i *)(dst + i), blit_bulk_bswap16 (x));
+		}
+#endif
+		for (; i < h; i++)
+			dst[i] = do_get_mem_word ((uae_u16 *)(mem + pt + i * 2));
+	}
+}
+
+STATIC_INLINE void blit_bulk_store (const uae_u16 *src, uae_u8 *mem, uaecptr pt, int h, bool desc)
+{
+	int i = 0;
+
+	if (desc) {
+#ifdef BLIT_BULK_SSE2
+		for (; i + 8 <= h; i += 8) {
+			__m128i x = _mm_loadu_si128 ((__m128i *)(src + i));
+			_mm_storeu_si128 ((__m128i *)(mem + pt - i * 2 - 14), blit_bulk_reverse16 (blit_bulk_bswap16 (x)));
+		}
+#endif
+		for (; i < h; i++)
+			do_put_mem_word ((uae_u16 *)(mem + pt - i * 2), src[i]);
+	} else {
+#ifdef BLIT_BULK_SSE2
+		for (; i + 8 <= h; i += 8) {
+			__m128i x = _mm_loadu_si128 ((__m128i *)(src + i));
+			_mm_storeu_si128 ((__m128i *)(mem + pt + i * 2), blit_bulk_bswap16 (x));
+		}
+#endif
+		for (; i < h; i++)
+			do_put_mem_word ((uae_u16 *)(mem + pt + i * 2), src[i]);
+	}
+}
+
+/* row[1..h] holds the words, row[0] the previous one; the shifted words
+end up in row[0..h-1], same as blitahold/blitbhold in the word loops */
+STATIC_INLINE void blit_bulk_shift (uae_u16 *row, int h, int shift, bool desc)
+{
+	int i = 0;
+
+#ifdef BLIT_BULK_SSE2
+	__m128i s1 = _mm_cvtsi32_si128 (shift), s2 = _mm_cvtsi32_si128 (16 - shift);
+	for (; i + 8 <= h; i += 8) {
+		__m128i prev = _mm_loadu_si128 ((__m128i *)(row + i));
+		__m128i cur = _mm_loadu_si128 ((__m128i *)(row + i + 1));
+		if (desc)
+			prev = _mm_or_si128 (_mm_srl_epi16 (prev, s1), _mm_sll_epi16 (cur, s2));
+		else
+			prev = _mm_or_si128 (_mm_srl_epi16 (cur, s1), _mm_sll_epi16 (prev, s2));
+		_mm_storeu_si128 ((__m128i *)(row + i), prev);
+	}
+#endif
+	for (; i < h; i++) {
+		if (desc)
+			row[i] = (((uae_u32)row[i + 1] << 16) | row[i]) >> shift;
+		else
+			row[i] = (((uae_u32)row[i] << 16) | row[i + 1]) >> shift;
+	}
+}
+
+/* minterm bit n is the output for A = n & 4, B = n & 2, C = n & 1 */
+STATIC_INLINE void blit_bulk_minterm (uae_u16 *d, const uae_u16 *a, const uae_u16 *b, const uae_u16 *c, int h, uae_u8 mt)
+{
+	uae_u16 m[8];
+	int i;
+
+	for (i = 0; i < 8; i++)
+		m[i] = (mt & (1 << i)) ? 0xffff : 0;
+	i = 0;
+#ifdef BLIT_BULK_SSE2
+	__m128i m0 = _mm_set1_epi16 (m[0]), m2 = _mm_set1_epi16 (m[2]);
+	__m128i m4 = _mm_set1_epi16 (m[4]), m6 = _mm_set1_epi16 (m[6]);
+	__m128i x10 = _mm_set1_epi16 (m[0] ^ m[1]), x32 = _mm_set1_epi16 (m[2] ^ m[3]);
+	__m128i x54 = _mm_set1_epi16 (m[4] ^ m[5]), x76 = _mm_set1_epi16 (m[6] ^ m[7]);
+	for (; i + 8 <= h; i += 8) {
+		__m128i va = _mm_loadu_si128 ((__m128i *)(a + i));
+		__m128i vb = _mm_loadu_si128 ((__m128i *)(b + i));
+		__m128i vc = _mm_loadu_si128 ((__m128i *)(c + i));
+		__m128i t0 = _mm_xor_si128 (m0, _mm_and_si128 (vc, x10));
+		__m128i t1 = _mm_xor_si128 (m2, _mm_and_si128 (vc, x32));
+		__m128i t2 = _mm_xor_si128 (m4, _mm_and_si128 (vc, x54));
+		__m128i t3 = _mm_xor_si128 (m6, _mm_and_si128 (vc, x76));
+		t0 = _mm_xor_si128 (t0, _mm_and_si128 (vb, _mm_xor_si128 (t0, t1)));
+		t2 = _mm_xor_si128 (t2, _mm_and_si128 (vb, _mm_xor_si128 (t2, t3)));
+		_mm_storeu_si128 ((__m128i *)(d + i), _mm_xor_si128 (t0, _mm_and_si128 (va, _mm_xor_si128 (t0, t2))));
+	}
+#endif
+	for (; i < h; i++) {
+		uae_u16 t0 = m[0] ^ (c[i] & (m[0] ^ m[1]));
+		uae_u16 t1 = m[2] ^ (c[i] & (m[2] ^ m[3]));
+		uae_u16 t2 = m[4] ^ (c[i] & (m[4] ^ m[5]));
+		uae_u16 t3 = m[6] ^ (c[i] & (m[6] ^ m[7]));
+		t0 ^= b[i] & (t0 ^ t1);
+		t2 ^= b[i] & (t2 ^ t3);
+		d[i] = t0 ^ (a[i] & (t0 ^ t2));
+	}
+}
+
+/*
+* mem/memsize: chip memory. filltable is blit_filltable, NULL if fill is
+* off, and ifemode its column (0 or 2). *fc is the fill carry each row
+* starts with (FCI) and returns the one left by the last row.
+*/
+static bool blit_bulk (uae_u8 *mem, uae_u32 memsize, struct bltinfo *b,
+	uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, bool desc, uae_u8 mt,
+	uae_u8 (*filltable)[4][2], int ifemode, int *fc)
+{
+	int h = b->hblitsize, v = b->vblitsize;
+	int dir = desc ? -2 : 2;
+	uae_u16 *ra = blit_bulk_row[0], *rb = blit_bulk_row[1], *rc = blit_bulk_row[2], *rd = blit_bulk_row[3];
+	uae_u16 carrya = 0, carryb = 0, lasta = 0, lastb = 0, lastc = 0, dor = 0;
+	uae_s64 dlo = 0, dhi = 0;
+	int fci = *fc;
+	int i, j;
+
+	if (h <= 0 || h > BLITTER_MAX_WORDS)
+		return false;
+	if (ptd && !blit_bulk_range (b, memsize, ptd, b->bltdmod, desc, &dlo, &dhi))
+		return false;
+	if (!blit_bulk_source_ok (b, memsize, pta, b->bltamod, ptd, desc, dlo, dhi)
+		|| !blit_bulk_source_ok (b, memsize, ptb, b->bltbmod, ptd, desc, dlo, dhi)
+		|| !blit_bulk_source_ok (b, memsize, ptc, b->bltcmod, ptd, desc, dlo, dhi))
+		return false;
+
+	for (j = 0; j < v; j++) {
+		if (pta) {
+			blit_bulk_load (ra + 1, mem, pta, h, desc);
+			lasta = ra[h];
+			pta += h * dir + (desc ? -b->bltamod : b->bltamod);
+		} else {
+			for (i = 1; i <= h; i++)
+				ra[i] = b->bltadat;
+		}
+		ra[1] &= b->bltafwm;
+		ra[h] &= b->bltalwm;
+		ra[0] = carrya;
+		carrya = ra[h];
+		blit_bulk_shift (ra, h, desc ? b->blitdownashift : b->blitashift, desc);
+
+		if (ptb) {
+			blit_bulk_load (rb + 1, mem, ptb, h, desc);
+			lastb = rb[h];
+			rb[0] = carryb;
+			carryb = rb[h];
+			blit_bulk_shift (rb, h, desc ? b->blitdownbshift : b->blitbshift, desc);
+			ptb += h * dir + (desc ? -b->bltbmod : b->bltbmod);
+		} else if (j == 0) {
+			for (i = 0; i < h; i++)
+				rb[i] = b->bltbhold;
+		}
+
+		if (ptc) {
+			blit_bulk_load (rc, mem, ptc, h, desc);
+			lastc = rc[h - 1];
+			ptc += h * dir + (desc ? -b->bltcmod : b->bltcmod);
+		} else if (j == 0) {
+			for (i = 0; i < h; i++)
+				rc[i] = b->bltcdat;
+		}
+
+		blit_bulk_minterm (rd, ra, rb, rc, h, mt);
+
+		*fc = fci;
+		if (filltable) {
+			for (i = 0; i < h; i++) {
+				uae_u16 d = rd[i];
+				int fc1 = filltable[d & 255][ifemode + *fc][1];
+				rd[i] = filltable[d & 255][ifemode + *fc][0]
+					+ (filltable[d >> 8][ifemode + fc1][0] << 8);
+				*fc = filltable[d >> 8][ifemode + fc1][1];
+			}
+		}
+		for (i = 0; i < h; i++)
+			dor |= rd[i];
+
+		if (ptd) {
+			blit_bulk_store (rd, mem, ptd, h, desc);
+			ptd += h * dir + (desc ? -b->bltdmod : b->bltdmod);
+		}
+	}
+
+	/* leave the registers as the word loops do */
+	if (pta)
+		b->bltadat = lasta;
+	if (ptb) {
+		b->bltbdat = lastb;
+		b->bltbhold = rb[h - 1];
+	}
+	if (ptc) {
+		b->bltcdat = lastc;
+		if (desc)
+			b->bltbdat = lastc;
+	}
+	b->bltddat = rd[h - 1];
+	if (dor)
+		b->blitzero = 0;
+	return true;
+}
+
+#endif /* UAE_BLITBULK_H */
@@ -72,14 +72,14 @@ STATIC_INLINE uae_u32 mem_access_delay_long_read_ce020 (uaecptr addr)
 			return wait_cpu_cycle_read_ce020 (addr, -1);
 		}
 	case CE_MEMBANK_FAST:
-		v = get_long (addr);
+		v = get_long_direct (addr);
 		if ((addr & 3) != 0)
 			do_cycles_ce020_mem (2 * CPU020_MEM_CYCLE, v);
 		else
 			do_cycles_ce020_mem (1 * CPU020_MEM_CYCLE, v);
 		return v;
 	case CE_MEMBANK_FAST16BIT:
-		v = get_long (addr);
+		v = get_long_direct (addr);
 		do_cycles_ce020_mem (2 * CPU020_MEM_CYCLE, v);
 		return v;
 	}
@@ -131,7 +131,7 @@ STATIC_INLINE uae_u32 mem_access_delay_word_read_ce020 (uaecptr addr)
 		}
 	case CE_MEMBANK_FAST:
 	case CE_MEMBANK_FAST16BIT:
-		v = get_word (addr);
+		v = get_word_direct (addr);
 		if ((addr & 3) == 3)
 			do_cycles_ce020_mem (2 * CPU020_MEM_CYCLE, v);
 		else
@@ -168,7 +168,7 @@ STATIC_INLINE uae_u32 mem_access_delay_byte_read_ce020 (uaecptr addr)
 		return wait_cpu_cycle_read_ce020 (addr, 0);
 	case CE_MEMBANK_FAST:
 	case CE_MEMBANK_FAST16BIT:
-		v = get_byte (addr);
+		v = get_byte_direct (addr);
 		do_cycles_ce020_mem (1 * CPU020_MEM_CYCLE, v);
 		return v;
 
@@ -186,7 +186,7 @@ STATIC_INLINE void mem_access_delay_byte_write_ce020 (uaecptr addr, uae_u32 v)
 		return;
 	case CE_MEMBANK_FAST:
 	case CE_MEMBANK_FAST16BIT:
-		put_byte (addr, v);
+		put_byte_direct (addr, v);
 		do_cycles_ce020_mem (1 * CPU020_MEM_CYCLE, v);
 		return;
 	}
@@ -209,7 +209,7 @@ STATIC_INLINE void mem_access_delay_word_write_ce020 (uaecptr addr, uae_u32 v)
 		break;
 	case CE_MEMBANK_FAST:
 	case CE_MEMBANK_FAST16BIT:
-		put_word (addr, v);
+		put_word_direct (addr, v);
 		if ((addr & 3) == 3)
 			do_cycles_ce020_mem (2 * CPU020_MEM_CYCLE, v);
 		else
@@ -234,14 +234,14 @@ STATIC_INLINE void mem_access_delay_long_write_ce020 (uaecptr addr, uae_u32 v)
 		return;
 		break;
 	case CE_MEMBANK_FAST:
-		put_long (addr, v);
+		put_long_direct (addr, v);
 		if ((addr & 3) != 0)
 			do_cycles_ce020_mem (2 * CPU020_MEM_CYCLE, v);
 		else
 			do_cycles_ce020_mem (1 * CPU020_MEM_CYCLE, v);
 		return;
 	case CE_MEMBANK_FAST16BIT:
-		put_long (addr, v);
+		put_long_direct (addr, v);
 		do_cycles_ce020_mem (2 * CPU020_MEM_CYCLE, v);
 		return;
 	}
@@ -403,7 +403,7 @@ STATIC_INLINE uae_u32 mem_access_delay_word_read (uaecptr addr)
 		return wait_cpu_cycle_read (addr, 1);
 	case CE_MEMBANK_FAST:
 	case CE_MEMBANK_FAST16BIT:
-		uae_u32 v = get_word (addr);
+		uae_u32 v = get_word_direct (addr);
 		x_do_cycles_post (4 * cpucycleunit, v);
 		return v;
 	}
@@ -432,7 +432,7 @@ STATIC_INLINE uae_u32 mem_access_delay_byte_read (uaecptr addr)
 		return wait_cpu_cycle_read (addr, 0);
 	case CE_MEMBANK_FAST:
 	case CE_MEMBANK_FAST16BIT:
-		uae_u32 v = get_byte (addr);
+		uae_u32 v = get_byte_direct (addr);
 		x_do_cycles_post (4 * cpucycleunit, v);
 		return v;
 	}
@@ -447,7 +447,7 @@ STATIC_INLINE void mem_access_delay_byte_write (uaecptr addr, uae_u32 v)
 		return;
 	case CE_MEMBANK_FAST:
 	case CE_MEMBANK_FAST16BIT:
-		put_byte (addr, v);
+		put_byte_direct (addr, v);
 		x_do_cycles_post (4 * cpucycleunit, v);
 		return;
 	}
@@ -462,7 +462,7 @@ STATIC_INLINE void mem_access_delay_word_write (uaecptr addr, uae_u32 v)
 		return;
 	case CE_MEMBANK_FAST:
 	case CE_MEMBANK_FAST16BIT:
-		put_word (addr, v);
+		put_word_direct (addr, v);
 		x_do_cycles_post (4 * cpucycleunit, v);
 		return;
 	}
@@ -252,6 +252,47 @@ static ALWAYS_INLINE bool mmu_user_lookup(uaecptr addr, bool super, bool data,
 	return (*cl)->tag == addr >> (ATC_TAG_SHIFT - 12);
 }
 
+/*
+ * softtlb: virtual page -> host pointer for pages that translate to plain
+ * RAM (avex_direct_banks), checked before the atc by the mmu_get_* and
+ * mmu_put_* accessors. Entries are only created after a successful
+ * mmu_fill_atc_l1, so write entries imply a writable, modified page.
+ * Indexed like atc_l1 ([super][data][rw][idx]) but with more lines; the
+ * atc flushes (pflush, pflusha, mmu_set_tc, mmu_reset) and any change of
+ * the bank map drop the matching entries.
+ */
+#define MMU_SOFTTLB_SIZE_LOG	10
+#define MMU_SOFTTLB_SIZE		(1 << MMU_SOFTTLB_SIZE_LOG)
+#define MMU_SOFTTLB_VALID		1	/* or'ed into vpage, so a cleared line never matches */
+
+struct mmu_softtlb_line {
+	uaecptr vpage;
+	uae_u8 *host;
+};
+
+typedef struct mmu_softtlb_line mmu_softtlb_array[2][2][MMU_SOFTTLB_SIZE];
+extern mmu_softtlb_array mmu_softtlb[2];
+extern mmu_softtlb_array *current_softtlb;
+
+#ifdef ATC_STATS
+extern unsigned long mmu_softtlb_hits, mmu_softtlb_misses;
+#define MMU_SOFTTLB_COUNT(x) ((x)++)
+#else
+#define MMU_SOFTTLB_COUNT(x)
+#endif
+
+static ALWAYS_INLINE uae_u8 *mmu_softtlb_lookup(uaecptr addr, bool data, bool write)
+{
+	struct mmu_softtlb_line *t = &(*current_softtlb)[data ? 1 : 0][write ? 1 : 0][(addr >> 12) % MMU_SOFTTLB_SIZE];
+
+	if (likely(t->vpage == ((addr & ~0xfff) | MMU_SOFTTLB_VALID))) {
+		MMU_SOFTTLB_COUNT(mmu_softtlb_hits);
+		return t->host + (addr & 0xfff);
+	}
+	MMU_SOFTTLB_COUNT(mmu_softtlb_misses);
+	return NULL;
+}
+
 extern uae_u16 REGPARAM3 mmu_get_word_unaligned(uaecptr addr, bool data) REGPARAM;
 extern uae_u32 REGPARAM3 mmu_get_long_unaligned(uaecptr addr, bool data) REGPARAM;
 
@@ -304,33 +345,36 @@ static ALWAYS_INLINE uaecptr mmu_get_real_address(uaecptr addr, struct mmu_atc_l
 
 static ALWAYS_INLINE void phys_put_long(uaecptr addr, uae_u32 l)
 {
-    longput(addr, l);
+    longput_direct(addr, l);
 }
 static ALWAYS_INLINE void phys_put_word(uaecptr addr, uae_u32 w)
 {
-    wordput(addr, w);
+    wordput_direct(addr, w);
 }
 static ALWAYS_INLINE void phys_put_byte(uaecptr addr, uae_u32 b)
 {
-    byteput(addr, b);
+    byteput_direct(addr, b);
 }
 static ALWAYS_INLINE uae_u32 phys_get_long(uaecptr addr)
 {
-    return longget (addr);
+    return longget_direct (addr);
 }
 static ALWAYS_INLINE uae_u32 phys_get_word(uaecptr addr)
 {
-    return wordget (addr);
+    return wordget_direct (addr);
 }
 static ALWAYS_INLINE uae_u32 phys_get_byte(uaecptr addr)
 {
-    return byteget (addr);
+    return byteget_direct (addr);
 }
 
 static ALWAYS_INLINE uae_u32 mmu_get_long(uaecptr addr, bool data, int size)
 {
 	struct mmu_atc_line *cl;
+	uae_u8 *p = mmu_softtlb_lookup(addr, data, false);
 
+	if (p)
+		return do_get_mem_long ((uae_u32 *)p);
 	if (likely(mmu_lookup(addr, data, false, &cl)))
 		return phys_get_long(mmu_get_real_address(addr, cl));
 	return mmu_get_long_slow(addr, regs.s != 0, data, size, cl);
@@ -339,7 +383,10 @@ static ALWAYS_INLINE uae_u32 mmu_get_long(uaecptr addr, bool data, int size)
 static ALWAYS_INLINE uae_u16 mmu_get_word(uaecptr addr, bool data, int size)
 {
 	struct mmu_atc_line *cl;
+	uae_u8 *p = mmu_softtlb_lookup(addr, data, false);
 
+	if (p)
+		return do_get_mem_word ((uae_u16 *)p);
 	if (likely(mmu_lookup(addr, data, false, &cl)))
 		return phys_get_word(mmu_get_real_address(addr, cl));
 	return mmu_get_word_slow(addr, regs.s != 0, data, size, cl);
@@ -348,7 +395,10 @@ static ALWAYS_INLINE uae_u16 mmu_get_word(uaecptr addr, bool data, int size)
 static ALWAYS_INLINE uae_u8 mmu_get_byte(uaecptr addr, bool data, int size)
 {
 	struct mmu_atc_line *cl;
+	uae_u8 *p = mmu_softtlb_lookup(addr, data, false);
 
+	if (p)
+		return do_get_mem_byte (p);
 	if (likely(mmu_lookup(addr, data, false, &cl)))
 		return phys_get_byte(mmu_get_real_address(addr, cl));
 	return mmu_get_byte_slow(addr, regs.s != 0, data, size, cl);
@@ -358,8 +408,11 @@ static ALWAYS_INLINE uae_u8 mmu_get_byte(uaecptr addr, bool data, int size)
 static ALWAYS_INLINE void mmu_put_long(uaecptr addr, uae_u32 val, bool data, int size)
 {
 	struct mmu_atc_line *cl;
+	uae_u8 *p = mmu_softtlb_lookup(addr, data, true);
 
-	if (likely(mmu_lookup(addr, data, true, &cl)))
+	if (p)
+		do_put_mem_long ((uae_u32 *)p, val);
+	else if (likely(mmu_lookup(addr, data, true, &cl)))
 		phys_put_long(mmu_get_real_address(addr, cl), val);
 	else
 		mmu_put_long_slow(addr, val, regs.s != 0, data, size, cl);
@@ -368,8 +421,11 @@ static ALWAYS_INLINE void mmu_put_long(uaecptr addr, uae_u32 val, bool data, int
 static ALWAYS_INLINE void mmu_put_word(uaecptr addr, uae_u16 val, bool data, int size)
 {
 	struct mmu_atc_line *cl;
+	uae_u8 *p = mmu_softtlb_lookup(addr, data, true);
 
-	if (likely(mmu_lookup(addr, data, true, &cl)))
+	if (p)
+		do_put_mem_word ((uae_u16 *)p, val);
+	else if (likely(mmu_lookup(addr, data, true, &cl)))
 		phys_put_word(mmu_get_real_address(addr, cl), val);
 	else
 		mmu_put_word_slow(addr, val, regs.s != 0, data, size, cl);
@@ -378,8 +434,11 @@ static ALWAYS_INLINE void mmu_put_word(uaecptr addr, uae_u16 val, bool data, int
 static ALWAYS_INLINE void mmu_put_byte(uaecptr addr, uae_u8 val, bool data, int size)
 {
 	struct mmu_atc_line *cl;
+	uae_u8 *p = mmu_softtlb_lookup(addr, data, true);
 
-	if (likely(mmu_lookup(addr, data, true, &cl)))
+	if (p)
+		do_put_mem_byte (p, val);
+	else if (likely(mmu_lookup(addr, data, true, &cl)))
 		phys_put_byte(mmu_get_real_address(addr, cl), val);
 	else
 		mmu_put_byte_slow(addr, val, regs.s != 0, data, size, cl);
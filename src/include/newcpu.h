@@ -378,6 +378,9 @@ extern void NMI_delayed (void);
 extern void prepare_interrupt (uae_u32);
 extern void doint (void);
 extern void dump_counts (void);
+extern bool pc_profile_active;
+extern void pc_profile_sample (bool blitter, bool copper);
+extern void dump_pc_profile (void);
 extern int m68k_move2c (int, uae_u32 *);
 extern int m68k_movec2 (int, uae_u32 *);
 extern void m68k_divl (uae_u32, uae_u32, uae_u16);
@@ -0,0 +1,278 @@
+ /*
+  * UAE - The Un*x Amiga Emulator
+  *
+  * Planar to chunky conversion kernels used by pfield_doline
+  *
+  * Every kernel reads one longword (32 pixels) per plane from bplpt[0..planes-1],
+  * advancing the pointers, and writes 8 longwords of 8-bit pixel indices.
+  * The SIMD versions run the same merge network as the scalar code on 4 (SSE2)
+  * or 8 (AVX2) longwords at once, so their output is bit-exact; they only
+  * convert whole vectors and leave the remainder to p2c_doline_scalar.
+  */
+
+#ifndef UAE_P2C_H
+#define UAE_P2C_H
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#include <immintrin.h>
+#ifdef __SSE2__
+#define P2C_SSE2
+#endif
+/* compiled with the target attribute, selected at run time */
+#define P2C_AVX2
+#define P2C_TARGET_AVX2 __attribute__ ((target ("avx2")))
+#endif
+
+#define P2C_MERGE(a,b,mask,shift) do {\
+	uae_u32 tmp = mask & (a ^ (b >> shift)); \
+	a ^= tmp; \
+	b ^= (tmp << shift); \
+} while (0)
+
+/* We use the compiler's inlining ability to ensure that PLANES is in effect a compile time
+constant.  That will cause some unnecessary code to be optimized away.
+Don't touch this if you don't know what you are doing.  */
+STATIC_INLINE void p2c_doline_scalar (uae_u8 **bplpt, uae_u32 *pixels, int wordcount, int planes)
+{
+	while (wordcount-- > 0) {
+		uae_u32 b0, b1, b2, b3, b4, b5, b6, b7;
+
+		b0 = 0, b1 = 0, b2 = 0, b3 = 0, b4 = 0, b5 = 0, b6 = 0, b7 = 0;
+		switch (planes) {
+		case 8: b0 = *(uae_u32 *)bplpt[7]; bplpt[7] += 4;
+		case 7: b1 = *(uae_u32 *)bplpt[6]; bplpt[6] += 4;
+		case 6: b2 = *(uae_u32 *)bplpt[5]; bplpt[5] += 4;
+		case 5: b3 = *(uae_u32 *)bplpt[4]; bplpt[4] += 4;
+		case 4: b4 = *(uae_u32 *)bplpt[3]; bplpt[3] += 4;
+		case 3: b5 = *(uae_u32 *)bplpt[2]; bplpt[2] += 4;
+		case 2: b6 = *(uae_u32 *)bplpt[1]; bplpt[1] += 4;
+		case 1: b7 = *(uae_u32 *)bplpt[0]; bplpt[0] += 4;
+		}
+
+		P2C_MERGE (b0, b1, 0x55555555, 1);
+		P2C_MERGE (b2, b3, 0x55555555, 1);
+		P2C_MERGE (b4, b5, 0x55555555, 1);
+		P2C_MERGE (b6, b7, 0x55555555, 1);
+
+		P2C_MERGE (b0, b2, 0x33333333, 2);
+		P2C_MERGE (b1, b3, 0x33333333, 2);
+		P2C_MERGE (b4, b6, 0x33333333, 2);
+		P2C_MERGE (b5, b7, 0x33333333, 2);
+
+		P2C_MERGE (b0, b4, 0x0f0f0f0f, 4);
+		P2C_MERGE (b1, b5, 0x0f0f0f0f, 4);
+		P2C_MERGE (b2, b6, 0x0f0f0f0f, 4);
+		P2C_MERGE (b3, b7, 0x0f0f0f0f, 4);
+
+		P2C_MERGE (b0, b1, 0x00ff00ff, 8);
+		P2C_MERGE (b2, b3, 0x00ff00ff, 8);
+		P2C_MERGE (b4, b5, 0x00ff00ff, 8);
+		P2C_MERGE (b6, b7, 0x00ff00ff, 8);
+
+		P2C_MERGE (b0, b2, 0x0000ffff, 16);
+		do_put_mem_long (pixels, b0);
+		do_put_mem_long (pixels + 4, b2);
+		P2C_MERGE (b1, b3, 0x0000ffff, 16);
+		do_put_mem_long (pixels + 2, b1);
+		do_put_mem_long (pixels + 6, b3);
+		P2C_MERGE (b4, b6, 0x0000ffff, 16);
+		do_put_mem_long (pixels + 1, b4);
+		do_put_mem_long (pixels + 5, b6);
+		P2C_MERGE (b5, b7, 0x0000ffff, 16);
+		do_put_mem_long (pixels + 3, b5);
+		do_put_mem_long (pixels + 7, b7);
+		pixels += 8;
+	}
+}
+
+#ifdef P2C_SSE2
+
+#define P2C_MERGE_SSE2(a,b,mask,shift) do {\
+	__m128i tmp = _mm_and_si128 (_mm_set1_epi32 (mask), _mm_xor_si128 (a, _mm_srli_epi32 (b, shift))); \
+	a = _mm_xor_si128 (a, tmp); \
+	b = _mm_xor_si128 (b, _mm_slli_epi32 (tmp, shift)); \
+} while (0)
+
+/* do_put_mem_long byte order, without pshufb */
+STATIC_INLINE __m128i p2c_bswap_sse2 (__m128i x)
+{
+	x = _mm_shufflehi_epi16 (_mm_shufflelo_epi16 (x, 0xb1), 0xb1);
+	return _mm_or_si128 (_mm_slli_epi16 (x, 8), _mm_srli_epi16 (x, 8));
+}
+
+/* lane k of a, b, c, d goes to pixels + k * 8 */
+STATIC_INLINE void p2c_store4_sse2 (uae_u32 *pixels, __m128i a, __m128i b, __m128i c, __m128i d)
+{
+	__m128i t0 = _mm_unpacklo_epi32 (a, b);
+	__m128i t1 = _mm_unpacklo_epi32 (c, d);
+	__m128i t2 = _mm_unpackhi_epi32 (a, b);
+	__m128i t3 = _mm_unpackhi_epi32 (c, d);
+
+	_mm_storeu_si128 ((__m128i *)(pixels + 0), _mm_unpacklo_epi64 (t0, t1));
+	_mm_storeu_si128 ((__m128i *)(pixels + 8), _mm_unpackhi_epi64 (t0, t1));
+	_mm_storeu_si128 ((__m128i *)(pixels + 16), _mm_unpacklo_epi64 (t2, t3));
+	_mm_storeu_si128 ((__m128i *)(pixels + 24), _mm_unpackhi_epi64 (t2, t3));
+}
+
+#define P2C_LOAD_SSE2(n) _mm_loadu_si128 ((const __m128i *)bplpt[n]); bplpt[n] += 16
+
+/* 128 pixels per iteration, wordcount is rounded down to a multiple of 4 */
+STATIC_INLINE void p2c_doline_sse2 (uae_u8 **bplpt, uae_u32 *pixels, int wordcount, int planes)
+{
+	for (wordcount >>= 2; wordcount > 0; wordcount--) {
+		__m128i b0, b1, b2, b3, b4, b5, b6, b7;
+
+		b0 = b1 = b2 = b3 = b4 = b5 = b6 = b7 = _mm_setzero_si128 ();
+		switch (planes) {
+		case 8: b0 = P2C_LOAD_SSE2 (7);
+		case 7: b1 = P2C_LOAD_SSE2 (6);
+		case 6: b2 = P2C_LOAD_SSE2 (5);
+		case 5: b3 = P2C_LOAD_SSE2 (4);
+		case 4: b4 = P2C_LOAD_SSE2 (3);
+		case 3: b5 = P2C_LOAD_SSE2 (2);
+		case 2: b6 = P2C_LOAD_SSE2 (1);
+		case 1: b7 = P2C_LOAD_SSE2 (0);
+		}
+
+		P2C_MERGE_SSE2 (b0, b1, 0x55555555, 1);
+		P2C_MERGE_SSE2 (b2, b3, 0x55555555, 1);
+		P2C_MERGE_SSE2 (b4, b5, 0x55555555, 1);
+		P2C_MERGE_SSE2 (b6, b7, 0x55555555, 1);
+
+		P2C_MERGE_SSE2 (b0, b2, 0x33333333, 2);
+		P2C_MERGE_SSE2 (b1, b3, 0x33333333, 2);
+		P2C_MERGE_SSE2 (b4, b6, 0x33333333, 2);
+		P2C_MERGE_SSE2 (b5, b7, 0x33333333, 2);
+
+		P2C_MERGE_SSE2 (b0, b4, 0x0f0f0f0f, 4);
+		P2C_MERGE_SSE2 (b1, b5, 0x0f0f0f0f, 4);
+		P2C_MERGE_SSE2 (b2, b6, 0x0f0f0f0f, 4);
+		P2C_MERGE_SSE2 (b3, b7, 0x0f0f0f0f, 4);
+
+		P2C_MERGE_SSE2 (b0, b1, 0x00ff00ff, 8);
+		P2C_MERGE_SSE2 (b2, b3, 0x00ff00ff, 8);
+		P2C_MERGE_SSE2 (b4, b5, 0x00ff00ff, 8);
+		P2C_MERGE_SSE2 (b6, b7, 0x00ff00ff, 8);
+
+		P2C_MERGE_SSE2 (b0, b2, 0x0000ffff, 16);
+		P2C_MERGE_SSE2 (b1, b3, 0x0000ffff, 16);
+		P2C_MERGE_SSE2 (b4, b6, 0x0000ffff, 16);
+		P2C_MERGE_SSE2 (b5, b7, 0x0000ffff, 16);
+
+		/* same longword order as the scalar stores */
+		p2c_store4_sse2 (pixels, p2c_bswap_sse2 (b0), p2c_bswap_sse2 (b4),
+			p2c_bswap_sse2 (b1), p2c_bswap_sse2 (b5));
+		p2c_store4_sse2 (pixels + 4, p2c_bswap_sse2 (b2), p2c_bswap_sse2 (b6),
+			p2c_bswap_sse2 (b3), p2c_bswap_sse2 (b7));
+		pixels += 32;
+	}
+}
+
+#endif /* P2C_SSE2 */
+
+#ifdef P2C_AVX2
+
+#define P2C_MERGE_AVX2(a,b,mask,shift) do {\
+	__m256i tmp = _mm256_and_si256 (_mm256_set1_epi32 (mask), _mm256_xor_si256 (a, _mm256_srli_epi32 (b, shift))); \
+	a = _mm256_xor_si256 (a, tmp); \
+	b = _mm256_xor_si256 (b, _mm256_slli_epi32 (tmp, shift)); \
+} while (0)
+
+/* lane k of a, b, c, d goes to pixels + k * 8, lane k of e, f, g, h to pixels + k * 8 + 4 */
+P2C_TARGET_AVX2 static inline void p2c_store8_avx2 (uae_u32 *pixels, __m256i a, __m256i b, __m256i c, __m256i d,
+	__m256i e, __m256i f, __m256i g, __m256i h)
+{
+	__m256i t0 = _mm256_unpacklo_epi32 (a, b);
+	__m256i t1 = _mm256_unpacklo_epi32 (c, d);
+	__m256i t2 = _mm256_unpackhi_epi32 (a, b);
+	__m256i t3 = _mm256_unpackhi_epi32 (c, d);
+	__m256i t4 = _mm256_unpacklo_epi32 (e, f);
+	__m256i t5 = _mm256_unpacklo_epi32 (g, h);
+	__m256i t6 = _mm256_unpackhi_epi32 (e, f);
+	__m256i t7 = _mm256_unpackhi_epi32 (g, h);
+	/* lanes k and k + 4 of each group, in the low and high halves */
+	__m256i r0 = _mm256_unpacklo_epi64 (t0, t1);
+	__m256i r1 = _mm256_unpackhi_epi64 (t0, t1);
+	__m256i r2 = _mm256_unpacklo_epi64 (t2, t3);
+	__m256i r3 = _mm256_unpackhi_epi64 (t2, t3);
+	__m256i r4 = _mm256_unpacklo_epi64 (t4, t5);
+	__m256i r5 = _mm256_unpackhi_epi64 (t4, t5);
+	__m256i r6 = _mm256_unpacklo_epi64 (t6, t7);
+	__m256i r7 = _mm256_unpackhi_epi64 (t6, t7);
+
+	_mm256_storeu_si256 ((__m256i *)(pixels + 0), _mm256_permute2x128_si256 (r0, r4, 0x20));
+	_mm256_storeu_si256 ((__m256i *)(pixels + 8), _mm256_permute2x128_si256 (r1, r5, 0x20));
+	_mm256_storeu_si256 ((__m256i *)(pixels + 16), _mm256_permute2x128_si256 (r2, r6, 0x20));
+	_mm256_storeu_si256 ((__m256i *)(pixels + 24), _mm256_permute2x128_si256 (r3, r7, 0x20));
+	_mm256_storeu_si256 ((__m256i *)(pixels + 32), _mm256_permute2x128_si256 (r0, r4, 0x31));
+	_mm256_storeu_si256 ((__m256i *)(pixels + 40), _mm256_permute2x128_si256 (r1, r5, 0x31));
+	_mm256_storeu_si256 ((__m256i *)(pixels + 48), _mm256_permute2x128_si256 (r2, r6, 0x31));
+	_mm256_storeu_si256 ((__m256i *)(pixels + 56), _mm256_permute2x128_si256 (r3, r7, 0x31));
+}
+
+#define P2C_LOAD_AVX2(n) _mm256_loadu_si256 ((const __m256i *)bplpt[n]); bplpt[n] += 32
+
+/* 256 pixels per iteration, wordcount is rounded down to a multiple of 8.
+Not inlined into the callers (different target), so planes is a run time value here. */
+P2C_TARGET_AVX2 static void NOINLINE p2c_doline_avx2 (uae_u8 **bplpt, uae_u32 *pixels, int wordcount, int planes)
+{
+	const __m256i swap = _mm256_setr_epi8 (3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+		3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+	for (wordcount >>= 3; wordcount > 0; wordcount--) {
+		__m256i b0, b1, b2, b3, b4, b5, b6, b7;
+
+		b0 = b1 = b2 = b3 = b4 = b5 = b6 = b7 = _mm256_setzero_si256 ();
+		switch (planes) {
+		case 8: b0 = P2C_LOAD_AVX2 (7);
+		case 7: b1 = P2C_LOAD_AVX2 (6);
+		case 6: b2 = P2C_LOAD_AVX2 (5);
+		case 5: b3 = P2C_LOAD_AVX2 (4);
+		case 4: b4 = P2C_LOAD_AVX2 (3);
+		case 3: b5 = P2C_LOAD_AVX2 (2);
+		case 2: b6 = P2C_LOAD_AVX2 (1);
+		case 1: b7 = P2C_LOAD_AVX2 (0);
+		}
+
+		P2C_MERGE_AVX2 (b0, b1, 0x55555555, 1);
+		P2C_MERGE_AVX2 (b2, b3, 0x55555555, 1);
+		P2C_MERGE_AVX2 (b4, b5, 0x55555555, 1);
+		P2C_MERGE_AVX2 (b6, b7, 0x55555555, 1);
+
+		P2C_MERGE_AVX2 (b0, b2, 0x33333333, 2);
+		P2C_MERGE_AVX2 (b1, b3, 0x33333333, 2);
+		P2C_MERGE_AVX2 (b4, b6, 0x33333333, 2);
+		P2C_MERGE_AVX2 (b5, b7, 0x33333333, 2);
+
+		P2C_MERGE_AVX2 (b0, b4, 0x0f0f0f0f, 4);
+		P2C_MERGE_AVX2 (b1, b5, 0x0f0f0f0f, 4);
+		P2C_MERGE_AVX2 (b2, b6, 0x0f0f0f0f, 4);
+		P2C_MERGE_AVX2 (b3, b7, 0x0f0f0f0f, 4);
+
+		P2C_MERGE_AVX2 (b0, b1, 0x00ff00ff, 8);
+		P2C_MERGE_AVX2 (b2, b3, 0x00ff00ff, 8);
+		P2C_MERGE_AVX2 (b4, b5, 0x00ff00ff, 8);
+		P2C_MERGE_AVX2 (b6, b7, 0x00ff00ff, 8);
+
+		P2C_MERGE_AVX2 (b0, b2, 0x0000ffff, 16);
+		P2C_MERGE_AVX2 (b1, b3, 0x0000ffff, 16);
+		P2C_MERGE_AVX2 (b4, b6, 0x0000ffff, 16);
+		P2C_MERGE_AVX2 (b5, b7, 0x0000ffff, 16);
+
+		p2c_store8_avx2 (pixels,
+			_mm256_shuffle_epi8 (b0, swap), _mm256_shuffle_epi8 (b4, swap),
+			_mm256_shuffle_epi8 (b1, swap), _mm256_shuffle_epi8 (b5, swap),
+			_mm256_shuffle_epi8 (b2, swap), _mm256_shuffle_epi8 (b6, swap),
+			_mm256_shuffle_epi8 (b3, swap), _mm256_shuffle_epi8 (b7, swap));
+		pixels += 64;
+	}
+}
+
+STATIC_INLINE int p2c_have_avx2 (void)
+{
+	return __builtin_cpu_supports ("avx2");
+}
+
+#endif /* P2C_AVX2 */
+
+#endif /* UAE_P2C_H */
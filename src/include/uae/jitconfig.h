@@ -1,6 +1,13 @@
 #ifndef _UAE_JITCONFIG_H_
 #define _UAE_JITCONFIG_H_
 
+/* The translator only emits 32-bit x86 code. Not enabled on x86-64:
+   besides the missing emitters (REX prefixes, RIP-relative regs access),
+   host addresses such as NATMEM_OFFSET, baseaddr, mem_banks and
+   cache_tags reach the code as IMM operands (mov_l_rm_indexed and
+   friends), and IMM is uae_u32 in compemu.h, so 64-bit natmem needs
+   that API widened first. Compiled blocks also access natmem directly
+   and would bypass the memory server hooks in uae/memory.h. */
 #if defined(__i386__) && !defined(OPENBSD) && !defined(FREEBSD)
 #define JIT
 // #define JIT_DEBUG
@@ -154,8 +154,22 @@ extern uae_u32 REGPARAM3 dummy_wgeti (uaecptr addr) REGPARAM; //TODO memory.cpp
 #ifdef JIT
 extern uae_u8 *baseaddr[MEMORY_BANKS];
 #endif
-extern addrbank avex_get_membank(uaecptr addr);
-#define get_mem_bank(addr) (avex_get_membank(bankindex(addr))) //TODO this is how mem_banks is accessed from the outside, needs wrapper
+/* mem_banks is still only written by memory.cpp; outside it the table is
+   read through this const pointer, so the lookup inlines to two loads
+   instead of a call that copied the whole addrbank */
+extern addrbank *const *const avex_mem_banks;
+STATIC_INLINE const addrbank *avex_get_membank(uaecptr addr)
+{
+	return avex_mem_banks[bankindex(addr)];
+}
+#define get_mem_bank(addr) (*avex_get_membank(addr)) //TODO this is how mem_banks is accessed from the outside, needs wrapper
+/* host address of each 64K segment of plain RAM, NULL elsewhere; rebuilt
+   by fill_direct_banks() whenever the bank map or a RAM bank's handlers
+   change */
+extern uae_u8 *const *const avex_direct_banks;
+extern void fill_direct_banks (void);
+/* drops the MMU softtlb host pointers taken from avex_direct_banks */
+extern void mmu_flush_softtlb (void);
 
 #ifdef JIT
 #define put_mem_bank(addr, b, realstart) do { \
@@ -191,27 +205,27 @@ extern void free_fastmemory (void); //TODO memory.cpp
 
 STATIC_INLINE uae_u32 get_long (uaecptr addr)
 {
-	readServer(addr);
+	readServerAsync(addr);
 	return longget (addr);
 }
 STATIC_INLINE uae_u32 get_word (uaecptr addr)
 {
-	readServer(addr);
+	readServerAsync(addr, 2);
 	return wordget (addr);
 }
 STATIC_INLINE uae_u32 get_byte (uaecptr addr)
 {
-	readServer(addr);
+	readServerAsync(addr, 1);
 	return byteget (addr);
 }
 STATIC_INLINE uae_u32 get_longi(uaecptr addr)
 {
-	readServer(addr);
+	readServerAsync(addr);
 	return longgeti (addr);
 }
 STATIC_INLINE uae_u32 get_wordi(uaecptr addr)
 {
-	readServer(addr);
+	readServerAsync(addr, 2);
 	return wordgeti (addr);
 }
 
@@ -252,15 +266,96 @@ STATIC_INLINE void put_long (uaecptr addr, uae_u32 l)
 }
 STATIC_INLINE void put_word (uaecptr addr, uae_u32 w)
 {
-	writeServer(addr, w);
+	writeServer(addr, w, 2);
 	wordput(addr, w);
 }
 STATIC_INLINE void put_byte (uaecptr addr, uae_u32 b)
 {
-	writeServer(addr, b);
+	writeServer(addr, b, 1);
 	byteput(addr, b);
 }
 
+/* Direct RAM fast path: for a 64K segment of plain chip/fast RAM the
+   access is a range check and a host load/store; anything else (custom,
+   CIA, I/O, ROM, or an access crossing the segment) goes to the bank
+   handler. The get_*_direct/put_*_direct versions keep the memory server hooks. */
+STATIC_INLINE uae_u32 longget_direct (uaecptr addr)
+{
+	uae_u8 *p = avex_direct_banks[bankindex(addr)];
+	if (p && (addr & 0xffff) <= 0xfffc)
+		return do_get_mem_long ((uae_u32 *)(p + (addr & 0xffff)));
+	return longget (addr);
+}
+STATIC_INLINE uae_u32 wordget_direct (uaecptr addr)
+{
+	uae_u8 *p = avex_direct_banks[bankindex(addr)];
+	if (p && (addr & 0xffff) <= 0xfffe)
+		return do_get_mem_word ((uae_u16 *)(p + (addr & 0xffff)));
+	return wordget (addr);
+}
+STATIC_INLINE uae_u32 byteget_direct (uaecptr addr)
+{
+	uae_u8 *p = avex_direct_banks[bankindex(addr)];
+	if (p)
+		return do_get_mem_byte (p + (addr & 0xffff));
+	return byteget (addr);
+}
+STATIC_INLINE void longput_direct (uaecptr addr, uae_u32 l)
+{
+	uae_u8 *p = avex_direct_banks[bankindex(addr)];
+	if (p && (addr & 0xffff) <= 0xfffc)
+		do_put_mem_long ((uae_u32 *)(p + (addr & 0xffff)), l);
+	else
+		longput (addr, l);
+}
+STATIC_INLINE void wordput_direct (uaecptr addr, uae_u32 w)
+{
+	uae_u8 *p = avex_direct_banks[bankindex(addr)];
+	if (p && (addr & 0xffff) <= 0xfffe)
+		do_put_mem_word ((uae_u16 *)(p + (addr & 0xffff)), w);
+	else
+		wordput (addr, w);
+}
+STATIC_INLINE void byteput_direct (uaecptr addr, uae_u32 b)
+{
+	uae_u8 *p = avex_direct_banks[bankindex(addr)];
+	if (p)
+		do_put_mem_byte (p + (addr & 0xffff), b);
+	else
+		byteput (addr, b);
+}
+
+STATIC_INLINE uae_u32 get_long_direct (uaecptr addr)
+{
+	readServerAsync(addr);
+	return longget_direct (addr);
+}
+STATIC_INLINE uae_u32 get_word_direct (uaecptr addr)
+{
+	readServerAsync(addr, 2);
+	return wordget_direct (addr);
+}
+STATIC_INLINE uae_u32 get_byte_direct (uaecptr addr)
+{
+	readServerAsync(addr, 1);
+	return byteget_direct (addr);
+}
+STATIC_INLINE void put_long_direct (uaecptr addr, uae_u32 l)
+{
+	writeServer(addr, l);
+	longput_direct (addr, l);
+}
+STATIC_INLINE void put_word_direct (uaecptr addr, uae_u32 w)
+{
+	writeServer(addr, w, 2);
+	wordput_direct (addr, w);
+}
+STATIC_INLINE void put_byte_direct (uaecptr addr, uae_u32 b)
+{
+	writeServer(addr, b, 1);
+	byteput_direct (addr, b);
+}
+
 extern void put_long_slow (uaecptr addr, uae_u32 v);
 extern void put_word_slow (uaecptr addr, uae_u32 v);
 extern void put_byte_slow (uaecptr addr, uae_u32 v);
@@ -300,8 +395,7 @@ STATIC_INLINE void put_pointer (uaecptr addr, void *v)
 
 STATIC_INLINE uae_u8 *get_real_address (uaecptr addr)
 {
-	addrbank tmpfix = get_mem_bank (addr);
-	return tmpfix.xlateaddr(addr);
+	return get_mem_bank (addr).xlateaddr(addr);
 }
 
 STATIC_INLINE int valid_address (uaecptr addr, uae_u32 size)
@@ -320,6 +414,7 @@ extern uae_u32 REGPARAM3 chipmem_agnus_wget (uaecptr) REGPARAM; //TODO memory.cp
 extern void REGPARAM3 chipmem_agnus_wput (uaecptr, uae_u32) REGPARAM; //TODO memory.cpp*
 
 extern uae_u32 chipmem_mask, kickmem_mask;
+extern uae_u32 chipmem_full_size;
 extern uae_u8 *kickmemory;
 extern addrbank dummy_bank;
 
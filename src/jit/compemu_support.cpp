@@ -315,6 +315,10 @@ STATIC_INLINE void invalidate_block(blockinfo* bi)
 	remove_deps(bi);
 }
 
+/* Block chaining: a block exit with a known target jumps straight to the
+target's direct handler. The jump offset is recorded in the target's
+deplist, so set_dhtu() repoints it whenever the target is recompiled or
+invalidated (back to direct_pen/direct_pcc). */
 STATIC_INLINE void create_jmpdep(blockinfo* bi, int i, uae_u32* jmpaddr, uae_u32 target)
 {
 	blockinfo*  tbi=get_blockinfo_addr((void*)target);
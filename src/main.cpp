@@ -850,6 +850,7 @@ void do_leave_program (void)
 	DISK_free ();
 	close_sound ();
 	dump_counts ();
+	dump_pc_profile ();
 #ifdef SERIAL_PORT
 	serial_exit ();
 #endif
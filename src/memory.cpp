@@ -94,9 +94,10 @@ static bool bogomem_aliasing;
 static bool last_address_space_24;
 //TODO WRAPPED! :3
 addrbank *mem_banks[MEMORY_BANKS];
-addrbank avex_get_membank(uaecptr addr) {
-	return *mem_banks[addr];
-}
+/* read-only view of mem_banks for the inline lookups in memory.h */
+addrbank *const *const avex_mem_banks = mem_banks;
+static uae_u8 *direct_banks[MEMORY_BANKS];
+uae_u8 *const *const avex_direct_banks = direct_banks;
 
 /* This has two functions. It either holds a host address that, when added
 to the 68k address, gives the host address corresponding to that 68k
@@ -104,7 +105,9 @@ address (in which case the value in this array is even), OR it holds the
 same value as mem_banks, for those banks that have baseaddr==0. In that
 case, bit 0 is set (the memory access routines will take care of it).  */
 
-//uae_u8 *baseaddr[MEMORY_BANKS];
+#ifdef JIT
+uae_u8 *baseaddr[MEMORY_BANKS];
+#endif
 
 #ifdef NO_INLINE_MEMORY_ACCESS
 __inline__ uae_u32 longget (uaecptr addr)
@@ -2393,15 +2396,13 @@ static void allocate_memory (void)
 static void fill_ce_banks (void)
 {
 	int i;
-	addrbank tmpfix;
 	memset (ce_banktype, CE_MEMBANK_FAST, sizeof ce_banktype);
 	// data cachable regions
 	memset (ce_cachable, 0, sizeof ce_cachable);
 	memset (ce_cachable + (0x00200000 >> 16), 1, currprefs.fastmem_size >> 16);
 	memset (ce_cachable + (0x10000000 >> 16), 1, currprefs.z3fastmem_size >> 16);
 
-	tmpfix = get_mem_bank (0);
-	if (&tmpfix == &chipmem_bank) {
+	if (&get_mem_bank (0) == &chipmem_bank) {
 		for (i = 0; i < (0x200000 >> 16); i++)
 			ce_banktype[i] = CE_MEMBANK_CHIP;
 	}
@@ -2412,11 +2413,8 @@ static void fill_ce_banks (void)
 	for (i = (0xd00000 >> 16); i < (0xe00000 >> 16); i++)
 		ce_banktype[i] = CE_MEMBANK_CHIP;
 	for (i = (0xa00000 >> 16); i < (0xc00000 >> 16); i++) {
-		addrbank *b;
 		ce_banktype[i] = CE_MEMBANK_CIA;
-		tmpfix = get_mem_bank (i << 16);
-		b = &tmpfix;
-		if (b != &cia_bank) {
+		if (&get_mem_bank (i << 16) != &cia_bank) {
 			ce_banktype[i] = CE_MEMBANK_FAST;
 			ce_cachable[i] = 1;
 		}
@@ -2433,6 +2431,38 @@ static void fill_ce_banks (void)
 			memcpy (&ce_banktype[i * 256], &ce_banktype[0], 256);
 	}
 }
+extern addrbank z3fastmem_bank, z3fastmem2_bank;
+
+/* Banks whose handlers do nothing but mask the address into their host
+   memory, so that their xlateaddr can stand in for them */
+static bool direct_ram_bank (addrbank *b)
+{
+	if (!b->baseaddr)
+		return false;
+#if !defined(DEBUG_MEM) && !defined(DEBUG_SYNC_MEMORY)
+	/* enforcer swaps the chip RAM handlers */
+	if (b == &chipmem_bank)
+		return b->lget == chipmem_lget && b->lput == chipmem_lput;
+#endif
+	return b == &bogomem_bank || b == &a3000lmem_bank || b == &a3000hmem_bank ||
+		b == &fastmem_bank || b == &z3fastmem_bank || b == &z3fastmem2_bank;
+}
+
+void fill_direct_banks (void)
+{
+	int i;
+
+	for (i = 0; i < MEMORY_BANKS; i++) {
+		addrbank *b = mem_banks[i];
+		uaecptr addr = i << 16;
+
+		if (b && direct_ram_bank (b) && b->check (addr, 0x10000))
+			direct_banks[i] = b->xlateaddr (addr);
+		else
+			direct_banks[i] = NULL;
+	}
+	mmu_flush_softtlb ();
+}
 //TODO WRAP THIS!!
 void map_overlay (int chip)
 {
@@ -2483,6 +2513,7 @@ void map_overlay (int chip)
 		map_banks (rb, 0, size, 0x80000);
 	}
 	fill_ce_banks ();
+	fill_direct_banks ();
 	if (!isrestore () && valid_address (regs.pc, 4))
 		m68k_setpc (m68k_getpc ());
 }
@@ -2938,6 +2969,7 @@ void map_banks (addrbank *bank, int start, int size, int realsize)
 			real_left--;
 		}
 		debug_bankchange (old);
+		fill_direct_banks ();
 		return;
 	}
 #endif
@@ -2962,6 +2994,7 @@ void map_banks (addrbank *bank, int start, int size, int realsize)
 	}
 	debug_bankchange (old);
 	fill_ce_banks ();
+	fill_direct_banks ();
 }
 
 #ifdef SAVESTATE
@@ -138,6 +138,79 @@ void dump_counts (void)
 }
 #endif
 
+/* Sampling profiler: with PCPROFILE=file in the environment, the hsync
+   handler records the current pc and the blitter/copper activity of every
+   line in a fixed-size hash histogram. At exit it is written in collapsed
+   stack format ("state;memory bank;pc count"), ready for flamegraph.pl. */
+#define PC_PROFILE_BITS 16
+#define PC_PROFILE_SLOTS (1 << PC_PROFILE_BITS)
+#define PC_PROFILE_PROBES 8
+
+struct pc_profile_slot {
+	uae_u32 pc;
+	uae_u32 state;
+	unsigned long count;
+};
+
+bool pc_profile_active;
+static struct pc_profile_slot *pc_profile;
+static unsigned long pc_profile_dropped;
+
+static void pc_profile_init (void)
+{
+	pc_profile_active = getenv ("PCPROFILE") != NULL;
+	if (pc_profile_active && !pc_profile)
+		pc_profile = xcalloc (struct pc_profile_slot, PC_PROFILE_SLOTS);
+}
+
+void pc_profile_sample (bool blitter, bool copper)
+{
+	uae_u32 pc = m68k_getpc ();
+	uae_u32 state = (blitter ? 1 : 0) | (copper ? 2 : 0);
+	uae_u32 hash = ((pc * 2654435761u) ^ state) >> (32 - PC_PROFILE_BITS);
+
+	for (int i = 0; i < PC_PROFILE_PROBES; i++) {
+		struct pc_profile_slot *p = &pc_profile[(hash + i) & (PC_PROFILE_SLOTS - 1)];
+
+		if (p->count && (p->pc != pc || p->state != state))
+			continue;
+		p->pc = pc;
+		p->state = state;
+		p->count++;
+		return;
+	}
+	pc_profile_dropped++;
+}
+
+void dump_pc_profile (void)
+{
+	static const char *states[] = { "cpu", "blitter", "copper", "blitter+copper" };
+	FILE *f;
+
+	if (!pc_profile_active || !pc_profile)
+		return;
+	if (!(f = fopen (getenv ("PCPROFILE"), "w"))) {
+		write_log (_T("Cannot write pc profile %s\n"), getenv ("PCPROFILE"));
+		return;
+	}
+	write_log (_T("Writing pc profile...\n"));
+	for (int i = 0; i < PC_PROFILE_SLOTS; i++) {
+		struct pc_profile_slot *p = &pc_profile[i];
+		const TCHAR *bank;
+
+		if (!p->count)
+			continue;
+		bank = get_mem_bank (p->pc).name;
+		fprintf (f, "%s;", states[p->state]);
+		for (; bank && *bank; bank++)
+			putc (*bank == ';' ? ',' : *bank, f);
+		fprintf (f, ";%08x %lu\n", p->pc, p->count);
+	}
+	if (pc_profile_dropped)
+		fprintf (f, "dropped %lu\n", pc_profile_dropped);
+	fclose (f);
+}
+
 /*
 
  ok, all this to "record" current instruction state
@@ -714,12 +787,12 @@ static void set_x_funcs (void)
 			x_get_ibyte = get_ibyte;
 			x_next_iword = NULL;
 			x_next_ilong = NULL;
-			x_put_long = put_long;
-			x_put_word = put_word;
-			x_put_byte = put_byte;
-			x_get_long = get_long;
-			x_get_word = get_word;
-			x_get_byte = get_byte;
+			x_put_long = put_long_direct;
+			x_put_word = put_word_direct;
+			x_put_byte = put_byte_direct;
+			x_get_long = get_long_direct;
+			x_get_word = get_word_direct;
+			x_get_byte = get_byte_direct;
 			x_do_cycles = do_cycles;
 			x_do_cycles_pre = do_cycles;
 			x_do_cycles_post = do_cycles_post;
@@ -731,12 +804,12 @@ static void set_x_funcs (void)
 			x_get_ibyte = get_ibyte;
 			x_next_iword = next_iword;
 			x_next_ilong = next_ilong;
-			x_put_long = put_long;
-			x_put_word = put_word;
-			x_put_byte = put_byte;
-			x_get_long = get_long;
-			x_get_word = get_word;
-			x_get_byte = get_byte;
+			x_put_long = put_long_direct;
+			x_put_word = put_word_direct;
+			x_put_byte = put_byte_direct;
+			x_get_long = get_long_direct;
+			x_get_word = get_word_direct;
+			x_get_byte = get_byte_direct;
 			x_do_cycles = do_cycles;
 			x_do_cycles_pre = do_cycles;
 			x_do_cycles_post = do_cycles_post;
@@ -749,12 +822,12 @@ static void set_x_funcs (void)
 		x_get_ibyte = get_ibyte;
 		x_next_iword = next_iword;
 		x_next_ilong = next_ilong;
-		x_put_long = put_long;
-		x_put_word = put_word;
-		x_put_byte = put_byte;
-		x_get_long = get_long;
-		x_get_word = get_word;
-		x_get_byte = get_byte;
+		x_put_long = put_long_direct;
+		x_put_word = put_word_direct;
+		x_put_byte = put_byte_direct;
+		x_get_long = get_long_direct;
+		x_get_word = get_word_direct;
+		x_get_byte = get_byte_direct;
 		x_do_cycles = do_cycles;
 		x_do_cycles_pre = do_cycles;
 		x_do_cycles_post = do_cycles_post;
@@ -1241,6 +1314,8 @@ void init_m68k (void)
 		movem_next[i] = i & (~(1 << j));
 	}
 
+	pc_profile_init ();
+
 #if COUNT_INSTRS
 	{
 		FILE *f = fopen (icountfilename (), "r");
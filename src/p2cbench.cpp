@@ -0,0 +1,134 @@
+ /*
+  * UAE - The Un*x Amiga Emulator
+  *
+  * Planar to chunky microbenchmark: checks the SIMD kernels in p2c.h
+  * against the scalar code and reports pixels per second for each.
+  *
+  * make p2c-benchmark && gensrc/p2cbench [iterations]
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sysconfig.h"
+#include "sysdeps.h"
+#include "machdep/maccess.h"
+#include "p2c.h"
+
+/* AGA, fmode 4x: widest line pfield_doline sees */
+#define BENCH_WORDS 28
+#define BENCH_PLANE_BYTES 256
+
+static uae_u8 planes_data[8 * BENCH_PLANE_BYTES + 32];
+static uae_u32 out_ref[BENCH_PLANE_BYTES * 2 + 8], out_simd[BENCH_PLANE_BYTES * 2 + 8];
+
+typedef void (*p2c_kernel)(uae_u8 **bplpt, uae_u32 *pixels, int wordcount, int planes);
+
+static void set_planes (uae_u8 **bplpt, int offset)
+{
+	for (int i = 0; i < 8; i++)
+		bplpt[i] = planes_data + i * BENCH_PLANE_BYTES + offset;
+}
+
+static void run_scalar (uae_u8 **bplpt, uae_u32 *pixels, int wordcount, int planes)
+{
+	p2c_doline_scalar (bplpt, pixels, wordcount, planes);
+}
+
+/* same split as pfield_doline_1 in drawing.cpp */
+#ifdef P2C_SSE2
+static void run_sse2 (uae_u8 **bplpt, uae_u32 *pixels, int wordcount, int planes)
+{
+	p2c_doline_sse2 (bplpt, pixels, wordcount, planes);
+	pixels += (wordcount & ~3) * 8;
+	p2c_doline_scalar (bplpt, pixels, wordcount & 3, planes);
+}
+#endif
+
+#ifdef P2C_AVX2
+static void run_avx2 (uae_u8 **bplpt, uae_u32 *pixels, int wordcount, int planes)
+{
+	p2c_doline_avx2 (bplpt, pixels, wordcount, planes);
+	pixels += (wordcount & ~7) * 8;
+	wordcount &= 7;
+#ifdef P2C_SSE2
+	p2c_doline_sse2 (bplpt, pixels, wordcount, planes);
+	pixels += (wordcount & ~3) * 8;
+	wordcount &= 3;
+#endif
+	p2c_doline_scalar (bplpt, pixels, wordcount, planes);
+}
+#endif
+
+static bool check (const char *name, p2c_kernel kernel)
+{
+	uae_u8 *ref_pt[8], *simd_pt[8];
+
+	for (int planes = 1; planes <= 8; planes++) {
+		for (int words = 0; words <= BENCH_WORDS + 7; words++) {
+			for (int offset = 0; offset < 4; offset++) {
+				memset (out_ref, 0xaa, sizeof out_ref);
+				memset (out_simd, 0xaa, sizeof out_simd);
+				set_planes (ref_pt, offset);
+				set_planes (simd_pt, offset);
+				p2c_doline_scalar (ref_pt, out_ref, words, planes);
+				kernel (simd_pt, out_simd, words, planes);
+				if (memcmp (out_ref, out_simd, sizeof out_ref) || memcmp (ref_pt, simd_pt, sizeof ref_pt)) {
+					printf ("%s: mismatch, %d planes, %d words, offset %d\n", name, planes, words, offset);
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+static void bench (const char *name, p2c_kernel kernel, int planes, int iterations)
+{
+	uae_u8 *bplpt[8];
+	struct timespec t0, t1;
+	double secs;
+
+	clock_gettime (CLOCK_MONOTONIC, &t0);
+	for (int i = 0; i < iterations; i++) {
+		set_planes (bplpt, 0);
+		kernel (bplpt, out_simd, BENCH_WORDS, planes);
+	}
+	clock_gettime (CLOCK_MONOTONIC, &t1);
+	secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+	printf ("  %-6s %8.1f Mpixels/s\n", name, (double) iterations * BENCH_WORDS * 32 / secs / 1e6);
+}
+
+int main (int argc, char **argv)
+{
+	int iterations = argc > 1 ? atoi (argv[1]) : 1000000;
+	bool ok = true;
+
+	srand (1);
+	for (size_t i = 0; i < sizeof planes_data; i++)
+		planes_data[i] = rand ();
+
+#ifdef P2C_SSE2
+	ok = check ("sse2", run_sse2) && ok;
+#endif
+#ifdef P2C_AVX2
+	if (p2c_have_avx2 ())
+		ok = check ("avx2", run_avx2) && ok;
+#endif
+	printf ("kernels %s the scalar code\n", ok ? "match" : "DO NOT match");
+
+	for (int planes = 4; planes <= 8; planes += 2) {
+		printf ("%d planes, %d words per line:\n", planes, BENCH_WORDS);
+		bench ("scalar", run_scalar, planes, iterations);
+#ifdef P2C_SSE2
+		bench ("sse2", run_sse2, planes, iterations);
+#endif
+#ifdef P2C_AVX2
+		if (p2c_have_avx2 ())
+			bench ("avx2", run_avx2, planes, iterations);
+#endif
+	}
+	return ok ? 0 : 1;
+}
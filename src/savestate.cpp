@@ -1056,6 +1056,8 @@ int save_state (const TCHAR *filename, const TCHAR *description)
 	new_blitter = false;
 	savestate_nodialogs = 0;
 	custom_prepare_savestate ();
+	/* memory server must hold the same contents as the state */
+	syncServer ();
 	f = zfile_fopen (filename, _T("w+b"), 0);
 	if (!f)
 		return 0;
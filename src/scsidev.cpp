@@ -317,8 +317,8 @@ static void scsidev_do_scsi (struct scsidevdata *sdd, uaecptr request)
     uaecptr scsi_sense = get_long (acmd + 22);
     uae_u16 scsi_sense_len = get_word (acmd + 26);
     int sactual = 0;
-    addrbank *bank_data = &get_mem_bank (scsi_data);
-    addrbank *bank_cmd  = &get_mem_bank (scsi_cmd);
+    const addrbank *bank_data = &get_mem_bank (scsi_data);
+    const addrbank *bank_cmd  = &get_mem_bank (scsi_cmd);
 
     /* do transfer directly to and from Amiga memory */
     if (!bank_data || !bank_data->check (scsi_data, scsi_len) ||